@@ -0,0 +1,134 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Collection of utility functions that are useful in benchmarks.
+
+#ifndef included_ibamr_benchmarks_h
+#define included_ibamr_benchmarks_h
+
+#include <ibamr/config.h>
+
+#include <ibtk/IBTK_MPI.h>
+
+#include <tbox/Database.h>
+#include <tbox/PIO.h>
+#include <tbox/Pointer.h>
+#include <tbox/Utilities.h>
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Default name of the file to which benchmark results are appended.
+static const std::string default_benchmark_results_file_name = "benchmark_results.csv";
+
+/**
+ * Class that times repeated executions of a single benchmark case and reports
+ * statistics of the measured wall clock times in a machine-readable format.
+ *
+ * Each timed sample starts with a barrier so that all processes begin
+ * together, and the time recorded for the sample is the maximum over all
+ * processes, i.e., the time taken by the slowest process.  The report is
+ * written (by rank 0) as one line of a CSV file with the columns
+ *
+ *   benchmark,case,dim,nodes,work,samples,min,median,mean,max,throughput
+ *
+ * where throughput is the work per second of the median sample.  The work
+ * (e.g., the number of Lagrangian markers or the number of degrees of
+ * freedom) is provided by the benchmark.  The header is written only if the
+ * file is empty, so that the results of several benchmark runs can be
+ * collected in a single file.
+ */
+class BenchmarkTimer
+{
+public:
+    BenchmarkTimer(std::string benchmark_name, std::string case_name, double work = 0.0)
+        : d_benchmark_name(std::move(benchmark_name)), d_case_name(std::move(case_name)), d_work(work)
+    {
+    }
+
+    void start()
+    {
+        IBTK::IBTK_MPI::barrier();
+        d_start = std::chrono::steady_clock::now();
+    }
+
+    void stop()
+    {
+        const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - d_start).count();
+        d_samples.push_back(IBTK::IBTK_MPI::maxReduction(elapsed));
+    }
+
+    void setWork(const double work)
+    {
+        d_work = work;
+    }
+
+    void report(const std::string& file_name = default_benchmark_results_file_name) const
+    {
+        if (d_samples.empty()) return;
+        std::vector<double> samples = d_samples;
+        std::sort(samples.begin(), samples.end());
+        const std::size_t n = samples.size();
+        const double median = n % 2 == 1 ? samples[n / 2] : 0.5 * (samples[n / 2 - 1] + samples[n / 2]);
+        const double mean = std::accumulate(samples.begin(), samples.end(), 0.0) / static_cast<double>(n);
+        const double throughput = median > 0.0 ? d_work / median : 0.0;
+
+        std::ostringstream os;
+        os << std::setprecision(6) << std::scientific;
+        os << d_benchmark_name << "," << d_case_name << "," << NDIM << "," << IBTK::IBTK_MPI::getNodes() << ","
+           << d_work << "," << n << "," << samples.front() << "," << median << "," << mean << "," << samples.back()
+           << "," << throughput << "\n";
+        SAMRAI::tbox::pout << d_benchmark_name << " [" << d_case_name << "]: median = " << median
+                           << " s, min = " << samples.front() << " s, max = " << samples.back() << " s\n";
+
+        if (IBTK::IBTK_MPI::getRank() == 0)
+        {
+            bool write_header;
+            {
+                std::ifstream is(file_name.c_str());
+                write_header = !is.good() || is.peek() == std::ifstream::traits_type::eof();
+            }
+            std::ofstream results(file_name.c_str(), std::ios_base::app);
+            if (write_header)
+                results << "benchmark,case,dim,nodes,work,samples,min,median,mean,max,throughput\n";
+            results << os.str();
+        }
+    }
+
+private:
+    std::string d_benchmark_name, d_case_name;
+    double d_work;
+    std::chrono::steady_clock::time_point d_start;
+    std::vector<double> d_samples;
+};
+
+// Return the number of timed repetitions and untimed warm-up repetitions
+// requested in the input database.
+inline std::pair<int, int>
+get_benchmark_repetitions(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db)
+{
+    const int num_reps = input_db->getIntegerWithDefault("num_repetitions", 10);
+    const int num_warmup_reps = input_db->getIntegerWithDefault("num_warmup_repetitions", 1);
+    TBOX_ASSERT(num_reps > 0);
+    TBOX_ASSERT(num_warmup_reps >= 0);
+    return std::make_pair(num_reps, num_warmup_reps);
+}
+
+#endif
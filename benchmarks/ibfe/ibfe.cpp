@@ -0,0 +1,193 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for basic libMesh objects
+#include <libmesh/equation_systems.h>
+#include <libmesh/mesh.h>
+#include <libmesh/mesh_generation.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/IBExplicitHierarchyIntegrator.h>
+#include <ibamr/IBFEMethod.h>
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+#include <ibtk/PerformanceTrace.h>
+#include <ibtk/libmesh_utilities.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// benchmark stuff
+#include "../benchmarks.h"
+
+// Benchmark for the immersed finite element method: a neo-Hookean disk (in
+// 2D) or ball (in 3D) is deformed by a shear flow.  Each time step and a
+// number of forced regrids (which include the redistribution of the finite
+// element data) are timed.  A per-phase performance trace is always recorded,
+// so that the time spent assembling the elastic forces, spreading, and
+// interpolating is reported in the load summary file.
+
+namespace ModelData
+{
+static double mu_s = 1.0;
+
+// Stress tensor function.
+void
+PK1_stress_function(TensorValue<double>& PP,
+                    const TensorValue<double>& FF,
+                    const libMesh::Point& /*X*/,
+                    const libMesh::Point& /*s*/,
+                    Elem* const /*elem*/,
+                    const std::vector<const std::vector<double>*>& /*var_data*/,
+                    const std::vector<const std::vector<VectorValue<double> >*>& /*grad_var_data*/,
+                    double /*time*/,
+                    void* /*ctx*/)
+{
+    PP = mu_s * (FF - tensor_inverse_transpose(FF, NDIM));
+    return;
+} // PK1_stress_function
+} // namespace ModelData
+using namespace ModelData;
+
+int
+main(int argc, char** argv)
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+    const LibMeshInit& init = ibtk_init.getLibMeshInit();
+
+    { // cleanup dynamically allocated objects prior to shutdown
+        // prevent a warning about timer initializations
+        TimerManager::createManager(nullptr);
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "ibfe.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create the structural mesh.
+        Mesh mesh(init.comm(), NDIM);
+        const double R = input_db->getDouble("R");
+        const double dx = input_db->getDouble("DX");
+        const double ds = input_db->getDouble("MFAC") * dx;
+        const auto elem_type = Utility::string_to_enum<ElemType>(input_db->getString("ELEM_TYPE"));
+        const double num_circum_segments = 2.0 * M_PI * R / ds;
+        const int r = std::max(0, static_cast<int>(std::log2(0.25 * num_circum_segments)));
+        MeshTools::Generation::build_sphere(mesh, R, r, elem_type);
+        const libMesh::Point center(0.5, 0.5, 0.5);
+        for (auto it = mesh.nodes_begin(); it != mesh.nodes_end(); ++it)
+        {
+            Node& n = **it;
+            for (unsigned int d = 0; d < NDIM; ++d) n(d) += center(d);
+        }
+        mu_s = input_db->getDoubleWithDefault("MU_S", 1.0);
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<INSHierarchyIntegrator> navier_stokes_integrator = new INSStaggeredHierarchyIntegrator(
+            "INSStaggeredHierarchyIntegrator", app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"));
+        Pointer<IBFEMethod> ib_method_ops =
+            new IBFEMethod("IBFEMethod",
+                           app_initializer->getComponentDatabase("IBFEMethod"),
+                           &mesh,
+                           app_initializer->getComponentDatabase("GriddingAlgorithm")->getInteger("max_levels"),
+                           /*register_for_restart*/ false);
+        Pointer<IBHierarchyIntegrator> time_integrator =
+            new IBExplicitHierarchyIntegrator("IBHierarchyIntegrator",
+                                              app_initializer->getComponentDatabase("IBHierarchyIntegrator"),
+                                              ib_method_ops,
+                                              navier_stokes_integrator);
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               time_integrator,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Configure the IBFE solver.
+        ib_method_ops->initializeFEEquationSystems();
+        ib_method_ops->registerPK1StressFunction(PK1_stress_function);
+
+        // Create Eulerian initial condition specification objects.
+        Pointer<CartGridFunction> u_init = new muParserCartGridFunction(
+            "u_init", app_initializer->getComponentDatabase("VelocityInitialConditions"), grid_geometry);
+        navier_stokes_integrator->registerVelocityInitialConditions(u_init);
+
+        // Initialize hierarchy configuration and data on all patches.
+        ib_method_ops->initializeFEData();
+        time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+
+        // Deallocate initialization objects.
+        app_initializer.setNull();
+
+        const double num_elems = static_cast<double>(mesh.n_elem());
+        const std::string case_name = input_db->getString("ELEM_TYPE") + "_elems=" +
+                                      std::to_string(static_cast<long>(num_elems));
+
+        // Time the time steps.
+        const std::pair<int, int> reps = get_benchmark_repetitions(input_db);
+        BenchmarkTimer step_timer("ibfe_step", case_name, num_elems);
+        for (int k = 0; k < reps.second + reps.first && time_integrator->stepsRemaining(); ++k)
+        {
+            const bool timed = k >= reps.second;
+            if (timed) PerformanceTrace::setEnabled(true);
+            const double dt = time_integrator->getMaximumTimeStepSize();
+            if (timed) step_timer.start();
+            time_integrator->advanceHierarchy(dt);
+            if (timed) step_timer.stop();
+        }
+        step_timer.report();
+
+        // Time regridding, which includes redistributing the FE data.
+        const int num_regrids = input_db->getIntegerWithDefault("num_regrids", 3);
+        BenchmarkTimer regrid_timer("ibfe_regrid", case_name, num_elems);
+        for (int k = 0; k < num_regrids; ++k)
+        {
+            regrid_timer.start();
+            time_integrator->regridHierarchy();
+            regrid_timer.stop();
+        }
+        regrid_timer.report();
+
+        const std::string trace_name = "ibfe_" + std::to_string(NDIM) + "d_" + case_name;
+        PerformanceTrace::writeChromeTrace(trace_name + ".trace.json");
+        PerformanceTrace::writeLoadSummary(trace_name + ".summary.csv");
+    } // cleanup dynamically allocated objects prior to shutdown
+} // main
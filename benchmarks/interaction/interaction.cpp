@@ -0,0 +1,210 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+#include <ibtk/LEInteractor.h>
+#include <ibtk/app_namespaces.h>
+
+#include <petscsys.h>
+
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CartesianPatchGeometry.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <SAMRAI_config.h>
+#include <StandardTagAndInitialize.h>
+
+#include <map>
+#include <random>
+
+// benchmark stuff
+#include "../benchmarks.h"
+
+// Benchmark for the Lagrangian-Eulerian interaction kernels of LEInteractor:
+// spreading and interpolation are timed for each requested kernel function
+// and each requested data centering on a uniform grid that is seeded with a
+// prescribed number of markers per cell.
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    // prevent a warning about timer initializations
+    TimerManager::createManager(nullptr);
+    {
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "interaction.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Read the benchmark parameters.
+        const Array<std::string> kernel_fcns = input_db->getStringArray("kernel_fcns");
+        const Array<std::string> var_types = input_db->getStringArray("var_types");
+        const double markers_per_cell = input_db->getDoubleWithDefault("markers_per_cell", 2.0);
+        const std::pair<int, int> reps = get_benchmark_repetitions(input_db);
+
+        // Create variables with enough ghost cells to support all of the
+        // requested kernels and register them with the variable database.
+        int gcw = 0;
+        for (int k = 0; k < kernel_fcns.getSize(); ++k)
+        {
+            gcw = std::max(gcw, LEInteractor::getMinimumGhostWidth(kernel_fcns[k]));
+        }
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+        Pointer<CellVariable<NDIM, double> > u_cc_var = new CellVariable<NDIM, double>("u_cc", NDIM);
+        Pointer<SideVariable<NDIM, double> > u_sc_var = new SideVariable<NDIM, double>("u_sc");
+        const int u_cc_idx = var_db->registerVariableAndContext(u_cc_var, ctx, IntVector<NDIM>(gcw));
+        const int u_sc_idx = var_db->registerVariableAndContext(u_sc_var, ctx, IntVector<NDIM>(gcw));
+
+        // Set up the grid.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        int tag_buffer = 1;
+        int level_number = 0;
+        bool done = false;
+        while (!done && (gridding_algorithm->levelCanBeRefined(level_number)))
+        {
+            gridding_algorithm->makeFinerLevel(patch_hierarchy, 0.0, 0.0, tag_buffer);
+            done = !patch_hierarchy->finerLevelExists(level_number);
+            ++level_number;
+        }
+        const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(finest_ln);
+        level->allocatePatchData(u_cc_idx, 0.0);
+        level->allocatePatchData(u_sc_idx, 0.0);
+
+        // Seed each local patch with randomly placed markers.  The seed
+        // depends on the rank so that the benchmark is reproducible for a
+        // fixed number of processes.
+        std::mt19937 std_seq(42u + static_cast<unsigned int>(IBTK_MPI::getRank()));
+        std::uniform_real_distribution<double> distribution(0.0, 1.0);
+        std::map<int, std::vector<double> > X_data, F_data;
+        double num_local_markers = 0.0;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
+            const double* const x_lower = patch_geom->getXLower();
+            const double* const x_upper = patch_geom->getXUpper();
+            const auto num_markers = static_cast<std::size_t>(markers_per_cell * patch->getBox().size());
+            std::vector<double>& X = X_data[p()];
+            std::vector<double>& F = F_data[p()];
+            X.resize(NDIM * num_markers);
+            F.resize(NDIM * num_markers);
+            for (std::size_t k = 0; k < num_markers; ++k)
+            {
+                for (int d = 0; d < NDIM; ++d)
+                {
+                    X[NDIM * k + d] = x_lower[d] + (x_upper[d] - x_lower[d]) * distribution(std_seq);
+                    F[NDIM * k + d] = distribution(std_seq);
+                }
+            }
+            num_local_markers += static_cast<double>(num_markers);
+        }
+        const double num_markers = IBTK_MPI::sumReduction(num_local_markers);
+
+        // Time spreading and interpolation for each kernel and centering.
+        for (int v = 0; v < var_types.getSize(); ++v)
+        {
+            const std::string& var_type = var_types[v];
+            if (var_type != "CELL" && var_type != "SIDE")
+            {
+                TBOX_ERROR("interaction: unsupported var_type " << var_type << "\n"
+                                                                << "Valid options are: CELL, SIDE");
+            }
+            const bool use_cell = var_type == "CELL";
+            for (int k = 0; k < kernel_fcns.getSize(); ++k)
+            {
+                const std::string& kernel_fcn = kernel_fcns[k];
+                const std::string case_name = var_type + "_" + kernel_fcn;
+
+                auto spread = [&]() {
+                    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+                    {
+                        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                        const Box<NDIM>& box = patch->getBox();
+                        if (use_cell)
+                        {
+                            Pointer<CellData<NDIM, double> > u_data = patch->getPatchData(u_cc_idx);
+                            u_data->fillAll(0.0);
+                            LEInteractor::spread(u_data, F_data[p()], NDIM, X_data[p()], NDIM, patch, box, kernel_fcn);
+                        }
+                        else
+                        {
+                            Pointer<SideData<NDIM, double> > u_data = patch->getPatchData(u_sc_idx);
+                            u_data->fillAll(0.0);
+                            LEInteractor::spread(u_data, F_data[p()], NDIM, X_data[p()], NDIM, patch, box, kernel_fcn);
+                        }
+                    }
+                };
+                auto interpolate = [&]() {
+                    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+                    {
+                        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                        const Box<NDIM>& box = patch->getBox();
+                        if (use_cell)
+                        {
+                            Pointer<CellData<NDIM, double> > u_data = patch->getPatchData(u_cc_idx);
+                            LEInteractor::interpolate(
+                                F_data[p()], NDIM, X_data[p()], NDIM, u_data, patch, box, kernel_fcn);
+                        }
+                        else
+                        {
+                            Pointer<SideData<NDIM, double> > u_data = patch->getPatchData(u_sc_idx);
+                            LEInteractor::interpolate(
+                                F_data[p()], NDIM, X_data[p()], NDIM, u_data, patch, box, kernel_fcn);
+                        }
+                    }
+                };
+
+                for (int r = 0; r < reps.second; ++r)
+                {
+                    spread();
+                    interpolate();
+                }
+                BenchmarkTimer spread_timer("spread", case_name, num_markers);
+                BenchmarkTimer interp_timer("interpolate", case_name, num_markers);
+                for (int r = 0; r < reps.first; ++r)
+                {
+                    spread_timer.start();
+                    spread();
+                    spread_timer.stop();
+
+                    interp_timer.start();
+                    interpolate();
+                    interp_timer.stop();
+                }
+                spread_timer.report();
+                interp_timer.report();
+            }
+        }
+    }
+} // main
@@ -0,0 +1,175 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <Box.h>
+#include <CartesianGridGeometry.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+#include <tbox/DatabaseBox.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+#include <ibtk/PerformanceTrace.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// benchmark stuff
+#include "../benchmarks.h"
+
+// Benchmark for the staggered-grid incompressible Navier-Stokes solver.  Each
+// time step (which is dominated by the FAC-preconditioned Stokes solve) is
+// timed, followed by a number of forced regrids of the patch hierarchy.
+//
+// If weak_scaling is set in the input file, the domain is extended in the x
+// direction in proportion to the number of processes, so that the number of
+// grid cells per process stays fixed.  The domain described in the input file
+// must consist of a single box and must be periodic in the x direction.
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    { // cleanup dynamically allocated objects prior to shutdown
+        // prevent a warning about timer initializations
+        TimerManager::createManager(nullptr);
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "stokes.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Extend the domain for weak scaling runs.
+        Pointer<Database> geometry_db = app_initializer->getComponentDatabase("CartesianGeometry");
+        const bool weak_scaling = input_db->getBoolWithDefault("weak_scaling", false);
+        if (weak_scaling)
+        {
+            const int nodes = IBTK_MPI::getNodes();
+            Array<DatabaseBox> domain_boxes = geometry_db->getDatabaseBoxArray("domain_boxes");
+            if (domain_boxes.getSize() != 1)
+            {
+                TBOX_ERROR("stokes: weak scaling requires a domain that consists of a single box\n");
+            }
+            Box<NDIM> domain_box(domain_boxes[0]);
+            domain_box.upper(0) = domain_box.lower(0) + nodes * domain_box.numberCells(0) - 1;
+            domain_boxes[0] = domain_box;
+            geometry_db->putDatabaseBoxArray("domain_boxes", domain_boxes);
+
+            const Array<double> x_lo = geometry_db->getDoubleArray("x_lo");
+            Array<double> x_up = geometry_db->getDoubleArray("x_up");
+            x_up[0] = x_lo[0] + nodes * (x_up[0] - x_lo[0]);
+            geometry_db->putDoubleArray("x_up", x_up);
+        }
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<INSHierarchyIntegrator> time_integrator = new INSStaggeredHierarchyIntegrator(
+            "INSStaggeredHierarchyIntegrator", app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"));
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry =
+            new CartesianGridGeometry<NDIM>("CartesianGeometry", geometry_db);
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               time_integrator,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Create initial condition specification objects.
+        Pointer<CartGridFunction> u_init = new muParserCartGridFunction(
+            "u_init", app_initializer->getComponentDatabase("VelocityInitialConditions"), grid_geometry);
+        time_integrator->registerVelocityInitialConditions(u_init);
+        Pointer<CartGridFunction> p_init = new muParserCartGridFunction(
+            "p_init", app_initializer->getComponentDatabase("PressureInitialConditions"), grid_geometry);
+        time_integrator->registerPressureInitialConditions(p_init);
+
+        // Initialize hierarchy configuration and data on all patches.
+        time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+
+        // Deallocate initialization objects.
+        app_initializer.setNull();
+
+        // Count the number of degrees of freedom.
+        double num_cells = 0.0;
+        for (int ln = 0; ln <= patch_hierarchy->getFinestLevelNumber(); ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                num_cells += static_cast<double>(level->getPatch(p())->getBox().size());
+            }
+        }
+        num_cells = IBTK_MPI::sumReduction(num_cells);
+        const double num_dofs = (NDIM + 1) * num_cells;
+        const std::string case_name = std::string(weak_scaling ? "weak" : "strong") +
+                                      "_N=" + std::to_string(static_cast<long>(num_cells));
+
+        // Optionally record a per-phase performance trace of the timed steps.
+        const bool write_trace = input_db->getBoolWithDefault("write_trace", false);
+
+        // Time the time steps.
+        const std::pair<int, int> reps = get_benchmark_repetitions(input_db);
+        BenchmarkTimer step_timer("stokes_step", case_name, num_dofs);
+        for (int r = 0; r < reps.second + reps.first && time_integrator->stepsRemaining(); ++r)
+        {
+            const bool timed = r >= reps.second;
+            if (timed && write_trace) PerformanceTrace::setEnabled(true);
+            const double dt = time_integrator->getMaximumTimeStepSize();
+            if (timed) step_timer.start();
+            time_integrator->advanceHierarchy(dt);
+            if (timed) step_timer.stop();
+        }
+        step_timer.report();
+
+        // Time regridding.
+        const int num_regrids = input_db->getIntegerWithDefault("num_regrids", 3);
+        BenchmarkTimer regrid_timer("stokes_regrid", case_name, num_dofs);
+        for (int r = 0; r < num_regrids; ++r)
+        {
+            regrid_timer.start();
+            time_integrator->regridHierarchy();
+            regrid_timer.stop();
+        }
+        regrid_timer.report();
+
+        if (write_trace)
+        {
+            const std::string trace_name = "stokes_" + std::to_string(NDIM) + "d_" + case_name;
+            PerformanceTrace::writeChromeTrace(trace_name + ".trace.json");
+            PerformanceTrace::writeLoadSummary(trace_name + ".summary.csv");
+        }
+    } // cleanup dynamically allocated objects prior to shutdown
+} // main
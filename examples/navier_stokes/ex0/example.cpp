@@ -28,6 +28,7 @@
 #include <ibamr/INSStaggeredHierarchyIntegrator.h>
 
 #include <ibtk/AppInitializer.h>
+#include <ibtk/AsynchronousCheckpointWriter.h>
 #include <ibtk/IBTKInit.h>
 #include <ibtk/IBTK_MPI.h>
 #include <ibtk/muParserCartGridFunction.h>
@@ -171,6 +172,15 @@ main(int argc, char* argv[])
             time_integrator->registerVisItDataWriter(visit_data_writer);
         }
 
+        // Set up the asynchronous restart file writer (when requested).
+        Pointer<AsynchronousCheckpointWriter> checkpoint_writer;
+        if (input_db->keyExists("AsynchronousCheckpointWriter"))
+        {
+            checkpoint_writer = new AsynchronousCheckpointWriter(
+                "AsynchronousCheckpointWriter", app_initializer->getComponentDatabase("AsynchronousCheckpointWriter"));
+            time_integrator->registerCheckpointWriter(checkpoint_writer);
+        }
+
         // Initialize hierarchy configuration and data on all patches.
         time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
 
@@ -228,7 +238,14 @@ main(int argc, char* argv[])
             if (dump_restart_data && (iteration_num % restart_dump_interval == 0 || last_step))
             {
                 pout << "\nWriting restart files...\n\n";
-                RestartManager::getManager()->writeRestartFile(restart_dump_dirname, iteration_num);
+                if (checkpoint_writer)
+                {
+                    checkpoint_writer->writeCheckpoint(restart_dump_dirname, iteration_num);
+                }
+                else
+                {
+                    RestartManager::getManager()->writeRestartFile(restart_dump_dirname, iteration_num);
+                }
             }
             if (dump_timer_data && (iteration_num % timer_dump_interval == 0 || last_step))
             {
@@ -241,6 +258,9 @@ main(int argc, char* argv[])
             }
         }
 
+        // Make sure that the last restart files have been written.
+        if (checkpoint_writer) checkpoint_writer->waitForCompletion();
+
         // Determine the accuracy of the computed solution.
         pout << "\n"
              << "+++++++++++++++++++++++++++++++++++++++++++++++++++\n"
@@ -0,0 +1,278 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDE GUARD ////////////////////////////////
+
+#ifndef included_IBTK_AsynchronousCheckpointWriter
+#define included_IBTK_AsynchronousCheckpointWriter
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <ibtk/config.h>
+
+#include "ibtk/IBTK_MPI.h"
+
+#include "tbox/Database.h"
+#include "tbox/DescribedClass.h"
+#include "tbox/Pointer.h"
+
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <string>
+#include <utility>
+#include <vector>
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class AsynchronousCheckpointWriter writes restart data in the
+ * background through a small number of aggregating processes.
+ *
+ * A standard restart dump (SAMRAI::tbox::RestartManager::writeRestartFile())
+ * has every process write its own file to the restart directory, and the time
+ * loop is blocked until all of these files have been written.  With this
+ * class, a checkpoint instead proceeds as follows:
+ *
+ * -# Each process writes its restart data to a private staging directory,
+ *    reads the resulting files back into memory, and removes them.  Additional
+ *    data (e.g., libMesh equation systems) may be written to the staging
+ *    directory by callback functions registered via registerStagingCallback().
+ *    This step is synchronous, since SAMRAI can only write restart data to
+ *    files.  Its cost is small when the staging directory is memory-backed,
+ *    which is why <tt>/dev/shm</tt> is used by default when it is available.
+ * -# The processes are divided into groups of consecutive ranks, one group for
+ *    each aggregator.  The in-memory snapshots are sent to the first process
+ *    of each group by nonblocking communication.  An aggregator receives the
+ *    snapshots of its group in batches of at most
+ *    <tt>max_aggregator_buffer_size</tt> bytes (or one snapshot, if that is
+ *    larger), so that it holds at most two batches at any time.
+ * -# Each aggregator appends the batches to a single file for its group from a
+ *    background thread while the next batch is received.  Only this thread
+ *    performs file I/O; all MPI calls are made from the main thread, so MPI
+ *    must have been initialized with a thread support level of at least
+ *    MPI_THREAD_FUNNELED.  If MPI only provides MPI_THREAD_SINGLE, or if
+ *    threads are not available, the batches are written synchronously.
+ *
+ * The computation may continue as soon as writeCheckpoint() returns.  The
+ * pending communication must be progressed by periodically calling
+ * advanceCommunication().  This is done after each cycle of each time step by
+ * a HierarchyIntegrator with which the writer has been registered via
+ * HierarchyIntegrator::registerCheckpointWriter().  waitForCompletion() blocks
+ * until the checkpoint has been fully written.  A new checkpoint is not started
+ * until the previous one has been completed.
+ *
+ * The aggregated data are stored in the directory
+ * <tt>restart_dump_dirname/restore.NNNNNN</tt> as the files
+ * <tt>aggregate.NNNNNNN</tt>, along with a small index file
+ * <tt>aggregate.info</tt> that is only written by waitForCompletion() once all
+ * aggregate files are complete.  Before the restart data are read, the
+ * collective function extractCheckpoint() recreates the standard per-process
+ * restart files from the aggregated data.  This is done automatically by
+ * AppInitializer for restarted runs.
+ *
+ * Sample parameters for initialization from database (and their default
+ * values): \verbatim
+
+ enable_asynchronous_writes = TRUE       // whether writeCheckpoint() returns before the data are written
+ num_aggregators = 1                     // defaults to one aggregator for every 64 processes
+ max_aggregator_buffer_size = 268435456  // maximum size in bytes of each batch received by an aggregator
+ staging_dirname = "/dev/shm"            // directory in which restart data are staged ("/tmp" without /dev/shm)
+ \endverbatim
+ *
+ * Typical use is:
+ *
+ * \code
+ * Pointer<AsynchronousCheckpointWriter> checkpoint_writer = new AsynchronousCheckpointWriter(
+ *     "AsynchronousCheckpointWriter", app_initializer->getComponentDatabase("AsynchronousCheckpointWriter"));
+ * checkpoint_writer->registerStagingCallback([&](const std::string& dirname, int restore_num) {
+ *     ib_method_ops->writeFEDataToRestartFile(dirname, restore_num);
+ * });
+ * time_integrator->registerCheckpointWriter(checkpoint_writer);
+ * ...
+ * while (...)
+ * {
+ *     time_integrator->advanceHierarchy(dt);
+ *     if (dump_restart_data && ...)
+ *     {
+ *         checkpoint_writer->writeCheckpoint(restart_dump_dirname, iteration_num);
+ *     }
+ * }
+ * checkpoint_writer->waitForCompletion();
+ * \endcode
+ *
+ * \note The constructor, writeCheckpoint(), waitForCompletion(), and
+ * extractCheckpoint() are collective, as is the destructor if a checkpoint is
+ * pending.  registerStagingCallback(), advanceCommunication(), and isComplete()
+ * are local operations.
+ */
+class AsynchronousCheckpointWriter : public SAMRAI::tbox::DescribedClass
+{
+public:
+    /*!
+     * \brief Constructor.
+     */
+    AsynchronousCheckpointWriter(std::string object_name, SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db);
+
+    /*!
+     * \brief Destructor.  Blocks until any pending checkpoint has been
+     * completed.
+     */
+    ~AsynchronousCheckpointWriter();
+
+    /*!
+     * \brief Register a function that writes additional restart data to the
+     * staging directory.  The function is called on all processes with the
+     * name of the staging directory and the restore number after the data
+     * managed by SAMRAI::tbox::RestartManager have been written.
+     */
+    void registerStagingCallback(std::function<void(const std::string&, int)> callback);
+
+    /*!
+     * \brief Take a snapshot of the restart data and begin writing it to the
+     * directory \a restart_dump_dirname.  Any previous checkpoint is completed
+     * first.
+     */
+    void writeCheckpoint(const std::string& restart_dump_dirname, int restore_num);
+
+    /*!
+     * \brief Make progress on the pending communication without blocking.  On
+     * aggregators, hand each batch of data that has been received to the
+     * background thread and start receiving the next batch.
+     */
+    void advanceCommunication();
+
+    /*!
+     * \brief Block until the pending checkpoint (if any) has been written by
+     * all processes and mark it as complete.
+     */
+    void waitForCompletion();
+
+    /*!
+     * \brief Return whether the local part of the pending checkpoint (if any)
+     * was found to be complete by the last call to advanceCommunication().
+     */
+    bool isComplete() const;
+
+    /*!
+     * \brief Recreate the standard per-process restart files in the directory
+     * \a restart_read_dirname from an aggregated checkpoint.  If the directory
+     * does not contain a complete aggregated checkpoint with the given restore
+     * number, this function does nothing.
+     */
+    static void extractCheckpoint(const std::string& restart_read_dirname, int restore_num);
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    AsynchronousCheckpointWriter() = delete;
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    AsynchronousCheckpointWriter(const AsynchronousCheckpointWriter& from) = delete;
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    AsynchronousCheckpointWriter& operator=(const AsynchronousCheckpointWriter& that) = delete;
+
+    /*!
+     * \brief Post the receives of the next batch of snapshots on an
+     * aggregator.
+     */
+    void postAggregatorReceives();
+
+    /*!
+     * \brief Start writing the batch of data in d_write_buffer, from a
+     * background thread if possible.
+     */
+    void startAggregateWrite();
+
+    /*!
+     * \brief Append the batch of data in d_write_buffer to the temporary
+     * aggregate file.  This function is executed by the background thread and
+     * does not make any MPI calls.
+     */
+    bool writeAggregateData(bool append);
+
+    /*!
+     * \brief Release the resources associated with the pending checkpoint and
+     * report any error that occurred while writing it.
+     */
+    void finalizeCheckpoint();
+
+    std::string d_object_name;
+
+    /*!
+     * Configuration options.
+     */
+    bool d_enable_asynchronous_writes = true;
+    int d_num_aggregators = 1;
+    std::uint64_t d_max_aggregator_buffer_size = 1 << 28;
+    std::string d_staging_dirname = "/tmp";
+
+    /*!
+     * The communicator that connects the processes of a group, the number of
+     * processes in each group, the index of the group of this process, and
+     * whether this process is the aggregator of its group.
+     */
+    IBTK_MPI::comm d_group_comm;
+    int d_group_size = 1;
+    int d_group_num = 0;
+    bool d_is_aggregator = false;
+
+    /*!
+     * Whether the aggregate files may be written by a background thread, which
+     * requires MPI_THREAD_FUNNELED support.
+     */
+    bool d_use_background_thread = true;
+
+    std::vector<std::function<void(const std::string&, int)> > d_staging_callbacks;
+
+    /*!
+     * State of the pending checkpoint.  On aggregators, d_recv_buffer holds
+     * the batch that is being received and d_write_buffer the batch that is
+     * being written, and d_next_recv_rank is the rank in the group of the
+     * first process whose snapshot has not yet been requested.
+     */
+    bool d_pending = false;
+    bool d_aggregate_file_started = false;
+    bool d_write_failed = false;
+    std::string d_restore_dirname, d_aggregate_file_name;
+    std::vector<char> d_snapshot, d_recv_buffer, d_write_buffer;
+    std::vector<std::uint64_t> d_snapshot_sizes;
+    int d_next_recv_rank = 0;
+    std::vector<IBTK_MPI::request> d_requests;
+    std::future<bool> d_write_result;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_AsynchronousCheckpointWriter
@@ -38,6 +38,7 @@ IBTK_DISABLE_EXTRA_WARNINGS
 #include "HYPRE_struct_mv.h"
 IBTK_ENABLE_EXTRA_WARNINGS
 
+#include <cstddef>
 #include <string>
 #include <vector>
 
@@ -112,6 +113,7 @@ namespace IBTK
  skip_relax = 1                 // see hypre User's Manual (only used by PFMG solver or
  preconditioner)
  two_norm = 1                   // see hypre User's Manual (only used by PCG solver)
+ reuse_solver_state = FALSE     // see initializeSolverState()
  \endverbatim
  *
  * \em hypre is developed in the Center for Applied Scientific Computing (CASC)
@@ -225,6 +227,13 @@ public:
      * already initialized.  In this case, the solver state is first deallocated
      * and then reinitialized.
      *
+     * \note If \c reuse_solver_state is enabled and the patch level and data
+     * depth are unchanged, the hypre grid, stencil, matrices, and vectors are
+     * kept.  The matrix coefficients and the solver setup are only recomputed
+     * if the problem coefficients or boundary condition objects have changed.
+     * Boundary condition coefficients are assumed to be independent of time in
+     * this case.
+     *
      * \see deallocateSolverState
      */
     void initializeSolverState(const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x,
@@ -306,6 +315,13 @@ private:
      */
     bool d_grid_aligned_anisotropy = true;
 
+    /*!
+     * \brief Data used to determine whether an initialized solver state may be
+     * reused.
+     */
+    bool d_reuse_solver_state = false;
+    std::size_t d_operator_fingerprint = 0;
+
     /*!
      * \name hypre objects.
      */
@@ -89,6 +89,8 @@ namespace IBTK
  * values): \verbatim
 
  smoother_type = "PATCH_GAUSS_SEIDEL"         // see setSmootherType()
+ smoother_sweeps_per_ghost_fill = 2           // only used by "BLOCKED_RED_BLACK_GAUSS_SEIDEL"
+ smoother_cache_size = 262144                 // only used by "BLOCKED_RED_BLACK_GAUSS_SEIDEL"
  prolongation_method = "LINEAR_REFINE"        // see setProlongationMethod()
  restriction_method = "CONSERVATIVE_COARSEN"  // see setRestrictionMethod()
  coarse_solver_type = "HYPRE_LEVEL_SOLVER"    // see setCoarseSolverType()
@@ -143,6 +145,16 @@ public:
      * - \c "PATCH_GAUSS_SEIDEL"
      * - \c "PROCESSOR_GAUSS_SEIDEL"
      * - \c "RED_BLACK_GAUSS_SEIDEL"
+     * - \c "BLOCKED_RED_BLACK_GAUSS_SEIDEL"
+     *
+     * The \c "BLOCKED_RED_BLACK_GAUSS_SEIDEL" smoother performs up to \c
+     * smoother_sweeps_per_ghost_fill red-black sweeps on each patch between
+     * ghost cell fills.  The sweeps are pipelined over tiles sized to fit in a
+     * cache of \c smoother_cache_size bytes, so that the patch data are
+     * streamed from memory once per block of sweeps rather than once per color
+     * sweep.  Patch boundary values are lagged within each block of sweeps.
+     * Both \c smoother_sweeps_per_ghost_fill and \c smoother_cache_size must
+     * be positive.
      */
     void setSmootherType(const std::string& smoother_type) override;
 
@@ -256,6 +268,12 @@ private:
     SAMRAI::tbox::Pointer<PoissonSolver> d_coarse_solver;
     SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> d_coarse_solver_db;
 
+    /*
+     * Parameters for the blocked red-black smoother.
+     */
+    int d_smoother_sweeps_per_ghost_fill = 2;
+    int d_smoother_cache_size = 262144;
+
     /*
      * Patch overlap data.
      */
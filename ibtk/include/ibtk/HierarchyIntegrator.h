@@ -20,6 +20,7 @@
 
 #include <ibtk/config.h>
 
+#include "ibtk/AsynchronousCheckpointWriter.h"
 #include "ibtk/CartGridFunction.h"
 #include "ibtk/HierarchyMathOps.h"
 #include "ibtk/ibtk_enums.h"
@@ -362,6 +363,19 @@ public:
      */
     SAMRAI::tbox::Pointer<SAMRAI::appu::VisItDataWriter<NDIM> > getVisItDataWriter() const;
 
+    /*!
+     * Register an asynchronous checkpoint writer.  The integrator progresses
+     * the pending communication of the writer after each cycle of each time
+     * step, so that a checkpoint is written while the computation continues.
+     */
+    void registerCheckpointWriter(SAMRAI::tbox::Pointer<AsynchronousCheckpointWriter> checkpoint_writer);
+
+    /*!
+     * Get a pointer to the asynchronous checkpoint writer registered with the
+     * integrator.
+     */
+    SAMRAI::tbox::Pointer<AsynchronousCheckpointWriter> getCheckpointWriter() const;
+
     /*!
      * Prepare variables for plotting.
      *
@@ -1044,6 +1058,11 @@ protected:
      */
     SAMRAI::tbox::Pointer<SAMRAI::appu::VisItDataWriter<NDIM> > d_visit_writer;
 
+    /*
+     * The object used to write restart data in the background.
+     */
+    SAMRAI::tbox::Pointer<AsynchronousCheckpointWriter> d_checkpoint_writer;
+
     /*
      * Time and time step size data read from input or set at initialization.
      */
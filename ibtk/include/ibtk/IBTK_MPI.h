@@ -25,6 +25,7 @@
 
 #include <mpi.h>
 
+#include <map>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -305,6 +306,23 @@ struct IBTK_MPI
 
     //@}
 
+    /*!
+     * @brief Exchange messages with a sparse set of processors that is not
+     * known in advance by the receiving processors.
+     *
+     * Each processor provides the messages that it sends, keyed by the rank of
+     * the receiving processor, and obtains the messages that were sent to it,
+     * keyed by the rank of the sending processor.  The exchange uses
+     * synchronous nonblocking sends and a nonblocking barrier (the NBX
+     * algorithm of Hoefler, Siebert, and Lumsdaine, PPoPP'10), so that its cost
+     * depends on the number of messages and not on the number of processors.
+     *
+     * \note This function is collective.
+     */
+    template <typename T>
+    static std::map<int, std::vector<T> > sparseExchange(const std::map<int, std::vector<T> >& send_data,
+                                                         IBTK_MPI::comm communicator = getCommunicator());
+
 private:
     /**
      * Performs common functions needed by some of the allToAll methods.
@@ -318,6 +336,13 @@ private:
     template <typename T>
     static void minMaxReduction(T* x, const int n, int* rank, MPI_Op op, IBTK_MPI::comm communicator);
 
+    /**
+     * Return the tag used by the next call to sparseExchange() on the given
+     * communicator.  Consecutive exchanges use different tags so that the
+     * messages of an exchange cannot be received by the previous exchange.
+     */
+    static int getSparseExchangeTag(IBTK_MPI::comm communicator);
+
     static IBTK_MPI::comm s_communicator;
 };
 
@@ -183,6 +183,21 @@ public:
      */
     void registerLagrangianAO(std::vector<AO>& ao, int coarsest_ln, int finest_ln);
 
+    /*!
+     * \brief Set the number of files to which the local data are written.
+     *
+     * By default, each MPI process writes its local data to its own file. If
+     * the number of files is less than the number of MPI processes, the
+     * processes are divided into contiguous groups, one per file, and the
+     * processes in each group take turns writing their data to separate
+     * directories in the group's file. A nonpositive value restores the
+     * default behavior.
+     *
+     * \note AppInitializer sets this value from the optional key
+     * <tt>silo_number_output_files</tt> of the <tt>Main</tt> input database.
+     */
+    void setNumberOfOutputFiles(int num_files);
+
     /*!
      * \brief Write the plot data to disk.
      */
@@ -230,6 +245,12 @@ private:
      */
     void buildVecScatters(AO& ao, int level_number);
 
+    /*!
+     * \brief Destroy the cached Vec objects that store the local data on the
+     * specified level.
+     */
+    void destroyLocalVecs(int level_number);
+
     /*!
      * Read object state from the restart file and initialize class data
      * members.  The database from which the restart data is read is determined
@@ -258,6 +279,12 @@ private:
      */
     std::string d_dump_directory_name;
 
+    /*
+     * The number of files to which the local data are written.  A nonpositive
+     * value indicates that each MPI process writes its own file.
+     */
+    int d_num_output_files = 0;
+
     /*
      * Time step number (passed in by user).
      */
@@ -321,6 +348,13 @@ private:
     std::vector<bool> d_build_vec_scatters;
     std::vector<std::map<int, Vec> > d_src_vec, d_dst_vec;
     std::vector<std::map<int, VecScatter> > d_vec_scatter;
+
+    /*
+     * Vecs storing the local coordinate data (entry 0) and variable data
+     * (entry v + 1) on each level.  These Vecs are reused by each call to
+     * writePlotData() until the VecScatters are rebuilt.
+     */
+    std::vector<std::vector<Vec> > d_local_vecs;
 };
 } // namespace IBTK
 
@@ -0,0 +1,171 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDE GUARD ////////////////////////////////
+
+#ifndef included_IBTK_PETScFischerGuess
+#define included_IBTK_PETScFischerGuess
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <ibtk/config.h>
+
+#include <ibtk/ibtk_utilities.h>
+
+#include "BoxArray.h"
+#include "PatchHierarchy.h"
+#include "tbox/Pointer.h"
+
+#include "petscvec.h"
+
+#include <cstddef>
+#include <vector>
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class PETScFischerGuess retains a subspace of previous solutions of a
+ * linear system A x = b and uses it to compute initial guesses for subsequent
+ * solves with new right-hand sides.
+ *
+ * This is Fischer's first algorithm from the 1998 manuscript "Projection
+ * techniques for iterative solution of A x = b with successive right-hand
+ * sides" applied to PETSc Vec objects. Unlike IBTK::FischerGuess, the
+ * right-hand side vectors are orthonormalized as they are submitted so that
+ * computing a guess only requires one multiple inner product and one multiple
+ * AXPY, and, since the pairs (x_i, b_i) satisfy A x_i = b_i, no applications
+ * of the operator A are required. This makes the class suitable for matrix-free
+ * operators whose application is itself expensive (e.g., operators that
+ * involve nested solves).
+ *
+ * When the retained subspace is full, the oldest pair is evicted to make room
+ * for a newly submitted pair. Since the retained right-hand sides are
+ * orthonormal, the remaining pairs do not need to be modified.
+ *
+ * The guess is only meaningful if the operator does not change (or changes
+ * slowly) between solves. The retained vectors are discarded automatically
+ * when the vector layout changes, when setPatchHierarchy() detects that the
+ * grid has been regridded, or when setOperatorFingerprint() is passed a
+ * different fingerprint. Callers may also call clear() directly.
+ */
+class PETScFischerGuess
+{
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param max_vectors The maximum number of retained solution and
+     * right-hand side pairs.
+     */
+    PETScFischerGuess(int max_vectors = 5);
+
+    /*!
+     * \brief Destructor.
+     */
+    ~PETScFischerGuess();
+
+    /*!
+     * \brief Deleted copy constructor.
+     */
+    PETScFischerGuess(const PETScFischerGuess& from) = delete;
+
+    /*!
+     * \brief Deleted assignment operator.
+     */
+    PETScFischerGuess& operator=(const PETScFischerGuess& that) = delete;
+
+    /*!
+     * \brief Add a solution and right-hand side pair to the retained subspace.
+     *
+     * Pairs whose right-hand side is (numerically) contained in the retained
+     * subspace are ignored.
+     */
+    void submit(Vec x, Vec b);
+
+    /*!
+     * \brief Compute an estimate of the solution corresponding to the
+     * right-hand side \a b.
+     *
+     * \return Whether a nonzero guess was computed. If no vectors are
+     * retained, \a x is set to zero and false is returned.
+     */
+    bool guess(Vec x, Vec b);
+
+    /*!
+     * \brief Set the levels of the patch hierarchy on which the operator is
+     * discretized.
+     *
+     * The retained vectors are discarded if the hierarchy or the boxes of any of
+     * the levels differ from those of the previous call.
+     */
+    void setPatchHierarchy(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                           int coarsest_ln,
+                           int finest_ln);
+
+    /*!
+     * \brief Set a value that identifies the operator.
+     *
+     * The retained vectors are discarded if \a fingerprint differs from the
+     * value of the previous call. The value must be the same on all processes.
+     */
+    void setOperatorFingerprint(std::size_t fingerprint);
+
+    /*!
+     * \brief Discard all retained vectors.
+     */
+    void clear();
+
+    /*!
+     * \brief Return the number of retained vectors.
+     */
+    int getNumberOfVectors() const;
+
+private:
+    /*!
+     * \brief Determine whether the retained vectors are compatible with \a v
+     * on every process that shares \a v. This function is collective.
+     */
+    bool isCompatible(Vec v) const;
+
+    /*!
+     * \brief Maximum number of retained vectors.
+     */
+    int d_max_vectors;
+
+    /*!
+     * \brief Retained solutions and orthonormalized right-hand sides, oldest
+     * first. The solutions are transformed with the same coefficients as the
+     * right-hand sides so that A d_x[k] = d_b[k].
+     */
+    std::vector<Vec> d_x, d_b;
+
+    /*!
+     * \brief Grid and operator for which the retained vectors were computed.
+     */
+    SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > d_hierarchy;
+    std::vector<SAMRAI::hier::BoxArray<NDIM> > d_level_boxes;
+    std::size_t d_operator_fingerprint = 0;
+    bool d_have_operator_fingerprint = false;
+
+    /*!
+     * \brief Workspace for inner products.
+     */
+    std::vector<PetscScalar> d_coefs;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_PETScFischerGuess
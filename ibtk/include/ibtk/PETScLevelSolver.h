@@ -21,6 +21,7 @@
 #include <ibtk/config.h>
 
 #include "ibtk/LinearSolver.h"
+#include "ibtk/PETScMatUtilities.h"
 #include "ibtk/ibtk_utilities.h"
 
 #include "CoarseFineBoundary.h"
@@ -33,6 +34,7 @@
 #include "petscmat.h"
 #include "petscvec.h"
 
+#include <cstddef>
 #include <string>
 #include <vector>
 
@@ -68,6 +70,7 @@ namespace IBTK
  abs_residual_tol = 1.0e-50    // see setAbsoluteTolerance()
  max_iterations = 10000        // see setMaxIterations()
  enable_logging = FALSE        // see setLoggingEnabled()
+ reuse_solver_state = FALSE    // see initializeSolverState()
  \endverbatim
  *
  * PETSc is developed at the Argonne National Laboratory Mathematics and
@@ -195,6 +198,16 @@ public:
      * already initialized.  In this case, the solver state is first deallocated
      * and then reinitialized.
      *
+     * \note If \c reuse_solver_state is enabled and the solver state is already
+     * initialized, the existing matrices and preconditioner are kept when the
+     * patch level, the vector layout, and the operator fingerprint computed by
+     * computeOperatorFingerprint() are unchanged.  If only the fingerprint has
+     * changed and the subclass implements refreshOperatorValues(), the matrix
+     * values are rewritten in place and the preconditioner is set up again,
+     * without recreating the matrix, the DOF indices, or the subdomains.
+     * The fingerprint includes the boundary condition coefficients evaluated at
+     * the solution time, so time-dependent coefficients also trigger a refresh.
+     *
      * \note Subclasses of class PETScLevelSolver should \em not override this
      * method.  Instead, they should override the protected method
      * initializeSolverStateSpecialized().
@@ -276,6 +289,29 @@ protected:
      */
     virtual void setupNullspace();
 
+    /*!
+     * \brief Compute a hash of the data that determine the linear operator on
+     * the patch level, excluding the patch level itself.
+     *
+     * The fingerprint is only used when \c reuse_solver_state is enabled.  The
+     * default implementation returns zero, i.e., the operator is assumed to
+     * depend only on the patch level.
+     */
+    virtual std::size_t computeOperatorFingerprint();
+
+    /*!
+     * \brief Rewrite the values of the operator matrix for the current problem
+     * coefficients without modifying its nonzero structure.
+     *
+     * This method is only called when \c reuse_solver_state is enabled and the
+     * operator fingerprint has changed.  Implementations should use
+     * d_mat_values_plan.  The default implementation returns false, in which
+     * case the solver state is reinitialized.
+     *
+     * \return Whether the matrix values were refreshed.
+     */
+    virtual bool refreshOperatorValues();
+
     /*!
      * \brief Associated hierarchy.
      */
@@ -293,6 +329,15 @@ protected:
      */
     SAMRAIDataCache d_cached_eulerian_data;
 
+    /*!
+     * \brief Data used to determine whether an initialized solver state may be
+     * reused.
+     */
+    bool d_reuse_solver_state = false;
+    std::size_t d_operator_fingerprint = 0;
+    std::vector<int> d_solver_state_idxs;
+    PETScMatUtilities::MatValuesPlan d_mat_values_plan;
+
     /*!
      * \name PETSc objects.
      */
@@ -348,6 +393,20 @@ private:
      */
     PETScLevelSolver& operator=(const PETScLevelSolver& that) = delete;
 
+    /*!
+     * \brief Determine whether the current solver state was set up for the
+     * patch level and the patch data layout of the specified solution and
+     * right-hand-side vectors.
+     */
+    bool canReuseSolverState(const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x,
+                             const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& b);
+
+    /*!
+     * \brief Set up the preconditioners again after the values of the operator
+     * matrix have been refreshed.
+     */
+    void resetSolverOperatorValues();
+
     /*!
      * \brief Apply the preconditioner to \a x and store the result in \a y.
      */
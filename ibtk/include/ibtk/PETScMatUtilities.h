@@ -30,6 +30,7 @@
 #include "petscvec.h"
 
 #include <cmath>
+#include <cstddef>
 #include <vector>
 
 namespace SAMRAI
@@ -61,6 +62,92 @@ namespace IBTK
 class PETScMatUtilities
 {
 public:
+    /*!
+     * \brief Class MatValuesPlan stores the locations of the locally owned
+     * entries of an assembled AIJ matrix within its local CSR value arrays, in
+     * the order in which the entries are set.
+     *
+     * A plan is built the first time that the values of a matrix are refreshed
+     * and is used for all subsequent refreshes of the same matrix, so that the
+     * new values can be written directly into the CSR arrays without calls to
+     * MatSetValues() and without assembly.  The plan must be cleared whenever
+     * the matrix or the DOF indices are recreated, e.g., after regridding.
+     */
+    class MatValuesPlan
+    {
+    public:
+        /*!
+         * \brief Discard the plan.
+         */
+        void clear();
+
+        /*!
+         * \brief Determine whether the plan has been built for the specified
+         * matrix.
+         */
+        bool isInitialized(Mat mat) const;
+
+    private:
+        friend class PETScMatUtilities;
+
+        Mat d_mat = nullptr;
+        PetscInt d_diag_nnz = 0;
+        std::vector<PetscInt> d_offsets;
+
+        /*
+         * Data that are only valid between calls to beginMatValuesRefresh()
+         * and endMatValuesRefresh().
+         */
+        bool d_building = false;
+        std::size_t d_pos = 0;
+        Mat d_diag_mat = nullptr, d_offdiag_mat = nullptr;
+        PetscScalar *d_diag_vals = nullptr, *d_offdiag_vals = nullptr;
+        const PetscInt *d_diag_ia = nullptr, *d_diag_ja = nullptr;
+        const PetscInt *d_offdiag_ia = nullptr, *d_offdiag_ja = nullptr;
+        const PetscInt* d_colmap = nullptr;
+        PetscInt d_num_offdiag_cols = 0;
+        PetscInt d_row_start = 0, d_row_end = 0, d_col_start = 0, d_col_end = 0;
+    };
+
+    /*!
+     * \name Methods for refreshing the values of matrices with a fixed nonzero
+     * structure.
+     */
+    //\{
+
+    /*!
+     * \brief Prepare to rewrite the values of the locally owned rows of an
+     * assembled AIJ matrix.
+     *
+     * If the plan has not been built for \a mat, it is (re)built by the
+     * subsequent calls to setMatRowValues().
+     */
+    static void beginMatValuesRefresh(Mat mat, MatValuesPlan& plan);
+
+    /*!
+     * \brief Set the values of a single locally owned matrix row.
+     *
+     * If \a plan is NULL, the values are set via MatSetValues() with
+     * INSERT_VALUES.  Otherwise, the values are written directly into the CSR
+     * arrays of the matrix.  In the latter case, the sequence of rows and
+     * columns must be the same for each refresh of the matrix values, and all
+     * columns must be part of the nonzero structure of the matrix.  As with
+     * MatSetValues(), negative column indices are ignored.
+     */
+    static void setMatRowValues(Mat mat,
+                                MatValuesPlan* plan,
+                                int row,
+                                int ncols,
+                                const int* cols,
+                                const double* vals);
+
+    /*!
+     * \brief Finish rewriting the values of a matrix.
+     */
+    static void endMatValuesRefresh(Mat mat, MatValuesPlan& plan);
+
+    //\}
+
     /*!
      * \name Methods acting on SAMRAI::hier::PatchLevel and
      * SAMRAI::hier::Variable objects.
@@ -126,6 +213,44 @@ public:
                                                  SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level,
                                                  VCInterpType mu_interp_type = VC_HARMONIC_INTERP);
 
+    /*!
+     * \brief Rewrite the values of a PETSc Mat object constructed by
+     * constructPatchLevelCCLaplaceOp() without modifying its nonzero
+     * structure.
+     *
+     * The patch level and the DOF indices must be the same as those used to
+     * construct \a mat.
+     */
+    static void refreshPatchLevelCCLaplaceOpValues(Mat& mat,
+                                                   MatValuesPlan& plan,
+                                                   const SAMRAI::solv::PoissonSpecifications& poisson_spec,
+                                                   const std::vector<SAMRAI::solv::RobinBcCoefStrategy<NDIM>*>& bc_coefs,
+                                                   double data_time,
+                                                   const std::vector<int>& num_dofs_per_proc,
+                                                   int dof_index_idx,
+                                                   SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level);
+
+    /*!
+     * \brief Rewrite the values of a PETSc Mat object constructed by
+     * constructPatchLevelVCSCViscousOp() without modifying its nonzero
+     * structure.
+     *
+     * The patch level and the DOF indices must be the same as those used to
+     * construct \a mat.
+     */
+    static void
+    refreshPatchLevelVCSCViscousOpValues(Mat& mat,
+                                         MatValuesPlan& plan,
+                                         const SAMRAI::solv::PoissonSpecifications& poisson_spec,
+                                         double alpha,
+                                         double beta,
+                                         const std::vector<SAMRAI::solv::RobinBcCoefStrategy<NDIM>*>& bc_coefs,
+                                         double data_time,
+                                         const std::vector<int>& num_dofs_per_proc,
+                                         int dof_index_idx,
+                                         SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level,
+                                         VCInterpType mu_interp_type = VC_HARMONIC_INTERP);
+
     /*!
      * \brief Construct a parallel PETSc Mat object corresponding to the
      * side-centered IB interpolation operator for the provided kernel function.
@@ -243,6 +368,35 @@ private:
      */
     PETScMatUtilities& operator=(const PETScMatUtilities& that) = delete;
 
+    /*!
+     * \brief Set the values of the locally owned rows of the cell-centered
+     * Laplacian.
+     */
+    static void setPatchLevelCCLaplaceOpValues(Mat& mat,
+                                               MatValuesPlan* plan,
+                                               const SAMRAI::solv::PoissonSpecifications& poisson_spec,
+                                               const std::vector<SAMRAI::solv::RobinBcCoefStrategy<NDIM>*>& bc_coefs,
+                                               double data_time,
+                                               const std::vector<int>& num_dofs_per_proc,
+                                               int dof_index_idx,
+                                               SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level);
+
+    /*!
+     * \brief Set the values of the locally owned rows of the side-centered
+     * viscous operator.
+     */
+    static void setPatchLevelVCSCViscousOpValues(Mat& mat,
+                                                 MatValuesPlan* plan,
+                                                 const SAMRAI::solv::PoissonSpecifications& poisson_spec,
+                                                 double alpha,
+                                                 double beta,
+                                                 const std::vector<SAMRAI::solv::RobinBcCoefStrategy<NDIM>*>& bc_coefs,
+                                                 double data_time,
+                                                 const std::vector<int>& num_dofs_per_proc,
+                                                 int dof_index_idx,
+                                                 SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level,
+                                                 VCInterpType mu_interp_type);
+
     /*!
      * \brief Construct a parallel PETSc Mat object corresponding to cc-data
      * and conservative prolongation from a coarser level to a finer level.
@@ -24,6 +24,7 @@
 
 #include <map>
 #include <utility>
+#include <vector>
 
 /////////////////////////////// CLASS DEFINITION /////////////////////////////
 
@@ -32,14 +33,24 @@ namespace IBTK
 /*!
  * \brief Class ParallelEdgeMap is a utility class for managing edge maps (i.e.,
  * maps from vertices to links between vertices) in parallel.
+ *
+ * By default, the edge map is replicated on every process.  Alternatively, the
+ * edge map may be partitioned among the processes by master index, in which
+ * case the edges associated with a master index are stored only by the process
+ * that owns the index and are obtained via the collective function
+ * getLocalView().
+ *
+ * \see ParallelSet
  */
 class ParallelEdgeMap : public SAMRAI::tbox::DescribedClass
 {
 public:
     /*!
      * \brief Default constructor.
+     *
+     * \param replicate_data Whether all edges are stored on every process.
      */
-    ParallelEdgeMap() = default;
+    explicit ParallelEdgeMap(bool replicate_data = true);
 
     /*!
      * \brief Destructor.
@@ -71,20 +82,39 @@ public:
      * communication.
      *
      * \note The master index argument is optional and is only used as a hint to
-     * attempt to find the link in the link table.
+     * attempt to find the link in the link table.  If the edge map is
+     * partitioned, the master index must be the one that was used when the edge
+     * was added.
      */
     void removeEdge(const std::pair<int, int>& link, int mastr_idx = -1);
 
     /*!
-     * \brief Communicate data to (re-)initialize the edge map.
+     * \brief Communicate data to (re-)initialize the edge map.  All pending
+     * additions are processed before any pending removals.
      */
     void communicateData();
 
+    /*!
+     * \brief Return whether all edges are stored on every process.
+     */
+    bool isReplicated() const;
+
     /*!
      * \brief Return a const reference to the edge map.
+     *
+     * \note If the edge map is partitioned, only the edges whose master indices
+     * are owned by this process are included.
      */
     const std::multimap<int, std::pair<int, int> >& getEdgeMap() const;
 
+    /*!
+     * \brief Return the edges that are associated with the specified master
+     * indices.
+     *
+     * \note This method is collective if the edge map is partitioned.
+     */
+    std::multimap<int, std::pair<int, int> > getLocalView(const std::vector<int>& mastr_idxs) const;
+
 private:
     /*!
      * \brief Copy constructor.
@@ -107,6 +137,7 @@ private:
     ParallelEdgeMap& operator=(const ParallelEdgeMap& that) = delete;
 
     // Member data.
+    bool d_replicate_data = true;
     std::multimap<int, std::pair<int, int> > d_edge_map;
     std::multimap<int, std::pair<int, int> > d_pending_additions, d_pending_removals;
 };
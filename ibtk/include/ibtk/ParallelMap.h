@@ -38,14 +38,25 @@ namespace IBTK
 /*!
  * \brief Class ParallelMap is a utility class for associating integer keys with
  * arbitrary data items in parallel.
+ *
+ * By default, the map is replicated, i.e., every process stores all items once
+ * communicateData() has been called.  Alternatively, the map may be partitioned
+ * among the processes: each item is then stored only by the process that owns
+ * its key (which is determined by hashing the key), communicateData() sends
+ * each pending addition or removal only to the owner of the key, and a process
+ * obtains the items that it needs via the collective function getLocalView().
+ *
+ * \see ParallelSet
  */
 class ParallelMap : public SAMRAI::tbox::DescribedClass
 {
 public:
     /*!
      * \brief Default constructor.
+     *
+     * \param replicate_data Whether all items are stored on every process.
      */
-    ParallelMap() = default;
+    explicit ParallelMap(bool replicate_data = true);
 
     /*!
      * \brief Copy constructor.
@@ -95,17 +106,35 @@ public:
     void removeItem(int key);
 
     /*!
-     * \brief Communicate data to (re-)initialize the map.
+     * \brief Communicate data to (re-)initialize the map.  All pending additions
+     * are processed before any pending removals.
      */
     void communicateData();
 
+    /*!
+     * \brief Return whether all items are stored on every process.
+     */
+    bool isReplicated() const;
+
     /*!
      * \brief Return a const reference to the map.
+     *
+     * \note If the map is partitioned, only the items whose keys are owned by
+     * this process are included.
      */
     const std::map<int, SAMRAI::tbox::Pointer<Streamable> >& getMap() const;
 
+    /*!
+     * \brief Return the items with the specified keys.  Keys that are not in the
+     * map are ignored.
+     *
+     * \note This method is collective if the map is partitioned.
+     */
+    std::map<int, SAMRAI::tbox::Pointer<Streamable> > getLocalView(const std::vector<int>& keys) const;
+
 private:
     // Member data.
+    bool d_replicate_data = true;
     std::map<int, SAMRAI::tbox::Pointer<Streamable> > d_map;
     std::map<int, SAMRAI::tbox::Pointer<Streamable> > d_pending_additions;
     std::vector<int> d_pending_removals;
@@ -32,14 +32,25 @@ namespace IBTK
 /*!
  * \brief Class ParallelSet is a utility class for storing collections of
  * integer keys in parallel.
+ *
+ * By default, the set is replicated, i.e., every process stores all keys once
+ * communicateData() has been called.  Alternatively, the set may be partitioned
+ * among the processes: each key is then stored only by the process that owns
+ * it (which is determined by hashing the key), communicateData() sends each
+ * pending addition or removal only to the owner of the key, and a process
+ * obtains the keys that it needs via the collective function getLocalView().
+ * In both cases, the amount of communication does not grow with the number of
+ * processes.
  */
 class ParallelSet : public SAMRAI::tbox::DescribedClass
 {
 public:
     /*!
      * \brief Default constructor.
+     *
+     * \param replicate_data Whether all keys are stored on every process.
      */
-    ParallelSet() = default;
+    explicit ParallelSet(bool replicate_data = true);
 
     /*!
      * \brief Copy constructor.
@@ -89,17 +100,35 @@ public:
     void removeItem(int key);
 
     /*!
-     * \brief Communicate data to (re-)initialize the set.
+     * \brief Communicate data to (re-)initialize the set.  All pending additions
+     * are processed before any pending removals.
      */
     void communicateData();
 
+    /*!
+     * \brief Return whether all keys are stored on every process.
+     */
+    bool isReplicated() const;
+
     /*!
      * \brief Return a const reference to the set.
+     *
+     * \note If the set is partitioned, only the keys owned by this process are
+     * included.
      */
     const std::set<int>& getSet() const;
 
+    /*!
+     * \brief Return the subset of the specified keys that are contained in the
+     * set.
+     *
+     * \note This method is collective if the set is partitioned.
+     */
+    std::set<int> getLocalView(const std::vector<int>& keys) const;
+
 private:
     // Member data.
+    bool d_replicate_data = true;
     std::set<int> d_set;
     std::vector<int> d_pending_additions, d_pending_removals;
 };
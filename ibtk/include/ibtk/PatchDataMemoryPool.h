@@ -0,0 +1,219 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDE GUARD ////////////////////////////////
+
+#ifndef included_IBTK_PatchDataMemoryPool
+#define included_IBTK_PatchDataMemoryPool
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <ibtk/config.h>
+
+#include "tbox/Arena.h"
+#include "tbox/Pointer.h"
+
+#include <cstddef>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class PatchDataMemoryPool is a SAMRAI::tbox::Arena that recycles the
+ * memory blocks used to store patch data.
+ *
+ * Memory released to the pool is retained and handed out again in response to
+ * subsequent requests for blocks of the same size.  Since the size of the
+ * block that stores the data of a patch data object is determined by the data
+ * type, centering, depth, ghost cell width, and patch box, scratch data that
+ * are repeatedly allocated and deallocated (e.g., by solvers that are
+ * reinitialized every time step) reuse the same, already-touched memory
+ * instead of going through the system allocator each time.  Blocks that
+ * become unused after regridding are released back to the system once the
+ * retained memory exceeds a prescribed limit, starting with the blocks whose
+ * size was least recently requested.
+ *
+ * The pool is used by passing the arena returned by getArena() to the
+ * allocation functions of SAMRAI::hier::PatchLevel and
+ * SAMRAI::solv::SAMRAIVectorReal, e.g.,
+ *
+ * \code
+ * level->allocatePatchData(scratch_idx, data_time, PatchDataMemoryPool::getArena());
+ * \endcode
+ *
+ * Pooling is disabled by default, in which case getArena() returns a null
+ * pointer, and SAMRAI uses its standard allocator.  Applications that use
+ * AppInitializer can enable it with the key
+ * <code>enable_patch_data_memory_pool</code> in the <code>Main</code> input
+ * database and limit the retained memory with
+ * <code>patch_data_memory_pool_max_retained_bytes</code> (256 MiB by default).
+ *
+ * \note The pool is a process-wide singleton and is not thread-safe.
+ */
+class PatchDataMemoryPool : public SAMRAI::tbox::Arena
+{
+public:
+    /*!
+     * Return a pointer to the process-wide memory pool.
+     *
+     * Note that when the pool is accessed for the first time, the freePool
+     * static method is registered with the ShutdownRegistry class.
+     */
+    static SAMRAI::tbox::Pointer<PatchDataMemoryPool> getPool();
+
+    /*!
+     * Release the reference to the process-wide memory pool held by this
+     * class.  The pool itself is deleted once all patch data allocated from it
+     * have been deallocated.
+     *
+     * It is not necessary to call this function at program termination, since
+     * it is automatically called by the ShutdownRegistry class.
+     */
+    static void freePool();
+
+    /*!
+     * Return the arena that should be used to allocate pooled patch data, or a
+     * null pointer if pooling is disabled.
+     */
+    static SAMRAI::tbox::Pointer<SAMRAI::tbox::Arena> getArena();
+
+    /*!
+     * Enable or disable pooling for subsequent allocations.  Pooling is
+     * disabled by default.  Disabling pooling releases all retained memory.
+     */
+    static void setEnabled(bool enabled);
+
+    /*!
+     * Return whether pooling is enabled.
+     */
+    static bool getEnabled();
+
+    /*!
+     * \brief Destructor.
+     */
+    ~PatchDataMemoryPool();
+
+    /*!
+     * \brief Allocate a block of the specified size, reusing a retained block
+     * if one of the same size is available.
+     */
+    void* alloc(const size_t bytes) override;
+
+    /*!
+     * \brief Return a block to the pool.
+     */
+    void free(void* p) override;
+
+    /*!
+     * \brief Set the maximum number of bytes retained in the pool.
+     */
+    void setMaxRetainedBytes(std::size_t max_retained_bytes);
+
+    /*!
+     * \brief Release all retained blocks to the system.  Blocks that are in
+     * use are not affected.
+     */
+    void release();
+
+    /*!
+     * \brief Return the number of bytes in blocks that are presently in use.
+     */
+    std::size_t getAllocatedBytes() const;
+
+    /*!
+     * \brief Return the number of bytes in blocks that are retained for reuse.
+     */
+    std::size_t getRetainedBytes() const;
+
+    /*!
+     * \brief Return the total number of allocation requests.
+     */
+    unsigned long getNumberOfRequests() const;
+
+    /*!
+     * \brief Return the number of allocation requests that were satisfied by
+     * reusing a retained block.
+     */
+    unsigned long getNumberOfRecycledRequests() const;
+
+private:
+    /*!
+     * \brief Constructor.
+     */
+    PatchDataMemoryPool() = default;
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    PatchDataMemoryPool(const PatchDataMemoryPool& from) = delete;
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    PatchDataMemoryPool& operator=(const PatchDataMemoryPool& that) = delete;
+
+    /*!
+     * \brief Release retained blocks, least recently requested sizes first,
+     * until at most \a max_retained_bytes bytes are retained.
+     */
+    void trim(std::size_t max_retained_bytes);
+
+    /*!
+     * Static data members used to control access to and destruction of the
+     * singleton pool.
+     */
+    static SAMRAI::tbox::Pointer<PatchDataMemoryPool> s_pool_instance;
+    static bool s_registered_callback;
+    static unsigned char s_shutdown_priority;
+    static bool s_enabled;
+
+    /*!
+     * \brief Retained blocks of a given size, along with the value of the
+     * request counter when a block of that size was last requested or
+     * returned.
+     */
+    struct FreeList
+    {
+        std::vector<void*> blocks;
+        unsigned long last_use = 0;
+    };
+    std::map<std::size_t, FreeList> d_free_lists;
+
+    /*!
+     * \brief Sizes of the blocks that are in use.
+     */
+    std::unordered_map<void*, std::size_t> d_block_sizes;
+
+    std::size_t d_max_retained_bytes = 256 * 1024 * 1024;
+    std::size_t d_allocated_bytes = 0, d_retained_bytes = 0;
+    unsigned long d_use_counter = 0, d_num_requests = 0, d_num_recycled_requests = 0;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_PatchDataMemoryPool
@@ -0,0 +1,203 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDE GUARD ////////////////////////////////
+
+#ifndef included_IBTK_PerformanceTrace
+#define included_IBTK_PerformanceTrace
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <ibtk/config.h>
+
+#include <string>
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class PerformanceTrace records a per-process trace of the time spent
+ * in the phases of a computation and of scalar quantities (e.g., the number of
+ * solver iterations), tagged with the time step number, and writes the trace
+ * in formats that can be analyzed after the run.
+ *
+ * Unlike SAMRAI::tbox::TimerManager, which only reports the total time spent
+ * in each timed region, the trace retains every individual interval, so that
+ * it is possible to determine how the cost of each phase evolves over the
+ * course of a simulation and how it differs between processes.
+ *
+ * Every region timed with the IBTK_TIMER_START / IBTK_TIMER_STOP and
+ * IBAMR_TIMER_START / IBAMR_TIMER_STOP macros is recorded as a phase named
+ * after its timer.  Additional phases and values may be recorded using the
+ * static functions of this class or the ScopedPhase helper class.
+ *
+ * Tracing is disabled by default, in which case recording a phase costs a
+ * single test of a boolean flag.  It may be enabled by calling setEnabled() or
+ * by setting the key <code>enable_performance_trace</code> in the
+ * <code>Main</code> database read by AppInitializer.  A typical use is
+ *
+ * \code
+ * PerformanceTrace::setEnabled(true);
+ * // ... advance the integrator ...
+ * PerformanceTrace::writeCSV("trace.csv");
+ * PerformanceTrace::writeChromeTrace("trace.json");
+ * PerformanceTrace::writeLoadSummary("trace_summary.csv");
+ * \endcode
+ *
+ * The output functions are collective: the traces of all processes are
+ * gathered and written by the process with rank zero.  Chrome trace files
+ * may be viewed using chrome://tracing or https://ui.perfetto.dev, where each
+ * process appears as a separate track.
+ *
+ * \note This class is not thread-safe.
+ */
+class PerformanceTrace
+{
+public:
+    /*!
+     * \brief Helper class that records a phase for the lifetime of the object.
+     */
+    class ScopedPhase
+    {
+    public:
+        /*!
+         * \brief Begin recording the phase named by the concatenation of \a
+         * prefix and \a name.  The name is only assembled if tracing is
+         * enabled.
+         */
+        ScopedPhase(const std::string& prefix, const char* name);
+
+        /*!
+         * \brief End recording the phase.
+         */
+        ~ScopedPhase();
+
+        ScopedPhase(const ScopedPhase& from) = delete;
+        ScopedPhase& operator=(const ScopedPhase& that) = delete;
+
+    private:
+        bool d_active = false;
+        std::string d_name;
+    };
+
+    /*!
+     * \brief Enable or disable recording.  Disabling recording does not discard
+     * the data that have already been recorded.
+     */
+    static void setEnabled(bool enabled);
+
+    /*!
+     * \brief Return whether recording is enabled.
+     */
+    static inline bool isEnabled()
+    {
+        return s_enabled;
+    } // isEnabled
+
+    /*!
+     * \brief Set the time step number associated with subsequently recorded
+     * phases and values.
+     */
+    static void setStep(int step);
+
+    /*!
+     * \brief Begin recording the phase with the specified name.  Phases may be
+     * nested.
+     */
+    static void beginPhase(const std::string& name);
+
+    /*!
+     * \brief End recording the most recently begun phase with the specified
+     * name.  Any phases begun after that phase that have not yet ended are
+     * ended as well.
+     */
+    static void endPhase(const std::string& name);
+
+    /*!
+     * \brief Record a scalar value (e.g., an iteration count).
+     */
+    static void recordValue(const std::string& name, double value);
+
+    /*!
+     * \brief Set the maximum number of phase and value records that are
+     * retained on each process.  The default is 1000000.
+     *
+     * Once this number is reached, subsequent phases and values are discarded
+     * (and a warning is printed).  The total time and number of calls of
+     * discarded phases are still reported by writeLoadSummary().
+     */
+    static void setMaximumNumberOfRecords(int max_records);
+
+    /*!
+     * \brief Return the number of phase and value records that have been
+     * discarded on this process since the trace was last cleared.
+     */
+    static int getNumberOfDiscardedRecords();
+
+    /*!
+     * \brief Discard all recorded data, including the totals reported by
+     * writeLoadSummary().
+     */
+    static void clear();
+
+    /*!
+     * \brief Write all recorded phases and values of all processes to a CSV
+     * file.
+     *
+     * Each line contains the rank, the time step number, the record type
+     * (phase or value), the name, the nesting depth, the start time and
+     * duration in seconds (for phases), and the value (for values).
+     */
+    static void writeCSV(const std::string& file_name);
+
+    /*!
+     * \brief Write all recorded phases and values of all processes to a file
+     * in the Chrome trace event JSON format.
+     */
+    static void writeChromeTrace(const std::string& file_name);
+
+    /*!
+     * \brief Write a CSV file that summarizes, for each phase, the number of
+     * calls and the minimum, mean, and maximum over all processes of the total
+     * time spent in the phase, along with the rank that spent the most time
+     * in the phase and the load imbalance (the ratio of the maximum to the
+     * mean time).
+     */
+    static void writeLoadSummary(const std::string& file_name);
+
+    /*!
+     * \brief Release all memory used by the trace.  It is not necessary to
+     * call this function at program termination, since it is automatically
+     * called by the ShutdownRegistry class.
+     */
+    static void freeTrace();
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    PerformanceTrace() = delete;
+
+    /*!
+     * \brief Flag indicating whether recording is enabled.
+     */
+    static bool s_enabled;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_PerformanceTrace
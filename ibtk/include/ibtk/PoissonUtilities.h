@@ -27,6 +27,7 @@
 #include "PoissonSpecifications.h"
 #include "tbox/Pointer.h"
 
+#include <cstddef>
 #include <map>
 #include <vector>
 
@@ -38,6 +39,8 @@ template <int DIM>
 class Index;
 template <int DIM>
 class Patch;
+template <int DIM>
+class PatchLevel;
 } // namespace hier
 namespace pdat
 {
@@ -220,6 +223,32 @@ public:
         const SAMRAI::tbox::Array<SAMRAI::hier::BoundaryBox<NDIM> >& type1_cf_bdry,
         VCInterpType mu_interp_type = VC_HARMONIC_INTERP);
 
+    /*!
+     * Compute a hash of the coefficients of a Poisson-type operator and of the
+     * physical boundary condition objects on a single patch level.
+     *
+     * Constant coefficients are hashed by value and variable coefficients are
+     * hashed by the values stored in their patch data in the interiors of the
+     * patches.  If \a level is null, variable coefficients are only hashed by
+     * patch data index.  Boundary condition objects are hashed by address and,
+     * if \a level is not null, by the values of the coefficients \f$ a \f$
+     * and \f$ b \f$ on the physical boundary of the level at time \a
+     * data_time.  The result only depends on data that are local to this
+     * process.
+     */
+    static std::size_t
+    computeOperatorFingerprint(const SAMRAI::solv::PoissonSpecifications& poisson_spec,
+                               const std::vector<SAMRAI::solv::RobinBcCoefStrategy<NDIM>*>& bc_coefs,
+                               SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > level,
+                               double data_time = 0.0);
+
+    /*!
+     * Combine \a value into the hash \a seed in the same way as
+     * computeOperatorFingerprint(), so that subclasses of the level solvers can
+     * add their own parameters to the fingerprint.
+     */
+    static void hashCombine(std::size_t& seed, std::size_t value);
+
 protected:
 private:
     /*!
@@ -33,6 +33,7 @@
 
 #include "petscvec.h"
 
+#include <cstddef>
 #include <string>
 #include <vector>
 
@@ -158,6 +159,12 @@ protected:
                       SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x,
                       SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& b) override;
 
+    /*!
+     * \brief Compute a hash of the problem coefficients and boundary condition
+     * objects that determine the operator.
+     */
+    std::size_t computeOperatorFingerprint() override;
+
     /*!
      * \name PETSc objects.
      */
@@ -133,6 +133,18 @@ protected:
                       SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x,
                       SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& b) override;
 
+    /*!
+     * \brief Compute a hash of the problem coefficients, boundary condition
+     * objects, and viscosity interpolation type that determine the operator.
+     */
+    std::size_t computeOperatorFingerprint() override;
+
+    /*!
+     * \brief Rewrite the values of the operator matrix for the current problem
+     * coefficients.
+     */
+    bool refreshOperatorValues() override;
+
 private:
     /*!
      * \brief Default constructor.
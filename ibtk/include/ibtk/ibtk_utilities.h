@@ -20,6 +20,8 @@
 
 #include <ibtk/config.h>
 
+#include "ibtk/PerformanceTrace.h"
+
 #include "PatchHierarchy.h"
 #include "tbox/MathUtilities.h"
 #include "tbox/PIO.h"
@@ -33,6 +35,7 @@ IBTK_ENABLE_EXTRA_WARNINGS
 #include <algorithm>
 #include <array>
 #include <utility>
+#include <vector>
 
 /////////////////////////////// MACRO DEFINITIONS ////////////////////////////
 
@@ -104,11 +107,13 @@ static const bool ENABLE_TIMERS = true;
     do                                                                                                                 \
     {                                                                                                                  \
         if (IBTK::ENABLE_TIMERS) timer->start();                                                                       \
+        if (IBTK::PerformanceTrace::isEnabled()) IBTK::PerformanceTrace::beginPhase(timer->getName());                 \
     } while (0);
 
 #define IBTK_TIMER_STOP(timer)                                                                                         \
     do                                                                                                                 \
     {                                                                                                                  \
+        if (IBTK::PerformanceTrace::isEnabled()) IBTK::PerformanceTrace::endPhase(timer->getName());                   \
         if (IBTK::ENABLE_TIMERS) timer->stop();                                                                        \
     } while (0);
 
@@ -178,6 +183,26 @@ level_can_be_refined(int level_number, int max_levels)
     return level_number < finest_level_number;
 }
 
+/*!
+ * Compute the weights of the Lagrange polynomial that interpolates values given
+ * at the distinct times @p times, evaluated at time @p t. For a function f that
+ * is a polynomial of degree less than times.size(), the sum of weights[k] *
+ * f(times[k]) equals f(t) up to roundoff.
+ */
+inline std::vector<double>
+lagrange_interpolation_weights(const std::vector<double>& times, const double t)
+{
+    std::vector<double> weights(times.size(), 1.0);
+    for (unsigned int k = 0; k < times.size(); ++k)
+    {
+        for (unsigned int j = 0; j < times.size(); ++j)
+        {
+            if (j != k) weights[k] *= (t - times[j]) / (times[k] - times[j]);
+        }
+    }
+    return weights;
+} // lagrange_interpolation_weights
+
 /*!
  * Convert a Voigt notation index to the corresponding symmetric tensor index. This function only returns the upper
  * triangular index.
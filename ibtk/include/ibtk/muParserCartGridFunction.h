@@ -29,7 +29,11 @@
 
 #include "muParser.h"
 
+#include <array>
+#include <cstddef>
+#include <list>
 #include <map>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -57,6 +61,16 @@ namespace IBTK
  * class CartGridFunction that allows for the run-time specification of
  * (possibly spatially- and temporally-varying) functions which are used to set
  * double precision values on standard SAMRAI SAMRAI::hier::PatchData objects.
+ *
+ * The functions are evaluated with muParser's bulk mode: the coordinates of all
+ * of the data locations of a patch are collected into arrays, and each
+ * function is evaluated at all of them by a single call to the parser. If none
+ * of the functions depend on the time variable (\em t or \em T), the function
+ * is reported to be time-independent and the values computed on each patch
+ * geometry that is evaluated more than once are cached and reused by later
+ * calls to setDataOnPatch(). The size of the cache is bounded: when it is full, the values of the least recently
+ * used patch geometries (e.g., those of patches that were removed by
+ * regridding) are evicted.
  */
 class muParserCartGridFunction : public CartGridFunction
 {
@@ -98,6 +112,21 @@ public:
     //\}
 
 private:
+    /*!
+     * \brief Define the time and position variables used by a parser in terms
+     * of the present evaluation arrays.
+     */
+    void defineParserVariables(mu::Parser& parser);
+
+    /*!
+     * \brief Evaluate a function at all of the positions stored in the
+     * evaluation arrays.
+     *
+     * \return A pointer to the computed values, which remain valid until the
+     * next call to this function.
+     */
+    const double* evaluateFunction(int function_depth, double data_time);
+
     /*!
      * \brief Default constructor.
      *
@@ -149,10 +178,37 @@ private:
     std::vector<mu::Parser> d_parsers;
 
     /*!
-     * Time and position variables.
+     * Time and position arrays along with the array of computed values used to
+     * evaluate the functions at all of the data locations of a patch.
+     */
+    std::vector<double> d_parser_time;
+    std::array<std::vector<double>, NDIM> d_parser_posn;
+    std::vector<double> d_parser_vals;
+
+    /*!
+     * Whether any of the functions depend on time.
+     */
+    bool d_time_dependent = true;
+
+    /*!
+     * Values of time-independent functions, keyed by the data centering and
+     * depth and the patch geometry, along with the keys ordered from the most
+     * to the least recently used one and the total number of cached values.
+     */
+    struct CachedPatchValues
+    {
+        std::vector<double> vals;
+        std::list<std::vector<double> >::iterator lru_pos;
+    };
+    std::map<std::vector<double>, CachedPatchValues> d_cached_patch_vals;
+    std::list<std::vector<double> > d_cached_patch_keys;
+    std::size_t d_num_cached_patch_vals = 0;
+
+    /*!
+     * Keys of the patch geometries that have been evaluated once but whose
+     * values are not cached.
      */
-    double d_parser_time = 0.0;
-    Point d_parser_posn;
+    std::set<std::vector<double> > d_evaluated_patch_keys;
 };
 } // namespace IBTK
 
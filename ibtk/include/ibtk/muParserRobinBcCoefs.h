@@ -29,6 +29,9 @@
 
 #include "muParser.h"
 
+#include <array>
+#include <cstddef>
+#include <list>
 #include <map>
 #include <string>
 #include <vector>
@@ -76,6 +79,12 @@ namespace IBTK
  * `condition ? result_if_true : result_if_false`. For more exotic boundary
  * conditions, one would need to create an extension of the class `RobinBcCoefStrategy`.
  *
+ * The coefficients are evaluated with muParser's bulk mode at all of the
+ * locations of a boundary box at once. Coefficients on sides of the boundary
+ * whose functions do not depend on time are computed once per boundary box and
+ * are subsequently copied from a cache. When the cache is full, the values of
+ * the least recently used boundary boxes are evicted.
+ *
  * \warning Not all linear solvers in IBTK properly handle time-varying \em
  * homogeneous Robin boundary condition coefficients.  Note, however, that all
  * linear solvers in IBTK are presently designed to support spatially and
@@ -180,25 +189,56 @@ private:
     muParserRobinBcCoefs& operator=(const muParserRobinBcCoefs& that) = delete;
 
     /*!
-     * Current time value used by the mu::Parser instances.
+     * \brief Define the time and position variables used by a parser in terms
+     * of the present evaluation arrays.
+     */
+    void defineParserVariables(mu::Parser& parser) const;
+
+    /*!
+     * \brief Evaluate a coefficient function at all of the positions stored
+     * in the evaluation arrays.
+     */
+    void evaluateCoefficient(mu::Parser& parser, double* vals) const;
+
+    /*!
+     * Time and position arrays used by the mu::Parser instances to evaluate
+     * the coefficients at all of the locations of a boundary box with a single
+     * bulk evaluation.
      *
-     * This value is mutable since the mu::Parser objects each store a pointer
-     * to it but its specific value (the present time) changes during each
-     * call to muParserRobinBcCoefs::setBcCoefs. The alternative would be to
-     * rebuild the mu::Parser objects during each call to
+     * These values are mutable since the mu::Parser objects each store
+     * pointers to them but their specific values change during each call to
+     * muParserRobinBcCoefs::setBcCoefs. The alternative would be to rebuild
+     * the mu::Parser objects during each call to
      * muParserRobinBcCoefs::setBcCoefs, which is much more expensive. Since
-     * this variable is only written to and subsequently read from in that
+     * these variables are only written to and subsequently read from in that
      * function this is reasonable.
      */
-    mutable double d_parser_time = 0.0;
+    mutable std::vector<double> d_parser_time;
+    mutable std::array<std::vector<double>, NDIM> d_parser_posn;
 
     /*!
-     * Current space point used by the mu::Parser instances.
+     * Whether any of the coefficient functions on each side of the physical
+     * boundary depend on time.
+     */
+    std::array<bool, 2 * NDIM> d_time_dependent;
+
+    /*!
+     * Values of the time-independent coefficients, keyed by the location
+     * index and the extents of the boundary box, along with the keys ordered
+     * from the most to the least recently used one and the total number of
+     * cached values.
      *
-     * This value is mutable for the same reasons that
+     * These values are mutable for the same reasons that
      * muParserRobinBcCoefs::d_parser_time is mutable.
      */
-    mutable Point d_parser_posn;
+    struct CachedCoefValues
+    {
+        std::vector<double> vals;
+        std::list<std::vector<double> >::iterator lru_pos;
+    };
+    mutable std::map<std::vector<double>, CachedCoefValues> d_cached_coef_vals;
+    mutable std::list<std::vector<double> > d_cached_coef_keys;
+    mutable std::size_t d_num_cached_coef_vals = 0;
 
     /*!
      * The Cartesian grid geometry object provides the extents of the
@@ -221,10 +261,13 @@ private:
 
     /*!
      * The mu::Parser objects which evaluate the data-setting functions.
+     *
+     * These objects are mutable since bulk evaluation modifies their internal
+     * state.
      */
-    std::array<mu::Parser, 2 * NDIM> d_acoef_parsers;
-    std::array<mu::Parser, 2 * NDIM> d_bcoef_parsers;
-    std::array<mu::Parser, 2 * NDIM> d_gcoef_parsers;
+    mutable std::array<mu::Parser, 2 * NDIM> d_acoef_parsers;
+    mutable std::array<mu::Parser, 2 * NDIM> d_bcoef_parsers;
+    mutable std::array<mu::Parser, 2 * NDIM> d_gcoef_parsers;
 };
 } // namespace IBTK
 
@@ -147,7 +147,7 @@ IBTK_MPI::allGather(const T* x_in, int size_in, T* x_out, int size_out, IBTK_MPI
     allGatherSetup(size_in, size_out, rcounts, disps, communicator);
 
     MPI_Allgatherv(
-        x_in, size_in, mpi_type_id(x_in[0]), x_out, rcounts.data(), disps.data(), mpi_type_id(x_in[0]), communicator);
+        x_in, size_in, mpi_type_id(T()), x_out, rcounts.data(), disps.data(), mpi_type_id(T()), communicator);
 } // allGather
 
 template <typename T>
@@ -157,6 +157,68 @@ IBTK_MPI::allGather(T x_in, T* x_out, IBTK_MPI::comm communicator)
     MPI_Allgather(&x_in, 1, mpi_type_id(x_in), x_out, 1, mpi_type_id(x_in), communicator);
 } // allGather
 
+template <typename T>
+inline std::map<int, std::vector<T> >
+IBTK_MPI::sparseExchange(const std::map<int, std::vector<T> >& send_data, IBTK_MPI::comm communicator)
+{
+    const int tag = getSparseExchangeTag(communicator);
+    const MPI_Datatype type = mpi_type_id(T());
+
+    // Post synchronous sends: a send completes only once it has been matched
+    // by a receive.
+    std::vector<MPI_Request> send_requests;
+    send_requests.reserve(send_data.size());
+    for (const auto& message : send_data)
+    {
+        send_requests.push_back(MPI_REQUEST_NULL);
+        MPI_Issend(message.second.data(),
+                   static_cast<int>(message.second.size()),
+                   type,
+                   message.first,
+                   tag,
+                   communicator,
+                   &send_requests.back());
+    }
+
+    // Receive messages until all processors have had their sends matched,
+    // which is detected by a nonblocking barrier that each processor enters
+    // once its own sends have completed.
+    std::map<int, std::vector<T> > recv_data;
+    MPI_Request barrier_request = MPI_REQUEST_NULL;
+    bool in_barrier = false;
+    while (true)
+    {
+        int flag = 0;
+        MPI_Status status;
+        MPI_Iprobe(MPI_ANY_SOURCE, tag, communicator, &flag, &status);
+        if (flag)
+        {
+            int count = 0;
+            MPI_Get_count(&status, type, &count);
+            std::vector<T>& buffer = recv_data[status.MPI_SOURCE];
+            buffer.resize(count);
+            MPI_Recv(buffer.data(), count, type, status.MPI_SOURCE, tag, communicator, MPI_STATUS_IGNORE);
+        }
+        if (in_barrier)
+        {
+            int done = 0;
+            MPI_Test(&barrier_request, &done, MPI_STATUS_IGNORE);
+            if (done) break;
+        }
+        else
+        {
+            int sent = 0;
+            MPI_Testall(static_cast<int>(send_requests.size()), send_requests.data(), &sent, MPI_STATUSES_IGNORE);
+            if (sent)
+            {
+                MPI_Ibarrier(communicator, &barrier_request);
+                in_barrier = true;
+            }
+        }
+    }
+    return recv_data;
+} // sparseExchange
+
 //////////////////////////////////////  PRIVATE  ///////////////////////////////////////////////////
 template <typename T>
 inline void
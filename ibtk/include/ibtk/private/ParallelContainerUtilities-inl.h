@@ -0,0 +1,55 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDE GUARD ////////////////////////////////
+
+#ifndef included_IBTK_ParallelContainerUtilities_inl_h
+#define included_IBTK_ParallelContainerUtilities_inl_h
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <ibtk/config.h>
+
+#include <cstdint>
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+namespace internal
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+/*!
+ * Return the rank of the process that owns the specified key when a
+ * ParallelSet, ParallelMap, or ParallelEdgeMap is partitioned.  Multiplicative
+ * hashing spreads consecutive keys over all processes.
+ *
+ * \note This function is an implementation detail of the parallel containers
+ * and is not part of the public interface of IBTK.
+ */
+inline int
+get_owner(const int key, const int nodes)
+{
+    const std::uint32_t hash = static_cast<std::uint32_t>(key) * 2654435769u;
+    return static_cast<int>((static_cast<std::uint64_t>(hash) * static_cast<std::uint64_t>(nodes)) >> 32);
+} // get_owner
+
+//////////////////////////////////////////////////////////////////////////////
+
+} // namespace internal
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_ParallelContainerUtilities_inl_h
@@ -34,6 +34,8 @@
 
 #include <algorithm>
 #include <array>
+#include <cstddef>
+#include <list>
 #include <map>
 #include <ostream>
 #include <string>
@@ -60,7 +62,11 @@ namespace IBTK
 namespace
 {
 static const int EXTENSIONS_FILLABLE = 128;
-}
+
+// Upper bound on the total number of values of time-independent coefficients
+// that are cached.
+static const std::size_t MAX_NUM_CACHED_COEF_VALS = 1 << 20;
+} // namespace
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
@@ -185,6 +191,11 @@ muParserRobinBcCoefs::muParserRobinBcCoefs(const std::string& object_name,
         }
     }
 
+    // The evaluation arrays must be nonempty when the parser variables are
+    // defined.
+    d_parser_time.resize(1);
+    for (auto& posn : d_parser_posn) posn.resize(1);
+
     // Define the default and user-provided constants.
     std::vector<mu::Parser*> all_parsers(3 * 2 * NDIM);
     for (int d = 0; d < 2 * NDIM; ++d)
@@ -268,15 +279,32 @@ muParserRobinBcCoefs::muParserRobinBcCoefs(const std::string& object_name,
         }
 
         // Variables.
-        parser->DefineVar("T", &d_parser_time);
-        parser->DefineVar("t", &d_parser_time);
-        for (unsigned int d = 0; d < NDIM; ++d)
+        defineParserVariables(*parser);
+    }
+
+    // The coefficients on a side of the boundary are time-independent if none
+    // of the corresponding functions use the time variable.
+    for (int d = 0; d < 2 * NDIM; ++d)
+    {
+        d_time_dependent[d] = false;
+        for (int k = 0; k < 3; ++k)
         {
-            const std::string postfix = std::to_string(d);
-            parser->DefineVar("X" + postfix, d_parser_posn.data() + d);
-            parser->DefineVar("x" + postfix, d_parser_posn.data() + d);
-            parser->DefineVar("X_" + postfix, d_parser_posn.data() + d);
-            parser->DefineVar("x_" + postfix, d_parser_posn.data() + d);
+            try
+            {
+                const mu::varmap_type& used_vars = all_parsers[3 * d + k]->GetUsedVar();
+                d_time_dependent[d] = d_time_dependent[d] || used_vars.count("T") || used_vars.count("t");
+            }
+            catch (mu::ParserError& e)
+            {
+                TBOX_ERROR("muParserRobinBcCoefs::muParserRobinBcCoefs():\n"
+                           << "  error: " << e.GetMsg() << "\n"
+                           << "  in:    " << e.GetExpr() << "\n");
+            }
+            catch (...)
+            {
+                TBOX_ERROR("muParserRobinBcCoefs::muParserRobinBcCoefs():\n"
+                           << "  unrecognized exception generated by muParser library.\n");
+            }
         }
     }
     return;
@@ -310,42 +338,98 @@ muParserRobinBcCoefs::setBcCoefs(Pointer<ArrayData<NDIM, double> >& acoef_data,
     TBOX_ASSERT(!bcoef_data || bc_coef_box == bcoef_data->getBox());
     TBOX_ASSERT(!gcoef_data || bc_coef_box == gcoef_data->getBox());
 #endif
+    const int num_vals = bc_coef_box.size();
+    if (num_vals == 0) return;
+
+    // Time-independent coefficients depend only on the location of the
+    // boundary box, so they are computed once and are subsequently copied from
+    // the cache.
+    const bool time_dependent = d_time_dependent[location_index];
+    std::vector<double> cache_key;
+    const double* coef_vals = nullptr;
+    if (!time_dependent)
+    {
+        cache_key.push_back(static_cast<double>(location_index));
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            cache_key.push_back(static_cast<double>(bc_coef_box.lower(d) - patch_lower(d)));
+            cache_key.push_back(static_cast<double>(bc_coef_box.upper(d) - patch_lower(d)));
+            cache_key.push_back(x_lower[d]);
+            cache_key.push_back(dx[d]);
+        }
+        const auto it = d_cached_coef_vals.find(cache_key);
+        if (it != d_cached_coef_vals.end())
+        {
+            coef_vals = it->second.vals.data();
+            d_cached_coef_keys.splice(d_cached_coef_keys.begin(), d_cached_coef_keys, it->second.lru_pos);
+        }
+    }
 
-    const mu::Parser& acoef_parser = d_acoef_parsers[location_index];
-    const mu::Parser& bcoef_parser = d_bcoef_parsers[location_index];
-    const mu::Parser& gcoef_parser = d_gcoef_parsers[location_index];
-    d_parser_time = fill_time;
-    for (Box<NDIM>::Iterator b(bc_coef_box); b; b++)
+    // Evaluate the coefficients at all of the locations of the boundary box.
+    std::vector<double> new_coef_vals;
+    if (!coef_vals)
     {
-        const hier::Index<NDIM>& i = b();
         for (unsigned int d = 0; d < NDIM; ++d)
         {
-            if (d != bdry_normal_axis)
-            {
-                d_parser_posn[d] = x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
-            }
-            else
+            d_parser_posn[d].resize(num_vals);
+        }
+        d_parser_time.assign(num_vals, fill_time);
+        int k = 0;
+        for (Box<NDIM>::Iterator b(bc_coef_box); b; b++, ++k)
+        {
+            const hier::Index<NDIM>& i = b();
+            for (unsigned int d = 0; d < NDIM; ++d)
             {
-                d_parser_posn[d] = x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
+                if (d != bdry_normal_axis)
+                {
+                    d_parser_posn[d][k] = x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
+                }
+                else
+                {
+                    d_parser_posn[d][k] = x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
+                }
             }
         }
-        try
+        new_coef_vals.resize(3 * num_vals);
+        if (acoef_data || !time_dependent)
         {
-            if (acoef_data) (*acoef_data)(i, 0) = acoef_parser.Eval();
-            if (bcoef_data) (*bcoef_data)(i, 0) = bcoef_parser.Eval();
-            if (gcoef_data) (*gcoef_data)(i, 0) = gcoef_parser.Eval();
+            evaluateCoefficient(d_acoef_parsers[location_index], &new_coef_vals[0]);
         }
-        catch (mu::ParserError& e)
+        if (bcoef_data || !time_dependent)
         {
-            TBOX_ERROR("muParserRobinBcCoefs::setDataOnPatch():\n"
-                       << "  error: " << e.GetMsg() << "\n"
-                       << "  in:    " << e.GetExpr() << "\n");
+            evaluateCoefficient(d_bcoef_parsers[location_index], &new_coef_vals[num_vals]);
         }
-        catch (...)
+        if (gcoef_data || !time_dependent)
         {
-            TBOX_ERROR("muParserRobinBcCoefs::setDataOnPatch():\n"
-                       << "  unrecognized exception generated by muParser library.\n");
+            evaluateCoefficient(d_gcoef_parsers[location_index], &new_coef_vals[2 * num_vals]);
         }
+        coef_vals = new_coef_vals.data();
+    }
+
+    int k = 0;
+    for (Box<NDIM>::Iterator b(bc_coef_box); b; b++, ++k)
+    {
+        const hier::Index<NDIM>& i = b();
+        if (acoef_data) (*acoef_data)(i, 0) = coef_vals[k];
+        if (bcoef_data) (*bcoef_data)(i, 0) = coef_vals[num_vals + k];
+        if (gcoef_data) (*gcoef_data)(i, 0) = coef_vals[2 * num_vals + k];
+    }
+
+    // Cache the newly computed values of time-independent coefficients,
+    // evicting the values of the least recently used boundary boxes to make
+    // room for them.
+    if (!time_dependent && !new_coef_vals.empty() && new_coef_vals.size() <= MAX_NUM_CACHED_COEF_VALS)
+    {
+        while (d_num_cached_coef_vals + new_coef_vals.size() > MAX_NUM_CACHED_COEF_VALS)
+        {
+            const auto it = d_cached_coef_vals.find(d_cached_coef_keys.back());
+            d_num_cached_coef_vals -= it->second.vals.size();
+            d_cached_coef_vals.erase(it);
+            d_cached_coef_keys.pop_back();
+        }
+        d_num_cached_coef_vals += new_coef_vals.size();
+        d_cached_coef_keys.push_front(cache_key);
+        d_cached_coef_vals[cache_key] = { std::move(new_coef_vals), d_cached_coef_keys.begin() };
     }
     return;
 } // setBcCoefs
@@ -360,6 +444,48 @@ muParserRobinBcCoefs::numberOfExtensionsFillable() const
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void
+muParserRobinBcCoefs::defineParserVariables(mu::Parser& parser) const
+{
+    // muParser requires each variable in bulk mode to be an array with one
+    // entry per evaluation point.
+    parser.DefineVar("T", d_parser_time.data());
+    parser.DefineVar("t", d_parser_time.data());
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        const std::string postfix = std::to_string(d);
+        parser.DefineVar("X" + postfix, d_parser_posn[d].data());
+        parser.DefineVar("x" + postfix, d_parser_posn[d].data());
+        parser.DefineVar("X_" + postfix, d_parser_posn[d].data());
+        parser.DefineVar("x_" + postfix, d_parser_posn[d].data());
+    }
+    return;
+} // defineParserVariables
+
+void
+muParserRobinBcCoefs::evaluateCoefficient(mu::Parser& parser, double* const vals) const
+{
+    try
+    {
+        // The evaluation arrays may have been reallocated since the variables
+        // were last defined.
+        defineParserVariables(parser);
+        parser.Eval(vals, static_cast<int>(d_parser_time.size()));
+    }
+    catch (mu::ParserError& e)
+    {
+        TBOX_ERROR("muParserRobinBcCoefs::setDataOnPatch():\n"
+                   << "  error: " << e.GetMsg() << "\n"
+                   << "  in:    " << e.GetExpr() << "\n");
+    }
+    catch (...)
+    {
+        TBOX_ERROR("muParserRobinBcCoefs::setDataOnPatch():\n"
+                   << "  unrecognized exception generated by muParser library.\n");
+    }
+    return;
+} // evaluateCoefficient
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBTK
@@ -34,6 +34,7 @@
 #include <mpi.h>
 
 #include <algorithm>
+#include <cstddef>
 #include <cstdio>
 #include <map>
 #include <memory>
@@ -58,9 +59,10 @@ namespace IBTK
 
 namespace
 {
-// The rank of the root MPI process and the MPI tag number.
+// The rank of the root MPI process and the MPI tag numbers.
 static const int SILO_MPI_ROOT = 0;
 static const int SILO_MPI_TAG = 0;
+static const int SILO_MPI_BATON_TAG = 1;
 
 // The name of the Silo dumps and database filenames.
 static const int SILO_NAME_BUFSIZE = 128;
@@ -70,11 +72,49 @@ static const std::string SILO_SUMMARY_FILE_PREFIX = "lag_data.cycle_";
 static const std::string SILO_SUMMARY_FILE_POSTFIX = ".summary.silo";
 static const std::string SILO_PROCESSOR_FILE_PREFIX = "lag_data.proc_";
 static const std::string SILO_PROCESSOR_FILE_POSTFIX = ".silo";
+static const std::string SILO_GROUP_FILE_PREFIX = "lag_data.group_";
+static const std::string SILO_PROCESSOR_DIR_PREFIX = "proc_";
 
 // Version of LSiloDataWriter restart file data.
 static const int LAG_SILO_DATA_WRITER_VERSION = 1;
 
 #if defined(IBTK_HAVE_SILO)
+/*!
+ * \brief Get the number of the file to which the specified MPI process writes
+ * its local data when the processes are divided into contiguous groups, one
+ * per file.
+ */
+inline int
+get_file_number(const int mpi_rank, const int mpi_nodes, const int num_files)
+{
+    return static_cast<int>((static_cast<long>(mpi_rank) * static_cast<long>(num_files)) / mpi_nodes);
+} // get_file_number
+
+/*!
+ * \brief Get the prefix of the paths of the local data written by the
+ * specified MPI process, i.e., the file name and, when several processes write
+ * to the same file, the process's directory within the file.
+ */
+std::string
+get_local_data_prefix(const int mpi_rank, const int mpi_nodes, const int num_files)
+{
+    char temp_buf[SILO_NAME_BUFSIZE];
+    std::string prefix;
+    if (num_files < mpi_nodes)
+    {
+        std::snprintf(temp_buf, sizeof(temp_buf), "%04d", get_file_number(mpi_rank, mpi_nodes, num_files));
+        prefix = SILO_GROUP_FILE_PREFIX + temp_buf + SILO_PROCESSOR_FILE_POSTFIX + ":";
+        std::snprintf(temp_buf, sizeof(temp_buf), "%04d", mpi_rank);
+        prefix += SILO_PROCESSOR_DIR_PREFIX + temp_buf + "/";
+    }
+    else
+    {
+        std::snprintf(temp_buf, sizeof(temp_buf), "%04d", mpi_rank);
+        prefix = SILO_PROCESSOR_FILE_PREFIX + temp_buf + SILO_PROCESSOR_FILE_POSTFIX + ":";
+    }
+    return prefix;
+} // get_local_data_prefix
+
 /*!
  * \brief Build a local mesh database entry corresponding to a cloud of marker
  * points.
@@ -638,7 +678,8 @@ LSiloDataWriter::LSiloDataWriter(std::string object_name, std::string dump_direc
       d_build_vec_scatters(d_finest_ln + 1),
       d_src_vec(d_finest_ln + 1),
       d_dst_vec(d_finest_ln + 1),
-      d_vec_scatter(d_finest_ln + 1)
+      d_vec_scatter(d_finest_ln + 1),
+      d_local_vecs(d_finest_ln + 1)
 {
 #if defined(IBTK_HAVE_SILO)
 // intentionally blank
@@ -670,6 +711,7 @@ LSiloDataWriter::~LSiloDataWriter()
     int ierr;
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
+        destroyLocalVecs(ln);
         for (auto& vec : d_dst_vec[ln])
         {
             Vec& v = vec.second;
@@ -718,6 +760,7 @@ LSiloDataWriter::resetLevels(const int coarsest_ln, const int finest_ln)
     int ierr;
     for (int ln = std::max(d_coarsest_ln, 0); (ln <= d_finest_ln) && (ln < coarsest_ln); ++ln)
     {
+        destroyLocalVecs(ln);
         for (auto& vec : d_dst_vec[ln])
         {
             Vec& v = vec.second;
@@ -740,6 +783,7 @@ LSiloDataWriter::resetLevels(const int coarsest_ln, const int finest_ln)
 
     for (int ln = finest_ln + 1; ln <= d_finest_ln; ++ln)
     {
+        destroyLocalVecs(ln);
         for (auto& vec : d_dst_vec[ln])
         {
             Vec& v = vec.second;
@@ -801,6 +845,7 @@ LSiloDataWriter::resetLevels(const int coarsest_ln, const int finest_ln)
     d_src_vec.resize(d_finest_ln + 1);
     d_dst_vec.resize(d_finest_ln + 1);
     d_vec_scatter.resize(d_finest_ln + 1);
+    d_local_vecs.resize(d_finest_ln + 1);
     return;
 } // resetLevels
 
@@ -1168,6 +1213,13 @@ LSiloDataWriter::registerLagrangianAO(std::vector<AO>& ao, const int coarsest_ln
     return;
 } // registerLagrangianAO
 
+void
+LSiloDataWriter::setNumberOfOutputFiles(const int num_files)
+{
+    d_num_output_files = num_files;
+    return;
+} // setNumberOfOutputFiles
+
 void
 LSiloDataWriter::writePlotData(const int time_step_number, const double simulation_time)
 {
@@ -1217,16 +1269,55 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
 
     Utilities::recursiveMkdir(dump_dirname);
 
-    // Create one local DBfile per MPI process.
-    std::snprintf(temp_buf, sizeof(temp_buf), "%04d", mpi_rank);
-    current_file_name = dump_dirname + "/" + SILO_PROCESSOR_FILE_PREFIX;
+    // Create the local DBfile.  By default, each MPI process writes its own
+    // file.  Otherwise, the processes are divided into contiguous groups, one
+    // per file, and the processes in each group write their data to separate
+    // directories of the group's file one after another, passing a baton to
+    // the next process in the group when they are done.
+    const int num_files = d_num_output_files > 0 ? std::min(d_num_output_files, mpi_nodes) : mpi_nodes;
+    const bool aggregate_files = num_files < mpi_nodes;
+    const int file_number = get_file_number(mpi_rank, mpi_nodes, num_files);
+    const bool first_in_group = mpi_rank == 0 || get_file_number(mpi_rank - 1, mpi_nodes, num_files) != file_number;
+    const bool last_in_group =
+        mpi_rank == mpi_nodes - 1 || get_file_number(mpi_rank + 1, mpi_nodes, num_files) != file_number;
+    int baton = 0, baton_size = 1;
+    if (!first_in_group)
+    {
+        IBTK_MPI::recv(&baton, baton_size, mpi_rank - 1, false, SILO_MPI_BATON_TAG);
+    }
+
+    std::snprintf(temp_buf, sizeof(temp_buf), "%04d", aggregate_files ? file_number : mpi_rank);
+    current_file_name = dump_dirname + "/" + (aggregate_files ? SILO_GROUP_FILE_PREFIX : SILO_PROCESSOR_FILE_PREFIX);
     current_file_name += temp_buf;
     current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
 
-    if (!(dbfile = DBCreate(current_file_name.c_str(), DB_CLOBBER, DB_LOCAL, nullptr, DB_PDB)))
+    if (first_in_group)
     {
-        TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                 << "  Could not create DBfile named " << current_file_name << std::endl);
+        if (!(dbfile = DBCreate(current_file_name.c_str(), DB_CLOBBER, DB_LOCAL, nullptr, DB_PDB)))
+        {
+            TBOX_ERROR(d_object_name << "::writePlotData()\n"
+                                     << "  Could not create DBfile named " << current_file_name << std::endl);
+        }
+    }
+    else
+    {
+        if (!(dbfile = DBOpen(current_file_name.c_str(), DB_PDB, DB_APPEND)))
+        {
+            TBOX_ERROR(d_object_name << "::writePlotData()\n"
+                                     << "  Could not open DBfile named " << current_file_name << std::endl);
+        }
+    }
+
+    std::string proc_dirname;
+    if (aggregate_files)
+    {
+        std::snprintf(temp_buf, sizeof(temp_buf), "%04d", mpi_rank);
+        proc_dirname = SILO_PROCESSOR_DIR_PREFIX + temp_buf;
+        if (DBMkDir(dbfile, proc_dirname.c_str()) == -1 || DBSetDir(dbfile, proc_dirname.c_str()) == -1)
+        {
+            TBOX_ERROR(d_object_name << "::writePlotData()\n"
+                                     << "  Could not create directory named " << proc_dirname << std::endl);
+        }
     }
 
     std::vector<std::vector<int> > meshtype(d_finest_ln + 1), vartype(d_finest_ln + 1);
@@ -1237,10 +1328,20 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
     {
         if (d_coords_data[ln])
         {
-            // Scatter the data from "global" to "local" form.
-            Vec local_X_vec;
-            ierr = VecDuplicate(d_dst_vec[ln][NDIM], &local_X_vec);
-            IBTK_CHKERRQ(ierr);
+            // Scatter the data from "global" to "local" form.  The local Vecs
+            // are created only as needed and are reused until the VecScatters
+            // are rebuilt.
+            std::vector<Vec>& local_vecs = d_local_vecs[ln];
+            if (local_vecs.size() < static_cast<std::size_t>(d_nvars[ln] + 1))
+            {
+                local_vecs.resize(d_nvars[ln] + 1, nullptr);
+            }
+            if (!local_vecs[0])
+            {
+                ierr = VecDuplicate(d_dst_vec[ln][NDIM], &local_vecs[0]);
+                IBTK_CHKERRQ(ierr);
+            }
+            Vec local_X_vec = local_vecs[0];
 
             Vec global_X_vec = d_coords_data[ln]->getVec();
             ierr = VecScatterBegin(d_vec_scatter[ln][NDIM], global_X_vec, local_X_vec, INSERT_VALUES, SCATTER_FORWARD);
@@ -1258,9 +1359,12 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
             for (int v = 0; v < d_nvars[ln]; ++v)
             {
                 const int var_depth = d_var_depths[ln][v];
-                Vec local_v_vec;
-                ierr = VecDuplicate(d_dst_vec[ln][var_depth], &local_v_vec);
-                IBTK_CHKERRQ(ierr);
+                if (!local_vecs[v + 1])
+                {
+                    ierr = VecDuplicate(d_dst_vec[ln][var_depth], &local_vecs[v + 1]);
+                    IBTK_CHKERRQ(ierr);
+                }
+                Vec local_v_vec = local_vecs[v + 1];
 
                 Vec global_v_vec = d_var_data[ln][v]->getVec();
                 ierr = VecScatterBegin(
@@ -1444,22 +1548,28 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
                 offset += ntot;
             }
 
-            // Clean up allocated data.
+            // Restore the local data.
             ierr = VecRestoreArray(local_X_vec, &local_X_arr);
             IBTK_CHKERRQ(ierr);
-            ierr = VecDestroy(&local_X_vec);
-            IBTK_CHKERRQ(ierr);
             for (int v = 0; v < d_nvars[ln]; ++v)
             {
                 ierr = VecRestoreArray(local_v_vecs[v], &local_v_arrs[v]);
                 IBTK_CHKERRQ(ierr);
-                ierr = VecDestroy(&local_v_vecs[v]);
-                IBTK_CHKERRQ(ierr);
             }
         }
     }
 
+    if (aggregate_files && DBSetDir(dbfile, "..") == -1)
+    {
+        TBOX_ERROR(d_object_name << "::writePlotData()\n"
+                                 << "  Could not return to the base directory from subdirectory " << proc_dirname
+                                 << std::endl);
+    }
     DBClose(dbfile);
+    if (!last_in_group)
+    {
+        IBTK_MPI::send(&baton, baton_size, mpi_rank + 1, false, SILO_MPI_BATON_TAG);
+    }
 
     // Send data to the root MPI process required to create the multimesh and
     // multivar objects.
@@ -1731,16 +1841,12 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
 
         for (int proc = 0; proc < mpi_nodes; ++proc)
         {
+            const std::string local_data_prefix = get_local_data_prefix(proc, mpi_nodes, num_files);
             for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
             {
                 for (int cloud = 0; cloud < nclouds_per_proc[ln][proc]; ++cloud)
                 {
-                    std::snprintf(temp_buf, sizeof(temp_buf), "%04d", proc);
-                    current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                    current_file_name += temp_buf;
-                    current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
-                    std::string meshname = current_file_name + ":level_" + std::to_string(ln) + "_cloud_" +
+                    std::string meshname = local_data_prefix + "level_" + std::to_string(ln) + "_cloud_" +
                                            std::to_string(cloud) + "/mesh";
                     auto meshname_ptr = const_cast<char*>(meshname.c_str());
                     int meshtype = DB_POINTMESH;
@@ -1758,12 +1864,7 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
 
                 for (int block = 0; block < nblocks_per_proc[ln][proc]; ++block)
                 {
-                    std::snprintf(temp_buf, sizeof(temp_buf), "%04d", proc);
-                    current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                    current_file_name += temp_buf;
-                    current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
-                    std::string meshname = current_file_name + ":level_" + std::to_string(ln) + "_block_" +
+                    std::string meshname = local_data_prefix + "level_" + std::to_string(ln) + "_block_" +
                                            std::to_string(block) + "/mesh";
                     auto meshname_ptr = const_cast<char*>(meshname.c_str());
                     int meshtype = meshtypes_per_proc[ln][proc][block];
@@ -1781,16 +1882,11 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
 
                 for (int mb = 0; mb < nmbs_per_proc[ln][proc]; ++mb)
                 {
-                    std::snprintf(temp_buf, sizeof(temp_buf), "%04d", proc);
-                    current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                    current_file_name += temp_buf;
-                    current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
                     const int nblocks = mb_nblocks_per_proc[ln][proc][mb];
                     std::vector<std::string> meshnames;
                     for (int block = 0; block < nblocks; ++block)
                     {
-                        meshnames.push_back(current_file_name + ":level_" + std::to_string(ln) + "_mb_" +
+                        meshnames.push_back(local_data_prefix + "level_" + std::to_string(ln) + "_mb_" +
                                             std::to_string(mb) + "_block_" + std::to_string(block) + "/mesh");
                     }
                     std::vector<const char*> meshnames_ptrs;
@@ -1817,13 +1913,8 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
 
                 for (int mesh = 0; mesh < nucd_meshes_per_proc[ln][proc]; ++mesh)
                 {
-                    std::snprintf(temp_buf, sizeof(temp_buf), "%04d", proc);
-                    current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                    current_file_name += temp_buf;
-                    current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
                     std::string meshname =
-                        current_file_name + ":level_" + std::to_string(ln) + "_mesh_" + std::to_string(mesh) + "/mesh";
+                        local_data_prefix + "level_" + std::to_string(ln) + "_mesh_" + std::to_string(mesh) + "/mesh";
                     auto meshname_ptr = const_cast<char*>(meshname.c_str());
                     int meshtype = DB_UCDMESH;
 
@@ -1842,12 +1933,7 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
                 {
                     for (int cloud = 0; cloud < nclouds_per_proc[ln][proc]; ++cloud)
                     {
-                        std::snprintf(temp_buf, sizeof(temp_buf), "%04d", proc);
-                        current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                        current_file_name += temp_buf;
-                        current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
-                        std::string varname = current_file_name + ":level_" + std::to_string(ln) + "_cloud_" +
+                        std::string varname = local_data_prefix + "level_" + std::to_string(ln) + "_cloud_" +
                                               std::to_string(cloud) + "/" + d_var_names[ln][v];
                         auto varname_ptr = const_cast<char*>(varname.c_str());
                         int vartype = DB_POINTVAR;
@@ -1861,12 +1947,7 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
 
                     for (int block = 0; block < nblocks_per_proc[ln][proc]; ++block)
                     {
-                        std::snprintf(temp_buf, sizeof(temp_buf), "%04d", proc);
-                        current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                        current_file_name += temp_buf;
-                        current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
-                        std::string varname = current_file_name + ":level_" + std::to_string(ln) + "_block_" +
+                        std::string varname = local_data_prefix + "level_" + std::to_string(ln) + "_block_" +
                                               std::to_string(block) + "/" + d_var_names[ln][v];
                         auto varname_ptr = const_cast<char*>(varname.c_str());
                         int vartype = vartypes_per_proc[ln][proc][block];
@@ -1880,17 +1961,12 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
 
                     for (int mb = 0; mb < nmbs_per_proc[ln][proc]; ++mb)
                     {
-                        std::snprintf(temp_buf, sizeof(temp_buf), "%04d", proc);
-                        current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                        current_file_name += temp_buf;
-                        current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
                         const int nblocks = mb_nblocks_per_proc[ln][proc][mb];
 
                         std::vector<std::string> varnames;
                         for (int block = 0; block < nblocks; ++block)
                         {
-                            varnames.push_back(current_file_name + ":level_" + std::to_string(ln) + "_mb_" +
+                            varnames.push_back(local_data_prefix + "level_" + std::to_string(ln) + "_mb_" +
                                                std::to_string(mb) + "_block_" + std::to_string(block) +
                                                d_var_names[ln][v]);
                         }
@@ -1914,12 +1990,7 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
 
                     for (int mesh = 0; mesh < nucd_meshes_per_proc[ln][proc]; ++mesh)
                     {
-                        std::snprintf(temp_buf, sizeof(temp_buf), "%04d", proc);
-                        current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                        current_file_name += temp_buf;
-                        current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
-                        std::string varname = current_file_name + ":level_" + std::to_string(ln) + "_mesh_" +
+                        std::string varname = local_data_prefix + "level_" + std::to_string(ln) + "_mesh_" +
                                               std::to_string(mesh) + "/" + d_var_names[ln][v];
                         auto varname_ptr = const_cast<char*>(varname.c_str());
                         int vartype = DB_UCDVAR;
@@ -2112,6 +2183,9 @@ LSiloDataWriter::putToDatabase(Pointer<Database> db)
 void
 LSiloDataWriter::buildVecScatters(AO& ao, const int level_number)
 {
+    // The local Vecs must be recreated to match the new VecScatters.
+    destroyLocalVecs(level_number);
+
     if (!d_coords_data[level_number]) return;
 
     int ierr;
@@ -2231,6 +2305,22 @@ LSiloDataWriter::buildVecScatters(AO& ao, const int level_number)
     return;
 } // buildVecScatters
 
+void
+LSiloDataWriter::destroyLocalVecs(const int level_number)
+{
+    int ierr;
+    for (auto& v : d_local_vecs[level_number])
+    {
+        if (v)
+        {
+            ierr = VecDestroy(&v);
+            IBTK_CHKERRQ(ierr);
+        }
+    }
+    d_local_vecs[level_number].clear();
+    return;
+} // destroyLocalVecs
+
 void
 LSiloDataWriter::getFromRestart()
 {
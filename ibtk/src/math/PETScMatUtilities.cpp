@@ -56,7 +56,9 @@
 #include "petscvec.h"
 #include <petsclog.h>
 
+#include <algorithm>
 #include <array>
+#include <cstddef>
 #include <iterator>
 #include <limits>
 #include <memory>
@@ -116,6 +118,235 @@ static const std::string LINEAR = "LINEAR";
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
+void
+PETScMatUtilities::MatValuesPlan::clear()
+{
+    d_mat = nullptr;
+    d_diag_nnz = 0;
+    d_offsets.clear();
+    return;
+} // clear
+
+bool
+PETScMatUtilities::MatValuesPlan::isInitialized(Mat mat) const
+{
+    return mat && d_mat == mat;
+} // isInitialized
+
+void
+PETScMatUtilities::beginMatValuesRefresh(Mat mat, MatValuesPlan& plan)
+{
+    int ierr;
+
+    // Get the local blocks of the matrix.
+    PetscBool is_mpiaij = PETSC_FALSE, is_seqaij = PETSC_FALSE;
+    ierr = PetscObjectTypeCompare(reinterpret_cast<PetscObject>(mat), MATMPIAIJ, &is_mpiaij);
+    IBTK_CHKERRQ(ierr);
+    ierr = PetscObjectTypeCompare(reinterpret_cast<PetscObject>(mat), MATSEQAIJ, &is_seqaij);
+    IBTK_CHKERRQ(ierr);
+    if (is_mpiaij)
+    {
+        ierr = MatMPIAIJGetSeqAIJ(mat, &plan.d_diag_mat, &plan.d_offdiag_mat, &plan.d_colmap);
+        IBTK_CHKERRQ(ierr);
+    }
+    else if (is_seqaij)
+    {
+        plan.d_diag_mat = mat;
+        plan.d_offdiag_mat = nullptr;
+        plan.d_colmap = nullptr;
+    }
+    else
+    {
+        TBOX_ERROR("PETScMatUtilities::beginMatValuesRefresh():\n"
+                   << "  only AIJ matrices are supported" << std::endl);
+    }
+    ierr = MatGetOwnershipRange(mat, &plan.d_row_start, &plan.d_row_end);
+    IBTK_CHKERRQ(ierr);
+    ierr = MatGetOwnershipRangeColumn(mat, &plan.d_col_start, &plan.d_col_end);
+    IBTK_CHKERRQ(ierr);
+
+    // The CSR structure of the matrix is only needed to build the plan.
+    plan.d_building = !plan.isInitialized(mat);
+    if (plan.d_building)
+    {
+        plan.d_mat = mat;
+        plan.d_offsets.clear();
+        PetscInt n_rows;
+        PetscBool done;
+        ierr = MatGetRowIJ(
+            plan.d_diag_mat, 0, PETSC_FALSE, PETSC_FALSE, &n_rows, &plan.d_diag_ia, &plan.d_diag_ja, &done);
+        IBTK_CHKERRQ(ierr);
+        if (!done)
+        {
+            TBOX_ERROR("PETScMatUtilities::beginMatValuesRefresh():\n"
+                       << "  unable to access the nonzero structure of the matrix" << std::endl);
+        }
+        plan.d_diag_nnz = plan.d_diag_ia[n_rows];
+        if (plan.d_offdiag_mat)
+        {
+            ierr = MatGetRowIJ(plan.d_offdiag_mat,
+                               0,
+                               PETSC_FALSE,
+                               PETSC_FALSE,
+                               &n_rows,
+                               &plan.d_offdiag_ia,
+                               &plan.d_offdiag_ja,
+                               &done);
+            IBTK_CHKERRQ(ierr);
+            if (!done)
+            {
+                TBOX_ERROR("PETScMatUtilities::beginMatValuesRefresh():\n"
+                           << "  unable to access the nonzero structure of the matrix" << std::endl);
+            }
+            ierr = MatGetSize(plan.d_offdiag_mat, nullptr, &plan.d_num_offdiag_cols);
+            IBTK_CHKERRQ(ierr);
+        }
+    }
+
+    // Get the CSR value arrays.
+    ierr = MatSeqAIJGetArray(plan.d_diag_mat, &plan.d_diag_vals);
+    IBTK_CHKERRQ(ierr);
+    if (plan.d_offdiag_mat)
+    {
+        ierr = MatSeqAIJGetArray(plan.d_offdiag_mat, &plan.d_offdiag_vals);
+        IBTK_CHKERRQ(ierr);
+    }
+    plan.d_pos = 0;
+    return;
+} // beginMatValuesRefresh
+
+void
+PETScMatUtilities::setMatRowValues(Mat mat,
+                                   MatValuesPlan* plan,
+                                   const int row,
+                                   const int ncols,
+                                   const int* const cols,
+                                   const double* const vals)
+{
+    if (!plan)
+    {
+        int ierr = MatSetValues(mat, 1, &row, ncols, cols, vals, INSERT_VALUES);
+        IBTK_CHKERRQ(ierr);
+        return;
+    }
+
+#if !defined(NDEBUG)
+    TBOX_ASSERT(plan->d_mat == mat);
+    TBOX_ASSERT(plan->d_row_start <= row && row < plan->d_row_end);
+#endif
+    const PetscInt local_row = row - plan->d_row_start;
+    for (int k = 0; k < ncols; ++k)
+    {
+        const PetscInt col = cols[k];
+        if (col < 0) continue;
+
+        // Locate the entry in the CSR arrays when building the plan.  Column
+        // indices are sorted within each row, and the off-diagonal block uses
+        // compressed column indices with a sorted column map.
+        if (plan->d_building)
+        {
+            PetscInt offset = -1;
+            if (plan->d_col_start <= col && col < plan->d_col_end)
+            {
+                const PetscInt* const row_begin = plan->d_diag_ja + plan->d_diag_ia[local_row];
+                const PetscInt* const row_end = plan->d_diag_ja + plan->d_diag_ia[local_row + 1];
+                const PetscInt* const it = std::lower_bound(row_begin, row_end, col - plan->d_col_start);
+                if (it != row_end && *it == col - plan->d_col_start) offset = it - plan->d_diag_ja;
+            }
+            else if (plan->d_offdiag_mat)
+            {
+                const PetscInt* const colmap_end = plan->d_colmap + plan->d_num_offdiag_cols;
+                const PetscInt* const cm = std::lower_bound(plan->d_colmap, colmap_end, col);
+                if (cm != colmap_end && *cm == col)
+                {
+                    const PetscInt local_col = cm - plan->d_colmap;
+                    const PetscInt* const row_begin = plan->d_offdiag_ja + plan->d_offdiag_ia[local_row];
+                    const PetscInt* const row_end = plan->d_offdiag_ja + plan->d_offdiag_ia[local_row + 1];
+                    const PetscInt* const it = std::lower_bound(row_begin, row_end, local_col);
+                    if (it != row_end && *it == local_col) offset = plan->d_diag_nnz + (it - plan->d_offdiag_ja);
+                }
+            }
+            if (offset < 0)
+            {
+                TBOX_ERROR("PETScMatUtilities::setMatRowValues():\n"
+                           << "  entry (" << row << ", " << col
+                           << ") is not part of the nonzero structure of the matrix" << std::endl);
+            }
+            plan->d_offsets.push_back(offset);
+        }
+
+        // Write the value directly into the CSR arrays.
+#if !defined(NDEBUG)
+        TBOX_ASSERT(plan->d_pos < plan->d_offsets.size());
+#endif
+        const PetscInt offset = plan->d_offsets[plan->d_pos++];
+        if (offset < plan->d_diag_nnz)
+        {
+            plan->d_diag_vals[offset] = vals[k];
+        }
+        else
+        {
+            plan->d_offdiag_vals[offset - plan->d_diag_nnz] = vals[k];
+        }
+    }
+    return;
+} // setMatRowValues
+
+void
+PETScMatUtilities::endMatValuesRefresh(Mat mat, MatValuesPlan& plan)
+{
+    int ierr;
+    if (plan.d_pos != plan.d_offsets.size())
+    {
+        TBOX_ERROR("PETScMatUtilities::endMatValuesRefresh():\n"
+                   << "  number of values set does not match the number of values in the plan" << std::endl);
+    }
+
+    // Restore the CSR arrays.
+    ierr = MatSeqAIJRestoreArray(plan.d_diag_mat, &plan.d_diag_vals);
+    IBTK_CHKERRQ(ierr);
+    if (plan.d_offdiag_mat)
+    {
+        ierr = MatSeqAIJRestoreArray(plan.d_offdiag_mat, &plan.d_offdiag_vals);
+        IBTK_CHKERRQ(ierr);
+    }
+    if (plan.d_building)
+    {
+        PetscInt n_rows;
+        PetscBool done;
+        ierr = MatRestoreRowIJ(
+            plan.d_diag_mat, 0, PETSC_FALSE, PETSC_FALSE, &n_rows, &plan.d_diag_ia, &plan.d_diag_ja, &done);
+        IBTK_CHKERRQ(ierr);
+        if (plan.d_offdiag_mat)
+        {
+            ierr = MatRestoreRowIJ(plan.d_offdiag_mat,
+                                   0,
+                                   PETSC_FALSE,
+                                   PETSC_FALSE,
+                                   &n_rows,
+                                   &plan.d_offdiag_ia,
+                                   &plan.d_offdiag_ja,
+                                   &done);
+            IBTK_CHKERRQ(ierr);
+        }
+    }
+
+    // Indicate that the matrix values have changed so that preconditioners
+    // built from the matrix are set up again.
+    ierr = PetscObjectStateIncrease(reinterpret_cast<PetscObject>(mat));
+    IBTK_CHKERRQ(ierr);
+
+    plan.d_building = false;
+    plan.d_diag_mat = nullptr;
+    plan.d_offdiag_mat = nullptr;
+    plan.d_diag_ia = nullptr;
+    plan.d_diag_ja = nullptr;
+    plan.d_offdiag_ia = nullptr;
+    plan.d_offdiag_ja = nullptr;
+    plan.d_colmap = nullptr;
+    return;
+} // endMatValuesRefresh
+
 void
 PETScMatUtilities::constructPatchLevelCCLaplaceOp(Mat& mat,
                                                   const PoissonSpecifications& poisson_spec,
@@ -231,49 +462,9 @@ PETScMatUtilities::constructPatchLevelCCLaplaceOp(Mat& mat,
     ierr = MatSetBlockSize(mat, depth);
     IBTK_CHKERRQ(ierr);
 
-    // Set the matrix coefficients to correspond to the standard finite
-    // difference approximation to the Laplacian.
-    for (PatchLevel<NDIM>::Iterator p(patch_level); p; p++)
-    {
-        Pointer<Patch<NDIM> > patch = patch_level->getPatch(p());
-        const Box<NDIM>& patch_box = patch->getBox();
-
-        // Compute matrix coefficients.
-        const IntVector<NDIM> no_ghosts(0);
-        CellData<NDIM, double> matrix_coefs(patch_box, stencil_sz * depth, no_ghosts);
-        PoissonUtilities::computeMatrixCoefficients(matrix_coefs, patch, stencil, poisson_spec, bc_coefs, data_time);
-
-        // Copy matrix entries to the PETSc matrix structure.
-        Pointer<CellData<NDIM, int> > dof_index_data = patch->getPatchData(dof_index_idx);
-        std::vector<double> mat_vals(stencil_sz);
-        std::vector<int> mat_cols(stencil_sz);
-        for (Box<NDIM>::Iterator b(CellGeometry<NDIM>::toCellBox(patch_box)); b; b++)
-        {
-            const CellIndex<NDIM>& i = b();
-            for (int d = 0; d < depth; ++d)
-            {
-                const int dof_index = (*dof_index_data)(i, d);
-                if (i_lower <= dof_index && dof_index < i_upper)
-                {
-                    // Notice that the order in which values are set corresponds
-                    // to that of the stencil defined above.
-                    const int offset = d * stencil_sz;
-                    mat_vals[0] = matrix_coefs(i, offset);
-                    mat_cols[0] = dof_index;
-                    for (unsigned int axis = 0, stencil_index = 1; axis < NDIM; ++axis)
-                    {
-                        for (int side = 0; side <= 1; ++side, ++stencil_index)
-                        {
-                            mat_vals[stencil_index] = matrix_coefs(i, offset + stencil_index);
-                            mat_cols[stencil_index] = (*dof_index_data)(i + stencil[stencil_index], d);
-                        }
-                    }
-                    ierr = MatSetValues(mat, 1, &dof_index, stencil_sz, &mat_cols[0], &mat_vals[0], INSERT_VALUES);
-                    IBTK_CHKERRQ(ierr);
-                }
-            }
-        }
-    }
+    // Set the matrix coefficients.
+    setPatchLevelCCLaplaceOpValues(
+        mat, nullptr, poisson_spec, bc_coefs, data_time, num_dofs_per_proc, dof_index_idx, patch_level);
 
     // Assemble the matrix.
     ierr = MatAssemblyBegin(mat, MAT_FINAL_ASSEMBLY);
@@ -283,6 +474,26 @@ PETScMatUtilities::constructPatchLevelCCLaplaceOp(Mat& mat,
     return;
 } // constructPatchLevelCCLaplaceOp
 
+void
+PETScMatUtilities::refreshPatchLevelCCLaplaceOpValues(Mat& mat,
+                                                      MatValuesPlan& plan,
+                                                      const PoissonSpecifications& poisson_spec,
+                                                      const std::vector<RobinBcCoefStrategy<NDIM>*>& bc_coefs,
+                                                      double data_time,
+                                                      const std::vector<int>& num_dofs_per_proc,
+                                                      const int dof_index_idx,
+                                                      Pointer<PatchLevel<NDIM> > patch_level)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(mat);
+#endif
+    beginMatValuesRefresh(mat, plan);
+    setPatchLevelCCLaplaceOpValues(
+        mat, &plan, poisson_spec, bc_coefs, data_time, num_dofs_per_proc, dof_index_idx, patch_level);
+    endMatValuesRefresh(mat, plan);
+    return;
+} // refreshPatchLevelCCLaplaceOpValues
+
 void
 PETScMatUtilities::constructPatchLevelSCLaplaceOp(Mat& mat,
                                                   const PoissonSpecifications& poisson_spec,
@@ -598,177 +809,18 @@ PETScMatUtilities::constructPatchLevelVCSCViscousOp(
                         &mat);
     IBTK_CHKERRQ(ierr);
 
-    using StencilMapType = std::map<hier::Index<NDIM>, int, IndexFortranOrder>;
-    static std::vector<StencilMapType> stencil_map_vec;
-    static const int stencil_sz = (2 * NDIM + 1) + 4 * (NDIM - 1);
-    static const hier::Index<NDIM> ORIGIN(0);
-
-#if (NDIM == 2)
-    // Create stencil dictionary.
-    enum DIRECTIONS
-    {
-        CENTER = 0,
-        EAST = 1,
-        WEST = 2,
-        NORTH = 3,
-        SOUTH = 4,
-        NORTHEAST = 5,
-        NORTHWEST = 6,
-        SOUTHEAST = 7,
-        SOUTHWEST = 8,
-        X = 0,
-        Y = 1
-    };
-    IBTK_DO_ONCE(static StencilMapType sm; sm[ORIGIN] = CENTER; sm[get_shift(X, 1)] = EAST; sm[get_shift(X, -1)] = WEST;
-                 sm[get_shift(Y, 1)] = NORTH;
-                 sm[get_shift(Y, -1)] = SOUTH;
-                 sm[get_shift(Y, 1) + get_shift(X, 1)] = NORTHEAST;
-                 sm[get_shift(Y, 1) + get_shift(X, -1)] = NORTHWEST;
-                 sm[get_shift(Y, -1) + get_shift(X, 1)] = SOUTHEAST;
-                 sm[get_shift(Y, -1) + get_shift(X, -1)] = SOUTHWEST;
-                 stencil_map_vec.push_back(sm););
-
-#elif (NDIM == 3)
-    // In 3D, the shifted directions depend on the axis under consideration
-    enum COMMONDIRECTIONS
-    {
-        CENTER = 0,
-        EAST = 1,
-        WEST = 2,
-        NORTH = 3,
-        SOUTH = 4,
-        TOP = 5,
-        BOTTOM = 6,
-        X = 0,
-        Y = 1,
-        Z = 2
-    };
-    IBTK_DO_ONCE(for (int axis = 0; axis < NDIM; ++axis) {
-        static StencilMapType sm;
-        // Common to all axes
-        sm[ORIGIN] = CENTER;
-        sm[get_shift(X, 1)] = EAST;
-        sm[get_shift(X, -1)] = WEST;
-        sm[get_shift(Y, 1)] = NORTH;
-        sm[get_shift(Y, -1)] = SOUTH;
-        sm[get_shift(Z, 1)] = TOP;
-        sm[get_shift(Z, -1)] = BOTTOM;
-
-        // Specific to certain axes
-        int idx = BOTTOM;
-        for (int d = 0; d < NDIM; ++d)
-        {
-            if (d == axis) continue;
-            idx += 1;
-            sm[get_shift(axis, 1) + get_shift(d, 1)] = idx;
-            idx += 1;
-            sm[get_shift(axis, -1) + get_shift(d, 1)] = idx;
-            idx += 1;
-            sm[get_shift(axis, 1) + get_shift(d, -1)] = idx;
-            idx += 1;
-            sm[get_shift(axis, -1) + get_shift(d, -1)] = idx;
-        }
-        stencil_map_vec.push_back(sm);
-    });
-#endif
-
-    // Set the matrix coefficients to correspond to the standard finite
-    // difference approximation to the divergence of the viscous stress tensor.
-    for (PatchLevel<NDIM>::Iterator p(patch_level); p; p++)
-    {
-        Pointer<Patch<NDIM> > patch = patch_level->getPatch(p());
-        const Box<NDIM>& patch_box = patch->getBox();
-
-        // Compute matrix coefficients.
-        const IntVector<NDIM> no_ghosts(0);
-        SideData<NDIM, double> matrix_coefs(patch_box, stencil_sz, no_ghosts);
-        PoissonUtilities::computeVCSCViscousOpMatrixCoefficients(
-            matrix_coefs, patch, stencil_map_vec, poisson_spec, alpha, beta, bc_coefs, data_time, mu_interp_type);
-
-        // Copy matrix entries to the PETSc matrix structure.
-        Pointer<SideData<NDIM, int> > dof_index_data = patch->getPatchData(dof_index_idx);
-        std::vector<double> mat_vals(stencil_sz);
-        std::vector<int> mat_cols(stencil_sz);
-
-#if (NDIM == 2)
-        StencilMapType& stencil_map = stencil_map_vec[0];
-#endif
-        for (unsigned int axis = 0; axis < NDIM; ++axis)
-        {
-#if (NDIM == 3)
-            StencilMapType& stencil_map = stencil_map_vec[axis];
-#endif
-            for (Box<NDIM>::Iterator b(SideGeometry<NDIM>::toSideBox(patch_box, axis)); b; b++)
-            {
-                const hier::Index<NDIM>& cc = b();
-                const SideIndex<NDIM> i(b(), axis, SideIndex<NDIM>::Lower);
-                const int dof_index = (*dof_index_data)(i);
-                if (proc_lower <= dof_index && dof_index < proc_upper)
-                {
-                    int idx = 0;
-                    mat_vals[idx] = matrix_coefs(i, stencil_map[ORIGIN]);
-                    mat_cols[idx] = dof_index;
-
-                    for (unsigned int d = 0; d < NDIM; ++d)
-                    {
-                        if (d == axis)
-                        {
-                            const hier::Index<NDIM> shift_axis_plus = get_shift(axis, 1);
-                            const hier::Index<NDIM> shift_axis_minus = get_shift(axis, -1);
-
-                            idx += 1;
-                            mat_vals[idx] = matrix_coefs(i, stencil_map[shift_axis_plus]);
-                            mat_cols[idx] = (*dof_index_data)(i + shift_axis_plus);
-
-                            idx += 1;
-                            mat_vals[idx] = matrix_coefs(i, stencil_map[shift_axis_minus]);
-                            mat_cols[idx] = (*dof_index_data)(i + shift_axis_minus);
-                        }
-                        else
-                        {
-                            const hier::Index<NDIM> shift_d_plus = get_shift(d, 1);
-                            const hier::Index<NDIM> shift_d_minus = get_shift(d, -1);
-                            const hier::Index<NDIM> shift_axis_plus = get_shift(axis, 1);
-                            const hier::Index<NDIM> shift_axis_minus = get_shift(axis, -1);
-
-                            idx += 1;
-                            mat_vals[idx] = matrix_coefs(i, stencil_map[shift_d_plus]);
-                            mat_cols[idx] = (*dof_index_data)(i + shift_d_plus);
-
-                            idx += 1;
-                            mat_vals[idx] = matrix_coefs(i, stencil_map[shift_d_minus]);
-                            mat_cols[idx] = (*dof_index_data)(i + shift_d_minus);
-
-                            idx += 1;
-                            mat_vals[idx] = matrix_coefs(i, stencil_map[shift_d_plus + shift_axis_plus]);
-                            const SideIndex<NDIM> ne(cc, d, SideIndex<NDIM>::Upper);
-                            mat_cols[idx] = (*dof_index_data)(ne);
-
-                            idx += 1;
-                            mat_vals[idx] = matrix_coefs(i, stencil_map[shift_d_plus + shift_axis_minus]);
-                            const SideIndex<NDIM> nw(cc + shift_axis_minus, d, SideIndex<NDIM>::Upper);
-                            mat_cols[idx] = (*dof_index_data)(nw);
-
-                            idx += 1;
-                            mat_vals[idx] = matrix_coefs(i, stencil_map[shift_d_minus + shift_axis_plus]);
-                            const SideIndex<NDIM> se(cc, d, SideIndex<NDIM>::Lower);
-                            mat_cols[idx] = (*dof_index_data)(se);
-
-                            idx += 1;
-                            mat_vals[idx] = matrix_coefs(i, stencil_map[shift_d_minus + shift_axis_minus]);
-                            const SideIndex<NDIM> sw(cc + shift_axis_minus, d, SideIndex<NDIM>::Lower);
-                            mat_cols[idx] = (*dof_index_data)(sw);
-                        }
-                    }
-#if !defined(NDEBUG)
-                    TBOX_ASSERT(idx == (stencil_sz - 1));
-#endif
-                    ierr = MatSetValues(mat, 1, &dof_index, stencil_sz, &mat_cols[0], &mat_vals[0], INSERT_VALUES);
-                    IBTK_CHKERRQ(ierr);
-                }
-            }
-        }
-    }
+    // Set the matrix coefficients.
+    setPatchLevelVCSCViscousOpValues(mat,
+                                     nullptr,
+                                     poisson_spec,
+                                     alpha,
+                                     beta,
+                                     bc_coefs,
+                                     data_time,
+                                     num_dofs_per_proc,
+                                     dof_index_idx,
+                                     patch_level,
+                                     mu_interp_type);
 
     // Assemble the matrix.
     ierr = MatAssemblyBegin(mat, MAT_FINAL_ASSEMBLY);
@@ -776,7 +828,40 @@ PETScMatUtilities::constructPatchLevelVCSCViscousOp(
     ierr = MatAssemblyEnd(mat, MAT_FINAL_ASSEMBLY);
     IBTK_CHKERRQ(ierr);
     return;
-} // constructPatchLevelVCSCViscousOp
+} // constructPatchLevelVCSCViscousOp
+
+void
+PETScMatUtilities::refreshPatchLevelVCSCViscousOpValues(Mat& mat,
+                                                        MatValuesPlan& plan,
+                                                        const PoissonSpecifications& poisson_spec,
+                                                        double alpha,
+                                                        double beta,
+                                                        const std::vector<RobinBcCoefStrategy<NDIM>*>& bc_coefs,
+                                                        double data_time,
+                                                        const std::vector<int>& num_dofs_per_proc,
+                                                        int dof_index_idx,
+                                                        Pointer<PatchLevel<NDIM> > patch_level,
+                                                        VCInterpType mu_interp_type)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(mat);
+    TBOX_ASSERT(bc_coefs.size() == NDIM);
+#endif
+    beginMatValuesRefresh(mat, plan);
+    setPatchLevelVCSCViscousOpValues(mat,
+                                     &plan,
+                                     poisson_spec,
+                                     alpha,
+                                     beta,
+                                     bc_coefs,
+                                     data_time,
+                                     num_dofs_per_proc,
+                                     dof_index_idx,
+                                     patch_level,
+                                     mu_interp_type);
+    endMatValuesRefresh(mat, plan);
+    return;
+} // refreshPatchLevelVCSCViscousOpValues
 
 void
 PETScMatUtilities::constructPatchLevelSCInterpOp(Mat& mat,
@@ -1222,6 +1307,272 @@ PETScMatUtilities::constructPatchLevelASMSubdomains(std::vector<IS>& is_overlap,
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void
+PETScMatUtilities::setPatchLevelCCLaplaceOpValues(Mat& mat,
+                                                  MatValuesPlan* plan,
+                                                  const PoissonSpecifications& poisson_spec,
+                                                  const std::vector<RobinBcCoefStrategy<NDIM>*>& bc_coefs,
+                                                  double data_time,
+                                                  const std::vector<int>& num_dofs_per_proc,
+                                                  const int dof_index_idx,
+                                                  Pointer<PatchLevel<NDIM> > patch_level)
+{
+    const int depth = static_cast<int>(bc_coefs.size());
+
+    // Setup the finite difference stencil.
+    static const int stencil_sz = 2 * NDIM + 1;
+    std::vector<hier::Index<NDIM> > stencil(stencil_sz, hier::Index<NDIM>(0));
+    for (unsigned int axis = 0, stencil_index = 1; axis < NDIM; ++axis)
+    {
+        for (int side = 0; side <= 1; ++side, ++stencil_index)
+        {
+            stencil[stencil_index](axis) = (side == 0 ? -1 : +1);
+        }
+    }
+
+    // Determine the index ranges.
+    const int mpi_rank = IBTK_MPI::getRank();
+    const int n_local = num_dofs_per_proc[mpi_rank];
+    const int i_lower = std::accumulate(num_dofs_per_proc.begin(), num_dofs_per_proc.begin() + mpi_rank, 0);
+    const int i_upper = i_lower + n_local;
+
+    // Set the matrix coefficients to correspond to the standard finite
+    // difference approximation to the Laplacian.
+    for (PatchLevel<NDIM>::Iterator p(patch_level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = patch_level->getPatch(p());
+        const Box<NDIM>& patch_box = patch->getBox();
+
+        // Compute matrix coefficients.
+        const IntVector<NDIM> no_ghosts(0);
+        CellData<NDIM, double> matrix_coefs(patch_box, stencil_sz * depth, no_ghosts);
+        PoissonUtilities::computeMatrixCoefficients(matrix_coefs, patch, stencil, poisson_spec, bc_coefs, data_time);
+
+        // Copy matrix entries to the PETSc matrix structure.
+        Pointer<CellData<NDIM, int> > dof_index_data = patch->getPatchData(dof_index_idx);
+        std::vector<double> mat_vals(stencil_sz);
+        std::vector<int> mat_cols(stencil_sz);
+        for (Box<NDIM>::Iterator b(CellGeometry<NDIM>::toCellBox(patch_box)); b; b++)
+        {
+            const CellIndex<NDIM>& i = b();
+            for (int d = 0; d < depth; ++d)
+            {
+                const int dof_index = (*dof_index_data)(i, d);
+                if (i_lower <= dof_index && dof_index < i_upper)
+                {
+                    // Notice that the order in which values are set corresponds
+                    // to that of the stencil defined above.
+                    const int offset = d * stencil_sz;
+                    mat_vals[0] = matrix_coefs(i, offset);
+                    mat_cols[0] = dof_index;
+                    for (unsigned int axis = 0, stencil_index = 1; axis < NDIM; ++axis)
+                    {
+                        for (int side = 0; side <= 1; ++side, ++stencil_index)
+                        {
+                            mat_vals[stencil_index] = matrix_coefs(i, offset + stencil_index);
+                            mat_cols[stencil_index] = (*dof_index_data)(i + stencil[stencil_index], d);
+                        }
+                    }
+                    setMatRowValues(mat, plan, dof_index, stencil_sz, &mat_cols[0], &mat_vals[0]);
+                }
+            }
+        }
+    }
+    return;
+} // setPatchLevelCCLaplaceOpValues
+
+void
+PETScMatUtilities::setPatchLevelVCSCViscousOpValues(Mat& mat,
+                                                    MatValuesPlan* plan,
+                                                    const PoissonSpecifications& poisson_spec,
+                                                    double alpha,
+                                                    double beta,
+                                                    const std::vector<RobinBcCoefStrategy<NDIM>*>& bc_coefs,
+                                                    double data_time,
+                                                    const std::vector<int>& num_dofs_per_proc,
+                                                    int dof_index_idx,
+                                                    Pointer<PatchLevel<NDIM> > patch_level,
+                                                    VCInterpType mu_interp_type)
+{
+    // Determine the index ranges.
+    const int mpi_rank = IBTK_MPI::getRank();
+    const int n_local = num_dofs_per_proc[mpi_rank];
+    const int proc_lower = std::accumulate(num_dofs_per_proc.begin(), num_dofs_per_proc.begin() + mpi_rank, 0);
+    const int proc_upper = proc_lower + n_local;
+
+    using StencilMapType = std::map<hier::Index<NDIM>, int, IndexFortranOrder>;
+    static std::vector<StencilMapType> stencil_map_vec;
+    static const int stencil_sz = (2 * NDIM + 1) + 4 * (NDIM - 1);
+    static const hier::Index<NDIM> ORIGIN(0);
+
+#if (NDIM == 2)
+    // Create stencil dictionary.
+    enum DIRECTIONS
+    {
+        CENTER = 0,
+        EAST = 1,
+        WEST = 2,
+        NORTH = 3,
+        SOUTH = 4,
+        NORTHEAST = 5,
+        NORTHWEST = 6,
+        SOUTHEAST = 7,
+        SOUTHWEST = 8,
+        X = 0,
+        Y = 1
+    };
+    IBTK_DO_ONCE(static StencilMapType sm; sm[ORIGIN] = CENTER; sm[get_shift(X, 1)] = EAST; sm[get_shift(X, -1)] = WEST;
+                 sm[get_shift(Y, 1)] = NORTH;
+                 sm[get_shift(Y, -1)] = SOUTH;
+                 sm[get_shift(Y, 1) + get_shift(X, 1)] = NORTHEAST;
+                 sm[get_shift(Y, 1) + get_shift(X, -1)] = NORTHWEST;
+                 sm[get_shift(Y, -1) + get_shift(X, 1)] = SOUTHEAST;
+                 sm[get_shift(Y, -1) + get_shift(X, -1)] = SOUTHWEST;
+                 stencil_map_vec.push_back(sm););
+
+#elif (NDIM == 3)
+    // In 3D, the shifted directions depend on the axis under consideration
+    enum COMMONDIRECTIONS
+    {
+        CENTER = 0,
+        EAST = 1,
+        WEST = 2,
+        NORTH = 3,
+        SOUTH = 4,
+        TOP = 5,
+        BOTTOM = 6,
+        X = 0,
+        Y = 1,
+        Z = 2
+    };
+    IBTK_DO_ONCE(for (int axis = 0; axis < NDIM; ++axis) {
+        static StencilMapType sm;
+        // Common to all axes
+        sm[ORIGIN] = CENTER;
+        sm[get_shift(X, 1)] = EAST;
+        sm[get_shift(X, -1)] = WEST;
+        sm[get_shift(Y, 1)] = NORTH;
+        sm[get_shift(Y, -1)] = SOUTH;
+        sm[get_shift(Z, 1)] = TOP;
+        sm[get_shift(Z, -1)] = BOTTOM;
+
+        // Specific to certain axes
+        int idx = BOTTOM;
+        for (int d = 0; d < NDIM; ++d)
+        {
+            if (d == axis) continue;
+            idx += 1;
+            sm[get_shift(axis, 1) + get_shift(d, 1)] = idx;
+            idx += 1;
+            sm[get_shift(axis, -1) + get_shift(d, 1)] = idx;
+            idx += 1;
+            sm[get_shift(axis, 1) + get_shift(d, -1)] = idx;
+            idx += 1;
+            sm[get_shift(axis, -1) + get_shift(d, -1)] = idx;
+        }
+        stencil_map_vec.push_back(sm);
+    });
+#endif
+
+    // Set the matrix coefficients to correspond to the standard finite
+    // difference approximation to the divergence of the viscous stress tensor.
+    for (PatchLevel<NDIM>::Iterator p(patch_level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = patch_level->getPatch(p());
+        const Box<NDIM>& patch_box = patch->getBox();
+
+        // Compute matrix coefficients.
+        const IntVector<NDIM> no_ghosts(0);
+        SideData<NDIM, double> matrix_coefs(patch_box, stencil_sz, no_ghosts);
+        PoissonUtilities::computeVCSCViscousOpMatrixCoefficients(
+            matrix_coefs, patch, stencil_map_vec, poisson_spec, alpha, beta, bc_coefs, data_time, mu_interp_type);
+
+        // Copy matrix entries to the PETSc matrix structure.
+        Pointer<SideData<NDIM, int> > dof_index_data = patch->getPatchData(dof_index_idx);
+        std::vector<double> mat_vals(stencil_sz);
+        std::vector<int> mat_cols(stencil_sz);
+
+#if (NDIM == 2)
+        StencilMapType& stencil_map = stencil_map_vec[0];
+#endif
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+#if (NDIM == 3)
+            StencilMapType& stencil_map = stencil_map_vec[axis];
+#endif
+            for (Box<NDIM>::Iterator b(SideGeometry<NDIM>::toSideBox(patch_box, axis)); b; b++)
+            {
+                const hier::Index<NDIM>& cc = b();
+                const SideIndex<NDIM> i(b(), axis, SideIndex<NDIM>::Lower);
+                const int dof_index = (*dof_index_data)(i);
+                if (proc_lower <= dof_index && dof_index < proc_upper)
+                {
+                    int idx = 0;
+                    mat_vals[idx] = matrix_coefs(i, stencil_map[ORIGIN]);
+                    mat_cols[idx] = dof_index;
+
+                    for (unsigned int d = 0; d < NDIM; ++d)
+                    {
+                        if (d == axis)
+                        {
+                            const hier::Index<NDIM> shift_axis_plus = get_shift(axis, 1);
+                            const hier::Index<NDIM> shift_axis_minus = get_shift(axis, -1);
+
+                            idx += 1;
+                            mat_vals[idx] = matrix_coefs(i, stencil_map[shift_axis_plus]);
+                            mat_cols[idx] = (*dof_index_data)(i + shift_axis_plus);
+
+                            idx += 1;
+                            mat_vals[idx] = matrix_coefs(i, stencil_map[shift_axis_minus]);
+                            mat_cols[idx] = (*dof_index_data)(i + shift_axis_minus);
+                        }
+                        else
+                        {
+                            const hier::Index<NDIM> shift_d_plus = get_shift(d, 1);
+                            const hier::Index<NDIM> shift_d_minus = get_shift(d, -1);
+                            const hier::Index<NDIM> shift_axis_plus = get_shift(axis, 1);
+                            const hier::Index<NDIM> shift_axis_minus = get_shift(axis, -1);
+
+                            idx += 1;
+                            mat_vals[idx] = matrix_coefs(i, stencil_map[shift_d_plus]);
+                            mat_cols[idx] = (*dof_index_data)(i + shift_d_plus);
+
+                            idx += 1;
+                            mat_vals[idx] = matrix_coefs(i, stencil_map[shift_d_minus]);
+                            mat_cols[idx] = (*dof_index_data)(i + shift_d_minus);
+
+                            idx += 1;
+                            mat_vals[idx] = matrix_coefs(i, stencil_map[shift_d_plus + shift_axis_plus]);
+                            const SideIndex<NDIM> ne(cc, d, SideIndex<NDIM>::Upper);
+                            mat_cols[idx] = (*dof_index_data)(ne);
+
+                            idx += 1;
+                            mat_vals[idx] = matrix_coefs(i, stencil_map[shift_d_plus + shift_axis_minus]);
+                            const SideIndex<NDIM> nw(cc + shift_axis_minus, d, SideIndex<NDIM>::Upper);
+                            mat_cols[idx] = (*dof_index_data)(nw);
+
+                            idx += 1;
+                            mat_vals[idx] = matrix_coefs(i, stencil_map[shift_d_minus + shift_axis_plus]);
+                            const SideIndex<NDIM> se(cc, d, SideIndex<NDIM>::Lower);
+                            mat_cols[idx] = (*dof_index_data)(se);
+
+                            idx += 1;
+                            mat_vals[idx] = matrix_coefs(i, stencil_map[shift_d_minus + shift_axis_minus]);
+                            const SideIndex<NDIM> sw(cc + shift_axis_minus, d, SideIndex<NDIM>::Lower);
+                            mat_cols[idx] = (*dof_index_data)(sw);
+                        }
+                    }
+#if !defined(NDEBUG)
+                    TBOX_ASSERT(idx == (stencil_sz - 1));
+#endif
+                    setMatRowValues(mat, plan, dof_index, stencil_sz, &mat_cols[0], &mat_vals[0]);
+                }
+            }
+        }
+    }
+    return;
+} // setPatchLevelVCSCViscousOpValues
+
 void
 PETScMatUtilities::constructConservativeProlongationOp_cell(Mat& mat,
                                                             int dof_index_idx,
@@ -27,22 +27,29 @@
 #include "CellData.h"
 #include "CellIndex.h"
 #include "EdgeData.h"
+#include "EdgeGeometry.h"
 #include "EdgeIterator.h"
 #include "IntVector.h"
 #include "NodeData.h"
+#include "NodeGeometry.h"
 #include "NodeIterator.h"
 #include "OutersideData.h"
 #include "Patch.h"
+#include "PatchData.h"
 #include "PatchGeometry.h"
+#include "PatchLevel.h"
 #include "PoissonSpecifications.h"
 #include "RobinBcCoefStrategy.h"
 #include "SideData.h"
+#include "SideGeometry.h"
 #include "SideIndex.h"
 #include "Variable.h"
 #include "tbox/Array.h"
 #include "tbox/Pointer.h"
 
 #include <array>
+#include <cstddef>
+#include <functional>
 #include <limits>
 #include <map>
 #include <string>
@@ -166,6 +173,87 @@ get_shift(int dir, int shift)
     iv(dir) = shift;
     return iv;
 } // get_shift
+
+inline void
+hash_array_data(std::size_t& seed, const ArrayData<NDIM, double>& array_data, const Box<NDIM>& box)
+{
+    const std::hash<double> hasher;
+    for (int d = 0; d < array_data.getDepth(); ++d)
+    {
+        for (Box<NDIM>::Iterator b(box * array_data.getBox()); b; b++)
+        {
+            PoissonUtilities::hashCombine(seed, hasher(array_data(b(), d)));
+        }
+    }
+    return;
+} // hash_array_data
+
+// Only the values in the patch interior enter the operator, so ghost cell
+// values are not hashed.
+void
+hash_patch_data(std::size_t& seed, Pointer<PatchData<NDIM> > data, const Box<NDIM>& patch_box)
+{
+    Pointer<CellData<NDIM, double> > cc_data = data;
+    Pointer<SideData<NDIM, double> > sc_data = data;
+    Pointer<NodeData<NDIM, double> > nc_data = data;
+    Pointer<EdgeData<NDIM, double> > ec_data = data;
+    if (cc_data)
+    {
+        hash_array_data(seed, cc_data->getArrayData(), patch_box);
+    }
+    else if (sc_data)
+    {
+        for (int axis = 0; axis < NDIM; ++axis)
+        {
+            hash_array_data(seed, sc_data->getArrayData(axis), SideGeometry<NDIM>::toSideBox(patch_box, axis));
+        }
+    }
+    else if (nc_data)
+    {
+        hash_array_data(seed, nc_data->getArrayData(), NodeGeometry<NDIM>::toNodeBox(patch_box));
+    }
+    else if (ec_data)
+    {
+        for (int axis = 0; axis < NDIM; ++axis)
+        {
+            hash_array_data(seed, ec_data->getArrayData(axis), EdgeGeometry<NDIM>::toEdgeBox(patch_box, axis));
+        }
+    }
+    else
+    {
+        TBOX_ERROR("PoissonUtilities::computeOperatorFingerprint():\n"
+                   << "  unsupported coefficient patch data type" << std::endl);
+    }
+    return;
+} // hash_patch_data
+
+void
+hash_coefficient(std::size_t& seed,
+                 const bool is_zero,
+                 const bool is_constant,
+                 const double constant,
+                 const int patch_data_idx,
+                 Pointer<PatchLevel<NDIM> > level)
+{
+    PoissonUtilities::hashCombine(seed, std::hash<bool>()(is_zero));
+    if (is_zero) return;
+    PoissonUtilities::hashCombine(seed, std::hash<bool>()(is_constant));
+    if (is_constant)
+    {
+        PoissonUtilities::hashCombine(seed, std::hash<double>()(constant));
+    }
+    else
+    {
+        PoissonUtilities::hashCombine(seed, std::hash<int>()(patch_data_idx));
+        if (!level) return;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            hash_patch_data(seed, patch->getPatchData(patch_data_idx), patch->getBox());
+        }
+    }
+    return;
+} // hash_coefficient
 } // namespace
 
 void
@@ -2259,6 +2347,68 @@ PoissonUtilities::adjustVCSCViscousOpRHSAtCoarseFineBoundary(SideData<NDIM, doub
     return;
 } // adjustVCSCViscousOpRHSAtCoarseFineBoundary
 
+std::size_t
+PoissonUtilities::computeOperatorFingerprint(const PoissonSpecifications& poisson_spec,
+                                             const std::vector<RobinBcCoefStrategy<NDIM>*>& bc_coefs,
+                                             Pointer<PatchLevel<NDIM> > level,
+                                             const double data_time)
+{
+    std::size_t seed = 0;
+    hash_coefficient(seed,
+                     poisson_spec.cIsZero(),
+                     poisson_spec.cIsConstant(),
+                     poisson_spec.cIsConstant() ? poisson_spec.getCConstant() : 0.0,
+                     poisson_spec.cIsVariable() ? poisson_spec.getCPatchDataId() : -1,
+                     level);
+    hash_coefficient(seed,
+                     /*is_zero*/ false,
+                     poisson_spec.dIsConstant(),
+                     poisson_spec.dIsConstant() ? poisson_spec.getDConstant() : 0.0,
+                     poisson_spec.dIsVariable() ? poisson_spec.getDPatchDataId() : -1,
+                     level);
+    for (const auto& bc_coef : bc_coefs)
+    {
+        hashCombine(seed, std::hash<const void*>()(bc_coef));
+    }
+
+    // The boundary condition coefficients may vary in time, so the values of
+    // a and b on the physical boundary of the level are also hashed.  The
+    // values of g only enter the right-hand side.
+    if (!level || bc_coefs.empty()) return seed;
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+        if (!pgeom->getTouchesRegularBoundary()) continue;
+        const Array<BoundaryBox<NDIM> > physical_codim1_boxes =
+            PhysicalBoundaryUtilities::getPhysicalBoundaryCodim1Boxes(*patch);
+        for (int n = 0; n < physical_codim1_boxes.size(); ++n)
+        {
+            const BoundaryBox<NDIM> trimmed_bdry_box =
+                PhysicalBoundaryUtilities::trimBoundaryCodim1Box(physical_codim1_boxes[n], *patch);
+            const Box<NDIM> bc_coef_box = PhysicalBoundaryUtilities::makeSideBoundaryCodim1Box(trimmed_bdry_box);
+            Pointer<ArrayData<NDIM, double> > acoef_data = new ArrayData<NDIM, double>(bc_coef_box, 1);
+            Pointer<ArrayData<NDIM, double> > bcoef_data = new ArrayData<NDIM, double>(bc_coef_box, 1);
+            Pointer<ArrayData<NDIM, double> > gcoef_data = nullptr;
+            for (const auto& bc_coef : bc_coefs)
+            {
+                if (!bc_coef) continue;
+                bc_coef->setBcCoefs(acoef_data, bcoef_data, gcoef_data, nullptr, *patch, trimmed_bdry_box, data_time);
+                hash_array_data(seed, *acoef_data, bc_coef_box);
+                hash_array_data(seed, *bcoef_data, bc_coef_box);
+            }
+        }
+    }
+    return seed;
+} // computeOperatorFingerprint
+
+void
+PoissonUtilities::hashCombine(std::size_t& seed, const std::size_t value)
+{
+    seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    return;
+} // hashCombine
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 /////////////////////////////// PROTECTED ////////////////////////////////////
@@ -55,6 +55,7 @@ IBTK_ENABLE_EXTRA_WARNINGS
 #include <mpi.h>
 
 #include <algorithm>
+#include <cstddef>
 #include <map>
 #include <memory>
 #include <ostream>
@@ -139,6 +140,8 @@ CCPoissonHypreLevelSolver::CCPoissonHypreLevelSolver(const std::string& object_n
         if (input_db->keyExists("initial_guess_nonzero"))
             d_initial_guess_nonzero = input_db->getBool("initial_guess_nonzero");
         if (input_db->keyExists("rel_change")) d_rel_change = input_db->getInteger("rel_change");
+        if (input_db->keyExists("reuse_solver_state"))
+            d_reuse_solver_state = input_db->getBool("reuse_solver_state");
 
         if (d_solver_type == "SMG" || d_precond_type == "SMG" || d_solver_type == "PFMG" || d_precond_type == "PFMG")
         {
@@ -280,6 +283,51 @@ CCPoissonHypreLevelSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, do
 #else
     NULL_USE(b);
 #endif
+    // Determine the data depth and the type of anisotropy.
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    const int x_idx = x.getComponentDescriptorIndex(0);
+    Pointer<CellDataFactory<NDIM, double> > x_fac = var_db->getPatchDescriptor()->getPatchDataFactory(x_idx);
+    const unsigned int depth = x_fac->getDefaultDepth();
+    bool grid_aligned_anisotropy = true;
+    if (!d_poisson_spec.dIsConstant())
+    {
+        Pointer<SideDataFactory<NDIM, double> > pdat_factory =
+            var_db->getPatchDescriptor()->getPatchDataFactory(d_poisson_spec.getDPatchDataId());
+#if !defined(NDEBUG)
+        TBOX_ASSERT(pdat_factory);
+#endif
+        grid_aligned_anisotropy = pdat_factory->getDefaultDepth() == 1;
+    }
+
+    // Keep the hypre data structures if the patch level and the data layout
+    // are unchanged.  In this case, only the matrix coefficients and the
+    // solver setup are recomputed, and only if the operator has changed.
+    const int ln = x.getCoarsestLevelNumber();
+    if (d_is_initialized && d_reuse_solver_state && x.getPatchHierarchy() == d_hierarchy && ln == d_level_num &&
+        d_hierarchy->getPatchLevel(ln) == d_level && depth == d_depth &&
+        grid_aligned_anisotropy == d_grid_aligned_anisotropy)
+    {
+        const std::size_t operator_fingerprint =
+            PoissonUtilities::computeOperatorFingerprint(d_poisson_spec, d_bc_coefs, d_level, d_solution_time);
+        const int operator_changed = operator_fingerprint != d_operator_fingerprint ? 1 : 0;
+        if (IBTK_MPI::maxReduction(operator_changed))
+        {
+            destroyHypreSolver();
+            if (d_grid_aligned_anisotropy)
+            {
+                setMatrixCoefficients_aligned();
+            }
+            else
+            {
+                setMatrixCoefficients_nonaligned();
+            }
+            setupHypreSolver();
+            d_operator_fingerprint = operator_fingerprint;
+        }
+        IBTK_TIMER_STOP(t_initialize_solver_state);
+        return;
+    }
+
     // Deallocate the solver state if the solver is already initialized.
     if (d_is_initialized) deallocateSolverState();
 
@@ -294,24 +342,8 @@ CCPoissonHypreLevelSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, do
     }
 
     // Allocate and initialize the hypre data structures.
-    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
-    const int x_idx = x.getComponentDescriptorIndex(0);
-    Pointer<CellDataFactory<NDIM, double> > x_fac = var_db->getPatchDescriptor()->getPatchDataFactory(x_idx);
-    d_depth = x_fac->getDefaultDepth();
-    if (d_poisson_spec.dIsConstant())
-    {
-        d_grid_aligned_anisotropy = true;
-    }
-    else
-    {
-        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
-        Pointer<SideDataFactory<NDIM, double> > pdat_factory =
-            var_db->getPatchDescriptor()->getPatchDataFactory(d_poisson_spec.getDPatchDataId());
-#if !defined(NDEBUG)
-        TBOX_ASSERT(pdat_factory);
-#endif
-        d_grid_aligned_anisotropy = pdat_factory->getDefaultDepth() == 1;
-    }
+    d_depth = depth;
+    d_grid_aligned_anisotropy = grid_aligned_anisotropy;
     allocateHypreData();
     if (d_grid_aligned_anisotropy)
     {
@@ -322,6 +354,11 @@ CCPoissonHypreLevelSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, do
         setMatrixCoefficients_nonaligned();
     }
     setupHypreSolver();
+    if (d_reuse_solver_state)
+    {
+        d_operator_fingerprint =
+            PoissonUtilities::computeOperatorFingerprint(d_poisson_spec, d_bc_coefs, d_level, d_solution_time);
+    }
 
     // Indicate that the solver is initialized.
     d_is_initialized = true;
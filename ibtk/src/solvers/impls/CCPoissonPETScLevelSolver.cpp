@@ -43,6 +43,7 @@
 #include <petsclog.h>
 
 #include <algorithm>
+#include <cstddef>
 #include <string>
 #include <utility>
 #include <vector>
@@ -206,6 +207,26 @@ CCPoissonPETScLevelSolver::setupKSPVecs(Vec& petsc_x,
     return;
 } // setupKSPVecs
 
+std::size_t
+CCPoissonPETScLevelSolver::computeOperatorFingerprint()
+{
+    return PoissonUtilities::computeOperatorFingerprint(d_poisson_spec, d_bc_coefs, d_level, d_solution_time);
+} // computeOperatorFingerprint
+
+bool
+CCPoissonPETScLevelSolver::refreshOperatorValues()
+{
+    PETScMatUtilities::refreshPatchLevelCCLaplaceOpValues(d_petsc_mat,
+                                                          d_mat_values_plan,
+                                                          d_poisson_spec,
+                                                          d_bc_coefs,
+                                                          d_solution_time,
+                                                          d_num_dofs_per_proc,
+                                                          d_dof_index_idx,
+                                                          d_level);
+    return true;
+} // refreshOperatorValues
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
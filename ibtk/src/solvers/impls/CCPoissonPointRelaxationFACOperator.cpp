@@ -55,6 +55,7 @@
 #include "tbox/TimerManager.h"
 #include "tbox/Utilities.h"
 
+#include <algorithm>
 #include <map>
 #include <memory>
 #include <ostream>
@@ -68,14 +69,18 @@
 #if (NDIM == 2)
 #define GS_SMOOTH_FC IBTK_FC_FUNC(gssmooth2d, GSSMOOTH2D)
 #define RB_GS_SMOOTH_FC IBTK_FC_FUNC(rbgssmooth2d, RBGSSMOOTH2D)
+#define RB_GS_SMOOTH_BLOCKED_FC IBTK_FC_FUNC(rbgssmoothblocked2d, RBGSSMOOTHBLOCKED2D)
 #define VC_CELL_GS_SMOOTH_FC IBTK_FC_FUNC(vccellgssmooth2d, VCCELLGSSMOOTH2D)
 #define VC_CELL_RB_GS_SMOOTH_FC IBTK_FC_FUNC(vccellrbgssmooth2d, VCCELLRBGSSMOOTH2D)
+#define VC_CELL_RB_GS_SMOOTH_BLOCKED_FC IBTK_FC_FUNC(vccellrbgssmoothblocked2d, VCCELLRBGSSMOOTHBLOCKED2D)
 #endif
 #if (NDIM == 3)
 #define GS_SMOOTH_FC IBTK_FC_FUNC(gssmooth3d, GSSMOOTH3D)
 #define RB_GS_SMOOTH_FC IBTK_FC_FUNC(rbgssmooth3d, RBGSSMOOTH3D)
+#define RB_GS_SMOOTH_BLOCKED_FC IBTK_FC_FUNC(rbgssmoothblocked3d, RBGSSMOOTHBLOCKED3D)
 #define VC_CELL_GS_SMOOTH_FC IBTK_FC_FUNC(vccellgssmooth3d, VCCELLGSSMOOTH3D)
 #define VC_CELL_RB_GS_SMOOTH_FC IBTK_FC_FUNC(vccellrbgssmooth3d, VCCELLRBGSSMOOTH3D)
+#define VC_CELL_RB_GS_SMOOTH_BLOCKED_FC IBTK_FC_FUNC(vccellrbgssmoothblocked3d, VCCELLRBGSSMOOTHBLOCKED3D)
 #endif
 
 // Function interfaces
@@ -114,6 +119,27 @@ extern "C"
                          const double* dx,
                          const int& red_or_black);
 
+    void RB_GS_SMOOTH_BLOCKED_FC(double* U,
+                                 const int& U_gcw,
+                                 const double& alpha,
+                                 const double& beta,
+                                 const double* F,
+                                 const int& F_gcw,
+                                 const int& ilower0,
+                                 const int& iupper0,
+                                 const int& ilower1,
+                                 const int& iupper1,
+#if (NDIM == 3)
+                                 const int& ilower2,
+                                 const int& iupper2,
+#endif
+                                 const double* dx,
+#if (NDIM == 3)
+                                 const int& tile1,
+#endif
+                                 const int& red_or_black,
+                                 const int& num_color_sweeps);
+
     void VC_CELL_GS_SMOOTH_FC(double* U,
                               const int& U_gcw,
                               const double* alpha0,
@@ -156,6 +182,32 @@ extern "C"
 #endif
                                  const double* dx,
                                  const int& red_or_black);
+
+    void VC_CELL_RB_GS_SMOOTH_BLOCKED_FC(double* U,
+                                         const int& U_gcw,
+                                         const double* alpha0,
+                                         const double* alpha1,
+#if (NDIM == 3)
+                                         const double* alpha2,
+#endif
+                                         const int& alpha_gcw,
+                                         const double& beta,
+                                         const double* F,
+                                         const int& F_gcw,
+                                         const int& ilower0,
+                                         const int& iupper0,
+                                         const int& ilower1,
+                                         const int& iupper1,
+#if (NDIM == 3)
+                                         const int& ilower2,
+                                         const int& iupper2,
+#endif
+                                         const double* dx,
+#if (NDIM == 3)
+                                         const int& tile1,
+#endif
+                                         const int& red_or_black,
+                                         const int& num_color_sweeps);
 }
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
@@ -196,6 +248,7 @@ enum SmootherType
     PATCH_GAUSS_SEIDEL,
     PROCESSOR_GAUSS_SEIDEL,
     RED_BLACK_GAUSS_SEIDEL,
+    BLOCKED_RED_BLACK_GAUSS_SEIDEL,
     UNKNOWN = -1
 };
 
@@ -204,8 +257,9 @@ get_smoother_type(const std::string& smoother_type_string)
 {
     if (smoother_type_string == "PATCH_GAUSS_SEIDEL") return PATCH_GAUSS_SEIDEL;
     if (smoother_type_string == "PROCESSOR_GAUSS_SEIDEL") return PROCESSOR_GAUSS_SEIDEL;
-    if (smoother_type_string == "RED_BLACK_GAUSS_SEIDEL")
-        return RED_BLACK_GAUSS_SEIDEL;
+    if (smoother_type_string == "RED_BLACK_GAUSS_SEIDEL") return RED_BLACK_GAUSS_SEIDEL;
+    if (smoother_type_string == "BLOCKED_RED_BLACK_GAUSS_SEIDEL")
+        return BLOCKED_RED_BLACK_GAUSS_SEIDEL;
     else
         return UNKNOWN;
 } // get_smoother_type
@@ -213,7 +267,7 @@ get_smoother_type(const std::string& smoother_type_string)
 inline bool
 use_red_black_ordering(SmootherType smoother_type)
 {
-    if (smoother_type == RED_BLACK_GAUSS_SEIDEL)
+    if (smoother_type == RED_BLACK_GAUSS_SEIDEL || smoother_type == BLOCKED_RED_BLACK_GAUSS_SEIDEL)
     {
         return true;
     }
@@ -223,10 +277,24 @@ use_red_black_ordering(SmootherType smoother_type)
     }
 } // use_red_black_ordering
 
+inline bool
+use_blocked_sweeps(SmootherType smoother_type)
+{
+    if (smoother_type == BLOCKED_RED_BLACK_GAUSS_SEIDEL)
+    {
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+} // use_blocked_sweeps
+
 inline bool
 do_local_data_update(SmootherType smoother_type)
 {
-    if (smoother_type == PROCESSOR_GAUSS_SEIDEL || smoother_type == RED_BLACK_GAUSS_SEIDEL)
+    if (smoother_type == PROCESSOR_GAUSS_SEIDEL || smoother_type == RED_BLACK_GAUSS_SEIDEL ||
+        smoother_type == BLOCKED_RED_BLACK_GAUSS_SEIDEL)
     {
         return true;
     }
@@ -235,6 +303,23 @@ do_local_data_update(SmootherType smoother_type)
         return false;
     }
 } // do_local_data_update
+
+#if (NDIM == 3)
+// Number of cells in the i1 direction of the tiles used by the blocked
+// red-black smoother.  The tiles are sized so that the planes spanned by the
+// wavefront of color sweeps fit into a cache of the specified size.
+inline int
+get_blocked_smoother_tile_size(const Box<NDIM>& patch_box,
+                               const int ghosts,
+                               const int num_color_sweeps,
+                               const int num_arrays,
+                               const int cache_size)
+{
+    const int row_size = (patch_box.numberCells(0) + 2 * ghosts) * static_cast<int>(sizeof(double)) * num_arrays;
+    const int num_planes = num_color_sweeps + 2;
+    return std::max(1, cache_size / (row_size * num_planes));
+} // get_blocked_smoother_tile_size
+#endif
 } // namespace
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -264,6 +349,24 @@ CCPoissonPointRelaxationFACOperator::CCPoissonPointRelaxationFACOperator(const s
     if (input_db)
     {
         if (input_db->keyExists("smoother_type")) d_smoother_type = input_db->getString("smoother_type");
+        if (input_db->keyExists("smoother_sweeps_per_ghost_fill"))
+        {
+            d_smoother_sweeps_per_ghost_fill = input_db->getInteger("smoother_sweeps_per_ghost_fill");
+            if (d_smoother_sweeps_per_ghost_fill < 1)
+            {
+                TBOX_ERROR(d_object_name << "::CCPoissonPointRelaxationFACOperator():\n"
+                                         << "  smoother_sweeps_per_ghost_fill must be at least 1" << std::endl);
+            }
+        }
+        if (input_db->keyExists("smoother_cache_size"))
+        {
+            d_smoother_cache_size = input_db->getInteger("smoother_cache_size");
+            if (d_smoother_cache_size < 1)
+            {
+                TBOX_ERROR(d_object_name << "::CCPoissonPointRelaxationFACOperator():\n"
+                                         << "  smoother_cache_size must be at least 1" << std::endl);
+            }
+        }
         if (input_db->keyExists("prolongation_method"))
             d_prolongation_method = input_db->getString("prolongation_method");
         if (input_db->keyExists("restriction_method")) d_restriction_method = input_db->getString("restriction_method");
@@ -372,6 +475,7 @@ CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
     TBOX_ASSERT(smoother_type != UNKNOWN);
 #endif
     const bool red_black_ordering = use_red_black_ordering(smoother_type);
+    const bool blocked_sweeps = use_blocked_sweeps(smoother_type);
     const bool update_local_data = do_local_data_update(smoother_type);
 
     // Cache coarse-fine interface ghost cell values in the "scratch" data.
@@ -395,9 +499,15 @@ CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
     }
 
     // Smooth the error by the specified number of sweeps.
+    //
+    // NOTE: The blocked red-black smoother performs several color sweeps
+    // between ghost cell fills.
     if (red_black_ordering) num_sweeps *= 2;
-    for (int isweep = 0; isweep < num_sweeps; ++isweep)
+    const int color_sweeps_per_fill = blocked_sweeps ? 2 * d_smoother_sweeps_per_ghost_fill : 1;
+    for (int isweep = 0; isweep < num_sweeps; isweep += color_sweeps_per_fill)
     {
+        const int num_color_sweeps = std::min(color_sweeps_per_fill, num_sweeps - isweep);
+
         // Re-fill ghost cell data as needed.
         if (level_num > d_coarsest_ln)
         {
@@ -501,7 +611,35 @@ CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
                 const int F_ghosts = (residual_data->getGhostCellWidth()).max();
                 if (D_is_constant)
                 {
-                    if (red_black_ordering)
+                    if (blocked_sweeps)
+                    {
+                        int red_or_black = isweep % 2; // "red" = 0, "black" = 1
+#if (NDIM == 3)
+                        const int tile_size = get_blocked_smoother_tile_size(
+                            patch_box, U_ghosts, num_color_sweeps, 2, d_smoother_cache_size);
+#endif
+                        RB_GS_SMOOTH_BLOCKED_FC(U,
+                                                U_ghosts,
+                                                alpha,
+                                                beta,
+                                                F,
+                                                F_ghosts,
+                                                patch_box.lower(0),
+                                                patch_box.upper(0),
+                                                patch_box.lower(1),
+                                                patch_box.upper(1),
+#if (NDIM == 3)
+                                                patch_box.lower(2),
+                                                patch_box.upper(2),
+#endif
+                                                dx,
+#if (NDIM == 3)
+                                                tile_size,
+#endif
+                                                red_or_black,
+                                                num_color_sweeps);
+                    }
+                    else if (red_black_ordering)
                     {
                         int red_or_black = isweep % 2; // "red" = 0, "black" = 1
                         RB_GS_SMOOTH_FC(U,
@@ -548,7 +686,40 @@ CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
                     const double* const alpha2 = alpha_data->getPointer(2, depth);
 #endif
                     const int alpha_ghosts = (alpha_data->getGhostCellWidth()).max();
-                    if (red_black_ordering)
+                    if (blocked_sweeps)
+                    {
+                        int red_or_black = isweep % 2; // "red" = 0, "black" = 1
+#if (NDIM == 3)
+                        const int tile_size = get_blocked_smoother_tile_size(
+                            patch_box, U_ghosts, num_color_sweeps, 2 + NDIM, d_smoother_cache_size);
+#endif
+                        VC_CELL_RB_GS_SMOOTH_BLOCKED_FC(U,
+                                                        U_ghosts,
+                                                        alpha0,
+                                                        alpha1,
+#if (NDIM == 3)
+                                                        alpha2,
+#endif
+                                                        alpha_ghosts,
+                                                        beta,
+                                                        F,
+                                                        F_ghosts,
+                                                        patch_box.lower(0),
+                                                        patch_box.upper(0),
+                                                        patch_box.lower(1),
+                                                        patch_box.upper(1),
+#if (NDIM == 3)
+                                                        patch_box.lower(2),
+                                                        patch_box.upper(2),
+#endif
+                                                        dx,
+#if (NDIM == 3)
+                                                        tile_size,
+#endif
+                                                        red_or_black,
+                                                        num_color_sweeps);
+                    }
+                    else if (red_black_ordering)
                     {
                         int red_or_black = isweep % 2; // "red" = 0, "black" = 1
                         VC_CELL_RB_GS_SMOOTH_FC(U,
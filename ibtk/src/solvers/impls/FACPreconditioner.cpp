@@ -16,6 +16,7 @@
 #include "ibtk/FACPreconditioner.h"
 #include "ibtk/FACPreconditionerStrategy.h"
 #include "ibtk/LinearSolver.h"
+#include "ibtk/PatchDataMemoryPool.h"
 #include "ibtk/ibtk_enums.h"
 
 #include "MultiblockDataTranslator.h"
@@ -176,8 +177,8 @@ FACPreconditioner::initializeSolverState(const SAMRAIVectorReal<NDIM, double>& s
     {
         d_f = rhs.cloneVector("");
         d_r = rhs.cloneVector("");
-        d_f->allocateVectorData();
-        d_r->allocateVectorData();
+        d_f->allocateVectorData(0.0, PatchDataMemoryPool::getArena());
+        d_r->allocateVectorData(0.0, PatchDataMemoryPool::getArena());
     }
 
     // Allocate scratch data.
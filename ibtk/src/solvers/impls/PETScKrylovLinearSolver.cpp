@@ -22,6 +22,8 @@
 #include "ibtk/PETScMatLOWrapper.h"
 #include "ibtk/PETScPCLSWrapper.h"
 #include "ibtk/PETScSAMRAIVectorReal.h"
+#include "ibtk/PatchDataMemoryPool.h"
+#include "ibtk/PerformanceTrace.h"
 #include "ibtk/ibtk_utilities.h"
 
 #include "Box.h"
@@ -214,6 +216,11 @@ PETScKrylovLinearSolver::solveSystem(SAMRAIVectorReal<NDIM, double>& x, SAMRAIVe
     IBTK_CHKERRQ(ierr);
     ierr = KSPGetResidualNorm(d_petsc_ksp, &d_current_residual_norm);
     IBTK_CHKERRQ(ierr);
+    if (PerformanceTrace::isEnabled())
+    {
+        PerformanceTrace::recordValue(d_object_name + "::iterations", d_current_iterations);
+        PerformanceTrace::recordValue(d_object_name + "::residual_norm", d_current_residual_norm);
+    }
     d_A->setHomogeneousBc(d_homogeneous_bc);
 
     // Determine the convergence reason.
@@ -316,7 +323,7 @@ PETScKrylovLinearSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, doub
     d_petsc_b = PETScSAMRAIVectorReal::createPETScVector(d_b, d_petsc_comm);
 
     // Allocate scratch data.
-    d_b->allocateVectorData();
+    d_b->allocateVectorData(0.0, PatchDataMemoryPool::getArena());
 
     // Initialize the linear operator and preconditioner objects.
     if (d_A) d_A->initializeOperatorState(*d_x, *d_b);
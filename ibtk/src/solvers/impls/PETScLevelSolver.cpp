@@ -42,6 +42,7 @@
 #include <petsclog.h>
 
 #include <algorithm>
+#include <cstddef>
 #include <limits>
 #include <memory>
 #include <set>
@@ -113,6 +114,15 @@ generate_petsc_is_from_std_is(std::vector<std::set<int> >& overlap_std,
 
     return;
 } // generate_petsc_is_from_std_is
+
+std::vector<int>
+get_component_idxs(const SAMRAIVectorReal<NDIM, double>& x, const SAMRAIVectorReal<NDIM, double>& b)
+{
+    std::vector<int> idxs;
+    for (int comp = 0; comp < x.getNumberOfComponents(); ++comp) idxs.push_back(x.getComponentDescriptorIndex(comp));
+    for (int comp = 0; comp < b.getNumberOfComponents(); ++comp) idxs.push_back(b.getComponentDescriptorIndex(comp));
+    return idxs;
+} // get_component_idxs
 } // namespace
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -304,6 +314,28 @@ PETScLevelSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, double>& x,
                                  << "  coarsest_ln != finest_ln in PETScLevelSolver" << std::endl);
     }
 #endif
+    // Keep the solver state if neither the patch level nor the operator have
+    // changed since it was initialized.  If only the operator coefficients have
+    // changed, rewrite the matrix values in place when the subclass supports
+    // it.
+    if (d_is_initialized && d_reuse_solver_state && canReuseSolverState(x, b))
+    {
+        const std::size_t operator_fingerprint = computeOperatorFingerprint();
+        const int operator_changed = operator_fingerprint != d_operator_fingerprint ? 1 : 0;
+        if (IBTK_MPI::maxReduction(operator_changed) == 0)
+        {
+            IBTK_TIMER_STOP(t_initialize_solver_state);
+            return;
+        }
+        if (refreshOperatorValues())
+        {
+            resetSolverOperatorValues();
+            d_operator_fingerprint = operator_fingerprint;
+            IBTK_TIMER_STOP(t_initialize_solver_state);
+            return;
+        }
+    }
+
     // Deallocate the solver state if the solver is already initialized.
     if (d_is_initialized) deallocateSolverState();
 
@@ -637,6 +669,14 @@ PETScLevelSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, double>& x,
         }
     }
 
+    // Record the data needed to determine whether the solver state can be
+    // reused.
+    if (d_reuse_solver_state)
+    {
+        d_solver_state_idxs = get_component_idxs(x, b);
+        d_operator_fingerprint = computeOperatorFingerprint();
+    }
+
     // Indicate that the solver is initialized.
     d_is_initialized = true;
 
@@ -653,6 +693,7 @@ PETScLevelSolver::deallocateSolverState()
 
     // Perform specialized operations to deallocate solver state.
     deallocateSolverStateSpecialized();
+    d_mat_values_plan.clear();
 
     // Deallocate PETSc objects.
     int ierr;
@@ -750,6 +791,8 @@ PETScLevelSolver::init(Pointer<Database> input_db, const std::string& default_op
         if (input_db->keyExists("shell_pc_type")) d_shell_pc_type = input_db->getString("shell_pc_type");
         if (input_db->keyExists("initial_guess_nonzero"))
             d_initial_guess_nonzero = input_db->getBool("initial_guess_nonzero");
+        if (input_db->keyExists("reuse_solver_state"))
+            d_reuse_solver_state = input_db->getBool("reuse_solver_state");
         if (input_db->keyExists("subdomain_box_size"))
             input_db->getIntegerArray("subdomain_box_size", d_box_size, NDIM);
         if (input_db->keyExists("subdomain_overlap_size"))
@@ -810,8 +853,107 @@ PETScLevelSolver::setupNullspace()
     return;
 } // setupNullspace
 
+std::size_t
+PETScLevelSolver::computeOperatorFingerprint()
+{
+    return 0;
+} // computeOperatorFingerprint
+
+bool
+PETScLevelSolver::refreshOperatorValues()
+{
+    return false;
+} // refreshOperatorValues
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+bool
+PETScLevelSolver::canReuseSolverState(const SAMRAIVectorReal<NDIM, double>& x, const SAMRAIVectorReal<NDIM, double>& b)
+{
+    // The patch level must not have been regridded.
+    if (x.getPatchHierarchy() != d_hierarchy) return false;
+    if (x.getCoarsestLevelNumber() != d_level_num || x.getFinestLevelNumber() != d_level_num) return false;
+    if (d_hierarchy->getPatchLevel(d_level_num) != d_level) return false;
+
+    // The vectors must use the same patch data layout.
+    return get_component_idxs(x, b) == d_solver_state_idxs;
+} // canReuseSolverState
+
+void
+PETScLevelSolver::resetSolverOperatorValues()
+{
+    int ierr;
+    if (d_pc_type == "shell")
+    {
+        // The local submatrices are copies, so extract their values again.
+#if PETSC_VERSION_GE(3, 8, 0)
+        ierr = MatCreateSubMatrices(d_petsc_mat,
+                                    d_n_local_subdomains,
+                                    d_n_local_subdomains ? &d_overlap_is[0] : nullptr,
+                                    d_n_local_subdomains ? &d_overlap_is[0] : nullptr,
+                                    MAT_REUSE_MATRIX,
+                                    &d_sub_mat);
+#else
+        ierr = MatGetSubMatrices(d_petsc_mat,
+                                 d_n_local_subdomains,
+                                 d_n_local_subdomains ? &d_overlap_is[0] : nullptr,
+                                 d_n_local_subdomains ? &d_overlap_is[0] : nullptr,
+                                 MAT_REUSE_MATRIX,
+                                 &d_sub_mat);
+#endif
+        IBTK_CHKERRQ(ierr);
+        if (d_shell_pc_type == "multiplicative" && d_n_local_subdomains > 0)
+        {
+            PetscInt n_lo, n_hi;
+            ierr = VecGetOwnershipRange(d_petsc_x, &n_lo, &n_hi);
+            IBTK_CHKERRQ(ierr);
+            IS local_idx;
+            ierr = ISCreateStride(PETSC_COMM_WORLD, n_hi - n_lo, n_lo, 1, &local_idx);
+            IBTK_CHKERRQ(ierr);
+            std::vector<IS> local_idxs(d_n_local_subdomains, local_idx);
+#if PETSC_VERSION_GE(3, 8, 0)
+            ierr = MatCreateSubMatrices(
+                d_petsc_mat, d_n_local_subdomains, &d_overlap_is[0], &local_idxs[0], MAT_REUSE_MATRIX, &d_sub_bc_mat);
+#else
+            ierr = MatGetSubMatrices(
+                d_petsc_mat, d_n_local_subdomains, &d_overlap_is[0], &local_idxs[0], MAT_REUSE_MATRIX, &d_sub_bc_mat);
+#endif
+            IBTK_CHKERRQ(ierr);
+            for (int i = 0; i < d_n_local_subdomains; ++i)
+            {
+                ierr = MatScale(d_sub_bc_mat[i], -1.0);
+                IBTK_CHKERRQ(ierr);
+            }
+            ierr = ISDestroy(&local_idx);
+            IBTK_CHKERRQ(ierr);
+        }
+
+        // Factor the subdomain matrices again.
+        for (int i = 0; i < d_n_local_subdomains; ++i)
+        {
+            ierr = KSPSetReusePreconditioner(d_sub_ksp[i], PETSC_FALSE);
+            IBTK_CHKERRQ(ierr);
+            ierr = KSPSetOperators(d_sub_ksp[i], d_sub_mat[i], d_sub_mat[i]);
+            IBTK_CHKERRQ(ierr);
+            ierr = KSPSetUp(d_sub_ksp[i]);
+            IBTK_CHKERRQ(ierr);
+            ierr = KSPSetReusePreconditioner(d_sub_ksp[i], PETSC_TRUE);
+            IBTK_CHKERRQ(ierr);
+        }
+    }
+
+    // Set up the preconditioner again for the new matrix values.
+    ierr = KSPSetReusePreconditioner(d_petsc_ksp, PETSC_FALSE);
+    IBTK_CHKERRQ(ierr);
+    ierr = KSPSetOperators(d_petsc_ksp, d_petsc_mat, d_petsc_pc);
+    IBTK_CHKERRQ(ierr);
+    ierr = KSPSetUp(d_petsc_ksp);
+    IBTK_CHKERRQ(ierr);
+    ierr = KSPSetReusePreconditioner(d_petsc_ksp, PETSC_TRUE);
+    IBTK_CHKERRQ(ierr);
+    return;
+} // resetSolverOperatorValues
+
 PetscErrorCode
 PETScLevelSolver::PCApply_Additive(PC pc, Vec x, Vec y)
 {
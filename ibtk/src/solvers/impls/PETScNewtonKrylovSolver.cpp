@@ -26,6 +26,7 @@
 #include "ibtk/PETScSAMRAIVectorReal.h"
 #include "ibtk/PETScSNESFunctionGOWrapper.h"
 #include "ibtk/PETScSNESJacobianJOWrapper.h"
+#include "ibtk/PerformanceTrace.h"
 
 #include "Box.h"
 #include "MultiblockDataTranslator.h"
@@ -218,6 +219,12 @@ PETScNewtonKrylovSolver::solveSystem(SAMRAIVectorReal<NDIM, double>& x, SAMRAIVe
     IBTK_CHKERRQ(ierr);
     ierr = VecNorm(residual, NORM_2, &d_current_residual_norm);
     IBTK_CHKERRQ(ierr);
+    if (PerformanceTrace::isEnabled())
+    {
+        PerformanceTrace::recordValue(d_object_name + "::iterations", d_current_iterations);
+        PerformanceTrace::recordValue(d_object_name + "::linear_iterations", d_current_linear_iterations);
+        PerformanceTrace::recordValue(d_object_name + "::residual_norm", d_current_residual_norm);
+    }
 
     // Determine the convergence reason.
     SNESConvergedReason reason;
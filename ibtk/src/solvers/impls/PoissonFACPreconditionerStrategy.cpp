@@ -18,6 +18,7 @@
 #include "ibtk/FACPreconditionerStrategy.h"
 #include "ibtk/HierarchyGhostCellInterpolation.h"
 #include "ibtk/HierarchyMathOps.h"
+#include "ibtk/PatchDataMemoryPool.h"
 #include "ibtk/PoissonFACPreconditionerStrategy.h"
 #include "ibtk/RefinePatchStrategySet.h"
 #include "ibtk/RobinPhysBdryPatchStrategy.h"
@@ -382,7 +383,8 @@ PoissonFACPreconditionerStrategy::initializeOperatorState(const SAMRAIVectorReal
     for (int ln = std::max(d_coarsest_ln, coarsest_reset_ln); ln <= finest_reset_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        if (!level->checkAllocated(d_scratch_idx)) level->allocatePatchData(d_scratch_idx);
+        if (!level->checkAllocated(d_scratch_idx))
+            level->allocatePatchData(d_scratch_idx, 0.0, PatchDataMemoryPool::getArena());
     }
 
     // Get the transfer operators.
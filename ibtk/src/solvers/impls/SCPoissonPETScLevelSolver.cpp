@@ -44,6 +44,7 @@
 #include <petsclog.h>
 
 #include <algorithm>
+#include <cstddef>
 #include <set>
 #include <string>
 #include <utility>
@@ -208,6 +209,12 @@ SCPoissonPETScLevelSolver::setupKSPVecs(Vec& petsc_x,
     return;
 } // setupKSPVecs
 
+std::size_t
+SCPoissonPETScLevelSolver::computeOperatorFingerprint()
+{
+    return PoissonUtilities::computeOperatorFingerprint(d_poisson_spec, d_bc_coefs, d_level, d_solution_time);
+} // computeOperatorFingerprint
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
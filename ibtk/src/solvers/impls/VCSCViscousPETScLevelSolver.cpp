@@ -39,6 +39,7 @@
 #include "petscvec.h"
 #include <petsclog.h>
 
+#include <functional>
 #include <string>
 #include <utility>
 
@@ -158,6 +159,35 @@ VCSCViscousPETScLevelSolver::setupKSPVecs(Vec& petsc_x,
     return;
 } // setupKSPVecs
 
+std::size_t
+VCSCViscousPETScLevelSolver::computeOperatorFingerprint()
+{
+    // The interpolated viscosity enters the matrix coefficients, so the
+    // interpolation type is part of the operator.
+    std::size_t seed = SCPoissonPETScLevelSolver::computeOperatorFingerprint();
+    PoissonUtilities::hashCombine(seed, std::hash<int>()(static_cast<int>(d_mu_interp_type)));
+    return seed;
+} // computeOperatorFingerprint
+
+bool
+VCSCViscousPETScLevelSolver::refreshOperatorValues()
+{
+    const double alpha = 1.0;
+    const double beta = 1.0;
+    PETScMatUtilities::refreshPatchLevelVCSCViscousOpValues(d_petsc_mat,
+                                                            d_mat_values_plan,
+                                                            d_poisson_spec,
+                                                            alpha,
+                                                            beta,
+                                                            d_bc_coefs,
+                                                            d_solution_time,
+                                                            d_num_dofs_per_proc,
+                                                            d_dof_index_idx,
+                                                            d_level,
+                                                            d_mu_interp_type);
+    return true;
+} // refreshOperatorValues
+
 void
 VCSCViscousPETScLevelSolver::setViscosityInterpolationType(const IBTK::VCInterpType mu_interp_type)
 {
@@ -140,6 +140,83 @@ c
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
+c     Perform num_color_sweeps alternating "red" and "black" Gauss-Seidel
+c     sweeps for F = alpha div grad U + beta U in a single cache-blocked
+c     pass over the patch data.
+c
+c     The color sweeps are pipelined along i1 as a wavefront, with sweep
+c     h lagging sweep h-1 by one row.  The result is identical to
+c     performing the color sweeps one after the other with fixed ghost
+c     cell values, but each row is brought into cache only once.
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine rbgssmoothblocked2d(
+     &     U,U_gcw,
+     &     alpha,beta,
+     &     F,F_gcw,
+     &     ilower0,iupper0,
+     &     ilower1,iupper1,
+     &     dx,
+     &     red_or_black,
+     &     num_color_sweeps)
+c
+      implicit none
+c
+c     Input.
+c
+      INTEGER ilower0,iupper0
+      INTEGER ilower1,iupper1
+      INTEGER U_gcw,F_gcw
+      INTEGER red_or_black
+      INTEGER num_color_sweeps
+
+      REAL alpha,beta
+
+      REAL F(ilower0-F_gcw:iupper0+F_gcw,
+     &       ilower1-F_gcw:iupper1+F_gcw)
+
+      REAL dx(0:NDIM-1)
+c
+c     Input/Output.
+c
+      REAL U(ilower0-U_gcw:iupper0+U_gcw,
+     &       ilower1-U_gcw:iupper1+U_gcw)
+c
+c     Local variables.
+c
+      INTEGER i0,i1,ih,ik,nt
+      INTEGER color
+      REAL    fac0,fac1,fac
+c
+c     Perform the pipelined "red" and "black" Gauss-Seidel sweeps.
+c
+      fac0 = alpha/(dx(0)*dx(0))
+      fac1 = alpha/(dx(1)*dx(1))
+      fac = 0.5d0/(fac0+fac1-0.5d0*beta)
+
+      nt = max(num_color_sweeps,1)
+
+      do ik = ilower1,iupper1+nt-1
+         do ih = 0,nt-1
+            i1 = ik-ih
+            if ( (i1 .ge. ilower1) .and. (i1 .le. iupper1) ) then
+               color = mod(red_or_black+ih,2) ! "red" = 0, "black" = 1
+               do i0 = ilower0+iand(ilower0+i1+color,1),iupper0,2
+                  U(i0,i1) = fac*(
+     &                 fac0*(U(i0-1,i1)+U(i0+1,i1)) +
+     &                 fac1*(U(i0,i1-1)+U(i0,i1+1)) -
+     &                 F(i0,i1))
+               enddo
+            endif
+         enddo
+      enddo
+c
+      return
+      end
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
 c     Perform a single Gauss-Seidel sweep for F = alpha div grad U +
 c     beta U with masking of certain degrees of freedom.
 c
@@ -437,6 +514,94 @@ c
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
+c     Perform num_color_sweeps alternating "red" and "black" Gauss-Seidel
+c     sweeps for F = div alpha grad U + beta U in a single cache-blocked
+c     pass over the patch data.
+c
+c     The smoother is written for cell-centered U and side-centered
+c     alpha = (alpha0,alpha1).  The blocking strategy is the same as in
+c     rbgssmoothblocked2d.
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine vccellrbgssmoothblocked2d(
+     &     U,U_gcw,
+     &     alpha0,alpha1,alpha_gcw,
+     &     beta,
+     &     F,F_gcw,
+     &     ilower0,iupper0,
+     &     ilower1,iupper1,
+     &     dx,
+     &     red_or_black,
+     &     num_color_sweeps)
+c
+      implicit none
+c
+c     Input.
+c
+      INTEGER ilower0,iupper0
+      INTEGER ilower1,iupper1
+      INTEGER U_gcw,F_gcw,alpha_gcw
+      INTEGER red_or_black
+      INTEGER num_color_sweeps
+      REAL beta
+
+      REAL F(ilower0-F_gcw:iupper0+F_gcw,
+     &       ilower1-F_gcw:iupper1+F_gcw)
+
+      REAL alpha0(SIDE2d0(ilower,iupper,alpha_gcw))
+      REAL alpha1(SIDE2d1(ilower,iupper,alpha_gcw))
+
+      REAL dx(0:NDIM-1)
+c
+c     Input/Output.
+c
+      REAL U(ilower0-U_gcw:iupper0+U_gcw,
+     &       ilower1-U_gcw:iupper1+U_gcw)
+c
+c     Local variables.
+c
+      INTEGER i0,i1,ih,ik,nt
+      INTEGER color
+      REAL    hxhx,hyhy
+      REAL    facu0,facl0
+      REAL    facu1,facl1
+      REAL    fac
+c
+c     Perform the pipelined "red" and "black" Gauss-Seidel sweeps.
+c
+      hxhx = dx(0)*dx(0)
+      hyhy = dx(1)*dx(1)
+
+      nt = max(num_color_sweeps,1)
+
+      do ik = ilower1,iupper1+nt-1
+         do ih = 0,nt-1
+            i1 = ik-ih
+            if ( (i1 .ge. ilower1) .and. (i1 .le. iupper1) ) then
+               color = mod(red_or_black+ih,2) ! "red" = 0, "black" = 1
+               do i0 = ilower0+iand(ilower0+i1+color,1),iupper0,2
+                  facu0 = alpha0(i0+1,i1)/hxhx
+                  facl0 = alpha0(i0,i1)/hxhx
+                  facu1 = alpha1(i0,i1+1)/hyhy
+                  facl1 = alpha1(i0,i1)/hyhy
+                  fac   = 1.d0/(facu0+facl0+facu1+facl1-beta)
+                  U(i0,i1) = fac*(
+     &                 facu0*U(i0+1,i1) +
+     &                 facl0*U(i0-1,i1) +
+     &                 facu1*U(i0,i1+1) +
+     &                 facl1*U(i0,i1-1) -
+     &                 F(i0,i1))
+               enddo
+            endif
+         enddo
+      enddo
+c
+      return
+      end
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
 c  Perform a single Gauss-Seidel sweep for 
 c     (f0,f1) = alpha div mu (grad (u0,u1) + grad (u0, u1)^T) + beta c (u0,u1).
 c
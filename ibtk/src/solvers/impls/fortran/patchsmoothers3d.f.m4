@@ -156,6 +156,101 @@ c
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
+c     Perform num_color_sweeps alternating "red" and "black" Gauss-Seidel
+c     sweeps for F = alpha div grad U + beta U in a single cache-blocked
+c     pass over the patch data.
+c
+c     The patch is split into tiles of tile1 cells in the i1 direction.
+c     Within each tile, the color sweeps are pipelined along i2 as a
+c     wavefront, with sweep h lagging sweep h-1 by one plane and one row.
+c     The result is identical to performing the color sweeps one after
+c     the other with fixed ghost cell values, but each tile is brought
+c     into cache only once.
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine rbgssmoothblocked3d(
+     &     U,U_gcw,
+     &     alpha,beta,
+     &     F,F_gcw,
+     &     ilower0,iupper0,
+     &     ilower1,iupper1,
+     &     ilower2,iupper2,
+     &     dx,
+     &     tile1,
+     &     red_or_black,
+     &     num_color_sweeps)
+c
+      implicit none
+c
+c     Input.
+c
+      INTEGER ilower0,iupper0
+      INTEGER ilower1,iupper1
+      INTEGER ilower2,iupper2
+      INTEGER U_gcw,F_gcw
+      INTEGER tile1
+      INTEGER red_or_black
+      INTEGER num_color_sweeps
+
+      REAL alpha,beta
+
+      REAL F(ilower0-F_gcw:iupper0+F_gcw,
+     &     ilower1-F_gcw:iupper1+F_gcw,
+     &     ilower2-F_gcw:iupper2+F_gcw)
+
+      REAL dx(0:NDIM-1)
+c
+c     Input/Output.
+c
+      REAL U(ilower0-U_gcw:iupper0+U_gcw,
+     &     ilower1-U_gcw:iupper1+U_gcw,
+     &     ilower2-U_gcw:iupper2+U_gcw)
+c
+c     Local variables.
+c
+      INTEGER i0,i1,i2,ih,ik,it,nt,tile
+      INTEGER color,jlower1,jupper1
+      REAL    fac0,fac1,fac2,fac
+c
+c     Perform the pipelined "red" and "black" Gauss-Seidel sweeps.
+c
+      fac0 = alpha/(dx(0)*dx(0))
+      fac1 = alpha/(dx(1)*dx(1))
+      fac2 = alpha/(dx(2)*dx(2))
+      fac = 0.5d0/(fac0+fac1+fac2-0.5d0*beta)
+
+      nt = max(num_color_sweeps,1)
+      tile = max(tile1,1)
+
+      do it = ilower1,iupper1+nt-1,tile
+         do ik = ilower2,iupper2+nt-1
+            do ih = 0,nt-1
+               i2 = ik-ih
+               if ( (i2 .ge. ilower2) .and. (i2 .le. iupper2) ) then
+                  color = mod(red_or_black+ih,2) ! "red" = 0, "black" = 1
+                  jlower1 = max(ilower1,it-ih)
+                  jupper1 = min(iupper1,it+tile-1-ih)
+                  do i1 = jlower1,jupper1
+                     do i0 = ilower0+iand(ilower0+i1+i2+color,1),
+     &                    iupper0,2
+                        U(i0,i1,i2) = fac*(
+     &                       fac0*(U(i0-1,i1,i2)+U(i0+1,i1,i2)) +
+     &                       fac1*(U(i0,i1-1,i2)+U(i0,i1+1,i2)) +
+     &                       fac2*(U(i0,i1,i2-1)+U(i0,i1,i2+1)) -
+     &                       F(i0,i1,i2))
+                     enddo
+                  enddo
+               endif
+            enddo
+         enddo
+      enddo
+c
+      return
+      end
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
 c     Perform a single Gauss-Seidel sweep for F = alpha div grad U +
 c     beta U with masking of certain degrees of freedom.
 c
@@ -494,6 +589,117 @@ c
       return
       end
 c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+c     Perform num_color_sweeps alternating "red" and "black" Gauss-Seidel
+c     sweeps for F = div alpha grad U + beta U in a single cache-blocked
+c     pass over the patch data.
+c
+c     The smoother is written for cell-centered U and side-centered
+c     alpha = (alpha0,alpha1,alpha2).  The blocking strategy is the same
+c     as in rbgssmoothblocked3d.
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine vccellrbgssmoothblocked3d(
+     &     U,U_gcw,
+     &     alpha0,alpha1,alpha2,alpha_gcw,
+     &     beta,
+     &     F,F_gcw,
+     &     ilower0,iupper0,
+     &     ilower1,iupper1,
+     &     ilower2,iupper2,
+     &     dx,
+     &     tile1,
+     &     red_or_black,
+     &     num_color_sweeps)
+c
+      implicit none
+c
+c     Input.
+c
+      INTEGER ilower0,iupper0
+      INTEGER ilower1,iupper1
+      INTEGER ilower2,iupper2
+      INTEGER U_gcw,F_gcw,alpha_gcw
+      INTEGER tile1
+      INTEGER red_or_black
+      INTEGER num_color_sweeps
+
+      REAL beta
+
+      REAL F(ilower0-F_gcw:iupper0+F_gcw,
+     &     ilower1-F_gcw:iupper1+F_gcw,
+     &     ilower2-F_gcw:iupper2+F_gcw)
+
+      REAL alpha0(SIDE3d0(ilower,iupper,alpha_gcw))
+      REAL alpha1(SIDE3d1(ilower,iupper,alpha_gcw))
+      REAL alpha2(SIDE3d2(ilower,iupper,alpha_gcw))
+
+      REAL dx(0:NDIM-1)
+c
+c     Input/Output.
+c
+      REAL U(ilower0-U_gcw:iupper0+U_gcw,
+     &     ilower1-U_gcw:iupper1+U_gcw,
+     &     ilower2-U_gcw:iupper2+U_gcw)
+c
+c     Local variables.
+c
+      INTEGER i0,i1,i2,ih,ik,it,nt,tile
+      INTEGER color,jlower1,jupper1
+      REAL    hxhx,hyhy,hzhz
+      REAL    facu0,facl0
+      REAL    facu1,facl1
+      REAL    facu2,facl2
+      REAL    fac
+c
+c     Perform the pipelined "red" and "black" Gauss-Seidel sweeps.
+c
+      hxhx = dx(0)*dx(0)
+      hyhy = dx(1)*dx(1)
+      hzhz = dx(2)*dx(2)
+
+      nt = max(num_color_sweeps,1)
+      tile = max(tile1,1)
+
+      do it = ilower1,iupper1+nt-1,tile
+         do ik = ilower2,iupper2+nt-1
+            do ih = 0,nt-1
+               i2 = ik-ih
+               if ( (i2 .ge. ilower2) .and. (i2 .le. iupper2) ) then
+                  color = mod(red_or_black+ih,2) ! "red" = 0, "black" = 1
+                  jlower1 = max(ilower1,it-ih)
+                  jupper1 = min(iupper1,it+tile-1-ih)
+                  do i1 = jlower1,jupper1
+                     do i0 = ilower0+iand(ilower0+i1+i2+color,1),
+     &                    iupper0,2
+                        facu0 = alpha0(i0+1,i1,i2)/hxhx
+                        facl0 = alpha0(i0,i1,i2)/hxhx
+                        facu1 = alpha1(i0,i1+1,i2)/hyhy
+                        facl1 = alpha1(i0,i1,i2)/hyhy
+                        facu2 = alpha2(i0,i1,i2+1)/hzhz
+                        facl2 = alpha2(i0,i1,i2)/hzhz
+                        fac = 1.d0/(facu0+facl0+facu1+facl1+facu2+facl2
+     &                       -beta)
+                        U(i0,i1,i2) = fac*(
+     &                       facu0*U(i0+1,i1,i2) +
+     &                       facl0*U(i0-1,i1,i2) +
+     &                       facu1*U(i0,i1+1,i2) +
+     &                       facl1*U(i0,i1-1,i2) +
+     &                       facu2*U(i0,i1,i2+1) +
+     &                       facl2*U(i0,i1,i2-1) -
+     &                       F(i0,i1,i2))
+                     enddo
+                  enddo
+               endif
+            enddo
+         enddo
+      enddo
+c
+      return
+      end
+c
 cccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c  Perform a single Gauss-Seidel sweep for 
 c     (f0,f1,f2) = alpha div mu (grad (u0,u1,u2) + grad (u0, u1,u2)^T) + beta c (u0,u1,u2).
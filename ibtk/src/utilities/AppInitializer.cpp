@@ -14,8 +14,11 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include "ibtk/AppInitializer.h"
+#include "ibtk/AsynchronousCheckpointWriter.h"
 #include "ibtk/IBTK_MPI.h"
 #include "ibtk/LSiloDataWriter.h"
+#include "ibtk/PatchDataMemoryPool.h"
+#include "ibtk/PerformanceTrace.h"
 
 #include "VisItDataWriter.h"
 #include "tbox/Array.h"
@@ -75,6 +78,7 @@ AppInitializer::AppInitializer(int argc, char* argv[], const std::string& defaul
     // Process restart data if this is a restarted run.
     if (d_is_from_restart)
     {
+        AsynchronousCheckpointWriter::extractCheckpoint(d_restart_read_dirname, d_restart_restore_num);
         RestartManager::getManager()->openRestartFile(
             d_restart_read_dirname, d_restart_restore_num, IBTK_MPI::getNodes());
     }
@@ -134,6 +138,38 @@ AppInitializer::AppInitializer(int argc, char* argv[], const std::string& defaul
         d_timer_dump_interval = main_db->getInteger(timer_dump_interval_key_name);
     }
 
+    // Configure pooling of patch data memory.
+    if (main_db->keyExists("enable_patch_data_memory_pool"))
+    {
+        PatchDataMemoryPool::setEnabled(main_db->getBool("enable_patch_data_memory_pool"));
+    }
+    if (main_db->keyExists("patch_data_memory_pool_max_retained_bytes"))
+    {
+        const int max_retained_bytes = main_db->getInteger("patch_data_memory_pool_max_retained_bytes");
+        if (max_retained_bytes < 0)
+        {
+            TBOX_ERROR("AppInitializer::AppInitializer():\n"
+                       << "  patch_data_memory_pool_max_retained_bytes must be nonnegative.\n");
+        }
+        PatchDataMemoryPool::getPool()->setMaxRetainedBytes(max_retained_bytes);
+    }
+
+    // Configure the performance trace.
+    if (main_db->keyExists("enable_performance_trace"))
+    {
+        PerformanceTrace::setEnabled(main_db->getBool("enable_performance_trace"));
+    }
+    if (main_db->keyExists("performance_trace_max_records"))
+    {
+        const int max_records = main_db->getInteger("performance_trace_max_records");
+        if (max_records < 0)
+        {
+            TBOX_ERROR("AppInitializer::AppInitializer():\n"
+                       << "  performance_trace_max_records must be nonnegative.\n");
+        }
+        PerformanceTrace::setMaximumNumberOfRecords(max_records);
+    }
+
     // Avoid some warnings by unconditionally creating the timer database, even if
     // we never use it:
     {
@@ -246,6 +282,8 @@ AppInitializer::AppInitializer(int argc, char* argv[], const std::string& defaul
         if (viz_writer == "Silo")
         {
             d_silo_data_writer = new LSiloDataWriter("LSiloDataWriter", d_viz_dump_dirname);
+            if (main_db->keyExists("silo_number_output_files"))
+                d_silo_data_writer->setNumberOfOutputFiles(main_db->getInteger("silo_number_output_files"));
         }
 
         if (viz_writer == "ExodusII")
@@ -0,0 +1,603 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibtk/AsynchronousCheckpointWriter.h"
+#include "ibtk/IBTK_MPI.h"
+#include "ibtk/ibtk_utilities.h"
+
+#include "tbox/Database.h"
+#include "tbox/PIO.h"
+#include "tbox/Pointer.h"
+#include "tbox/RestartManager.h"
+#include "tbox/Timer.h"
+#include "tbox/TimerManager.h"
+#include "tbox/Utilities.h"
+
+#include <mpi.h>
+
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <future>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// Timers.
+static Timer* t_write_checkpoint;
+static Timer* t_wait_for_completion;
+
+// Identifier at the start of each aggregate file.
+static const char AGGREGATE_FILE_MAGIC[8] = { 'I', 'B', 'T', 'K', 'A', 'G', 'G', '1' };
+
+// Messages larger than this are split into several messages, since MPI counts
+// are of type int.
+static const std::uint64_t MAX_MESSAGE_SIZE = 1 << 30;
+
+// Permissions of the directories that are created.
+static const mode_t DIR_MODE = S_IRWXU | S_IRGRP | S_IXGRP | S_IROTH | S_IXOTH;
+
+inline std::string
+get_restore_dirname(const std::string& root_dirname, const int restore_num)
+{
+    return root_dirname + "/restore." + Utilities::intToString(restore_num, 6);
+} // get_restore_dirname
+
+template <typename T>
+inline void
+append_value(std::vector<char>& buffer, const T value)
+{
+    const char* const p = reinterpret_cast<const char*>(&value);
+    buffer.insert(buffer.end(), p, p + sizeof(T));
+    return;
+} // append_value
+
+template <typename T>
+inline T
+extract_value(const std::vector<char>& buffer, std::size_t& offset)
+{
+    TBOX_ASSERT(offset + sizeof(T) <= buffer.size());
+    T value;
+    std::memcpy(&value, buffer.data() + offset, sizeof(T));
+    offset += sizeof(T);
+    return value;
+} // extract_value
+
+// Append every regular file below root_dirname to the buffer as a (relative
+// path, contents) record and remove the staged files and directories.
+void
+snapshot_and_remove_files(const std::string& root_dirname, const std::string& rel_dirname, std::vector<char>& buffer)
+{
+    const std::string dirname = rel_dirname.empty() ? root_dirname : root_dirname + "/" + rel_dirname;
+    DIR* dir = opendir(dirname.c_str());
+    if (!dir)
+    {
+        TBOX_ERROR("AsynchronousCheckpointWriter: could not open staging directory " << dirname << "\n");
+    }
+    std::vector<std::string> entries;
+    for (dirent* entry = readdir(dir); entry; entry = readdir(dir))
+    {
+        const std::string name = entry->d_name;
+        if (name != "." && name != "..") entries.push_back(name);
+    }
+    closedir(dir);
+    std::sort(entries.begin(), entries.end());
+
+    for (const auto& name : entries)
+    {
+        const std::string rel_path = rel_dirname.empty() ? name : rel_dirname + "/" + name;
+        const std::string path = root_dirname + "/" + rel_path;
+        struct stat status;
+        if (stat(path.c_str(), &status) != 0) continue;
+        if (S_ISDIR(status.st_mode))
+        {
+            snapshot_and_remove_files(root_dirname, rel_path, buffer);
+            rmdir(path.c_str());
+        }
+        else if (S_ISREG(status.st_mode))
+        {
+            std::ifstream is(path.c_str(), std::ios::binary);
+            std::vector<char> contents((std::istreambuf_iterator<char>(is)), std::istreambuf_iterator<char>());
+            if (contents.size() != static_cast<std::size_t>(status.st_size))
+            {
+                TBOX_ERROR("AsynchronousCheckpointWriter: could not read staged file " << path << "\n");
+            }
+            append_value<std::uint64_t>(buffer, rel_path.size());
+            buffer.insert(buffer.end(), rel_path.begin(), rel_path.end());
+            append_value<std::uint64_t>(buffer, contents.size());
+            buffer.insert(buffer.end(), contents.begin(), contents.end());
+            std::remove(path.c_str());
+        }
+    }
+    return;
+} // snapshot_and_remove_files
+
+// Write the files that are recorded in the buffer to root_dirname.
+void
+restore_files(const std::string& root_dirname, const std::vector<char>& buffer)
+{
+    std::size_t offset = 0;
+    while (offset < buffer.size())
+    {
+        const auto path_size = extract_value<std::uint64_t>(buffer, offset);
+        const std::string rel_path(buffer.data() + offset, path_size);
+        offset += path_size;
+        const auto data_size = extract_value<std::uint64_t>(buffer, offset);
+        TBOX_ASSERT(offset + data_size <= buffer.size());
+
+        const std::string path = root_dirname + "/" + rel_path;
+        const std::string::size_type slash = path.find_last_of('/');
+        Utilities::recursiveMkdir(path.substr(0, slash), DIR_MODE, false);
+        std::ofstream os(path.c_str(), std::ios::binary | std::ios::trunc);
+        os.write(buffer.data() + offset, data_size);
+        if (!os.good())
+        {
+            TBOX_ERROR("AsynchronousCheckpointWriter::extractCheckpoint(): could not write file " << path << "\n");
+        }
+        offset += data_size;
+    }
+    return;
+} // restore_files
+} // namespace
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+AsynchronousCheckpointWriter::AsynchronousCheckpointWriter(std::string object_name, Pointer<Database> input_db)
+    : d_object_name(std::move(object_name))
+{
+    const int nodes = IBTK_MPI::getNodes();
+    d_num_aggregators = std::max(1, nodes / 64);
+
+    // Stage restart data in memory-backed storage if it is available.
+    struct stat status;
+    if (stat("/dev/shm", &status) == 0 && S_ISDIR(status.st_mode)) d_staging_dirname = "/dev/shm";
+
+    if (input_db)
+    {
+        if (input_db->keyExists("enable_asynchronous_writes"))
+            d_enable_asynchronous_writes = input_db->getBool("enable_asynchronous_writes");
+        if (input_db->keyExists("num_aggregators")) d_num_aggregators = input_db->getInteger("num_aggregators");
+        if (input_db->keyExists("max_aggregator_buffer_size"))
+        {
+            const int max_aggregator_buffer_size = input_db->getInteger("max_aggregator_buffer_size");
+            if (max_aggregator_buffer_size < 1)
+            {
+                TBOX_ERROR(d_object_name << "::AsynchronousCheckpointWriter():\n"
+                                         << "  max_aggregator_buffer_size must be positive\n");
+            }
+            d_max_aggregator_buffer_size = max_aggregator_buffer_size;
+        }
+        if (input_db->keyExists("staging_dirname")) d_staging_dirname = input_db->getString("staging_dirname");
+    }
+    if (d_num_aggregators < 1)
+    {
+        TBOX_ERROR(d_object_name << "::AsynchronousCheckpointWriter():\n"
+                                 << "  num_aggregators must be positive\n");
+    }
+    d_num_aggregators = std::min(d_num_aggregators, nodes);
+
+    // Divide the processes into groups of consecutive ranks.
+    d_group_size = (nodes + d_num_aggregators - 1) / d_num_aggregators;
+    d_group_num = IBTK_MPI::getRank() / d_group_size;
+    MPI_Comm_split(IBTK_MPI::getCommunicator(), d_group_num, IBTK_MPI::getRank(), &d_group_comm);
+    d_is_aggregator = IBTK_MPI::getRank(d_group_comm) == 0;
+
+    // The background thread makes no MPI calls, but the MPI library must
+    // still permit a second thread to exist.
+    int thread_level;
+    MPI_Query_thread(&thread_level);
+    d_use_background_thread = thread_level >= MPI_THREAD_FUNNELED;
+
+    // Setup Timers.
+    IBTK_DO_ONCE(t_write_checkpoint =
+                     TimerManager::getManager()->getTimer("IBTK::AsynchronousCheckpointWriter::writeCheckpoint()");
+                 t_wait_for_completion =
+                     TimerManager::getManager()->getTimer("IBTK::AsynchronousCheckpointWriter::waitForCompletion()"););
+    return;
+} // AsynchronousCheckpointWriter
+
+AsynchronousCheckpointWriter::~AsynchronousCheckpointWriter()
+{
+    int finalized;
+    MPI_Finalized(&finalized);
+    if (!finalized)
+    {
+        waitForCompletion();
+        MPI_Comm_free(&d_group_comm);
+    }
+    return;
+} // ~AsynchronousCheckpointWriter
+
+void
+AsynchronousCheckpointWriter::registerStagingCallback(std::function<void(const std::string&, int)> callback)
+{
+    d_staging_callbacks.push_back(std::move(callback));
+    return;
+} // registerStagingCallback
+
+void
+AsynchronousCheckpointWriter::writeCheckpoint(const std::string& restart_dump_dirname, const int restore_num)
+{
+    waitForCompletion();
+
+    IBTK_TIMER_START(t_write_checkpoint);
+
+    const int rank = IBTK_MPI::getRank();
+    const int nodes = IBTK_MPI::getNodes();
+
+    // Write the restart data to a staging directory that is private to this
+    // process.  The staging directory may be shared by the processes of a
+    // node (or by all processes), so its name includes the rank.  SAMRAI only
+    // creates the restart directory on rank 0, so we create it here on every
+    // process.
+    const std::string staging_root = d_staging_dirname + "/" + d_object_name + "." + std::to_string(rank) + "." +
+                                     std::to_string(getpid());
+    Utilities::recursiveMkdir(get_restore_dirname(staging_root, restore_num) + "/nodes." +
+                                  Utilities::nodeToString(nodes),
+                              DIR_MODE,
+                              false);
+    RestartManager::getManager()->writeRestartFile(staging_root, restore_num);
+    for (const auto& callback : d_staging_callbacks) callback(staging_root, restore_num);
+
+    // Take an in-memory snapshot of the staged files.
+    d_snapshot.clear();
+    snapshot_and_remove_files(staging_root, "", d_snapshot);
+    rmdir(staging_root.c_str());
+
+    // Collect the sizes of the snapshots of the group on the aggregator.
+    const int group_nodes = IBTK_MPI::getNodes(d_group_comm);
+    unsigned long long snapshot_size = d_snapshot.size();
+    std::vector<unsigned long long> snapshot_sizes(d_is_aggregator ? group_nodes : 0);
+    MPI_Gather(
+        &snapshot_size, 1, MPI_UNSIGNED_LONG_LONG, snapshot_sizes.data(), 1, MPI_UNSIGNED_LONG_LONG, 0, d_group_comm);
+
+    // Post the (nonblocking) transfers of the snapshots to the aggregator.
+    d_requests.clear();
+    d_write_failed = false;
+    d_restore_dirname = get_restore_dirname(restart_dump_dirname, restore_num);
+    if (d_is_aggregator)
+    {
+        // A previously written checkpoint with the same restore number is no
+        // longer valid once we start to overwrite its files.
+        Utilities::recursiveMkdir(d_restore_dirname, DIR_MODE, false);
+        if (rank == 0) std::remove((d_restore_dirname + "/aggregate.info").c_str());
+        d_aggregate_file_name = d_restore_dirname + "/aggregate." + Utilities::nodeToString(d_group_num);
+
+        // The aggregate file starts with an index that contains the rank,
+        // offset, and size of the data of each process of the group, followed
+        // by the data of the aggregator itself.
+        d_snapshot_sizes.assign(snapshot_sizes.begin(), snapshot_sizes.end());
+        std::uint64_t offset = sizeof(AGGREGATE_FILE_MAGIC) + sizeof(std::uint64_t) +
+                               3 * sizeof(std::uint64_t) * static_cast<std::uint64_t>(group_nodes);
+        d_recv_buffer.clear();
+        d_recv_buffer.insert(
+            d_recv_buffer.end(), AGGREGATE_FILE_MAGIC, AGGREGATE_FILE_MAGIC + sizeof(AGGREGATE_FILE_MAGIC));
+        append_value<std::uint64_t>(d_recv_buffer, group_nodes);
+        for (int k = 0; k < group_nodes; ++k)
+        {
+            append_value<std::uint64_t>(d_recv_buffer, d_group_num * d_group_size + k);
+            append_value<std::uint64_t>(d_recv_buffer, offset);
+            append_value<std::uint64_t>(d_recv_buffer, d_snapshot_sizes[k]);
+            offset += d_snapshot_sizes[k];
+        }
+        d_recv_buffer.insert(d_recv_buffer.end(), d_snapshot.begin(), d_snapshot.end());
+        std::vector<char>().swap(d_snapshot);
+
+        // The snapshots of the other processes of the group are received in
+        // batches, the first of which shares the buffer with the index.
+        d_next_recv_rank = 1;
+        d_aggregate_file_started = false;
+        postAggregatorReceives();
+    }
+    else
+    {
+        for (std::uint64_t chunk = 0, tag = 0; chunk < d_snapshot.size(); chunk += MAX_MESSAGE_SIZE, ++tag)
+        {
+            const auto count = static_cast<int>(std::min<std::uint64_t>(MAX_MESSAGE_SIZE, d_snapshot.size() - chunk));
+            d_requests.push_back(MPI_REQUEST_NULL);
+            MPI_Isend(
+                d_snapshot.data() + chunk, count, MPI_CHAR, 0, static_cast<int>(tag), d_group_comm, &d_requests.back());
+        }
+    }
+    d_pending = true;
+
+    IBTK_TIMER_STOP(t_write_checkpoint);
+
+    if (d_enable_asynchronous_writes)
+    {
+        advanceCommunication();
+    }
+    else
+    {
+        waitForCompletion();
+    }
+    return;
+} // writeCheckpoint
+
+void
+AsynchronousCheckpointWriter::advanceCommunication()
+{
+    if (!d_pending) return;
+    int flag = 1;
+    if (!d_requests.empty())
+    {
+        MPI_Testall(static_cast<int>(d_requests.size()), d_requests.data(), &flag, MPI_STATUSES_IGNORE);
+    }
+    if (!flag) return;
+    d_requests.clear();
+    if (!d_is_aggregator)
+    {
+        std::vector<char>().swap(d_snapshot);
+        return;
+    }
+
+    // The aggregate file is written sequentially, so the previous batch must
+    // have been written before the next one is handed to the background
+    // thread.
+    if (d_write_result.valid())
+    {
+        if (d_write_result.wait_for(std::chrono::seconds(0)) != std::future_status::ready) return;
+        if (!d_write_result.get()) d_write_failed = true;
+    }
+    if (d_recv_buffer.empty()) return;
+    d_write_buffer.swap(d_recv_buffer);
+    d_recv_buffer.clear();
+    startAggregateWrite();
+    postAggregatorReceives();
+    return;
+} // advanceCommunication
+
+void
+AsynchronousCheckpointWriter::waitForCompletion()
+{
+    if (!d_pending) return;
+
+    IBTK_TIMER_START(t_wait_for_completion);
+
+    while (!isComplete())
+    {
+        if (!d_requests.empty())
+        {
+            MPI_Waitall(static_cast<int>(d_requests.size()), d_requests.data(), MPI_STATUSES_IGNORE);
+        }
+        if (d_write_result.valid()) d_write_result.wait();
+        advanceCommunication();
+    }
+    finalizeCheckpoint();
+
+    IBTK_TIMER_STOP(t_wait_for_completion);
+    return;
+} // waitForCompletion
+
+bool
+AsynchronousCheckpointWriter::isComplete() const
+{
+    return !d_pending || (d_requests.empty() && d_recv_buffer.empty() && !d_write_result.valid());
+} // isComplete
+
+void
+AsynchronousCheckpointWriter::extractCheckpoint(const std::string& restart_read_dirname, const int restore_num)
+{
+    const std::string restore_dirname = get_restore_dirname(restart_read_dirname, restore_num);
+
+    // Only rank 0 reads the index file, which holds whether the checkpoint is
+    // complete and how the processes were grouped, and shares its contents.
+    int info_data[4] = { 0, 0, 0, 0 };
+    if (IBTK_MPI::getRank() == 0)
+    {
+        std::ifstream info((restore_dirname + "/aggregate.info").c_str());
+        info >> info_data[1] >> info_data[2] >> info_data[3];
+        info_data[0] = info.fail() ? 0 : 1;
+    }
+    int info_length = 4;
+    IBTK_MPI::bcast(info_data, info_length, 0);
+    if (!info_data[0]) return;
+    const int nodes = info_data[1], group_size = info_data[3];
+    if (nodes != IBTK_MPI::getNodes())
+    {
+        TBOX_ERROR("AsynchronousCheckpointWriter::extractCheckpoint():\n"
+                   << "  checkpoint in " << restore_dirname << " was written by " << nodes << " processes, but "
+                   << IBTK_MPI::getNodes() << " processes are in use\n");
+    }
+
+    // Read the index of the aggregate file of the group of this process and
+    // then the data of this process.
+    const int rank = IBTK_MPI::getRank();
+    const std::string file_name = restore_dirname + "/aggregate." + Utilities::nodeToString(rank / group_size);
+    std::ifstream is(file_name.c_str(), std::ios::binary);
+    std::vector<char> header(sizeof(AGGREGATE_FILE_MAGIC) + sizeof(std::uint64_t));
+    is.read(header.data(), header.size());
+    if (!is.good() ||
+        !std::equal(AGGREGATE_FILE_MAGIC, AGGREGATE_FILE_MAGIC + sizeof(AGGREGATE_FILE_MAGIC), header.data()))
+    {
+        TBOX_ERROR("AsynchronousCheckpointWriter::extractCheckpoint():\n"
+                   << "  could not read aggregated checkpoint file " << file_name
+                   << "\n  the checkpoint may be incomplete\n");
+    }
+    std::size_t pos = sizeof(AGGREGATE_FILE_MAGIC);
+    const auto num_entries = extract_value<std::uint64_t>(header, pos);
+    std::vector<char> index(3 * sizeof(std::uint64_t) * num_entries);
+    is.read(index.data(), index.size());
+    std::uint64_t offset = 0, size = 0;
+    bool found = false;
+    pos = 0;
+    for (std::uint64_t k = 0; k < num_entries && is.good(); ++k)
+    {
+        const auto entry_rank = extract_value<std::uint64_t>(index, pos);
+        const auto entry_offset = extract_value<std::uint64_t>(index, pos);
+        const auto entry_size = extract_value<std::uint64_t>(index, pos);
+        if (entry_rank == static_cast<std::uint64_t>(rank))
+        {
+            offset = entry_offset;
+            size = entry_size;
+            found = true;
+        }
+    }
+    std::vector<char> buffer(size);
+    if (found)
+    {
+        is.seekg(offset);
+        is.read(buffer.data(), size);
+    }
+    if (!found || !is.good())
+    {
+        TBOX_ERROR("AsynchronousCheckpointWriter::extractCheckpoint():\n"
+                   << "  could not read the data of process " << rank << " from " << file_name << "\n");
+    }
+    restore_files(restart_read_dirname, buffer);
+
+    // Make sure that all files are available before any are read.
+    IBTK_MPI::barrier();
+    return;
+} // extractCheckpoint
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void
+AsynchronousCheckpointWriter::postAggregatorReceives()
+{
+    // Receive the snapshots of as many processes as fit into the buffer, but
+    // at least one.  The buffer is resized before any receive is posted since
+    // resizing it later would invalidate the receive buffers.
+    const int group_nodes = static_cast<int>(d_snapshot_sizes.size());
+    std::size_t batch_size = d_recv_buffer.size();
+    int end_rank = d_next_recv_rank;
+    while (end_rank < group_nodes &&
+           (end_rank == d_next_recv_rank || batch_size + d_snapshot_sizes[end_rank] <= d_max_aggregator_buffer_size))
+    {
+        batch_size += d_snapshot_sizes[end_rank];
+        ++end_rank;
+    }
+    std::size_t offset = d_recv_buffer.size();
+    d_recv_buffer.resize(batch_size);
+    for (int k = d_next_recv_rank; k < end_rank; ++k)
+    {
+        for (std::uint64_t chunk = 0, tag = 0; chunk < d_snapshot_sizes[k]; chunk += MAX_MESSAGE_SIZE, ++tag)
+        {
+            const auto count =
+                static_cast<int>(std::min<std::uint64_t>(MAX_MESSAGE_SIZE, d_snapshot_sizes[k] - chunk));
+            d_requests.push_back(MPI_REQUEST_NULL);
+            MPI_Irecv(d_recv_buffer.data() + offset + chunk,
+                      count,
+                      MPI_CHAR,
+                      k,
+                      static_cast<int>(tag),
+                      d_group_comm,
+                      &d_requests.back());
+        }
+        offset += d_snapshot_sizes[k];
+    }
+    d_next_recv_rank = end_rank;
+    return;
+} // postAggregatorReceives
+
+void
+AsynchronousCheckpointWriter::startAggregateWrite()
+{
+    // The first batch starts a new file and the later ones are appended to it.
+    const bool append = d_aggregate_file_started;
+    d_aggregate_file_started = true;
+    if (d_use_background_thread)
+    {
+        try
+        {
+            d_write_result =
+                std::async(std::launch::async, &AsynchronousCheckpointWriter::writeAggregateData, this, append);
+            return;
+        }
+        catch (const std::system_error&)
+        {
+            // Threads are not available, so fall back to writing the data
+            // synchronously.
+        }
+    }
+    std::promise<bool> result;
+    result.set_value(writeAggregateData(append));
+    d_write_result = result.get_future();
+    return;
+} // startAggregateWrite
+
+bool
+AsynchronousCheckpointWriter::writeAggregateData(const bool append)
+{
+    std::ofstream os((d_aggregate_file_name + ".tmp").c_str(),
+                     std::ios::binary | (append ? std::ios::app : std::ios::trunc));
+    os.write(d_write_buffer.data(), d_write_buffer.size());
+    os.close();
+    return !os.fail();
+} // writeAggregateData
+
+void
+AsynchronousCheckpointWriter::finalizeCheckpoint()
+{
+    // Write to a temporary file that is renamed once it is complete so that
+    // an interrupted write does not leave behind a truncated checkpoint.
+    bool success = !d_write_failed;
+    if (d_is_aggregator && success)
+    {
+        success = std::rename((d_aggregate_file_name + ".tmp").c_str(), d_aggregate_file_name.c_str()) == 0;
+    }
+    std::vector<char>().swap(d_snapshot);
+    std::vector<char>().swap(d_recv_buffer);
+    std::vector<char>().swap(d_write_buffer);
+    d_snapshot_sizes.clear();
+    d_pending = false;
+
+    // Rank 0 records how the processes were grouped, which marks the
+    // checkpoint as complete.  The reduction also serves as a barrier that
+    // ensures that all aggregate files have been written before this happens.
+    const int num_failures = IBTK_MPI::sumReduction(success ? 0 : 1);
+    if (num_failures == 0 && IBTK_MPI::getRank() == 0)
+    {
+        std::ofstream info((d_restore_dirname + "/aggregate.info").c_str());
+        info << IBTK_MPI::getNodes() << " " << d_num_aggregators << " " << d_group_size << "\n";
+    }
+    if (!success)
+    {
+        TBOX_ERROR(d_object_name << "::waitForCompletion():\n"
+                                 << "  could not write aggregated checkpoint file " << d_aggregate_file_name << "\n");
+    }
+    else if (num_failures > 0)
+    {
+        TBOX_ERROR(d_object_name << "::waitForCompletion():\n"
+                                 << "  " << num_failures << " aggregated checkpoint files could not be written\n");
+    }
+    return;
+} // finalizeCheckpoint
+
+//////////////////////////////////////////////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
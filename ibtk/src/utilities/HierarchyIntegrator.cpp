@@ -17,6 +17,8 @@
 #include "ibtk/CartGridFunction.h"
 #include "ibtk/HierarchyIntegrator.h"
 #include "ibtk/HierarchyMathOps.h"
+#include "ibtk/PatchDataMemoryPool.h"
+#include "ibtk/PerformanceTrace.h"
 #include "ibtk/RefinePatchStrategySet.h"
 #include "ibtk/ibtk_enums.h"
 #include "ibtk/ibtk_utilities.h"
@@ -261,9 +263,15 @@ HierarchyIntegrator::advanceHierarchy(double dt)
         plog << d_object_name << "::advanceHierarchy(): time interval = [" << current_time << "," << new_time
              << "], dt = " << dt << "\n";
 
+    // Tag the performance trace with the number of the time step that is being
+    // computed by the outermost integrator.
+    if (!d_parent_integrator) PerformanceTrace::setStep(d_integrator_step + 1);
+    PerformanceTrace::ScopedPhase advance_phase(d_object_name, "::advanceHierarchy()");
+
     // Regrid the patch hierarchy.
     if (atRegridPoint())
     {
+        PerformanceTrace::ScopedPhase regrid_phase(d_object_name, "::regridHierarchy()");
         if (d_enable_logging)
             plog << d_object_name << "::advanceHierarchy(): regridding prior to timestep " << d_integrator_step << "\n";
         d_regridding_hierarchy = true;
@@ -279,7 +287,10 @@ HierarchyIntegrator::advanceHierarchy(double dt)
     // Execute the preprocessing method of the parent integrator, and
     // recursively execute all preprocessing callbacks registered with the
     // parent and child integrators.
-    preprocessIntegrateHierarchy(current_time, new_time, d_current_num_cycles);
+    {
+        PerformanceTrace::ScopedPhase preprocess_phase(d_object_name, "::preprocessIntegrateHierarchy()");
+        preprocessIntegrateHierarchy(current_time, new_time, d_current_num_cycles);
+    }
 
     // Perform one or more cycles.  In each cycle, execute the integration
     // method of the parent integrator, and recursively execute all integration
@@ -292,14 +303,21 @@ HierarchyIntegrator::advanceHierarchy(double dt)
             plog << d_object_name << "::advanceHierarchy(): executing cycle " << cycle_num + 1 << " of "
                  << d_current_num_cycles << "\n";
         }
+        PerformanceTrace::ScopedPhase integrate_phase(d_object_name, "::integrateHierarchy()");
         integrateHierarchy(current_time, new_time, cycle_num);
+
+        // Progress the transfers of any checkpoint that is being written.
+        if (d_checkpoint_writer) d_checkpoint_writer->advanceCommunication();
     }
 
     // Execute the postprocessing method of the parent integrator, and
     // recursively execute all postprocessing callbacks registered with the
     // parent and child integrators.
     static const bool skip_synchronize_new_state_data = true;
-    postprocessIntegrateHierarchy(current_time, new_time, skip_synchronize_new_state_data, d_current_num_cycles);
+    {
+        PerformanceTrace::ScopedPhase postprocess_phase(d_object_name, "::postprocessIntegrateHierarchy()");
+        postprocessIntegrateHierarchy(current_time, new_time, skip_synchronize_new_state_data, d_current_num_cycles);
+    }
 
     // Ensure that the current values of num_cycles, cycle_num, and dt are
     // reset.
@@ -573,6 +591,19 @@ HierarchyIntegrator::getVisItDataWriter() const
     return d_visit_writer;
 }
 
+void
+HierarchyIntegrator::registerCheckpointWriter(Pointer<AsynchronousCheckpointWriter> checkpoint_writer)
+{
+    d_checkpoint_writer = checkpoint_writer;
+    return;
+} // registerCheckpointWriter
+
+Pointer<AsynchronousCheckpointWriter>
+HierarchyIntegrator::getCheckpointWriter() const
+{
+    return d_checkpoint_writer;
+} // getCheckpointWriter
+
 void
 HierarchyIntegrator::setupPlotData()
 {
@@ -753,7 +784,7 @@ HierarchyIntegrator::initializeLevelData(const Pointer<BasePatchHierarchy<NDIM>
     Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_number);
     if (allocate_data)
     {
-        level->allocatePatchData(d_current_data, init_data_time);
+        level->allocatePatchData(d_current_data, init_data_time, PatchDataMemoryPool::getArena());
     }
     else
     {
@@ -763,7 +794,7 @@ HierarchyIntegrator::initializeLevelData(const Pointer<BasePatchHierarchy<NDIM>
     // Fill data from coarser levels in AMR hierarchy.
     if (!initial_time && (level_number > 0 || old_level))
     {
-        level->allocatePatchData(d_scratch_data, init_data_time);
+        level->allocatePatchData(d_scratch_data, init_data_time, PatchDataMemoryPool::getArena());
         std::vector<RefinePatchStrategy<NDIM>*> fill_after_regrid_prolong_patch_strategies;
         CartExtrapPhysBdryOp fill_after_regrid_extrap_bc_op(d_fill_after_regrid_bc_idxs, d_bdry_extrap_type);
         fill_after_regrid_prolong_patch_strategies.push_back(&fill_after_regrid_extrap_bc_op);
@@ -1002,7 +1033,8 @@ HierarchyIntegrator::allocatePatchData(const int data_idx, const double data_tim
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        if (!level->checkAllocated(data_idx)) level->allocatePatchData(data_idx, data_time);
+        if (!level->checkAllocated(data_idx))
+            level->allocatePatchData(data_idx, data_time, PatchDataMemoryPool::getArena());
     }
     return;
 } // allocatePatchData
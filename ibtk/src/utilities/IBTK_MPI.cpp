@@ -19,6 +19,7 @@
 #include "tbox/SAMRAI_MPI.h"
 #include "tbox/Utilities.h"
 
+#include <map>
 #include <ostream>
 #include <string>
 #include <vector>
@@ -140,4 +141,15 @@ IBTK_MPI::allGatherSetup(int size_in,
                    << "should be: " << c << std::endl);
     }
 } // allGatherSetup
+
+int
+IBTK_MPI::getSparseExchangeTag(IBTK_MPI::comm communicator)
+{
+    // A processor can only send the messages of exchange k + 2 after every
+    // processor has entered the barrier of exchange k + 1, so it suffices to
+    // alternate between two tags.
+    static const int SPARSE_EXCHANGE_TAGS[2] = { 27182, 27183 };
+    static std::map<IBTK_MPI::comm, unsigned int> exchange_counts;
+    return SPARSE_EXCHANGE_TAGS[exchange_counts[communicator]++ % 2];
+} // getSparseExchangeTag
 } // namespace IBTK
@@ -0,0 +1,251 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibtk/IBTK_CHKERRQ.h"
+#include "ibtk/IBTK_MPI.h"
+#include "ibtk/PETScFischerGuess.h"
+
+#include "BoxArray.h"
+#include "PatchHierarchy.h"
+#include "PatchLevel.h"
+#include "tbox/Pointer.h"
+#include "tbox/Utilities.h"
+
+#include "petscvec.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// Relative tolerance used to determine whether a submitted right-hand side is
+// (numerically) contained in the retained subspace.
+static const double ORTHOGONALIZATION_TOL = 1.0e-10;
+} // namespace
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+PETScFischerGuess::PETScFischerGuess(const int max_vectors) : d_max_vectors(max_vectors)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_max_vectors > 0);
+#endif
+    d_x.reserve(d_max_vectors);
+    d_b.reserve(d_max_vectors);
+    d_coefs.reserve(d_max_vectors);
+    return;
+} // PETScFischerGuess
+
+PETScFischerGuess::~PETScFischerGuess()
+{
+    clear();
+    return;
+} // ~PETScFischerGuess
+
+void
+PETScFischerGuess::submit(Vec x, Vec b)
+{
+    int ierr;
+    if (!isCompatible(b)) clear();
+
+    // Evict the oldest pair if the retained subspace is full.  The remaining
+    // right-hand sides are still orthonormal.
+    if (static_cast<int>(d_b.size()) == d_max_vectors)
+    {
+        ierr = VecDestroy(&d_x.front());
+        IBTK_CHKERRQ(ierr);
+        ierr = VecDestroy(&d_b.front());
+        IBTK_CHKERRQ(ierr);
+        d_x.erase(d_x.begin());
+        d_b.erase(d_b.begin());
+    }
+
+    Vec x_new, b_new;
+    ierr = VecDuplicate(x, &x_new);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecCopy(x, x_new);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecDuplicate(b, &b_new);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecCopy(b, b_new);
+    IBTK_CHKERRQ(ierr);
+
+    // Orthogonalize the new right-hand side against the retained right-hand
+    // sides using classical Gram-Schmidt with reorthogonalization, and apply
+    // the same transformation to the solution.
+    PetscReal b_norm_initial, b_norm;
+    ierr = VecNorm(b_new, NORM_2, &b_norm_initial);
+    IBTK_CHKERRQ(ierr);
+    const int n_vectors = static_cast<int>(d_b.size());
+    if (n_vectors > 0)
+    {
+        d_coefs.resize(n_vectors);
+        for (int pass = 0; pass < 2; ++pass)
+        {
+            ierr = VecMDot(b_new, n_vectors, d_b.data(), d_coefs.data());
+            IBTK_CHKERRQ(ierr);
+            std::transform(d_coefs.begin(), d_coefs.end(), d_coefs.begin(), [](PetscScalar c) { return -c; });
+            ierr = VecMAXPY(b_new, n_vectors, d_coefs.data(), d_b.data());
+            IBTK_CHKERRQ(ierr);
+            ierr = VecMAXPY(x_new, n_vectors, d_coefs.data(), d_x.data());
+            IBTK_CHKERRQ(ierr);
+        }
+    }
+    ierr = VecNorm(b_new, NORM_2, &b_norm);
+    IBTK_CHKERRQ(ierr);
+
+    // Discard the pair if it does not enlarge the retained subspace.
+    if (b_norm <= ORTHOGONALIZATION_TOL * b_norm_initial || b_norm == 0.0)
+    {
+        ierr = VecDestroy(&x_new);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecDestroy(&b_new);
+        IBTK_CHKERRQ(ierr);
+        return;
+    }
+
+    ierr = VecScale(b_new, 1.0 / b_norm);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecScale(x_new, 1.0 / b_norm);
+    IBTK_CHKERRQ(ierr);
+    d_x.push_back(x_new);
+    d_b.push_back(b_new);
+    return;
+} // submit
+
+bool
+PETScFischerGuess::guess(Vec x, Vec b)
+{
+    int ierr;
+    ierr = VecSet(x, 0.0);
+    IBTK_CHKERRQ(ierr);
+    if (d_b.empty() || !isCompatible(b)) return false;
+
+    // Since the retained right-hand sides are orthonormal, the projection of b
+    // onto their span is sum_k (b_k, b) b_k, and the corresponding solution is
+    // sum_k (b_k, b) x_k.
+    const int n_vectors = static_cast<int>(d_b.size());
+    d_coefs.resize(n_vectors);
+    ierr = VecMDot(b, n_vectors, d_b.data(), d_coefs.data());
+    IBTK_CHKERRQ(ierr);
+    ierr = VecMAXPY(x, n_vectors, d_coefs.data(), d_x.data());
+    IBTK_CHKERRQ(ierr);
+    return true;
+} // guess
+
+void
+PETScFischerGuess::setPatchHierarchy(Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                     const int coarsest_ln,
+                                     const int finest_ln)
+{
+    std::vector<BoxArray<NDIM> > level_boxes;
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        level_boxes.push_back(hierarchy->getPatchLevel(ln)->getBoxes());
+    }
+    bool grid_changed = hierarchy != d_hierarchy || level_boxes.size() != d_level_boxes.size();
+    for (unsigned int k = 0; !grid_changed && k < level_boxes.size(); ++k)
+    {
+        const BoxArray<NDIM>& boxes = level_boxes[k];
+        const BoxArray<NDIM>& old_boxes = d_level_boxes[k];
+        grid_changed = boxes.getNumberOfBoxes() != old_boxes.getNumberOfBoxes();
+        for (int i = 0; !grid_changed && i < boxes.getNumberOfBoxes(); ++i)
+        {
+            grid_changed = !(boxes[i] == old_boxes[i]);
+        }
+    }
+    if (grid_changed)
+    {
+        clear();
+        d_hierarchy = hierarchy;
+        d_level_boxes = level_boxes;
+    }
+    return;
+} // setPatchHierarchy
+
+void
+PETScFischerGuess::setOperatorFingerprint(const std::size_t fingerprint)
+{
+    if (d_have_operator_fingerprint && fingerprint != d_operator_fingerprint) clear();
+    d_operator_fingerprint = fingerprint;
+    d_have_operator_fingerprint = true;
+    return;
+} // setOperatorFingerprint
+
+void
+PETScFischerGuess::clear()
+{
+    int ierr;
+    for (Vec& v : d_x)
+    {
+        ierr = VecDestroy(&v);
+        IBTK_CHKERRQ(ierr);
+    }
+    for (Vec& v : d_b)
+    {
+        ierr = VecDestroy(&v);
+        IBTK_CHKERRQ(ierr);
+    }
+    d_x.clear();
+    d_b.clear();
+    return;
+} // clear
+
+int
+PETScFischerGuess::getNumberOfVectors() const
+{
+    return static_cast<int>(d_b.size());
+} // getNumberOfVectors
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+bool
+PETScFischerGuess::isCompatible(Vec v) const
+{
+    if (d_b.empty()) return true;
+    int ierr;
+    PetscInt size, local_size, retained_size, retained_local_size;
+    ierr = VecGetSize(v, &size);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecGetLocalSize(v, &local_size);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecGetSize(d_b.front(), &retained_size);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecGetLocalSize(d_b.front(), &retained_local_size);
+    IBTK_CHKERRQ(ierr);
+
+    // The local sizes may differ on only some processes, so the result must be
+    // agreed upon by all of them: otherwise some processes would clear the
+    // retained vectors or skip the collective projection while others do not.
+    MPI_Comm comm;
+    ierr = PetscObjectGetComm(reinterpret_cast<PetscObject>(v), &comm);
+    IBTK_CHKERRQ(ierr);
+    const int local_compatible = (size == retained_size && local_size == retained_local_size) ? 1 : 0;
+    return IBTK_MPI::minReduction(local_compatible, nullptr, comm) == 1;
+} // isCompatible
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
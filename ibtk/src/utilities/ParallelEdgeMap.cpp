@@ -15,9 +15,13 @@
 
 #include "ibtk/IBTK_MPI.h"
 #include "ibtk/ParallelEdgeMap.h"
+#include "ibtk/private/ParallelContainerUtilities-inl.h"
 
 #include <algorithm>
 #include <map>
+#include <numeric>
+#include <set>
+#include <utility>
 #include <vector>
 
 #include "ibtk/namespaces.h" // IWYU pragma: keep
@@ -30,6 +34,12 @@ namespace IBTK
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
+ParallelEdgeMap::ParallelEdgeMap(const bool replicate_data) : d_replicate_data(replicate_data)
+{
+    // intentionally blank
+    return;
+} // ParallelEdgeMap
+
 int
 ParallelEdgeMap::addEdge(const std::pair<int, int>& link, int mastr_idx)
 {
@@ -62,98 +72,87 @@ void
 ParallelEdgeMap::communicateData()
 {
     const int size = IBTK_MPI::getNodes();
-    const int rank = IBTK_MPI::getRank();
 
-    std::vector<int> num_additions_and_removals(2 * size, 0);
-    num_additions_and_removals[2 * rank] = static_cast<int>(d_pending_additions.size());
-    num_additions_and_removals[2 * rank + 1] = static_cast<int>(d_pending_removals.size());
-    IBTK_MPI::sumReduction(&num_additions_and_removals[0], 2 * size);
-
-    int num_transactions = 0, offset = 0;
-    for (int k = 0; k < size; ++k)
+    // Each message consists of the number of additions followed by the master
+    // index and the vertices of each link that is added or removed.
+    static const int SIZE = 3;
+    std::vector<std::vector<int> > messages;
+    if (d_replicate_data)
     {
-        int size_k = num_additions_and_removals[2 * k] + num_additions_and_removals[2 * k + 1];
-        num_transactions += size_k;
-        if (k < rank)
+        // Gather the pending additions and removals of all processes.
+        std::vector<int> message(1, static_cast<int>(d_pending_additions.size()));
+        for (const auto& addition : d_pending_additions)
         {
-            offset += size_k;
+            message.insert(message.end(), { addition.first, addition.second.first, addition.second.second });
+        }
+        for (const auto& removal : d_pending_removals)
+        {
+            message.insert(message.end(), { removal.first, removal.second.first, removal.second.second });
+        }
+        std::vector<int> message_sizes(size);
+        IBTK_MPI::allGather(static_cast<int>(message.size()), message_sizes.data());
+        const int total_size = std::accumulate(message_sizes.begin(), message_sizes.end(), 0);
+        if (total_size == size) return;
+        std::vector<int> all_messages(total_size);
+        IBTK_MPI::allGather(message.data(), static_cast<int>(message.size()), all_messages.data(), total_size);
+        for (int k = 0, offset = 0; k < size; offset += message_sizes[k], ++k)
+        {
+            messages.emplace_back(all_messages.begin() + offset, all_messages.begin() + offset + message_sizes[k]);
         }
     }
-
-    if (num_transactions == 0) return;
-
-    static const int SIZE = 3;
-    std::vector<int> transactions(SIZE * num_transactions, 0);
-    for (auto cit = d_pending_additions.begin(); cit != d_pending_additions.end(); ++cit, ++offset)
-    {
-        transactions[SIZE * offset] = cit->first;
-        transactions[SIZE * offset + 1] = cit->second.first;
-        transactions[SIZE * offset + 2] = cit->second.second;
-    }
-    for (auto cit = d_pending_removals.begin(); cit != d_pending_removals.end(); ++cit, ++offset)
-    {
-        transactions[SIZE * offset] = cit->first;
-        transactions[SIZE * offset + 1] = cit->second.first;
-        transactions[SIZE * offset + 2] = cit->second.second;
-    }
-    IBTK_MPI::sumReduction(&transactions[0], SIZE * num_transactions);
-
-    offset = 0;
-    for (int k = 0; k < size; ++k)
+    else
     {
-        for (int t = 0; t < num_additions_and_removals[2 * k]; ++t, ++offset)
+        // Send the pending additions and removals to the owners of the master
+        // indices.
+        std::map<int, std::pair<std::vector<int>, std::vector<int> > > transactions;
+        for (const auto& addition : d_pending_additions)
         {
-            const int mastr_idx = transactions[SIZE * offset];
-            const int idx1 = transactions[SIZE * offset + 1];
-            const int idx2 = transactions[SIZE * offset + 2];
-            const std::pair<int, int> link = std::make_pair(idx1, idx2);
-            d_pending_additions.insert(std::make_pair(mastr_idx, link));
+            std::vector<int>& additions = transactions[internal::get_owner(addition.first, size)].first;
+            additions.insert(additions.end(), { addition.first, addition.second.first, addition.second.second });
         }
-        for (int t = 0; t < num_additions_and_removals[2 * k + 1]; ++t, ++offset)
+        for (const auto& removal : d_pending_removals)
         {
-            const int mastr_idx = transactions[SIZE * offset];
-            const int idx1 = transactions[SIZE * offset + 1];
-            const int idx2 = transactions[SIZE * offset + 2];
-            const std::pair<int, int> link = std::make_pair(idx1, idx2);
-            d_pending_removals.insert(std::make_pair(mastr_idx, link));
+            std::vector<int>& removals = transactions[internal::get_owner(removal.first, size)].second;
+            removals.insert(removals.end(), { removal.first, removal.second.first, removal.second.second });
+        }
+        std::map<int, std::vector<int> > send_data;
+        for (const auto& owner_transactions : transactions)
+        {
+            const std::vector<int>& additions = owner_transactions.second.first;
+            const std::vector<int>& removals = owner_transactions.second.second;
+            std::vector<int>& message = send_data[owner_transactions.first];
+            message.push_back(static_cast<int>(additions.size()) / SIZE);
+            message.insert(message.end(), additions.begin(), additions.end());
+            message.insert(message.end(), removals.begin(), removals.end());
+        }
+        for (auto& source_message : IBTK_MPI::sparseExchange(send_data))
+        {
+            messages.push_back(std::move(source_message.second));
         }
     }
 
-    using multimap_iterator = std::multimap<int, std::pair<int, int> >::iterator;
-    for (const auto& pending_addition : d_pending_additions)
+    // Add edges to the edge map.
+    for (const auto& message : messages)
     {
-        d_edge_map.insert(std::make_pair(pending_addition.first, pending_addition.second));
+        for (int t = 0; t < message[0]; ++t)
+        {
+            const int* const transaction = &message[1 + SIZE * t];
+            d_edge_map.insert(std::make_pair(transaction[0], std::make_pair(transaction[1], transaction[2])));
+        }
     }
 
-    for (const auto& pending_removal : d_pending_removals)
+    // Remove edges from the edge map.
+    using multimap_iterator = std::multimap<int, std::pair<int, int> >::iterator;
+    for (const auto& message : messages)
     {
-        int mastr_idx = pending_removal.first;
-        const std::pair<int, int>& link = pending_removal.second;
-
-        bool found_link = false;
-
-        std::pair<multimap_iterator, multimap_iterator> range = d_edge_map.equal_range(mastr_idx);
-        for (auto it = range.first; it != range.second && !found_link; ++it)
+        const int num_transactions = (static_cast<int>(message.size()) - 1) / SIZE;
+        for (int t = message[0]; t < num_transactions; ++t)
         {
-            if (it->second == link)
-            {
-                found_link = true;
-                d_edge_map.erase(it);
-            }
-        }
+            const int* const transaction = &message[1 + SIZE * t];
+            int mastr_idx = transaction[0];
+            const std::pair<int, int> link = std::make_pair(transaction[1], transaction[2]);
 
-        if (!found_link)
-        {
-            const int idx1 = link.first;
-            const int idx2 = link.second;
-            if (mastr_idx == idx1)
-            {
-                mastr_idx = idx2;
-            }
-            else
-            {
-                mastr_idx = idx1;
-            }
+            bool found_link = false;
 
             std::pair<multimap_iterator, multimap_iterator> range = d_edge_map.equal_range(mastr_idx);
             for (auto it = range.first; it != range.second && !found_link; ++it)
@@ -164,6 +163,30 @@ ParallelEdgeMap::communicateData()
                     d_edge_map.erase(it);
                 }
             }
+
+            if (!found_link && d_replicate_data)
+            {
+                const int idx1 = link.first;
+                const int idx2 = link.second;
+                if (mastr_idx == idx1)
+                {
+                    mastr_idx = idx2;
+                }
+                else
+                {
+                    mastr_idx = idx1;
+                }
+
+                std::pair<multimap_iterator, multimap_iterator> range = d_edge_map.equal_range(mastr_idx);
+                for (auto it = range.first; it != range.second && !found_link; ++it)
+                {
+                    if (it->second == link)
+                    {
+                        found_link = true;
+                        d_edge_map.erase(it);
+                    }
+                }
+            }
         }
     }
 
@@ -172,12 +195,65 @@ ParallelEdgeMap::communicateData()
     return;
 } // communicateData
 
+bool
+ParallelEdgeMap::isReplicated() const
+{
+    return d_replicate_data;
+} // isReplicated
+
 const std::multimap<int, std::pair<int, int> >&
 ParallelEdgeMap::getEdgeMap() const
 {
     return d_edge_map;
 } // getEdgeMap
 
+std::multimap<int, std::pair<int, int> >
+ParallelEdgeMap::getLocalView(const std::vector<int>& mastr_idxs) const
+{
+    std::multimap<int, std::pair<int, int> > local_view;
+    if (d_replicate_data)
+    {
+        for (const int mastr_idx : std::set<int>(mastr_idxs.begin(), mastr_idxs.end()))
+        {
+            const auto range = d_edge_map.equal_range(mastr_idx);
+            local_view.insert(range.first, range.second);
+        }
+        return local_view;
+    }
+
+    // Request the edges from the owners of the master indices.
+    const int size = IBTK_MPI::getNodes();
+    std::map<int, std::set<int> > requested_idxs;
+    for (const int mastr_idx : mastr_idxs) requested_idxs[internal::get_owner(mastr_idx, size)].insert(mastr_idx);
+    std::map<int, std::vector<int> > requests;
+    for (const auto& owner_idxs : requested_idxs)
+    {
+        requests[owner_idxs.first].assign(owner_idxs.second.begin(), owner_idxs.second.end());
+    }
+    std::map<int, std::vector<int> > replies;
+    for (const auto& source_idxs : IBTK_MPI::sparseExchange(requests))
+    {
+        for (const int mastr_idx : source_idxs.second)
+        {
+            const auto range = d_edge_map.equal_range(mastr_idx);
+            for (auto it = range.first; it != range.second; ++it)
+            {
+                replies[source_idxs.first].insert(replies[source_idxs.first].end(),
+                                                  { it->first, it->second.first, it->second.second });
+            }
+        }
+    }
+    for (const auto& owner_edges : IBTK_MPI::sparseExchange(replies))
+    {
+        const std::vector<int>& edges = owner_edges.second;
+        for (std::size_t k = 0; k + 2 < edges.size(); k += 3)
+        {
+            local_view.insert(std::make_pair(edges[k], std::make_pair(edges[k + 1], edges[k + 2])));
+        }
+    }
+    return local_view;
+} // getLocalView
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
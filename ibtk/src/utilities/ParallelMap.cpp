@@ -16,6 +16,7 @@
 #include "ibtk/FixedSizedStream.h"
 #include "ibtk/IBTK_MPI.h"
 #include "ibtk/ParallelMap.h"
+#include "ibtk/private/ParallelContainerUtilities-inl.h"
 #include "ibtk/Streamable.h"
 #include "ibtk/StreamableManager.h"
 
@@ -23,6 +24,7 @@
 #include "tbox/Pointer.h"
 
 #include <map>
+#include <numeric>
 #include <utility>
 #include <vector>
 
@@ -34,13 +36,71 @@ namespace IBTK
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
+namespace
+{
+// Pack the keys and data items to add and the keys to remove into a buffer.
+std::vector<char>
+pack_transactions(const std::vector<int>& addition_keys,
+                  std::vector<tbox::Pointer<Streamable> >& addition_items,
+                  const std::vector<int>& removal_keys)
+{
+    StreamableManager* streamable_manager = StreamableManager::getManager();
+    const auto num_additions = static_cast<int>(addition_keys.size());
+    const auto num_removals = static_cast<int>(removal_keys.size());
+    const auto data_size = static_cast<int>(tbox::AbstractStream::sizeofInt() * (2 + num_additions + num_removals) +
+                                            streamable_manager->getDataStreamSize(addition_items));
+    FixedSizedStream stream(data_size);
+    stream.pack(&num_additions, 1);
+    if (num_additions > 0) stream.pack(addition_keys.data(), num_additions);
+    streamable_manager->packStream(stream, addition_items);
+    stream.pack(&num_removals, 1);
+    if (num_removals > 0) stream.pack(removal_keys.data(), num_removals);
+#if !defined(NDEBUG)
+    TBOX_ASSERT(stream.getCurrentSize() == data_size);
+#endif
+    const char* const buffer = static_cast<const char*>(stream.getBufferStart());
+    return std::vector<char>(buffer, buffer + stream.getCurrentSize());
+} // pack_transactions
+
+// Unpack a buffer that was packed by pack_transactions().
+void
+unpack_transactions(const char* const buffer,
+                    const int data_size,
+                    std::vector<int>& addition_keys,
+                    std::vector<tbox::Pointer<Streamable> >& addition_items,
+                    std::vector<int>& removal_keys)
+{
+    FixedSizedStream stream(buffer, data_size);
+    int num_additions, num_removals;
+    stream.unpack(&num_additions, 1);
+    addition_keys.resize(num_additions);
+    if (num_additions > 0) stream.unpack(addition_keys.data(), num_additions);
+    const hier::IntVector<NDIM> offset = 0;
+    StreamableManager::getManager()->unpackStream(stream, offset, addition_items);
+    stream.unpack(&num_removals, 1);
+    removal_keys.resize(num_removals);
+    if (num_removals > 0) stream.unpack(removal_keys.data(), num_removals);
+#if !defined(NDEBUG)
+    TBOX_ASSERT(addition_keys.size() == addition_items.size());
+#endif
+    return;
+} // unpack_transactions
+} // namespace
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
+ParallelMap::ParallelMap(const bool replicate_data) : d_replicate_data(replicate_data)
+{
+    // intentionally blank
+    return;
+} // ParallelMap
+
 ParallelMap&
 ParallelMap::operator=(const ParallelMap& that)
 {
     if (this != &that)
     {
+        d_replicate_data = that.d_replicate_data;
         d_map = that.d_map;
         d_pending_additions = that.d_pending_additions;
         d_pending_removals = that.d_pending_removals;
@@ -65,135 +125,175 @@ ParallelMap::removeItem(const int key)
 void
 ParallelMap::communicateData()
 {
-    const int size = IBTK_MPI::getNodes();
     const int rank = IBTK_MPI::getRank();
+    const int size = IBTK_MPI::getNodes();
 
-    // Add items to the map.
-    if (IBTK_MPI::maxReduction(static_cast<int>(d_pending_additions.size())) > 0)
+    // Collect the buffers that contain the additions and removals that are to
+    // be applied by this process, along with the ranks of the processes that
+    // sent them.  The transactions of this process that are to be applied
+    // locally are kept as they are rather than packed and unpacked again.
+    std::vector<char> all_buffers;
+    std::vector<int> buffer_ranks, buffer_offsets, buffer_sizes;
+    std::vector<int> local_addition_keys, local_removal_keys;
+    std::vector<tbox::Pointer<Streamable> > local_addition_items;
+    if (d_replicate_data)
     {
-        StreamableManager* streamable_manager = StreamableManager::getManager();
-
-        // Determine how many keys have been registered for addition on each
-        // process.
-        std::vector<int> num_additions(size, 0);
-        num_additions[rank] = static_cast<int>(d_pending_additions.size());
-        IBTK_MPI::sumReduction(&num_additions[0], size);
-
-        // Get the local values to send and determine the amount of data to be
-        // broadcast by each process.
-        std::vector<int> keys_to_send;
-        std::vector<tbox::Pointer<Streamable> > data_items_to_send;
+        // Gather the pending additions and removals of all processes.
+        const int num_transactions = static_cast<int>(d_pending_additions.size() + d_pending_removals.size());
+        if (IBTK_MPI::maxReduction(num_transactions) == 0) return;
         for (const auto& pending_addition : d_pending_additions)
         {
-            keys_to_send.push_back(pending_addition.first);
-            data_items_to_send.push_back(pending_addition.second);
+            local_addition_keys.push_back(pending_addition.first);
+            local_addition_items.push_back(pending_addition.second);
         }
-        std::vector<int> data_sz(size, 0);
-        data_sz[rank] = static_cast<int>(tbox::AbstractStream::sizeofInt() * keys_to_send.size() +
-                                         streamable_manager->getDataStreamSize(data_items_to_send));
-        IBTK_MPI::sumReduction(&data_sz[0], size);
-
-        // Broadcast data from each process.
-        for (int sending_proc = 0; sending_proc < size; ++sending_proc)
+        local_removal_keys = d_pending_removals;
+        const std::vector<char> buffer =
+            pack_transactions(local_addition_keys, local_addition_items, local_removal_keys);
+        std::vector<int> all_buffer_sizes(size);
+        IBTK_MPI::allGather(static_cast<int>(buffer.size()), all_buffer_sizes.data());
+        const int total_size = std::accumulate(all_buffer_sizes.begin(), all_buffer_sizes.end(), 0);
+        all_buffers.resize(total_size);
+        IBTK_MPI::allGather(buffer.data(), static_cast<int>(buffer.size()), all_buffers.data(), total_size);
+        for (int k = 0, offset = 0; k < size; offset += all_buffer_sizes[k], ++k)
         {
-            int num_keys = num_additions[sending_proc];
-            if (num_keys == 0) continue;
-            if (sending_proc == rank)
-            {
-                // Pack and broadcast data on process sending_proc.
-                FixedSizedStream stream(data_sz[sending_proc]);
-                stream.pack(&keys_to_send[0], static_cast<int>(keys_to_send.size()));
-                streamable_manager->packStream(stream, data_items_to_send);
-                int data_size = stream.getCurrentSize();
-#if !defined(NDEBUG)
-                TBOX_ASSERT(static_cast<int>(d_pending_additions.size()) == num_keys);
-                TBOX_ASSERT(data_size == data_sz[sending_proc]);
-#endif
-                IBTK_MPI::bcast(static_cast<char*>(stream.getBufferStart()), data_size, sending_proc);
-                for (int k = 0; k < num_keys; ++k)
-                {
-                    d_map[keys_to_send[k]] = data_items_to_send[k];
-                }
-            }
-            else
-            {
-                // Receive and unpack data broadcast from process sending_proc.
-                std::vector<char> buffer(data_sz[sending_proc]);
-                int data_size = data_sz[sending_proc];
-                IBTK_MPI::bcast(&buffer[0], data_size, sending_proc);
-#if !defined(NDEBUG)
-                TBOX_ASSERT(data_size == data_sz[sending_proc]);
-#endif
-                FixedSizedStream stream(&buffer[0], data_size);
-                std::vector<int> keys_received(num_keys);
-                stream.unpack(&keys_received[0], num_keys);
-                std::vector<tbox::Pointer<Streamable> > data_items_received;
-                hier::IntVector<NDIM> offset = 0;
-                streamable_manager->unpackStream(stream, offset, data_items_received);
-#if !defined(NDEBUG)
-                TBOX_ASSERT(keys_received.size() == data_items_received.size());
-#endif
-                for (int k = 0; k < num_keys; ++k)
-                {
-                    d_map[keys_received[k]] = data_items_received[k];
-                }
-            }
+            if (k == rank) continue;
+            buffer_ranks.push_back(k);
+            buffer_offsets.push_back(offset);
+            buffer_sizes.push_back(all_buffer_sizes[k]);
+        }
+    }
+    else
+    {
+        // Send the pending additions and removals to the owners of the keys.
+        std::map<int, std::vector<int> > addition_keys, removal_keys;
+        std::map<int, std::vector<tbox::Pointer<Streamable> > > addition_items;
+        for (const auto& pending_addition : d_pending_additions)
+        {
+            const int owner = internal::get_owner(pending_addition.first, size);
+            addition_keys[owner].push_back(pending_addition.first);
+            addition_items[owner].push_back(pending_addition.second);
+        }
+        for (const int key : d_pending_removals) removal_keys[internal::get_owner(key, size)].push_back(key);
+        std::map<int, std::vector<char> > send_data;
+        for (const auto& owner_keys : addition_keys) send_data[owner_keys.first];
+        for (const auto& owner_keys : removal_keys) send_data[owner_keys.first];
+        send_data.erase(rank);
+        for (auto& owner_buffer : send_data)
+        {
+            const int owner = owner_buffer.first;
+            owner_buffer.second = pack_transactions(addition_keys[owner], addition_items[owner], removal_keys[owner]);
+        }
+        local_addition_keys = addition_keys[rank];
+        local_addition_items = addition_items[rank];
+        local_removal_keys = removal_keys[rank];
+        for (const auto& source_buffer : IBTK_MPI::sparseExchange(send_data))
+        {
+            buffer_ranks.push_back(source_buffer.first);
+            buffer_offsets.push_back(static_cast<int>(all_buffers.size()));
+            all_buffers.insert(all_buffers.end(), source_buffer.second.begin(), source_buffer.second.end());
+            buffer_sizes.push_back(static_cast<int>(source_buffer.second.size()));
         }
-
-        // Clear the set of pending additions.
-        d_pending_additions.clear();
     }
 
-    // Remove items from the map.
-    if (IBTK_MPI::maxReduction(static_cast<int>(d_pending_removals.size())) > 0)
+    // Add items to the map in the order of the ranks of the processes that
+    // sent them, and then remove items from the map.
+    std::vector<int> removals;
+    bool applied_local_transactions = false;
+    for (int k = 0; k <= static_cast<int>(buffer_ranks.size()); ++k)
     {
-        // Determine how many keys have been registered for removal on each
-        // process.
-        std::vector<int> num_removals(size, 0);
-        num_removals[rank] = static_cast<int>(d_pending_removals.size());
-        IBTK_MPI::sumReduction(&num_removals[0], size);
-
-        // Broadcast data from each process.
-        for (int sending_proc = 0; sending_proc < size; ++sending_proc)
+        const bool is_last = k == static_cast<int>(buffer_ranks.size());
+        if (!applied_local_transactions && (is_last || buffer_ranks[k] > rank))
         {
-            int num_keys = num_removals[sending_proc];
-            if (num_keys == 0) continue;
-            if (sending_proc == rank)
-            {
-// Pack and broadcast data on process sending_proc.
-#if !defined(NDEBUG)
-                TBOX_ASSERT(static_cast<int>(d_pending_removals.size()) == num_keys);
-#endif
-                IBTK_MPI::bcast(&d_pending_removals[0], num_keys, sending_proc);
-                for (int k = 0; k < num_keys; ++k)
-                {
-                    d_map.erase(d_pending_removals[k]);
-                }
-            }
-            else
+            for (unsigned int i = 0; i < local_addition_keys.size(); ++i)
             {
-                // Receive and unpack data broadcast from process sending_proc.
-                std::vector<int> keys_received(num_removals[sending_proc]);
-                IBTK_MPI::bcast(&keys_received[0], num_keys, sending_proc);
-                for (int k = 0; k < num_keys; ++k)
-                {
-                    d_map.erase(keys_received[k]);
-                }
+                d_map[local_addition_keys[i]] = local_addition_items[i];
             }
+            removals.insert(removals.end(), local_removal_keys.begin(), local_removal_keys.end());
+            applied_local_transactions = true;
         }
-
-        // Clear the set of pending removals.
-        d_pending_removals.clear();
+        if (is_last) break;
+        std::vector<int> keys, buffer_removals;
+        std::vector<tbox::Pointer<Streamable> > data_items;
+        unpack_transactions(&all_buffers[buffer_offsets[k]], buffer_sizes[k], keys, data_items, buffer_removals);
+        for (unsigned int i = 0; i < keys.size(); ++i)
+        {
+            d_map[keys[i]] = data_items[i];
+        }
+        removals.insert(removals.end(), buffer_removals.begin(), buffer_removals.end());
     }
+    for (const int key : removals) d_map.erase(key);
+
+    // Clear the pending additions and removals.
+    d_pending_additions.clear();
+    d_pending_removals.clear();
     return;
 } // communicateData
 
+bool
+ParallelMap::isReplicated() const
+{
+    return d_replicate_data;
+} // isReplicated
+
 const std::map<int, SAMRAI::tbox::Pointer<Streamable> >&
 ParallelMap::getMap() const
 {
     return d_map;
 } // getMap
 
+std::map<int, SAMRAI::tbox::Pointer<Streamable> >
+ParallelMap::getLocalView(const std::vector<int>& keys) const
+{
+    std::map<int, tbox::Pointer<Streamable> > local_view;
+    if (d_replicate_data)
+    {
+        for (const int key : keys)
+        {
+            const auto it = d_map.find(key);
+            if (it != d_map.end()) local_view.insert(*it);
+        }
+        return local_view;
+    }
+
+    // Request the items from the owners of the keys.  Only the items that are
+    // found are returned.
+    const int size = IBTK_MPI::getNodes();
+    std::map<int, std::vector<int> > requests;
+    for (const int key : keys) requests[internal::get_owner(key, size)].push_back(key);
+    std::map<int, std::vector<char> > replies;
+    for (const auto& source_keys : IBTK_MPI::sparseExchange(requests))
+    {
+        std::vector<int> found_keys;
+        std::vector<tbox::Pointer<Streamable> > found_items;
+        for (const int key : source_keys.second)
+        {
+            const auto it = d_map.find(key);
+            if (it == d_map.end()) continue;
+            found_keys.push_back(key);
+            found_items.push_back(it->second);
+        }
+        if (!found_keys.empty())
+        {
+            replies[source_keys.first] = pack_transactions(found_keys, found_items, std::vector<int>());
+        }
+    }
+    for (const auto& owner_buffer : IBTK_MPI::sparseExchange(replies))
+    {
+        std::vector<int> found_keys, removal_keys;
+        std::vector<tbox::Pointer<Streamable> > found_items;
+        unpack_transactions(owner_buffer.second.data(),
+                            static_cast<int>(owner_buffer.second.size()),
+                            found_keys,
+                            found_items,
+                            removal_keys);
+        for (unsigned int i = 0; i < found_keys.size(); ++i)
+        {
+            local_view[found_keys[i]] = found_items[i];
+        }
+    }
+    return local_view;
+} // getLocalView
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
@@ -15,8 +15,12 @@
 
 #include "ibtk/IBTK_MPI.h"
 #include "ibtk/ParallelSet.h"
+#include "ibtk/private/ParallelContainerUtilities-inl.h"
 
+#include <map>
+#include <numeric>
 #include <set>
+#include <utility>
 #include <vector>
 
 #include "ibtk/namespaces.h" // IWYU pragma: keep
@@ -29,11 +33,18 @@ namespace IBTK
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
+ParallelSet::ParallelSet(const bool replicate_data) : d_replicate_data(replicate_data)
+{
+    // intentionally blank
+    return;
+} // ParallelSet
+
 ParallelSet&
 ParallelSet::operator=(const ParallelSet& that)
 {
     if (this != &that)
     {
+        d_replicate_data = that.d_replicate_data;
         d_set = that.d_set;
         d_pending_additions = that.d_pending_additions;
         d_pending_removals = that.d_pending_removals;
@@ -59,100 +70,112 @@ void
 ParallelSet::communicateData()
 {
     const int size = IBTK_MPI::getNodes();
-    const int rank = IBTK_MPI::getRank();
 
-    // Add items from the set.
-    if (IBTK_MPI::maxReduction(static_cast<int>(d_pending_additions.size())) > 0)
+    // Each message consists of the number of additions, the keys to add, and
+    // the keys to remove.
+    std::vector<std::vector<int> > messages;
+    if (d_replicate_data)
     {
-        // Determine how many keys have been registered for addition on each
-        // process.
-        std::vector<int> num_additions(size, 0);
-        num_additions[rank] = static_cast<int>(d_pending_additions.size());
-        IBTK_MPI::sumReduction(&num_additions[0], size);
-
-        // Broadcast data from each process.
-        for (int sending_proc = 0; sending_proc < size; ++sending_proc)
+        // Gather the pending additions and removals of all processes.
+        std::vector<int> message(1, static_cast<int>(d_pending_additions.size()));
+        message.insert(message.end(), d_pending_additions.begin(), d_pending_additions.end());
+        message.insert(message.end(), d_pending_removals.begin(), d_pending_removals.end());
+        std::vector<int> message_sizes(size);
+        IBTK_MPI::allGather(static_cast<int>(message.size()), message_sizes.data());
+        const int total_size = std::accumulate(message_sizes.begin(), message_sizes.end(), 0);
+        if (total_size == size) return;
+        std::vector<int> all_messages(total_size);
+        IBTK_MPI::allGather(message.data(), static_cast<int>(message.size()), all_messages.data(), total_size);
+        for (int k = 0, offset = 0; k < size; offset += message_sizes[k], ++k)
         {
-            int num_keys = num_additions[sending_proc];
-            if (num_keys == 0) continue;
-            if (sending_proc == rank)
-            {
-// Pack and broadcast data on process sending_proc.
-#if !defined(NDEBUG)
-                TBOX_ASSERT(static_cast<int>(d_pending_additions.size()) == num_keys);
-#endif
-                IBTK_MPI::bcast(&d_pending_additions[0], num_keys, sending_proc);
-                for (int k = 0; k < num_keys; ++k)
-                {
-                    d_set.insert(d_pending_additions[k]);
-                }
-            }
-            else
-            {
-                // Receive and unpack data broadcast from process sending_proc.
-                std::vector<int> keys_received(num_additions[sending_proc]);
-                IBTK_MPI::bcast(&keys_received[0], num_keys, sending_proc);
-                for (int k = 0; k < num_keys; ++k)
-                {
-                    d_set.insert(keys_received[k]);
-                }
-            }
+            messages.emplace_back(all_messages.begin() + offset, all_messages.begin() + offset + message_sizes[k]);
         }
-
-        // Clear the set of pending additions.
-        d_pending_additions.clear();
     }
-
-    // Remove items from the set.
-    if (IBTK_MPI::maxReduction(static_cast<int>(d_pending_removals.size())) > 0)
+    else
     {
-        // Determine how many keys have been registered for removal on each
-        // process.
-        std::vector<int> num_removals(size, 0);
-        num_removals[rank] = static_cast<int>(d_pending_removals.size());
-        IBTK_MPI::sumReduction(&num_removals[0], size);
-
-        // Broadcast data from each process.
-        for (int sending_proc = 0; sending_proc < size; ++sending_proc)
+        // Send the pending additions and removals to the owners of the keys.
+        std::map<int, std::pair<std::vector<int>, std::vector<int> > > transactions;
+        for (const int key : d_pending_additions) transactions[internal::get_owner(key, size)].first.push_back(key);
+        for (const int key : d_pending_removals) transactions[internal::get_owner(key, size)].second.push_back(key);
+        std::map<int, std::vector<int> > send_data;
+        for (const auto& owner_transactions : transactions)
+        {
+            const std::vector<int>& additions = owner_transactions.second.first;
+            const std::vector<int>& removals = owner_transactions.second.second;
+            std::vector<int>& message = send_data[owner_transactions.first];
+            message.push_back(static_cast<int>(additions.size()));
+            message.insert(message.end(), additions.begin(), additions.end());
+            message.insert(message.end(), removals.begin(), removals.end());
+        }
+        for (auto& source_message : IBTK_MPI::sparseExchange(send_data))
         {
-            int num_keys = num_removals[sending_proc];
-            if (num_keys == 0) continue;
-            if (sending_proc == rank)
-            {
-// Pack and broadcast data on process sending_proc.
-#if !defined(NDEBUG)
-                TBOX_ASSERT(static_cast<int>(d_pending_removals.size()) == num_keys);
-#endif
-                IBTK_MPI::bcast(&d_pending_removals[0], num_keys, sending_proc);
-                for (int k = 0; k < num_keys; ++k)
-                {
-                    d_set.erase(d_pending_removals[k]);
-                }
-            }
-            else
-            {
-                // Receive and unpack data broadcast from process sending_proc.
-                std::vector<int> keys_received(num_removals[sending_proc]);
-                IBTK_MPI::bcast(&keys_received[0], num_keys, sending_proc);
-                for (int k = 0; k < num_keys; ++k)
-                {
-                    d_set.erase(keys_received[k]);
-                }
-            }
+            messages.push_back(std::move(source_message.second));
         }
+    }
+
+    // Add items to the set.
+    for (const auto& message : messages)
+    {
+        d_set.insert(message.begin() + 1, message.begin() + 1 + message[0]);
+    }
 
-        // Clear the set of pending removals.
-        d_pending_removals.clear();
+    // Remove items from the set.
+    for (const auto& message : messages)
+    {
+        for (auto it = message.begin() + 1 + message[0]; it != message.end(); ++it) d_set.erase(*it);
     }
+
+    // Clear the pending additions and removals.
+    d_pending_additions.clear();
+    d_pending_removals.clear();
     return;
 } // communicateData
 
+bool
+ParallelSet::isReplicated() const
+{
+    return d_replicate_data;
+} // isReplicated
+
 const std::set<int>&
 ParallelSet::getSet() const
 {
     return d_set;
 } // getSet
 
+std::set<int>
+ParallelSet::getLocalView(const std::vector<int>& keys) const
+{
+    std::set<int> local_view;
+    if (d_replicate_data)
+    {
+        for (const int key : keys)
+        {
+            if (d_set.count(key)) local_view.insert(key);
+        }
+        return local_view;
+    }
+
+    // Ask the owners which of the keys are contained in the set.  Only the
+    // keys that are found are returned.
+    const int size = IBTK_MPI::getNodes();
+    std::map<int, std::vector<int> > requests;
+    for (const int key : keys) requests[internal::get_owner(key, size)].push_back(key);
+    std::map<int, std::vector<int> > replies;
+    for (const auto& source_keys : IBTK_MPI::sparseExchange(requests))
+    {
+        for (const int key : source_keys.second)
+        {
+            if (d_set.count(key)) replies[source_keys.first].push_back(key);
+        }
+    }
+    for (const auto& owner_keys : IBTK_MPI::sparseExchange(replies))
+    {
+        local_view.insert(owner_keys.second.begin(), owner_keys.second.end());
+    }
+    return local_view;
+} // getLocalView
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
@@ -0,0 +1,205 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibtk/PatchDataMemoryPool.h"
+
+#include "tbox/Arena.h"
+#include "tbox/Pointer.h"
+#include "tbox/ShutdownRegistry.h"
+#include "tbox/Utilities.h"
+
+#include <cstddef>
+#include <new>
+
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+Pointer<PatchDataMemoryPool> PatchDataMemoryPool::s_pool_instance;
+bool PatchDataMemoryPool::s_registered_callback = false;
+unsigned char PatchDataMemoryPool::s_shutdown_priority = 200;
+bool PatchDataMemoryPool::s_enabled = false;
+
+Pointer<PatchDataMemoryPool>
+PatchDataMemoryPool::getPool()
+{
+    if (!s_pool_instance)
+    {
+        s_pool_instance = new PatchDataMemoryPool();
+    }
+    if (!s_registered_callback)
+    {
+        ShutdownRegistry::registerShutdownRoutine(freePool, s_shutdown_priority);
+        s_registered_callback = true;
+    }
+    return s_pool_instance;
+} // getPool
+
+void
+PatchDataMemoryPool::freePool()
+{
+    if (s_pool_instance) s_pool_instance->release();
+    s_pool_instance.setNull();
+    return;
+} // freePool
+
+Pointer<Arena>
+PatchDataMemoryPool::getArena()
+{
+    if (!s_enabled) return Pointer<Arena>(nullptr);
+    return Pointer<Arena>(getPool());
+} // getArena
+
+void
+PatchDataMemoryPool::setEnabled(const bool enabled)
+{
+    s_enabled = enabled;
+    if (!s_enabled && s_pool_instance) s_pool_instance->release();
+    return;
+} // setEnabled
+
+bool
+PatchDataMemoryPool::getEnabled()
+{
+    return s_enabled;
+} // getEnabled
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+PatchDataMemoryPool::~PatchDataMemoryPool()
+{
+    release();
+    return;
+} // ~PatchDataMemoryPool
+
+void*
+PatchDataMemoryPool::alloc(const size_t bytes)
+{
+    ++d_num_requests;
+    ++d_use_counter;
+    void* p = nullptr;
+    auto it = d_free_lists.find(bytes);
+    if (it != d_free_lists.end())
+    {
+        it->second.last_use = d_use_counter;
+        if (!it->second.blocks.empty())
+        {
+            p = it->second.blocks.back();
+            it->second.blocks.pop_back();
+            d_retained_bytes -= bytes;
+            ++d_num_recycled_requests;
+        }
+    }
+    if (!p) p = ::operator new(bytes);
+    d_block_sizes[p] = bytes;
+    d_allocated_bytes += bytes;
+    return p;
+} // alloc
+
+void
+PatchDataMemoryPool::free(void* p)
+{
+    if (!p) return;
+    auto it = d_block_sizes.find(p);
+    if (it == d_block_sizes.end())
+    {
+        TBOX_ERROR("PatchDataMemoryPool::free():\n"
+                   << "  attempting to free a block that was not allocated by this pool.\n");
+    }
+    const std::size_t bytes = it->second;
+    d_block_sizes.erase(it);
+    d_allocated_bytes -= bytes;
+
+    FreeList& free_list = d_free_lists[bytes];
+    free_list.blocks.push_back(p);
+    free_list.last_use = ++d_use_counter;
+    d_retained_bytes += bytes;
+    trim(s_enabled ? d_max_retained_bytes : 0);
+    return;
+} // free
+
+void
+PatchDataMemoryPool::setMaxRetainedBytes(const std::size_t max_retained_bytes)
+{
+    d_max_retained_bytes = max_retained_bytes;
+    trim(d_max_retained_bytes);
+    return;
+} // setMaxRetainedBytes
+
+void
+PatchDataMemoryPool::release()
+{
+    trim(0);
+    d_free_lists.clear();
+    return;
+} // release
+
+std::size_t
+PatchDataMemoryPool::getAllocatedBytes() const
+{
+    return d_allocated_bytes;
+} // getAllocatedBytes
+
+std::size_t
+PatchDataMemoryPool::getRetainedBytes() const
+{
+    return d_retained_bytes;
+} // getRetainedBytes
+
+unsigned long
+PatchDataMemoryPool::getNumberOfRequests() const
+{
+    return d_num_requests;
+} // getNumberOfRequests
+
+unsigned long
+PatchDataMemoryPool::getNumberOfRecycledRequests() const
+{
+    return d_num_recycled_requests;
+} // getNumberOfRecycledRequests
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void
+PatchDataMemoryPool::trim(const std::size_t max_retained_bytes)
+{
+    while (d_retained_bytes > max_retained_bytes)
+    {
+        // Release a block from the free list that was least recently used.
+        auto lru_it = d_free_lists.end();
+        for (auto it = d_free_lists.begin(); it != d_free_lists.end(); ++it)
+        {
+            if (it->second.blocks.empty()) continue;
+            if (lru_it == d_free_lists.end() || it->second.last_use < lru_it->second.last_use) lru_it = it;
+        }
+#if !defined(NDEBUG)
+        TBOX_ASSERT(lru_it != d_free_lists.end());
+#endif
+        ::operator delete(lru_it->second.blocks.back());
+        lru_it->second.blocks.pop_back();
+        d_retained_bytes -= lru_it->first;
+    }
+    return;
+} // trim
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,464 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibtk/IBTK_MPI.h"
+#include "ibtk/PerformanceTrace.h"
+
+#include "tbox/ShutdownRegistry.h"
+#include "tbox/Utilities.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <map>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+using clock_type = std::chrono::steady_clock;
+
+struct PhaseRecord
+{
+    int name_id;
+    int step;
+    int depth;
+    double start;
+    double duration;
+};
+
+struct ValueRecord
+{
+    int name_id;
+    int step;
+    double time;
+    double value;
+};
+
+struct OpenPhase
+{
+    int name_id;
+    double start;
+};
+
+struct PhaseTotal
+{
+    int calls = 0;
+    double duration = 0.0;
+};
+
+struct TraceData
+{
+    clock_type::time_point origin = clock_type::now();
+    int step = 0;
+    std::vector<std::string> names;
+    std::unordered_map<std::string, int> name_ids;
+    std::vector<OpenPhase> open_phases;
+    std::vector<PhaseRecord> phases;
+    std::vector<ValueRecord> values;
+
+    // The totals are indexed by name id and include the phases whose records
+    // were discarded.
+    std::vector<PhaseTotal> phase_totals;
+    std::size_t max_records = 1000000;
+    std::size_t num_discarded_records = 0;
+};
+
+TraceData* s_trace_data = nullptr;
+bool s_registered_callback = false;
+const unsigned char s_shutdown_priority = 200;
+
+TraceData&
+get_trace_data()
+{
+    if (!s_trace_data) s_trace_data = new TraceData();
+    if (!s_registered_callback)
+    {
+        ShutdownRegistry::registerShutdownRoutine(PerformanceTrace::freeTrace, s_shutdown_priority);
+        s_registered_callback = true;
+    }
+    return *s_trace_data;
+} // get_trace_data
+
+int
+get_name_id(TraceData& data, const std::string& name)
+{
+    auto it = data.name_ids.find(name);
+    if (it != data.name_ids.end()) return it->second;
+    const int name_id = static_cast<int>(data.names.size());
+    data.names.push_back(name);
+    data.name_ids[name] = name_id;
+    return name_id;
+} // get_name_id
+
+// Return whether there is room for another phase or value record, and count
+// the record as discarded if there is not.
+bool
+can_store_record(TraceData& data)
+{
+    if (data.phases.size() + data.values.size() < data.max_records) return true;
+    if (data.num_discarded_records == 0)
+    {
+        TBOX_WARNING("PerformanceTrace: the maximum number of records ("
+                     << data.max_records << ") has been reached.\n"
+                     << "  Subsequent phases and values are not recorded individually, but phases are still\n"
+                     << "  included in the load summary.\n");
+    }
+    ++data.num_discarded_records;
+    return false;
+} // can_store_record
+
+double
+elapsed_seconds(const TraceData& data)
+{
+    return std::chrono::duration<double>(clock_type::now() - data.origin).count();
+} // elapsed_seconds
+
+std::string
+escape_string(const std::string& str)
+{
+    std::string escaped;
+    escaped.reserve(str.size());
+    for (const char c : str)
+    {
+        if (c == '"' || c == '\\') escaped.push_back('\\');
+        escaped.push_back(c);
+    }
+    return escaped;
+} // escape_string
+
+// Quote a field of a CSV file, doubling any quotation marks that it contains.
+std::string
+quote_csv_field(const std::string& str)
+{
+    std::string quoted = "\"";
+    quoted.reserve(str.size() + 2);
+    for (const char c : str)
+    {
+        if (c == '"') quoted.push_back('"');
+        quoted.push_back(c);
+    }
+    quoted.push_back('"');
+    return quoted;
+} // quote_csv_field
+
+// Gather the strings of all processes on the process with rank zero, in rank
+// order.  The returned string is empty on all other processes.
+std::string
+gather_to_root(const std::string& local_str)
+{
+    const int rank = IBTK_MPI::getRank();
+    const int nodes = IBTK_MPI::getNodes();
+    std::vector<int> lengths(nodes);
+    IBTK_MPI::allGather(static_cast<int>(local_str.size()), lengths.data());
+    if (rank != 0)
+    {
+        if (!local_str.empty()) IBTK_MPI::send(local_str.data(), lengths[rank], 0, false);
+        return std::string();
+    }
+    std::string global_str = local_str;
+    std::vector<char> buf;
+    for (int r = 1; r < nodes; ++r)
+    {
+        int length = lengths[r];
+        if (length == 0) continue;
+        buf.resize(length);
+        IBTK_MPI::recv(buf.data(), length, r, false);
+        global_str.append(buf.data(), length);
+    }
+    return global_str;
+} // gather_to_root
+
+void
+write_file(const std::string& file_name, const std::string& contents)
+{
+    std::ofstream os(file_name.c_str());
+    if (!os.good())
+    {
+        TBOX_ERROR("PerformanceTrace: unable to open file " << file_name << " for writing.\n");
+    }
+    os << contents;
+    return;
+} // write_file
+} // namespace
+
+bool PerformanceTrace::s_enabled = false;
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+PerformanceTrace::ScopedPhase::ScopedPhase(const std::string& prefix, const char* name)
+{
+    if (!PerformanceTrace::isEnabled()) return;
+    d_active = true;
+    d_name = prefix + name;
+    PerformanceTrace::beginPhase(d_name);
+    return;
+} // ScopedPhase
+
+PerformanceTrace::ScopedPhase::~ScopedPhase()
+{
+    if (d_active) PerformanceTrace::endPhase(d_name);
+    return;
+} // ~ScopedPhase
+
+void
+PerformanceTrace::setEnabled(const bool enabled)
+{
+    if (enabled) get_trace_data();
+    s_enabled = enabled;
+    return;
+} // setEnabled
+
+void
+PerformanceTrace::setStep(const int step)
+{
+    if (!s_enabled) return;
+    get_trace_data().step = step;
+    return;
+} // setStep
+
+void
+PerformanceTrace::beginPhase(const std::string& name)
+{
+    if (!s_enabled) return;
+    TraceData& data = get_trace_data();
+    const int name_id = get_name_id(data, name);
+    data.open_phases.push_back({ name_id, elapsed_seconds(data) });
+    return;
+} // beginPhase
+
+void
+PerformanceTrace::endPhase(const std::string& name)
+{
+    if (!s_enabled) return;
+    TraceData& data = get_trace_data();
+    const double end = elapsed_seconds(data);
+    const int name_id = get_name_id(data, name);
+    auto it = std::find_if(data.open_phases.rbegin(), data.open_phases.rend(), [name_id](const OpenPhase& phase) {
+        return phase.name_id == name_id;
+    });
+    if (it == data.open_phases.rend()) return;
+    const auto n_open = static_cast<int>(data.open_phases.size());
+    const auto n_keep = static_cast<int>(data.open_phases.rend() - it) - 1;
+    for (int k = n_open - 1; k >= n_keep; --k)
+    {
+        const OpenPhase& phase = data.open_phases[k];
+        if (data.phase_totals.size() <= static_cast<std::size_t>(phase.name_id))
+        {
+            data.phase_totals.resize(phase.name_id + 1);
+        }
+        PhaseTotal& total = data.phase_totals[phase.name_id];
+        total.calls += 1;
+        total.duration += end - phase.start;
+        if (can_store_record(data))
+        {
+            data.phases.push_back({ phase.name_id, data.step, k, phase.start, end - phase.start });
+        }
+    }
+    data.open_phases.resize(n_keep);
+    return;
+} // endPhase
+
+void
+PerformanceTrace::recordValue(const std::string& name, const double value)
+{
+    if (!s_enabled) return;
+    TraceData& data = get_trace_data();
+    if (can_store_record(data))
+    {
+        data.values.push_back({ get_name_id(data, name), data.step, elapsed_seconds(data), value });
+    }
+    return;
+} // recordValue
+
+void
+PerformanceTrace::setMaximumNumberOfRecords(const int max_records)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(max_records >= 0);
+#endif
+    get_trace_data().max_records = static_cast<std::size_t>(max_records);
+    return;
+} // setMaximumNumberOfRecords
+
+int
+PerformanceTrace::getNumberOfDiscardedRecords()
+{
+    if (!s_trace_data) return 0;
+    return static_cast<int>(s_trace_data->num_discarded_records);
+} // getNumberOfDiscardedRecords
+
+void
+PerformanceTrace::clear()
+{
+    if (!s_trace_data) return;
+    s_trace_data->phases.clear();
+    s_trace_data->values.clear();
+    s_trace_data->phase_totals.clear();
+    s_trace_data->num_discarded_records = 0;
+    return;
+} // clear
+
+void
+PerformanceTrace::writeCSV(const std::string& file_name)
+{
+    const TraceData& data = get_trace_data();
+    const int rank = IBTK_MPI::getRank();
+    std::ostringstream os;
+    os << std::setprecision(std::numeric_limits<double>::digits10 + 1);
+    for (const PhaseRecord& phase : data.phases)
+    {
+        os << rank << "," << phase.step << ",phase," << quote_csv_field(data.names[phase.name_id]) << ","
+           << phase.depth << "," << phase.start << "," << phase.duration << ",\n";
+    }
+    for (const ValueRecord& value : data.values)
+    {
+        os << rank << "," << value.step << ",value," << quote_csv_field(data.names[value.name_id]) << ",,"
+           << value.time << ",," << value.value << "\n";
+    }
+    const std::string global_str = gather_to_root(os.str());
+    if (rank == 0) write_file(file_name, "rank,step,type,name,depth,start,duration,value\n" + global_str);
+    return;
+} // writeCSV
+
+void
+PerformanceTrace::writeChromeTrace(const std::string& file_name)
+{
+    const TraceData& data = get_trace_data();
+    const int rank = IBTK_MPI::getRank();
+
+    // Each event is preceded by a separator so that the events of all
+    // processes can simply be concatenated.  Times are in microseconds.
+    std::ostringstream os;
+    os << std::fixed << std::setprecision(3);
+    os << ",\n{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << rank << ",\"args\":{\"name\":\"rank " << rank
+       << "\"}}";
+    for (const PhaseRecord& phase : data.phases)
+    {
+        os << ",\n{\"name\":\"" << escape_string(data.names[phase.name_id]) << "\",\"ph\":\"X\",\"ts\":"
+           << 1.0e6 * phase.start << ",\"dur\":" << 1.0e6 * phase.duration << ",\"pid\":" << rank
+           << ",\"tid\":0,\"args\":{\"step\":" << phase.step << "}}";
+    }
+    for (const ValueRecord& value : data.values)
+    {
+        os << ",\n{\"name\":\"" << escape_string(data.names[value.name_id]) << "\",\"ph\":\"C\",\"ts\":"
+           << 1.0e6 * value.time << ",\"pid\":" << rank << ",\"args\":{\"value\":" << value.value << "}}";
+    }
+    std::string global_str = gather_to_root(os.str());
+    if (rank == 0)
+    {
+        // Remove the leading separator.
+        global_str.erase(0, 1);
+        write_file(file_name, "{\"traceEvents\":[" + global_str + "\n]}\n");
+    }
+    return;
+} // writeChromeTrace
+
+void
+PerformanceTrace::writeLoadSummary(const std::string& file_name)
+{
+    const TraceData& data = get_trace_data();
+    const int rank = IBTK_MPI::getRank();
+    const int nodes = IBTK_MPI::getNodes();
+
+    // Send the total time and number of calls for each phase on this process,
+    // including the phases whose records were discarded.
+    std::ostringstream os;
+    os << std::setprecision(std::numeric_limits<double>::digits10 + 1);
+    for (std::size_t name_id = 0; name_id < data.phase_totals.size(); ++name_id)
+    {
+        const PhaseTotal& total = data.phase_totals[name_id];
+        if (total.calls == 0) continue;
+        os << rank << "\t" << data.names[name_id] << "\t" << total.calls << "\t" << total.duration << "\n";
+    }
+    const std::string global_str = gather_to_root(os.str());
+    if (rank != 0) return;
+
+    // Collect the totals of all processes.  Processes that never entered a
+    // phase contribute zero time.
+    std::map<std::string, std::vector<std::pair<int, double> > > global_totals;
+    std::istringstream is(global_str);
+    std::string line;
+    while (std::getline(is, line))
+    {
+        std::istringstream line_is(line);
+        std::string rank_str, name, calls_str, time_str;
+        std::getline(line_is, rank_str, '\t');
+        std::getline(line_is, name, '\t');
+        std::getline(line_is, calls_str, '\t');
+        std::getline(line_is, time_str, '\t');
+        std::vector<std::pair<int, double> >& totals = global_totals[name];
+        totals.resize(nodes, std::make_pair(0, 0.0));
+        totals[std::stoi(rank_str)] = std::make_pair(std::stoi(calls_str), std::stod(time_str));
+    }
+
+    std::ostringstream summary_os;
+    summary_os << std::setprecision(std::numeric_limits<double>::digits10 + 1);
+    summary_os << "name,calls_min,calls_max,time_min,time_mean,time_max,rank_of_max,imbalance\n";
+    for (const auto& name_totals_pair : global_totals)
+    {
+        const std::vector<std::pair<int, double> >& totals = name_totals_pair.second;
+        int calls_min = std::numeric_limits<int>::max(), calls_max = 0, rank_of_max = 0;
+        double time_min = std::numeric_limits<double>::max(), time_max = 0.0, time_sum = 0.0;
+        for (int r = 0; r < nodes; ++r)
+        {
+            calls_min = std::min(calls_min, totals[r].first);
+            calls_max = std::max(calls_max, totals[r].first);
+            time_min = std::min(time_min, totals[r].second);
+            time_sum += totals[r].second;
+            if (totals[r].second > time_max)
+            {
+                time_max = totals[r].second;
+                rank_of_max = r;
+            }
+        }
+        const double time_mean = time_sum / static_cast<double>(nodes);
+        summary_os << quote_csv_field(name_totals_pair.first) << "," << calls_min << "," << calls_max << "," << time_min
+                   << "," << time_mean << "," << time_max << "," << rank_of_max << ","
+                   << (time_mean > 0.0 ? time_max / time_mean : 1.0) << "\n";
+    }
+    write_file(file_name, summary_os.str());
+    return;
+} // writeLoadSummary
+
+void
+PerformanceTrace::freeTrace()
+{
+    delete s_trace_data;
+    s_trace_data = nullptr;
+    s_enabled = false;
+    return;
+} // freeTrace
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
@@ -13,6 +13,7 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include "ibtk/PatchDataMemoryPool.h"
 #include "ibtk/SAMRAIDataCache.h"
 #include "ibtk/ibtk_utilities.h"
 
@@ -254,7 +255,8 @@ SAMRAIDataCache::lookupCachedPatchDataIndex(const int idx)
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        if (!level->checkAllocated(cloned_idx)) level->allocatePatchData(cloned_idx);
+        if (!level->checkAllocated(cloned_idx))
+            level->allocatePatchData(cloned_idx, 0.0, PatchDataMemoryPool::getArena());
     }
     return cloned_idx;
 }
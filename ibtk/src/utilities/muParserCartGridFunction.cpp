@@ -48,9 +48,13 @@
 #include "muParserError.h"
 
 #include <algorithm>
+#include <array>
+#include <cstddef>
+#include <list>
 #include <map>
 #include <memory>
 #include <ostream>
+#include <set>
 #include <string>
 #include <utility>
 #include <vector>
@@ -81,6 +85,80 @@ namespace IBTK
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
+namespace
+{
+// Upper bound on the total number of values of time-independent functions
+// that are cached.
+static const std::size_t MAX_NUM_CACHED_PATCH_VALS = 1 << 22;
+
+// Upper bound on the number of patch geometries that have been evaluated once
+// but whose values are not yet cached.  These are forgotten when the bound is
+// reached.
+static const std::size_t MAX_NUM_EVALUATED_PATCH_KEYS = 1 << 12;
+
+enum DataCentering
+{
+    CELL_CENTERED,
+    FACE_CENTERED,
+    NODE_CENTERED,
+    SIDE_CENTERED,
+    EDGE_CENTERED
+};
+
+// Store the positions of the data indices traversed by the iterator.  The
+// index coordinates are assumed to be cyclically permuted by the specified
+// shift, which is nonzero only for face-centered data.
+template <class Iterator>
+void
+set_positions(Iterator it,
+              const unsigned int shift,
+              const hier::Index<NDIM>& patch_lower,
+              const double* const XLower,
+              const double* const dx,
+              const std::array<double, NDIM>& offset,
+              std::array<std::vector<double>, NDIM>& posn)
+{
+    for (unsigned int d = 0; d < NDIM; ++d) posn[d].clear();
+    for (; it; it++)
+    {
+        const hier::Index<NDIM>& i = it();
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            const int i_d = i((d + NDIM - shift) % NDIM);
+            posn[d].push_back(XLower[d] + dx[d] * (static_cast<double>(i_d - patch_lower(d)) + offset[d]));
+        }
+    }
+    return;
+} // set_positions
+
+// Copy values to the data indices traversed by the iterator and return the
+// number of values that were copied.
+template <class Iterator, class DataType>
+int
+set_values(Iterator it, DataType& data, const int data_depth, const double* const vals)
+{
+    int k = 0;
+    for (; it; it++, ++k)
+    {
+        data(it(), data_depth) = vals[k];
+    }
+    return k;
+} // set_values
+
+// Determine the function used to set the data component with the specified
+// depth and axis for face-, side-, and edge-centered data.
+int
+get_function_depth(const std::size_t num_parsers, const int num_depths, const int data_depth, const unsigned int axis)
+{
+    const int parsers_size = static_cast<int>(num_parsers);
+    if (parsers_size == 1) return 0;
+    if (parsers_size == NDIM) return axis;
+    if (parsers_size == num_depths) return data_depth;
+    if (parsers_size == NDIM * num_depths) return NDIM * data_depth + axis;
+    return -1;
+} // get_function_depth
+} // namespace
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 muParserCartGridFunction::muParserCartGridFunction(std::string object_name,
@@ -170,6 +248,11 @@ muParserCartGridFunction::muParserCartGridFunction(std::string object_name,
                    << "  note that function specifications are assumed to be strings." << std::endl);
     }
 
+    // The evaluation arrays must be nonempty when the parser variables are
+    // defined.
+    d_parser_time.resize(1);
+    for (auto& posn : d_parser_posn) posn.resize(1);
+
     // Define the default and user-provided constants.
     const double pi = 3.1415926535897932384626433832795;
     const double* const x_lower = grid_geom->getXLower();
@@ -246,15 +329,29 @@ muParserCartGridFunction::muParserCartGridFunction(std::string object_name,
         }
 
         // Variables.
-        parser.DefineVar("T", &d_parser_time);
-        parser.DefineVar("t", &d_parser_time);
-        for (unsigned int d = 0; d < NDIM; ++d)
+        defineParserVariables(parser);
+    }
+
+    // The functions are time-independent if none of them use the time
+    // variable.
+    d_time_dependent = false;
+    for (const auto& parser : d_parsers)
+    {
+        try
         {
-            const std::string postfix = std::to_string(d);
-            parser.DefineVar("X" + postfix, &(d_parser_posn[d]));
-            parser.DefineVar("x" + postfix, &(d_parser_posn[d]));
-            parser.DefineVar("X_" + postfix, &(d_parser_posn[d]));
-            parser.DefineVar("x_" + postfix, &(d_parser_posn[d]));
+            const mu::varmap_type& used_vars = parser.GetUsedVar();
+            d_time_dependent = d_time_dependent || used_vars.count("T") || used_vars.count("t");
+        }
+        catch (mu::ParserError& e)
+        {
+            TBOX_ERROR("muParserCartGridFunction::muParserCartGridFunction():\n"
+                       << "  error: " << e.GetMsg() << "\n"
+                       << "  in:    " << e.GetExpr() << "\n");
+        }
+        catch (...)
+        {
+            TBOX_ERROR("muParserCartGridFunction::muParserCartGridFunction():\n"
+                       << "  unrecognized exception generated by muParser library.\n");
         }
     }
     return;
@@ -263,7 +360,7 @@ muParserCartGridFunction::muParserCartGridFunction(std::string object_name,
 bool
 muParserCartGridFunction::isTimeDependent() const
 {
-    return true;
+    return d_time_dependent;
 } // isTimeDependent
 
 void
@@ -274,8 +371,6 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
                                          const bool /*initial_time*/,
                                          Pointer<PatchLevel<NDIM> > /*level*/)
 {
-    d_parser_time = data_time;
-
     const Box<NDIM>& patch_box = patch->getBox();
     const hier::Index<NDIM>& patch_lower = patch_box.lower();
     Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
@@ -293,37 +388,82 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
     Pointer<NodeData<NDIM, double> > nc_data = data;
     Pointer<SideData<NDIM, double> > sc_data = data;
     Pointer<EdgeData<NDIM, double> > ec_data = data;
+    const DataCentering centering = cc_data ? CELL_CENTERED :
+                                     fc_data ? FACE_CENTERED :
+                                     nc_data ? NODE_CENTERED :
+                                     sc_data ? SIDE_CENTERED :
+                                               EDGE_CENTERED;
+
+    // The values of time-independent functions depend only on the data
+    // centering and depth and on the patch geometry.  They are cached when a
+    // patch geometry is evaluated for the second time, so that functions that
+    // are evaluated only once (e.g., initial conditions) do not use the cache,
+    // and are subsequently copied from the cache.
+    const double* cached_vals = nullptr;
+    bool cache_new_vals = false;
+    std::vector<double> cache_key, new_cached_vals;
+    if (!d_time_dependent)
+    {
+        cache_key.push_back(static_cast<double>(centering));
+        cache_key.push_back(static_cast<double>(cc_data ? cc_data->getDepth() :
+                                                fc_data ? fc_data->getDepth() :
+                                                nc_data ? nc_data->getDepth() :
+                                                sc_data ? sc_data->getDepth() :
+                                                ec_data ? ec_data->getDepth() :
+                                                          0));
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            cache_key.push_back(static_cast<double>(patch_box.lower(d)));
+            cache_key.push_back(static_cast<double>(patch_box.upper(d)));
+            cache_key.push_back(XLower[d]);
+            cache_key.push_back(dx[d]);
+        }
+        const auto it = d_cached_patch_vals.find(cache_key);
+        if (it != d_cached_patch_vals.end())
+        {
+            cached_vals = it->second.vals.data();
+            d_cached_patch_keys.splice(d_cached_patch_keys.begin(), d_cached_patch_keys, it->second.lru_pos);
+        }
+        else if (d_evaluated_patch_keys.erase(cache_key))
+        {
+            cache_new_vals = true;
+        }
+        else
+        {
+            if (d_evaluated_patch_keys.size() >= MAX_NUM_EVALUATED_PATCH_KEYS) d_evaluated_patch_keys.clear();
+            d_evaluated_patch_keys.insert(cache_key);
+        }
+    }
+    auto get_vals = [&](const int function_depth) -> const double* {
+        return cached_vals ? cached_vals : evaluateFunction(function_depth, data_time);
+    };
+    auto update_cache = [&](const double* const vals, const int num_vals) {
+        if (cached_vals)
+        {
+            cached_vals += num_vals;
+        }
+        else if (cache_new_vals)
+        {
+            new_cached_vals.insert(new_cached_vals.end(), vals, vals + num_vals);
+        }
+    };
+
+    std::array<double, NDIM> offset;
     if (cc_data)
     {
 #if !defined(NDEBUG)
         TBOX_ASSERT(d_parsers.size() == 1 || d_parsers.size() == static_cast<unsigned int>(cc_data->getDepth()));
 #endif
+        offset.fill(0.5);
+        if (!cached_vals)
+        {
+            set_positions(CellIterator<NDIM>(patch_box), 0, patch_lower, XLower, dx, offset, d_parser_posn);
+        }
         for (int data_depth = 0; data_depth < cc_data->getDepth(); ++data_depth)
         {
             const int function_depth = (d_parsers.size() == 1 ? 0 : data_depth);
-            for (CellIterator<NDIM> ic(patch_box); ic; ic++)
-            {
-                const CellIndex<NDIM>& i = ic();
-                for (unsigned int d = 0; d < NDIM; ++d)
-                {
-                    d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
-                }
-                try
-                {
-                    (*cc_data)(i, data_depth) = d_parsers[function_depth].Eval();
-                }
-                catch (mu::ParserError& e)
-                {
-                    TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                               << "  error: " << e.GetMsg() << "\n"
-                               << "  in:    " << e.GetExpr() << "\n");
-                }
-                catch (...)
-                {
-                    TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                               << "  unrecognized exception generated by muParser library.\n");
-                }
-            }
+            const double* const vals = get_vals(function_depth);
+            update_cache(vals, set_values(CellIterator<NDIM>(patch_box), *cc_data, data_depth, vals));
         }
     }
     else if (fc_data)
@@ -333,62 +473,22 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
                     d_parsers.size() == static_cast<unsigned int>(fc_data->getDepth()) ||
                     d_parsers.size() == NDIM * static_cast<unsigned int>(fc_data->getDepth()));
 #endif
-        for (int data_depth = 0; data_depth < fc_data->getDepth(); ++data_depth)
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
         {
-            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            // Face indices are permuted so that the first index corresponds to
+            // the face normal direction.
+            offset.fill(0.5);
+            offset[axis] = 0.0;
+            if (!cached_vals)
+            {
+                set_positions(
+                    FaceIterator<NDIM>(patch_box, axis), axis, patch_lower, XLower, dx, offset, d_parser_posn);
+            }
+            for (int data_depth = 0; data_depth < fc_data->getDepth(); ++data_depth)
             {
-                int function_depth = -1;
-                const int parsers_size = static_cast<int>(d_parsers.size());
-                const int fc_data_depth = fc_data->getDepth();
-                if (parsers_size == 1)
-                {
-                    function_depth = 0;
-                }
-                else if (parsers_size == NDIM)
-                {
-                    function_depth = axis;
-                }
-                else if (parsers_size == fc_data_depth)
-                {
-                    function_depth = data_depth;
-                }
-                else if (parsers_size == NDIM * fc_data_depth)
-                {
-                    function_depth = NDIM * data_depth + axis;
-                }
-
-                for (FaceIterator<NDIM> ic(patch_box, axis); ic; ic++)
-                {
-                    const FaceIndex<NDIM>& i = ic();
-                    const hier::Index<NDIM>& cell_idx = i.toCell(1);
-                    for (unsigned int d = 0; d < NDIM; ++d)
-                    {
-                        if (d == axis)
-                        {
-                            d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(cell_idx(d) - patch_lower(d)));
-                        }
-                        else
-                        {
-                            d_parser_posn[d] =
-                                XLower[d] + dx[d] * (static_cast<double>(cell_idx(d) - patch_lower(d)) + 0.5);
-                        }
-                    }
-                    try
-                    {
-                        (*fc_data)(i, data_depth) = d_parsers[function_depth].Eval();
-                    }
-                    catch (mu::ParserError& e)
-                    {
-                        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                                   << "  error: " << e.GetMsg() << "\n"
-                                   << "  in:    " << e.GetExpr() << "\n");
-                    }
-                    catch (...)
-                    {
-                        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                                   << "  unrecognized exception generated by muParser library.\n");
-                    }
-                }
+                const int function_depth = get_function_depth(d_parsers.size(), fc_data->getDepth(), data_depth, axis);
+                const double* const vals = get_vals(function_depth);
+                update_cache(vals, set_values(FaceIterator<NDIM>(patch_box, axis), *fc_data, data_depth, vals));
             }
         }
     }
@@ -397,32 +497,16 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
 #if !defined(NDEBUG)
         TBOX_ASSERT(d_parsers.size() == 1 || d_parsers.size() == static_cast<unsigned int>(nc_data->getDepth()));
 #endif
+        offset.fill(0.0);
+        if (!cached_vals)
+        {
+            set_positions(NodeIterator<NDIM>(patch_box), 0, patch_lower, XLower, dx, offset, d_parser_posn);
+        }
         for (int data_depth = 0; data_depth < nc_data->getDepth(); ++data_depth)
         {
             const int function_depth = (d_parsers.size() == 1 ? 0 : data_depth);
-            for (NodeIterator<NDIM> ic(patch_box); ic; ic++)
-            {
-                const NodeIndex<NDIM>& i = ic();
-                for (unsigned int d = 0; d < NDIM; ++d)
-                {
-                    d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
-                }
-                try
-                {
-                    (*nc_data)(i, data_depth) = d_parsers[function_depth].Eval();
-                }
-                catch (mu::ParserError& e)
-                {
-                    TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                               << "  error: " << e.GetMsg() << "\n"
-                               << "  in:    " << e.GetExpr() << "\n");
-                }
-                catch (...)
-                {
-                    TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                               << "  unrecognized exception generated by muParser library.\n");
-                }
-            }
+            const double* const vals = get_vals(function_depth);
+            update_cache(vals, set_values(NodeIterator<NDIM>(patch_box), *nc_data, data_depth, vals));
         }
     }
     else if (sc_data)
@@ -432,60 +516,19 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
                     d_parsers.size() == static_cast<unsigned int>(sc_data->getDepth()) ||
                     d_parsers.size() == NDIM * static_cast<unsigned int>(sc_data->getDepth()));
 #endif
-        for (int data_depth = 0; data_depth < sc_data->getDepth(); ++data_depth)
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
         {
-            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            offset.fill(0.5);
+            offset[axis] = 0.0;
+            if (!cached_vals)
+            {
+                set_positions(SideIterator<NDIM>(patch_box, axis), 0, patch_lower, XLower, dx, offset, d_parser_posn);
+            }
+            for (int data_depth = 0; data_depth < sc_data->getDepth(); ++data_depth)
             {
-                int function_depth = -1;
-                const int parsers_size = static_cast<int>(d_parsers.size());
-                const int sc_data_depth = sc_data->getDepth();
-                if (parsers_size == 1)
-                {
-                    function_depth = 0;
-                }
-                else if (parsers_size == NDIM)
-                {
-                    function_depth = axis;
-                }
-                else if (parsers_size == sc_data_depth)
-                {
-                    function_depth = data_depth;
-                }
-                else if (parsers_size == NDIM * sc_data_depth)
-                {
-                    function_depth = NDIM * data_depth + axis;
-                }
-
-                for (SideIterator<NDIM> ic(patch_box, axis); ic; ic++)
-                {
-                    const SideIndex<NDIM>& i = ic();
-                    for (unsigned int d = 0; d < NDIM; ++d)
-                    {
-                        if (d == axis)
-                        {
-                            d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
-                        }
-                        else
-                        {
-                            d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
-                        }
-                    }
-                    try
-                    {
-                        (*sc_data)(i, data_depth) = d_parsers[function_depth].Eval();
-                    }
-                    catch (mu::ParserError& e)
-                    {
-                        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                                   << "  error: " << e.GetMsg() << "\n"
-                                   << "  in:    " << e.GetExpr() << "\n");
-                    }
-                    catch (...)
-                    {
-                        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                                   << "  unrecognized exception generated by muParser library.\n");
-                    }
-                }
+                const int function_depth = get_function_depth(d_parsers.size(), sc_data->getDepth(), data_depth, axis);
+                const double* const vals = get_vals(function_depth);
+                update_cache(vals, set_values(SideIterator<NDIM>(patch_box, axis), *sc_data, data_depth, vals));
             }
         }
     }
@@ -496,60 +539,19 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
                     d_parsers.size() == static_cast<unsigned int>(ec_data->getDepth()) ||
                     d_parsers.size() == NDIM * static_cast<unsigned int>(ec_data->getDepth()));
 #endif
-        for (int data_depth = 0; data_depth < ec_data->getDepth(); ++data_depth)
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
         {
-            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            offset.fill(0.0);
+            offset[axis] = 0.5;
+            if (!cached_vals)
+            {
+                set_positions(EdgeIterator<NDIM>(patch_box, axis), 0, patch_lower, XLower, dx, offset, d_parser_posn);
+            }
+            for (int data_depth = 0; data_depth < ec_data->getDepth(); ++data_depth)
             {
-                int function_depth = -1;
-                const int parsers_size = static_cast<int>(d_parsers.size());
-                const int ec_data_depth = ec_data->getDepth();
-                if (parsers_size == 1)
-                {
-                    function_depth = 0;
-                }
-                else if (parsers_size == NDIM)
-                {
-                    function_depth = axis;
-                }
-                else if (parsers_size == ec_data_depth)
-                {
-                    function_depth = data_depth;
-                }
-                else if (parsers_size == NDIM * ec_data_depth)
-                {
-                    function_depth = NDIM * data_depth + axis;
-                }
-
-                for (EdgeIterator<NDIM> ic(patch_box, axis); ic; ic++)
-                {
-                    const EdgeIndex<NDIM>& i = ic();
-                    for (unsigned int d = 0; d < NDIM; ++d)
-                    {
-                        if (d == axis)
-                        {
-                            d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
-                        }
-                        else
-                        {
-                            d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
-                        }
-                    }
-                    try
-                    {
-                        (*ec_data)(i, data_depth) = d_parsers[function_depth].Eval();
-                    }
-                    catch (mu::ParserError& e)
-                    {
-                        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                                   << "  error: " << e.GetMsg() << "\n"
-                                   << "  in:    " << e.GetExpr() << "\n");
-                    }
-                    catch (...)
-                    {
-                        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                                   << "  unrecognized exception generated by muParser library.\n");
-                    }
-                }
+                const int function_depth = get_function_depth(d_parsers.size(), ec_data->getDepth(), data_depth, axis);
+                const double* const vals = get_vals(function_depth);
+                update_cache(vals, set_values(EdgeIterator<NDIM>(patch_box, axis), *ec_data, data_depth, vals));
             }
         }
     }
@@ -558,9 +560,75 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
         TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
                    << "  unsupported patch data type encountered." << std::endl);
     }
+
+    // Cache the newly computed values of time-independent functions, evicting
+    // the values of the least recently used patch geometries (e.g., those of
+    // patches that no longer exist after regridding) to make room for them.
+    if (cache_new_vals && new_cached_vals.size() <= MAX_NUM_CACHED_PATCH_VALS)
+    {
+        while (d_num_cached_patch_vals + new_cached_vals.size() > MAX_NUM_CACHED_PATCH_VALS)
+        {
+            const auto it = d_cached_patch_vals.find(d_cached_patch_keys.back());
+            d_num_cached_patch_vals -= it->second.vals.size();
+            d_cached_patch_vals.erase(it);
+            d_cached_patch_keys.pop_back();
+        }
+        d_num_cached_patch_vals += new_cached_vals.size();
+        d_cached_patch_keys.push_front(cache_key);
+        d_cached_patch_vals[cache_key] = { std::move(new_cached_vals), d_cached_patch_keys.begin() };
+    }
     return;
 } // setDataOnPatch
 
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void
+muParserCartGridFunction::defineParserVariables(mu::Parser& parser)
+{
+    // muParser requires each variable in bulk mode to be an array with one
+    // entry per evaluation point.
+    parser.DefineVar("T", d_parser_time.data());
+    parser.DefineVar("t", d_parser_time.data());
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        const std::string postfix = std::to_string(d);
+        parser.DefineVar("X" + postfix, d_parser_posn[d].data());
+        parser.DefineVar("x" + postfix, d_parser_posn[d].data());
+        parser.DefineVar("X_" + postfix, d_parser_posn[d].data());
+        parser.DefineVar("x_" + postfix, d_parser_posn[d].data());
+    }
+    return;
+} // defineParserVariables
+
+const double*
+muParserCartGridFunction::evaluateFunction(const int function_depth, const double data_time)
+{
+    const int num_vals = static_cast<int>(d_parser_posn[0].size());
+    d_parser_vals.resize(num_vals);
+    if (num_vals == 0) return d_parser_vals.data();
+    d_parser_time.assign(num_vals, data_time);
+    mu::Parser& parser = d_parsers[function_depth];
+    try
+    {
+        // The evaluation arrays may have been reallocated since the variables
+        // were last defined.
+        defineParserVariables(parser);
+        parser.Eval(d_parser_vals.data(), num_vals);
+    }
+    catch (mu::ParserError& e)
+    {
+        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
+                   << "  error: " << e.GetMsg() << "\n"
+                   << "  in:    " << e.GetExpr() << "\n");
+    }
+    catch (...)
+    {
+        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
+                   << "  unrecognized exception generated by muParser library.\n");
+    }
+    return d_parser_vals.data();
+} // evaluateFunction
+
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBTK
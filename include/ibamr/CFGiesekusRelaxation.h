@@ -101,6 +101,12 @@ public:
 
     //\}
 
+protected:
+    /*!
+     * \brief Use both versions of convertToConformation() provided by CFRelaxationOperator.
+     */
+    using CFRelaxationOperator::convertToConformation;
+
 private:
     double d_alpha, d_lambda;
 };
@@ -116,6 +116,12 @@ public:
 
     //\}
 
+protected:
+    /*!
+     * \brief Use both versions of convertToConformation() provided by CFRelaxationOperator.
+     */
+    using CFRelaxationOperator::convertToConformation;
+
 private:
     double d_lambda;
 };
@@ -24,6 +24,8 @@
 
 #include "ibtk/CartGridFunction.h"
 
+#include "Box.h"
+#include "CellData.h"
 #include "CellVariable.h"
 #include "HierarchyDataOpsManager.h"
 #include "Patch.h"
@@ -101,6 +103,27 @@ protected:
      */
     virtual IBTK::MatrixNd convertToConformation(const IBTK::MatrixNd& mat);
 
+    /*!
+     * \brief Indicates whether the data are converted to the conformation tensor one tensor at a time by the
+     * single tensor version of convertToConformation(). Returns false.
+     *
+     * \note Derived classes that override the single tensor version of convertToConformation() must also override
+     * this function to return true.
+     */
+    virtual bool usesSingleTensorConversion() const;
+
+    /*!
+     * \brief This function converts the data stored in in_data to the conformation tensor on each cell of the box, and
+     * stores the result in conform_data. If usesSingleTensorConversion() returns true, each cell is converted by the
+     * single tensor version of convertToConformation(). Otherwise, all cells of the box are converted at once by
+     * symmetric_tensor_exp() or symmetric_tensor_square().
+     *
+     * \note in_data and conform_data may be the same object.
+     */
+    void convertToConformation(const SAMRAI::pdat::CellData<NDIM, double>& in_data,
+                               SAMRAI::pdat::CellData<NDIM, double>& conform_data,
+                               const SAMRAI::hier::Box<NDIM>& box);
+
     int d_W_cc_idx = IBTK::invalid_index;
 
 private:
@@ -0,0 +1,90 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2019 - 2019 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDE GUARD ////////////////////////////////
+
+#ifndef included_CFTensorUtilities
+#define included_CFTensorUtilities
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <ibamr/config.h>
+
+#include "ibtk/ibtk_utilities.h"
+
+namespace SAMRAI
+{
+namespace hier
+{
+template <int DIM>
+class Box;
+} // namespace hier
+namespace pdat
+{
+template <int DIM, class TYPE>
+class CellData;
+} // namespace pdat
+} // namespace SAMRAI
+
+/////////////////////////////// FUNCTION DEFINITIONS /////////////////////////
+
+namespace IBAMR
+{
+/*!
+ * \name Functions of symmetric tensors.
+ *
+ * These functions evaluate f(A) = V f(Lambda) V^T for symmetric tensors A = V Lambda V^T. The patch data versions
+ * operate on cell-centered data that stores the tensor components in Voigt notation, i.e., (xx, yy, xy) in 2D and
+ * (xx, yy, zz, yz, xz, xy) in 3D, and process the cells in the given box one row at a time. In 2D, the tensor
+ * function is evaluated by a closed-form, branch-free spectral decomposition that the compiler can vectorize. In 3D,
+ * the eigenvalues and eigenvectors are computed by the closed-form solver
+ * Eigen::SelfAdjointEigenSolver::computeDirect().
+ *
+ * \note The input and output patch data may be the same, in which case the data are modified in place. The box must be
+ * contained in the ghost boxes of both patch data objects.
+ */
+//\{
+
+/*!
+ * \brief Compute the matrix exponential of a symmetric tensor.
+ */
+IBTK::MatrixNd symmetric_tensor_exp(const IBTK::MatrixNd& A);
+
+/*!
+ * \brief Compute the matrix exponential of each symmetric tensor in the box.
+ */
+void symmetric_tensor_exp(const SAMRAI::pdat::CellData<NDIM, double>& in_data,
+                          SAMRAI::pdat::CellData<NDIM, double>& out_data,
+                          const SAMRAI::hier::Box<NDIM>& box);
+
+/*!
+ * \brief Compute the square of each symmetric tensor in the box by multiplying out its components.
+ */
+void symmetric_tensor_square(const SAMRAI::pdat::CellData<NDIM, double>& in_data,
+                             SAMRAI::pdat::CellData<NDIM, double>& out_data,
+                             const SAMRAI::hier::Box<NDIM>& box);
+
+/*!
+ * \brief Project each symmetric tensor in the box onto the set of symmetric positive semi-definite tensors by setting
+ * its negative eigenvalues to zero.
+ */
+void symmetric_tensor_positive_part(const SAMRAI::pdat::CellData<NDIM, double>& in_data,
+                                    SAMRAI::pdat::CellData<NDIM, double>& out_data,
+                                    const SAMRAI::hier::Box<NDIM>& box);
+
+//\}
+} // namespace IBAMR
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_CFTensorUtilities
@@ -36,6 +36,7 @@
 #include "petscmat.h"
 #include "petscvec.h"
 
+#include <functional>
 #include <iosfwd>
 #include <string>
 #include <utility>
@@ -439,6 +440,23 @@ public:
                                  double f_periodic_corr,
                                  const int managing_rank) override;
 
+    // \see CIBStrategy::getMobilityMatrixEntryFunction() method.
+    /*!
+     * \brief Get a function that evaluates the entries of the mobility
+     * matrix for the prototypical structures without assembling it.
+     */
+    std::function<double(int, int)> getMobilityMatrixEntryFunction(const std::string& mat_name,
+                                                                   MobilityMatrixType mat_type,
+                                                                   const std::vector<unsigned>& prototype_struct_ids,
+                                                                   const double* grid_dx,
+                                                                   const double* domain_extents,
+                                                                   const bool initial_time,
+                                                                   double rho,
+                                                                   double mu,
+                                                                   const std::pair<double, double>& scale,
+                                                                   double f_periodic_corr,
+                                                                   const int managing_rank) override;
+
     // \see CIBStrategy::constructGeometricMatrix() method.
     /*!
      * \brief Generate block-diagonal geometric matrix for the prototypical structures
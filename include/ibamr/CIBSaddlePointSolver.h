@@ -21,6 +21,7 @@
 #include <ibamr/config.h>
 
 #include "ibtk/HierarchyGhostCellInterpolation.h"
+#include "ibtk/PETScFischerGuess.h"
 
 #include "tbox/DescribedClass.h"
 #include "tbox/Pointer.h"
@@ -28,6 +29,7 @@
 #include "petscksp.h"
 
 #include <limits>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -108,6 +110,13 @@ namespace IBAMR
  *
  * Here, we employ the Krylov solver to solve the above saddle-point problem. We use
  * Schur complement preconditioner to precondition the iterative solver.
+ *
+ * If <tt>recycle_subspace_size</tt> is positive and
+ * <tt>initial_guess_nonzero</tt> is FALSE, the initial guess of each solve is
+ * projected from up to that many previous solutions (see
+ * IBTK::PETScFischerGuess). They are kept until the grid or the velocity
+ * problem coefficients change, or for at most <tt>recycle_refresh_interval</tt>
+ * solves if that key is positive.
  */
 class CIBSaddlePointSolver : public SAMRAI::tbox::DescribedClass
 {
@@ -367,6 +376,10 @@ private:
     bool d_initial_guess_nonzero = true;
     bool d_enable_logging = false;
 
+    // Retained solution subspace used to compute initial guesses.
+    int d_recycle_subspace_size = 0, d_recycle_refresh_interval = 0, d_num_recycled_solves = 0;
+    std::unique_ptr<IBTK::PETScFischerGuess> d_recycled_subspace;
+
     // Preconditioner stuff
     SAMRAI::tbox::Pointer<IBAMR::INSStaggeredHierarchyIntegrator> d_ins_integrator;
     SAMRAI::tbox::Pointer<IBAMR::StaggeredStokesSolver> d_LInv;
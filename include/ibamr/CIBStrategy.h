@@ -34,6 +34,7 @@ IBTK_DISABLE_EXTRA_WARNINGS
 #include <Eigen/Geometry>
 IBTK_ENABLE_EXTRA_WARNINGS
 
+#include <functional>
 #include <map>
 #include <string>
 #include <utility>
@@ -509,6 +510,31 @@ public:
                                          double f_periodic_corr,
                                          const int managing_rank);
 
+    /*!
+     * \brief Get a function that evaluates the (i,j)-th entry of the mobility
+     * matrix that constructMobilityMatrix() would assemble for the same
+     * arguments, without assembling the dense matrix. This is used to compress
+     * large mobility matrices directly (e.g., by IBAMR::HODLRMatrix).
+     * \note This function is collective. The returned function is only
+     * valid on \a managing_rank; it is empty on the other ranks.
+     * \note A default implementation that returns an empty function, i.e.,
+     * that does not support entry-wise evaluation, is provided in this class.
+     *
+     * The parameters have the same meaning as for constructMobilityMatrix().
+     */
+    virtual std::function<double(int, int)>
+    getMobilityMatrixEntryFunction(const std::string& mat_name,
+                                   MobilityMatrixType mat_type,
+                                   const std::vector<unsigned>& prototype_struct_ids,
+                                   const double* grid_dx,
+                                   const double* domain_extents,
+                                   const bool initial_time,
+                                   double rho,
+                                   double mu,
+                                   const std::pair<double, double>& scale,
+                                   double f_periodic_corr,
+                                   const int managing_rank);
+
     /*!
      * \brief Construct a geometric matrix for the prototypical structures
      * identified by their indices. A geometric matrix maps center of mass rigid
@@ -52,8 +52,10 @@ IBTK_ENABLE_EXTRA_WARNINGS
 #include <algorithm>
 #include <fstream>
 #include <limits>
+#include <map>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace IBTK
@@ -119,6 +121,15 @@ public:
      */
     virtual void postprocessIntegrateData(double current_time, double new_time, int num_cycles) override;
 
+    /*!
+     * \brief Complete redistributing Lagrangian data following regridding the
+     * patch hierarchy and discard the cached structure membership of the local
+     * nodes.
+     */
+    virtual void endDataRedistribution(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                                       SAMRAI::tbox::Pointer<SAMRAI::mesh::GriddingAlgorithm<NDIM> > gridding_alg)
+        override;
+
     /*!
      * \brief Register kinematics of the immersed structure(s) with this class.
      */
@@ -207,6 +218,18 @@ public:
         return d_center_of_mass_current;
     }
 
+    /*!
+     * \brief Get the current moment of inertia for all Lagrangian structures
+     * with respect to their center of mass.
+     *
+     * \note The moment of inertia is only computed for self-rotating
+     * structures.
+     */
+    inline const IBTK::EigenAlignedVector<Eigen::Matrix3d>& getCurrentStructureMOI()
+    {
+        return d_moment_of_inertia_current;
+    }
+
     /*
      * Set velocity physical boundary options
      */
@@ -309,6 +332,20 @@ private:
      */
     void setInitialLagrangianVelocity();
 
+    /*!
+     * \brief Determine the structure to which each local node on the given
+     * level belongs.
+     *
+     * \return For each local node, the position of its structure in
+     * d_ib_kinematics and the first Lagrangian index of the structure on the
+     * level, or (-1, -1) if the node does not belong to a structure handled by
+     * this class.
+     *
+     * \note The result is cached until the Lagrangian data are redistributed
+     * or new kinematics objects are registered.
+     */
+    const std::vector<std::pair<int, int> >& getLocalNodeStructures(int ln);
+
     /*!
      * \brief Calculate center of mass and moment of inertia of immersed
      * structures.
@@ -321,10 +358,11 @@ private:
     void calculateKinematicsVelocity();
 
     /*!
-     * \brief Calculate momentum of kinematics velocity. This is extraneous momentum
-     * that needs to be subtracted from the kinematics velocity.
+     * \brief Calculate momentum of kinematics velocity of all self-translating
+     * structures. This is extraneous momentum that needs to be subtracted from
+     * the kinematics velocity.
      */
-    void calculateMomentumOfKinematicsVelocity(const int position_handle);
+    void calculateMomentumOfKinematicsVelocity();
 
     /*!
      * \brief Calculate volume element associated with material points.
@@ -452,6 +490,13 @@ private:
      */
     std::vector<SAMRAI::tbox::Pointer<IBAMR::ConstraintIBKinematics> > d_ib_kinematics;
 
+    /*!
+     * Cached structure membership of the local nodes on each level.
+     *
+     * \see getLocalNodeStructures()
+     */
+    std::map<int, std::vector<std::pair<int, int> > > d_local_node_structures;
+
     /*!
      * FuRMoRP apply time.
      */
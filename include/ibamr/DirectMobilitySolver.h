@@ -20,6 +20,7 @@
 
 #include <ibamr/config.h>
 
+#include "ibamr/HODLRMatrix.h"
 #include "ibamr/ibamr_enums.h"
 
 #include "tbox/Database.h"
@@ -29,7 +30,9 @@
 #include "petscmat.h"
 #include "petscvec.h"
 
+#include <functional>
 #include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -53,6 +56,26 @@ namespace IBAMR
 /*!
  * \brief Class DirectMobilitySolver solves the mobility and body-mobility
  * sub-problem by employing direct solvers.
+ *
+ * In addition to the dense LAPACK factorizations, the mobility matrix can be
+ * inverted approximately using a hierarchically off-diagonal low-rank
+ * factorization (inversion type HODLR, see IBAMR::HODLRMatrix), whose cost
+ * grows almost linearly with the number of markers. The approximation is
+ * controlled by the optional input database
+ *
+ * \verbatim
+ HODLR {
+    leaf_size = 64    // maximum size of dense diagonal blocks
+    rel_tol = 1.0e-6  // relative tolerance for off-diagonal compression
+    max_rank = 64     // maximum rank of off-diagonal blocks
+ }
+ \endverbatim
+ *
+ * HODLR is only supported for the mobility matrix; the body mobility matrix is
+ * small and is always factorized densely. Unless the mobility matrix is read
+ * from a file, the HODLR approximation is compressed directly from the entries
+ * provided by CIBStrategy::getMobilityMatrixEntryFunction(), and the dense
+ * mobility matrix is never allocated.
  */
 class DirectMobilitySolver : public SAMRAI::tbox::DescribedClass
 {
@@ -239,10 +262,23 @@ private:
                               const std::string& mat_name,
                               const std::string& err_msg);
 
+    /*!
+     * \brief Compress the matrix whose entries are given by \a entry into a
+     * HODLR approximation and factorize it.
+     */
+    void factorizeHODLRMatrix(const HODLRMatrix::EntryFcn& entry,
+                              const int mat_size,
+                              const std::string& mat_name,
+                              const std::string& err_msg);
+
     /*!
      * \brief Compute solution and store in the rhs vector.
      */
-    void computeSolution(Mat& mat, const MobilityMatrixInverseType& inv_type, int* ipiv, double* rhs);
+    void computeSolution(Mat& mat,
+                         const MobilityMatrixInverseType& inv_type,
+                         int* ipiv,
+                         double* rhs,
+                         const HODLRMatrix* hodlr_mat = nullptr);
 
     // Solver stuff
     std::string d_object_name;
@@ -264,6 +300,8 @@ private:
     std::map<std::string, std::pair<double, double> > d_mat_scale_map;
     std::map<std::string, std::string> d_mat_filename_map;
     std::map<std::string, std::pair<std::vector<int>, std::vector<int> > > d_ipiv_map; // permutation matrices for LU
+    std::map<std::string, std::unique_ptr<HODLRMatrix> > d_hodlr_mat_map; // compressed mobility matrices
+    std::map<std::string, HODLRMatrix::EntryFcn> d_mobility_entry_map;    // entries of unassembled matrices
 
     // PETSc representation of matrices.
     std::map<std::string, std::pair<Mat, Mat> > d_petsc_mat_map;
@@ -278,6 +316,8 @@ private:
     double d_f_periodic_corr = 0.0;
     bool d_recompute_mob_mat = false;
     double d_svd_replace_value, d_svd_eps;
+    int d_hodlr_leaf_size = 64, d_hodlr_max_rank = 64;
+    double d_hodlr_rel_tol = 1.0e-6;
 
 }; // DirectMobilitySolver
 
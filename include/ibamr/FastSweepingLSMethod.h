@@ -23,9 +23,11 @@
 #include "ibamr/LSInitStrategy.h"
 #include "ibamr/ibamr_enums.h"
 
+#include "Box.h"
 #include "tbox/Pointer.h"
 #include "tbox/Serializable.h"
 
+#include <map>
 #include <string>
 #include <vector>
 
@@ -39,8 +41,6 @@ class CellData;
 namespace hier
 {
 template <int DIM>
-class Box;
-template <int DIM>
 class Patch;
 } // namespace hier
 } // namespace SAMRAI
@@ -59,6 +59,22 @@ namespace IBAMR
  * specified through input file. In presence of a physical domain wall, the distance function
  * at a grid point is D = min(distance from interface, distance from wall location).
  *
+ * \note By default, each outer iteration sweeps every patch once and convergence is
+ * measured by the change of the distance function over the entire hierarchy. If
+ * <code>front_propagation = TRUE</code> is specified in the input database, each patch
+ * is instead swept until its values no longer change (up to <code>max_patch_sweeps</code>
+ * times, which must be at least one), and is only swept again once the front entering it
+ * through its ghost cells has changed. Values are considered unchanged if they differ by
+ * at most <code>front_tol</code> (default 1.0e-12), which is separate from the tolerance
+ * <code>abs_tol</code> of the L2-norm used by the default iterations. The fronts are
+ * exchanged between the patches owned by the same processor by direct copies until no
+ * local patch changes, and only then through a ghost cell fill on all processors. The
+ * iterations stop once no patch on any processor has changed, so that the work done is
+ * proportional to the number of patches that the front passes through. The number of
+ * local exchanges in each outer iteration is limited by <code>max_local_iterations</code>
+ * (default 100, which must be at least one); if the limit is reached, the remaining
+ * exchanges are done in the next outer iteration.
+ *
  * References
  * Zhao, H., <A HREF="http://www.ams.org/journals/mcom/2005-74-250/S0025-5718-04-01678-3/">
  * A Fast Sweeping Method For Eikonal Equations</A>
@@ -87,17 +103,82 @@ public:
                           double time,
                           bool initial_time) override;
 
+    /*!
+     * \return The number of outer iterations done by the most recent call to
+     * initializeLSData().
+     */
+    int getNumberOfIterations() const;
+
 protected:
     // Algorithm parameters.
     bool d_consider_phys_bdry_wall = false;
     int d_wall_location_idx[2 * NDIM];
+    bool d_use_front_propagation = false;
+    int d_max_patch_sweeps = 8;
+    int d_max_local_its = 100;
+    double d_front_tol = 1.0e-12;
 
 private:
+    /*!
+     * \brief A copy of the values of a local patch into the ghost cells of
+     * another local patch on the same level.
+     */
+    struct LocalGhostCopy
+    {
+        int dst_patch_num;
+        int src_patch_num;
+        SAMRAI::hier::Box<NDIM> overlap;
+    };
+
+    /*!
+     * \brief The number of outer iterations done by the most recent call to
+     * initializeLSData().
+     */
+    int d_num_outer_its = 0;
+
     /*!
      * \brief Do one fast sweep over the hierarchy.
      */
     void fastSweep(SAMRAI::tbox::Pointer<IBTK::HierarchyMathOps> hier_math_ops, int dist_idx) const;
 
+    /*!
+     * \brief Sweep each local patch whose incoming front has changed since it was
+     * last swept until its values no longer change.
+     *
+     * The values of the ghost cells of each converged patch are stored in
+     * patch_fronts, indexed by level number and patch number.
+     *
+     * \return The number of local patches whose values have changed.
+     */
+    int sweepPatchesWithChangedFronts(SAMRAI::tbox::Pointer<IBTK::HierarchyMathOps> hier_math_ops,
+                                      int dist_idx,
+                                      std::vector<std::map<int, std::vector<double> > >& patch_fronts) const;
+
+    /*!
+     * \brief Determine, for each level, the copies of the values of the local
+     * patches into the ghost cells of the local patches that intersect the
+     * narrow band.
+     *
+     * The neighbors of each patch are found with the box tree of its level, so
+     * that the copies are determined once per reinitialization and are reused
+     * by every call to copyLocalGhostData().
+     */
+    void buildLocalGhostCopies(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                               int dist_idx,
+                               std::vector<std::vector<LocalGhostCopy> >& local_ghost_copies) const;
+
+    /*!
+     * \brief Copy the values of each local patch into the ghost cells of the
+     * local patches on the same level that intersect the narrow band, as
+     * determined by buildLocalGhostCopies().
+     *
+     * \note Ghost cells that are filled from other processors, coarser levels,
+     * periodic images, or physical boundary conditions are not modified.
+     */
+    void copyLocalGhostData(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                            int dist_idx,
+                            const std::vector<std::vector<LocalGhostCopy> >& local_ghost_copies) const;
+
     /*!
      * \brief Do one fast sweep over a patch.
      */
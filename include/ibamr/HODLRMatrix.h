@@ -0,0 +1,177 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDE GUARD ////////////////////////////////
+
+#ifndef included_IBAMR_HODLRMatrix
+#define included_IBAMR_HODLRMatrix
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <ibamr/config.h>
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <vector>
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBAMR
+{
+/*!
+ * \brief Class HODLRMatrix stores a hierarchically off-diagonal low-rank
+ * (HODLR) approximation of a dense square matrix and provides fast
+ * matrix-vector products and an approximate direct solver.
+ *
+ * The index set is recursively bisected until the diagonal blocks contain at
+ * most \a leaf_size rows. Diagonal blocks on the finest level are stored as
+ * dense LU factorizations, and each off-diagonal block is compressed to a
+ * low-rank product \f$ U V^T \f$ by adaptive cross approximation (ACA) with
+ * partial pivoting, which only requires evaluating O((m + n) r) entries of an
+ * m x n block of rank r. The approximate inverse is applied by recursively
+ * applying the Sherman-Morrison-Woodbury formula on each level of the tree
+ * (Ambikasaran and Darve, J. Sci. Comput. 57:477-501, 2013).
+ *
+ * For kernel matrices such as the Rotne-Prager-Yamakawa mobility matrix, the
+ * off-diagonal blocks have low numerical rank when contiguous index ranges
+ * correspond to spatially localized sets of points (e.g., markers of a
+ * structure numbered along its surface). In that case, the storage and the
+ * factorization costs are O(r N log N) and O(r^2 N log^2 N), respectively,
+ * and each solve costs O(r N log N).
+ */
+class HODLRMatrix
+{
+public:
+    /*!
+     * \brief Type of the function that evaluates the (i,j)-th entry of the
+     * matrix to be compressed.
+     */
+    using EntryFcn = std::function<double(int i, int j)>;
+
+    /*!
+     * \brief Constructor.
+     *
+     * \param leaf_size Maximum size of the dense diagonal blocks.
+     *
+     * \param rel_tol Relative tolerance used to truncate the low-rank
+     * approximations of the off-diagonal blocks.
+     *
+     * \param max_rank Maximum rank of the low-rank approximations of the
+     * off-diagonal blocks.
+     */
+    HODLRMatrix(int leaf_size = 64, double rel_tol = 1.0e-6, int max_rank = 64);
+
+    /*!
+     * \brief Destructor.
+     */
+    ~HODLRMatrix();
+
+    /*!
+     * \brief Deleted copy constructor.
+     */
+    HODLRMatrix(const HODLRMatrix& from) = delete;
+
+    /*!
+     * \brief Deleted assignment operator.
+     */
+    HODLRMatrix& operator=(const HODLRMatrix& that) = delete;
+
+    /*!
+     * \brief Compress the n x n matrix whose entries are given by \a entry.
+     * Any previously computed approximation is discarded.
+     */
+    void compress(int n, const EntryFcn& entry);
+
+    /*!
+     * \brief Compute the approximate factorization of the compressed matrix.
+     */
+    void factorize();
+
+    /*!
+     * \brief Compute y = A x using the compressed matrix.
+     */
+    void apply(const double* x, double* y) const;
+
+    /*!
+     * \brief Overwrite \a rhs with the solution of A x = rhs computed using
+     * the approximate factorization.
+     */
+    void solve(double* rhs) const;
+
+    /*!
+     * \brief Return the size of the matrix.
+     */
+    int getSize() const;
+
+    /*!
+     * \brief Return the maximum rank of the off-diagonal blocks.
+     */
+    int getMaxRank() const;
+
+    /*!
+     * \brief Return the number of stored double precision values, including
+     * the factorization.
+     */
+    std::size_t getStorageSize() const;
+
+private:
+    struct Node;
+
+    /*!
+     * \brief Recursively build the tree and compress the off-diagonal blocks.
+     */
+    std::unique_ptr<Node> buildNode(int begin, int size, const EntryFcn& entry);
+
+    /*!
+     * \brief Compress the m x n block with row offset \a row_begin and column
+     * offset \a col_begin.
+     */
+    void compressBlock(int row_begin,
+                       int m,
+                       int col_begin,
+                       int n,
+                       const EntryFcn& entry,
+                       int& rank,
+                       std::vector<double>& U,
+                       std::vector<double>& V) const;
+
+    /*!
+     * \brief Recursively factorize a node.
+     */
+    void factorizeNode(Node& node);
+
+    /*!
+     * \brief Recursively apply the matrix to the vectors stored in \a x.
+     */
+    void applyNode(const Node& node, const double* x, double* y) const;
+
+    /*!
+     * \brief Recursively solve with \a nrhs right-hand sides stored
+     * column-wise with leading dimension \a ld.
+     */
+    void solveNode(const Node& node, double* rhs, int nrhs, int ld) const;
+
+    int d_leaf_size;
+    double d_rel_tol;
+    int d_max_rank;
+
+    int d_size = 0;
+    bool d_is_factorized = false;
+    std::unique_ptr<Node> d_root;
+};
+} // namespace IBAMR
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBAMR_HODLRMatrix
@@ -31,6 +31,7 @@ IBTK_DISABLE_EXTRA_WARNINGS
 #include <boost/multi_array.hpp>
 IBTK_ENABLE_EXTRA_WARNINGS
 
+#include <array>
 #include <functional>
 #include <iosfwd>
 #include <map>
@@ -135,12 +136,25 @@ public:
 
     /*!
      * \brief Initialize hierarchy- and configuration-dependent data.
+     *
+     * The meter webs and their interpolation stencils are rebuilt only if
+     * invalidateHierarchyDependentData() has been called or if the perimeter
+     * nodes of the meters have moved since the stencils were last built.
+     * Otherwise, only the time step number and the time at which the
+     * instrument data is read are updated.
      */
     void initializeHierarchyDependentData(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
                                           IBTK::LDataManager* l_data_manager,
                                           int timestep_num,
                                           double data_time);
 
+    /*!
+     * \brief Indicate that the patch hierarchy has changed, so that the meter
+     * webs and their interpolation stencils must be rebuilt by the next call to
+     * initializeHierarchyDependentData().
+     */
+    void invalidateHierarchyDependentData();
+
     /*!
      * \brief Compute the flow rates and pressures in the various distributed
      * internal flow meters and pressure gauges.
@@ -228,43 +242,51 @@ private:
     std::vector<double> d_flow_values, d_mean_pres_values, d_point_pres_values;
 
     /*!
-     * \brief Data structures employed to manage mappings between cell indices
-     * and web patch data (i.e., patch centroids and area-weighted normals) and
-     * meter centroid data.
+     * \brief Precomputed linear interpolation stencil.  The stencil consists of
+     * the 2^NDIM data indices whose lower corner is \a lower, and the weight of
+     * each index is the product of the one-dimensional weights \a wgt.
      */
-    struct IndexFortranOrder
+    struct LinearStencil
     {
-        inline bool operator()(const SAMRAI::hier::Index<NDIM>& lhs, const SAMRAI::hier::Index<NDIM>& rhs) const
-        {
-            return (lhs(0) < rhs(0)
-#if (NDIM > 1)
-                    || (lhs(0) == rhs(0) && lhs(1) < rhs(1))
-#if (NDIM > 2)
-                    || (lhs(0) == rhs(0) && lhs(1) == rhs(1) && lhs(2) < rhs(2))
-#endif
-#endif
-            );
-        } // operator()
+        SAMRAI::hier::Index<NDIM> lower;
+        std::array<std::array<double, 2>, NDIM> wgt;
     };
 
+    /*!
+     * \brief Data structures employed to store the web patch data (i.e., the
+     * area-weighted normals) and the interpolation stencils of the web patches
+     * and meter centroids.
+     *
+     * These data are computed by initializeHierarchyDependentData() and are
+     * stored for each level by local patch number, so that
+     * readInstrumentData() only visits the patches and cells that are touched
+     * by the flow meters and pressure gauges.
+     */
     struct WebPatch
     {
         int meter_num;
-        const IBTK::Vector* X;
         const IBTK::Vector* dA;
+        LinearStencil cc_stencil;
+        std::array<LinearStencil, NDIM> sc_stencil;
     };
 
-    using WebPatchMap = std::multimap<SAMRAI::hier::Index<NDIM>, WebPatch, IndexFortranOrder>;
-    std::vector<WebPatchMap> d_web_patch_map;
+    std::vector<std::map<int, std::vector<WebPatch> > > d_web_patch_map;
 
     struct WebCentroid
     {
         int meter_num;
-        const IBTK::Vector* X;
+        LinearStencil cc_stencil;
     };
 
-    using WebCentroidMap = std::multimap<SAMRAI::hier::Index<NDIM>, WebCentroid, IndexFortranOrder>;
-    std::vector<WebCentroidMap> d_web_centroid_map;
+    std::vector<std::map<int, std::vector<WebCentroid> > > d_web_centroid_map;
+
+    /*!
+     * \brief Whether the meter webs and their interpolation stencils must be
+     * rebuilt, and the positions of the perimeter nodes for which they were
+     * last built.
+     */
+    bool d_web_data_is_stale = true;
+    std::vector<double> d_web_X_perimeter;
 
     /*
      * The directory where data is to be dumped and the most recent timestep
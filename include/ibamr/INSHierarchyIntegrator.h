@@ -355,6 +355,32 @@ public:
      */
     int getNumberOfCycles() const override;
 
+    /*!
+     * Returns the largest stable time step size on each level of the patch
+     * hierarchy, as determined by the level-local CFL condition.
+     *
+     * All levels are advanced synchronously using the minimum of these values.
+     * The values returned by this function are the time step sizes that each
+     * level could use if it were advanced with its own time step size.
+     */
+    std::vector<double> getLevelMaximumTimeStepSizes() const;
+
+    /*!
+     * Returns an estimate of the factor by which the number of cell updates
+     * per unit of simulated time would be reduced if the levels of the patch
+     * hierarchy were advanced with level-dependent time step sizes (i.e., if
+     * time subcycling were used) rather than with a single, synchronous time
+     * step size.
+     *
+     * The estimate assumes that the time step size on each level is the time
+     * step size of the next coarser level divided by the refinement ratio
+     * between the levels, as in the Berger-Colella algorithm.
+     *
+     * \note This is a diagnostic only: all levels are still advanced
+     * synchronously.
+     */
+    double getEstimatedSubcyclingWorkReduction() const;
+
 protected:
     /*!
      * The constructor for class INSHierarchyIntegrator sets some default
@@ -613,6 +639,12 @@ private:
      * members.
      */
     void getFromRestart();
+
+    /*!
+     * Estimate the work reduction from time subcycling given the largest
+     * stable time step size on each level.
+     */
+    double getEstimatedSubcyclingWorkReduction(const std::vector<double>& level_dt) const;
 };
 } // namespace IBAMR
 
@@ -39,7 +39,9 @@
 #include "tbox/Database.h"
 #include "tbox/Pointer.h"
 
+#include <deque>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace IBAMR
@@ -140,6 +142,29 @@ public:
      */
     void setStokesSolverNeedsInit();
 
+    /*!
+     * Set the order of the polynomial extrapolation of the velocity and
+     * pressure from previous time steps that is used as the initial guess for
+     * the first Stokes solve of each time step.
+     *
+     * An order of zero (the default) uses the current state as the initial
+     * guess.  Orders one and two use linear and quadratic extrapolation from
+     * the solutions of the last two and three time steps, respectively.  The
+     * stored solutions are discarded whenever the patch hierarchy is
+     * regridded, and the initial guess falls back to the current state until
+     * enough time steps have been completed on the new hierarchy.
+     *
+     * This value may also be set in the input database using the key
+     * <code>stokes_initial_guess_extrapolation_order</code>.
+     */
+    void setStokesInitialGuessExtrapolationOrder(int order);
+
+    /*!
+     * Get the number of solutions of previous time steps that are currently
+     * stored for computing initial guesses for the Stokes solver.
+     */
+    int getNumberOfStoredStokesSolutions() const;
+
     /*!
      * Initialize the variables, basic communications algorithms, solvers, and
      * other data structures used by this time integrator object.
@@ -314,6 +339,29 @@ protected:
      */
     void regridProjection() override;
 
+    /*!
+     * Overwrite the solution vector with the extrapolation of the stored
+     * solutions of previous time steps to the time interval [current_time,
+     * new_time].  The solution vector is not modified if not enough solutions
+     * have been stored.
+     */
+    void extrapolateStokesSolution(const SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> >& sol_vec,
+                                   double current_time,
+                                   double new_time);
+
+    /*!
+     * Store the solution of the time step [current_time, new_time] for use in
+     * computing initial guesses for subsequent time steps.
+     */
+    void storeStokesSolution(const SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> >& sol_vec,
+                             double current_time,
+                             double new_time);
+
+    /*!
+     * Discard all stored solutions.
+     */
+    void clearStokesSolutionHistory();
+
 private:
     /*!
      * \brief Default constructor.
@@ -396,6 +444,15 @@ private:
     SAMRAI::tbox::Pointer<StaggeredStokesSolver> d_stokes_solver;
     bool d_stokes_solver_needs_init;
 
+    /*
+     * Solutions of previous time steps (most recent first) along with their
+     * time intervals, used to extrapolate initial guesses for the Stokes
+     * solver.
+     */
+    int d_stokes_initial_guess_extrap_order = 0;
+    std::deque<SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > > d_stokes_sol_history;
+    std::deque<std::pair<double, double> > d_stokes_sol_history_times;
+
     /*!
      * Fluid solver variables.
      */
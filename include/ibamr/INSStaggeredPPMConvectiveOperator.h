@@ -33,6 +33,7 @@
 #include "tbox/Database.h"
 #include "tbox/Pointer.h"
 
+#include <array>
 #include <string>
 #include <vector>
 
@@ -190,6 +191,10 @@ private:
     // Scratch data.
     SAMRAI::tbox::Pointer<SAMRAI::pdat::SideVariable<NDIM, double> > d_U_var;
     int d_U_scratch_idx = IBTK::invalid_index;
+
+    // Work arrays reused by the patch-level kernels.
+    std::array<std::array<std::vector<double>, NDIM>, NDIM> d_U_adv_buffers, d_U_half_buffers;
+    std::vector<double> d_dU_buffer, d_U_L_buffer, d_U_R_buffer, d_U_scratch1_buffer, d_U_scratch2_buffer;
 };
 } // namespace IBAMR
 
@@ -28,6 +28,9 @@
 #include "RobinBcCoefStrategy.h"
 #include "tbox/Pointer.h"
 
+#include <array>
+#include <limits>
+#include <map>
 #include <string>
 #include <vector>
 
@@ -164,14 +167,26 @@ private:
     void getFromInput(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> db);
 
     /*!
-     * Get surface elevation at a specified horizontal position and time.
+     * Compute cos(omega t) and sin(omega t) for each component wave, unless
+     * they have already been computed for the specified time.
      */
-    double getSurfaceElevation(double x, double time) const;
+    void updateTimePhases(double time) const;
 
     /*!
-     * Get velocity at a specified position and time.
+     * Get surface elevation at a specified horizontal position and the time
+     * of the most recent call to updateTimePhases().
      */
-    double getVelocity(double x, double z_plus_d, double time) const;
+    double getSurfaceElevation(double x) const;
+
+    /*!
+     * Get the table of velocity coefficients for a column of num_z boundary
+     * points at horizontal position x and vertical positions z_lower + k*dz.
+     *
+     * Row k of the table stores coefficients A_i and B_i for each component
+     * wave so that the velocity at the kth point is sum_i A_i cos(omega_i t) +
+     * B_i sin(omega_i t). Tables are cached between calls.
+     */
+    const std::vector<double>& getVelocityTable(double x, double z_lower, double dz, int num_z) const;
 
     /*!
      * Book-keeping.
@@ -219,6 +234,18 @@ private:
      * Number of interface cells.
      */
     double d_num_interface_cells;
+
+    /*!
+     * Cached values of cos(omega t) and sin(omega t) for each component wave,
+     * and the time at which they were computed.
+     */
+    mutable double d_time_phases_time = std::numeric_limits<double>::quiet_NaN();
+    mutable std::vector<double> d_cos_omega_t, d_sin_omega_t;
+
+    /*!
+     * Cached velocity coefficient tables, indexed by (x, z_lower, dz, num_z).
+     */
+    mutable std::map<std::array<double, 4>, std::vector<double> > d_velocity_tables;
 };
 } // namespace IBAMR
 
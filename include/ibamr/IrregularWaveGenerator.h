@@ -26,7 +26,10 @@
 
 #include <fstream>
 #include <limits>
+#include <list>
+#include <map>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace SAMRAI
@@ -68,6 +71,42 @@ private:
      */
     void getFromInput(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> db);
 
+    /*!
+     * Compute cos(omega t) and sin(omega t) for each component wave, unless
+     * they have already been computed for the specified time.
+     */
+    void updateTimePhases(double time) const;
+
+    /*!
+     * Get cos(k x + phase) followed by sin(k x + phase) for each component
+     * wave at the specified horizontal position.
+     */
+    const std::vector<double>& getHorizontalFactors(double x) const;
+
+    /*!
+     * Get the vertical profiles a omega cosh(k z) / sinh(k d) followed by
+     * a omega sinh(k z) / sinh(k d) for each component wave at the specified
+     * vertical position.
+     */
+    const std::vector<double>& getDepthProfiles(double z_plus_d) const;
+
+    /*!
+     * Values of the component waves cached by position. When the cache is
+     * full, the entry of the least recently used position is reused.
+     */
+    struct PositionCache
+    {
+        std::list<std::pair<double, std::vector<double> > > entries;
+        std::map<double, std::list<std::pair<double, std::vector<double> > >::iterator> index;
+    };
+
+    /*!
+     * Get the cached values at the specified position, which are marked as the
+     * most recently used ones. If the position is not cached, an entry for it
+     * is created and is_cached is set to false.
+     */
+    std::vector<double>& getCachedValues(PositionCache& cache, double position, bool& is_cached) const;
+
     ///
     /// Number of component waves with random phases to be generated (default = 50).
     ///
@@ -117,6 +156,17 @@ private:
     /// Phase (random) of component waves [rad].
     ///
     std::vector<double> d_phase;
+
+    ///
+    /// Cached values of cos(omega t) and sin(omega t) of component waves, and the time at which they were computed.
+    ///
+    mutable double d_time_phases_time = std::numeric_limits<double>::quiet_NaN();
+    mutable std::vector<double> d_cos_omega_t, d_sin_omega_t;
+
+    ///
+    /// Cached horizontal factors and vertical profiles of component waves.
+    ///
+    mutable PositionCache d_horizontal_factors, d_depth_profiles;
 };
 
 } // namespace IBAMR
@@ -20,12 +20,15 @@
 
 #include <ibamr/config.h>
 
+#include "ibtk/PETScFischerGuess.h"
+
 #include "tbox/Database.h"
 #include "tbox/DescribedClass.h"
 #include "tbox/Pointer.h"
 
 #include "petscksp.h"
 
+#include <memory>
 #include <vector>
 
 namespace IBAMR
@@ -50,6 +53,10 @@ namespace IBAMR
  * operator. We employ Krylov solver preconditioned by direct solver to solve the
  * body-mobility equation.
  *
+ * The input keys <tt>recycle_subspace_size</tt> and
+ * <tt>recycle_refresh_interval</tt> enable initial guesses computed from
+ * previous body velocities, as in CIBSaddlePointSolver. The retained vectors
+ * are also discarded when the fluid density or viscosity changes.
  */
 
 class KrylovFreeBodyMobilitySolver : public SAMRAI::tbox::DescribedClass
@@ -243,6 +250,10 @@ private:
     bool d_initial_guess_nonzero = true;
     bool d_enable_logging = false;
 
+    // Retained solution subspace used to compute initial guesses.
+    int d_recycle_subspace_size = 0, d_recycle_refresh_interval = 0, d_num_recycled_solves = 0;
+    std::unique_ptr<IBTK::PETScFischerGuess> d_recycled_subspace;
+
     // Pointers
     SAMRAI::tbox::Pointer<IBAMR::CIBStrategy> d_cib_strategy;
     SAMRAI::tbox::Pointer<IBAMR::CIBMobilitySolver> d_mobility_solver;
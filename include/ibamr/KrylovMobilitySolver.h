@@ -21,6 +21,7 @@
 #include <ibamr/config.h>
 
 #include "ibtk/HierarchyGhostCellInterpolation.h"
+#include "ibtk/PETScFischerGuess.h"
 
 #include "PoissonSpecifications.h"
 #include "RobinBcCoefStrategy.h"
@@ -31,6 +32,7 @@
 
 #include "petscksp.h"
 
+#include <memory>
 #include <vector>
 
 namespace IBAMR
@@ -58,6 +60,11 @@ namespace IBAMR
  * operator, \f$ L \f$ is the Stokes operator, and \f$ S \f$ is the spreading
  * operator.
  *
+ * Because the Lagrangian velocity changes little between time steps, the
+ * initial guess can be projected from previous solutions of the mobility
+ * problem by setting <tt>recycle_subspace_size</tt>; this requires
+ * <tt>initial_guess_nonzero</tt> to be FALSE. See CIBSaddlePointSolver for the
+ * related input keys.
  */
 class KrylovMobilitySolver : public SAMRAI::tbox::DescribedClass
 {
@@ -304,6 +311,10 @@ private:
     bool d_initial_guess_nonzero = false;
     bool d_enable_logging = false;
 
+    // Retained solution subspace used to compute initial guesses.
+    int d_recycle_subspace_size = 0, d_recycle_refresh_interval = 0, d_num_recycled_solves = 0;
+    std::unique_ptr<IBTK::PETScFischerGuess> d_recycled_subspace;
+
     // Velocity BCs and cached communication operators for interpolation operation.
     SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > d_hierarchy;
     std::vector<SAMRAI::solv::RobinBcCoefStrategy<NDIM>*> d_u_bc_coefs;
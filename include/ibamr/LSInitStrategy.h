@@ -22,9 +22,11 @@
 
 #include "ibamr/ibamr_enums.h"
 
+#include "Index.h"
 #include "tbox/Pointer.h"
 #include "tbox/Serializable.h"
 
+#include <map>
 #include <string>
 #include <vector>
 
@@ -45,6 +47,11 @@ class Variable;
 template <int DIM>
 class BasePatchHierarchy;
 } // namespace hier
+namespace pdat
+{
+template <int DIM, class TYPE>
+class CellVariable;
+} // namespace pdat
 namespace solv
 {
 template <int DIM>
@@ -54,6 +61,11 @@ namespace tbox
 {
 class Database;
 } // namespace tbox
+namespace xfer
+{
+template <int DIM>
+class VariableFillPattern;
+} // namespace xfer
 } // namespace SAMRAI
 
 /////////////////////////////// CLASS DEFINITION /////////////////////////////
@@ -63,6 +75,30 @@ namespace IBAMR
 /*!
  * \brief Class LSInitStrategy provides a generic interface for initializing the
  * implementation details of a particular version of the level set method.
+ *
+ * Implementations may support a narrow band mode, which is enabled by setting
+ * the input parameter <tt>narrow_band_width</tt> to a positive number of grid
+ * cells.  In this mode, only the cells that are within this many cells of the
+ * zero contour of the level set are iterated to convergence, patches that do
+ * not contain any such cells are skipped, and the magnitude of the level set
+ * is capped outside of the band.  The band is recomputed each time the level
+ * set is reinitialized.
+ *
+ * \note The narrow band mode has the following limitations:
+ * - The band is resolved at patch granularity: every cell of a patch that
+ *   intersects the band is iterated, so the savings depend on the patch sizes
+ *   chosen by the gridding algorithm.
+ * - Outside of the band, the level set only retains its sign.  Its magnitude is
+ *   capped at <tt>(narrow_band_width + 1) * sqrt(NDIM) * dx</tt>, so it must
+ *   not be used as a distance far from the interface.
+ * - The ghost cells of patches that do not intersect the band are not refilled
+ *   during the iterations and hence are not valid afterwards.
+ * - The band is determined from the initial guess provided by the interface
+ *   locating functions, so it does not follow an interface that moves during
+ *   the reinitialization.
+ * - Implementations that require global integrals of the level set (such as the
+ *   mass constraint and the volume shift of RelaxationLSMethod) do not support
+ *   this mode.
  */
 class LSInitStrategy : public SAMRAI::tbox::Serializable
 {
@@ -118,6 +154,55 @@ public:
     void putToDatabase(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> db) override;
 
 protected:
+    /*!
+     * \brief Determine the cells of each local patch that are in the narrow
+     * band around the zero contour of the level set \a phi_idx, and cap the
+     * magnitude of the level set outside of the band.
+     *
+     * \note This function does nothing unless narrow band mode is enabled.
+     */
+    void initializeNarrowBand(int phi_idx, SAMRAI::tbox::Pointer<IBTK::HierarchyMathOps> hier_math_ops, double time);
+
+    /*!
+     * \brief Return whether the specified local patch contains cells in the
+     * narrow band.  This function always returns true if narrow band mode is
+     * disabled.
+     */
+    bool patchIntersectsNarrowBand(int ln, int patch_num) const;
+
+    /*!
+     * \brief Return a fill pattern that restricts ghost cell filling to the
+     * patches that intersect the narrow band, or a null pointer if narrow band
+     * mode is disabled.
+     *
+     * \note The pattern is only valid until the next call to
+     * initializeNarrowBand() or the next regrid.
+     */
+    SAMRAI::tbox::Pointer<SAMRAI::xfer::VariableFillPattern<NDIM> > getNarrowBandFillPattern() const;
+
+    /*!
+     * \brief Cap the magnitude of the level set outside the narrow band on the
+     * patches that intersect the band.
+     */
+    void capNarrowBandData(int phi_idx, SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy) const;
+
+    /*!
+     * \brief Copy the level set data on the patches that intersect the narrow
+     * band.
+     */
+    void copyNarrowBandData(int dst_idx,
+                            int src_idx,
+                            SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy) const;
+
+    /*!
+     * \brief Compute the weighted discrete L2 norm of the difference between
+     * two level sets over the cells in the narrow band.
+     */
+    double computeNarrowBandDifferenceNorm(int phi_idx,
+                                           int phi_prev_idx,
+                                           int wgt_idx,
+                                           SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy) const;
+
     // Book-keeping.
     std::string d_object_name;
     bool d_registered_for_restart;
@@ -133,12 +218,27 @@ protected:
     int d_reinit_interval = 0;
 
     // Boundary condition object for level set.
-    SAMRAI::solv::RobinBcCoefStrategy<NDIM>* d_bc_coef;
+    SAMRAI::solv::RobinBcCoefStrategy<NDIM>* d_bc_coef = nullptr;
 
     // Neighborhood locating functions.
     std::vector<LocateInterfaceNeighborhoodFcnPtr> d_locate_interface_fcns;
     std::vector<void*> d_locate_interface_fcns_ctx;
 
+    // Narrow band data: the width of the band (in grid cells, or zero if the
+    // entire hierarchy is to be reinitialized), the indices of the cells in the
+    // band for each level and local patch number, and the maximum magnitude of
+    // the level set on each level.
+    int d_narrow_band_width = 0;
+    std::vector<std::map<int, std::vector<SAMRAI::hier::Index<NDIM> > > > d_narrow_band_idxs;
+    std::vector<double> d_narrow_band_cap;
+
+    // Scratch copy of the level set used to detect the narrow band, which is
+    // registered the first time that the band is determined, and the fill
+    // pattern that skips the patches that do not intersect the band.
+    SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > d_narrow_band_phi_var;
+    int d_narrow_band_phi_idx = -1;
+    SAMRAI::tbox::Pointer<SAMRAI::xfer::VariableFillPattern<NDIM> > d_narrow_band_fill_pattern;
+
 private:
     /*!
      * \brief Copy constructor.
@@ -99,6 +99,35 @@ public:
                                            const int num_nodes,
                                            const double periodic_correction,
                                            double* mm);
+
+    /*!
+     * \brief Evaluate the (i,j)-th entry of the matrix assembled by
+     * constructEmpiricalMobilityMatrix() without assembling the matrix. The
+     * arguments have the same meaning as for that function, and the empirical
+     * constants are not reset.
+     */
+    static double getEmpiricalMobilityMatrixEntry(const char* kernel_name,
+                                                  const double mu,
+                                                  const double rho,
+                                                  const double dt,
+                                                  const double dx,
+                                                  const double* X,
+                                                  const int i,
+                                                  const int j,
+                                                  const double l_domain);
+
+    /*!
+     * \brief Evaluate the (i,j)-th entry of the matrix assembled by
+     * constructRPYMobilityMatrix() without assembling the matrix. The
+     * arguments have the same meaning as for that function.
+     */
+    static double getRPYMobilityMatrixEntry(const char* kernel_name,
+                                            const double mu,
+                                            const double dx,
+                                            const double* X,
+                                            const int i,
+                                            const int j,
+                                            const double periodic_correction);
 }; // MobilityFunctions
 
 } // namespace IBAMR
@@ -20,11 +20,43 @@
 
 #include <ibamr/config.h>
 
+#include <string>
+
+namespace SAMRAI
+{
+namespace hier
+{
+template <int DIM>
+class Box;
+} // namespace hier
+namespace pdat
+{
+template <int DIM, class TYPE>
+class ArrayData;
+} // namespace pdat
+} // namespace SAMRAI
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
 namespace IBAMR
 {
 /*!
  * \brief Class RNG organizes functions that provide random-number generator
  * functionality.
+ *
+ * Two kinds of generators are provided:
+ *
+ * - srandgen(), genrand(), and genrandn() draw values from a single serial
+ *   MT19937 stream on each process.  parallel_seed() seeds these streams with
+ *   distinct values on each process.
+ *
+ * - The array version of genrandn() uses the counter-based Philox4x32-10
+ *   generator (Salmon et al., SC'11).  Each value is a function only of the
+ *   counter-based seed, a stream key, the time step number, a substream
+ *   number, the level number, the index, and the depth, so that the generated
+ *   values do not depend on the patch layout, the number of processes, or the
+ *   order in which patches are visited, and runs may be reproduced after
+ *   regridding or restarting with a different number of processes.
  */
 class RNG
 {
@@ -35,8 +67,49 @@ public:
 
     static void genrandn(double* result);
 
+    /*!
+     * \brief Seed the serial generators of all processes with distinct seeds
+     * derived from \a global_seed, and set the seed of the counter-based
+     * generator to \a global_seed.  If \a global_seed is zero, a seed is
+     * obtained from the clock on rank 0.
+     *
+     * \note This function is collective.
+     */
     static void parallel_seed(int global_seed);
 
+    /*!
+     * \brief Set the seed of the counter-based generator.  The seed must be the
+     * same on all processes.
+     */
+    static void counter_seed(unsigned int seed);
+
+    /*!
+     * \brief Return the key of the counter-based stream that belongs to the
+     * object with the given name.  The key depends on the counter-based seed and
+     * (through a portable hash) on the name, so that objects with different
+     * names draw independent values.
+     */
+    static unsigned int counter_stream_key(const std::string& object_name);
+
+    /*!
+     * \brief Fill the array data over the specified box with independent
+     * standard normal random variates generated by the counter-based generator.
+     *
+     * The value at index i and depth d is determined by (stream_key, step_num,
+     * substream_num, level_num, i, d).  Distinct substream numbers should be
+     * used for independent fields that are generated by the same object within
+     * the same time step (e.g., for different samples or data centerings).
+     *
+     * \note The substream number must be less than 2^16, and the level number
+     * and half of the depth of the array data must be less than 2^8.
+     */
+    static void genrandn(SAMRAI::pdat::ArrayData<NDIM, double>& data,
+                         const SAMRAI::hier::Box<NDIM>& box,
+                         unsigned int stream_key,
+                         unsigned int step_num,
+                         unsigned int substream_num,
+                         int level_num);
+
 private:
     RNG() = delete;
     RNG(RNG&) = delete;
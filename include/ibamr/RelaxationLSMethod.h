@@ -66,6 +66,13 @@ namespace IBAMR
  * constraint assumes that \f$Q^0\f$ is already close to a signed distance function and
  * is hence, by default, disabled at initial time.
  *
+ * \note The narrow band mode of LSInitStrategy (<tt>narrow_band_width</tt> > 0)
+ * cannot be combined with the mass constraint or the volume shift, because both
+ * require integrals of the level set over the entire domain.  An unrecoverable
+ * error is raised if they are both requested, either when the input database is
+ * read or, if they are enabled later by setApplyMassConstraint() or
+ * setApplyVolumeShift(), when the level set is reinitialized.
+ *
  *
  * References
  * Min, C., <A HREF="http://www.sciencedirect.com/science/article/pii/S0021999109007189">
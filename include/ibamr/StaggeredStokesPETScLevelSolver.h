@@ -35,6 +35,7 @@
 
 #include "petscvec.h"
 
+#include <cstddef>
 #include <set>
 #include <string>
 #include <vector>
@@ -135,6 +136,18 @@ protected:
                       SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x,
                       SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& b) override;
 
+    /*!
+     * \brief Compute a hash of the problem coefficients and boundary condition
+     * objects that determine the operator.
+     */
+    std::size_t computeOperatorFingerprint() override;
+
+    /*!
+     * \brief Rewrite the values of the operator matrix for the current problem
+     * coefficients.
+     */
+    bool refreshOperatorValues() override;
+
 private:
     /*!
      * \brief Default constructor.
@@ -20,6 +20,8 @@
 
 #include <ibamr/config.h>
 
+#include "ibtk/PETScMatUtilities.h"
+
 #include "IntVector.h"
 #include "PoissonSpecifications.h"
 #include "tbox/Pointer.h"
@@ -78,6 +80,27 @@ public:
                                                int p_dof_index_idx,
                                                SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level);
 
+    /*!
+     * \brief Rewrite the values of a PETSc Mat object constructed by
+     * constructPatchLevelMACStokesOp() without modifying its nonzero
+     * structure.
+     *
+     * The patch level and the DOF indices must be the same as those used to
+     * construct \a mat.
+     *
+     * \see IBTK::PETScMatUtilities::MatValuesPlan
+     */
+    static void
+    refreshPatchLevelMACStokesOpValues(Mat& mat,
+                                       IBTK::PETScMatUtilities::MatValuesPlan& plan,
+                                       const SAMRAI::solv::PoissonSpecifications& u_problem_coefs,
+                                       const std::vector<SAMRAI::solv::RobinBcCoefStrategy<NDIM>*>& u_bc_coefs,
+                                       double data_time,
+                                       const std::vector<int>& num_dofs_per_proc,
+                                       int u_dof_index_idx,
+                                       int p_dof_index_idx,
+                                       SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level);
+
     /*!
      * \brief Partition the patch level into subdomains suitable to be used for
      * additive Schwarz method.
@@ -151,6 +174,20 @@ private:
      * \return A reference to this object.
      */
     StaggeredStokesPETScMatUtilities& operator=(const StaggeredStokesPETScMatUtilities& that) = delete;
+
+    /*!
+     * \brief Set the values of the locally owned rows of the MAC Stokes
+     * operator.
+     */
+    static void setPatchLevelMACStokesOpValues(Mat& mat,
+                                               IBTK::PETScMatUtilities::MatValuesPlan* plan,
+                                               const SAMRAI::solv::PoissonSpecifications& u_problem_coefs,
+                                               const std::vector<SAMRAI::solv::RobinBcCoefStrategy<NDIM>*>& u_bc_coefs,
+                                               double data_time,
+                                               const std::vector<int>& num_dofs_per_proc,
+                                               int u_dof_index_idx,
+                                               int p_dof_index_idx,
+                                               SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level);
 };
 } // namespace IBAMR
 
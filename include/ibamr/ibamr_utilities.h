@@ -20,6 +20,8 @@
 
 #include <ibamr/config.h>
 
+#include "ibtk/PerformanceTrace.h"
+
 #include "tbox/PIO.h"
 
 /////////////////////////////// MACRO DEFINITIONS ////////////////////////////
@@ -71,11 +73,13 @@ static const bool ENABLE_TIMERS = true;
     do                                                                                                                 \
     {                                                                                                                  \
         if (IBAMR::ENABLE_TIMERS) timer->start();                                                                      \
+        if (IBTK::PerformanceTrace::isEnabled()) IBTK::PerformanceTrace::beginPhase(timer->getName());                 \
     } while (0);
 
 #define IBAMR_TIMER_STOP(timer)                                                                                        \
     do                                                                                                                 \
     {                                                                                                                  \
+        if (IBTK::PerformanceTrace::isEnabled()) IBTK::PerformanceTrace::endPhase(timer->getName());                   \
         if (IBAMR::ENABLE_TIMERS) timer->stop();                                                                       \
     } while (0);
 
@@ -1514,6 +1514,89 @@ CIBMethod::constructMobilityMatrix(const std::string& /*mat_name*/,
     return;
 } // constructMobilityMatrix
 
+std::function<double(int, int)>
+CIBMethod::getMobilityMatrixEntryFunction(const std::string& /*mat_name*/,
+                                          MobilityMatrixType mat_type,
+                                          const std::vector<unsigned>& prototype_struct_ids,
+                                          const double* grid_dx,
+                                          const double* domain_extents,
+                                          const bool initial_time,
+                                          double rho,
+                                          double mu,
+                                          const std::pair<double, double>& scale,
+                                          double f_periodic_corr,
+                                          const int managing_rank)
+{
+    const double dt = d_new_time - d_current_time;
+    const int struct_ln = getStructuresLevelNumber();
+    const std::string ib_kernel = d_l_data_manager->getDefaultInterpKernelFunction();
+    const int rank = IBTK_MPI::getRank();
+
+    // Get the size of matrix.
+    unsigned num_nodes = 0;
+    for (const auto& prototype_struct_id : prototype_struct_ids)
+    {
+        num_nodes += getNumberOfNodes(prototype_struct_id);
+    }
+    const int size = num_nodes * NDIM;
+
+    // Gather the position and the regulator data on the managing rank, as in
+    // constructMobilityMatrix().
+    std::vector<double> X, W;
+    if (rank == managing_rank)
+    {
+        X.resize(size);
+        W.resize(size);
+    }
+    Vec X_vec;
+    if (initial_time)
+    {
+        X_vec = d_l_data_manager->getLData("X0_unshifted", struct_ln)->getVec();
+    }
+    else
+    {
+        std::vector<Pointer<LData> >* X_half_data;
+        bool* X_half_needs_ghost_fill;
+        getPositionData(&X_half_data, &X_half_needs_ghost_fill, d_half_time);
+        X_vec = (*X_half_data)[struct_ln]->getVec();
+    }
+    copyVecToArray(X_vec, X.data(), prototype_struct_ids, /*depth*/ NDIM, managing_rank);
+    Vec W_vec = d_l_data_manager->getLData("regulator", struct_ln)->getVec();
+    copyVecToArray(W_vec, W.data(), prototype_struct_ids, /*depth*/ NDIM, managing_rank);
+    if (rank != managing_rank) return {};
+
+    const double dx = grid_dx[0];
+    const double l_domain = domain_extents[0];
+    std::function<double(int, int)> mobility_entry;
+    if (mat_type == RPY)
+    {
+        mobility_entry = [ib_kernel, mu, dx, X, f_periodic_corr](int i, int j) {
+            return MobilityFunctions::getRPYMobilityMatrixEntry(
+                ib_kernel.c_str(), mu, dx, X.data(), i, j, f_periodic_corr);
+        };
+    }
+    else if (mat_type == EMPIRICAL)
+    {
+        mobility_entry = [ib_kernel, mu, rho, dt, dx, X, l_domain](int i, int j) {
+            return MobilityFunctions::getEmpiricalMobilityMatrixEntry(
+                ib_kernel.c_str(), mu, rho, dt, dx, X.data(), i, j, l_domain);
+        };
+    }
+    else
+    {
+        TBOX_ERROR("CIBMethod::getMobilityMatrixEntryFunction(): Invalid type of a "
+                   "mobility matrix."
+                   << std::endl);
+    }
+
+    // Regularize the mobility matrix.
+    return [mobility_entry, scale, W](int i, int j) {
+        double entry = mobility_entry(i, j) * scale.first;
+        if (i == j) entry += scale.second * W[i];
+        return entry;
+    };
+} // getMobilityMatrixEntryFunction
+
 void
 CIBMethod::constructGeometricMatrix(const std::string& /*mat_name*/,
                                     Mat& geometric_mat,
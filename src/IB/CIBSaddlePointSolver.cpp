@@ -34,6 +34,7 @@
 #include "ibtk/NewtonKrylovSolver.h"
 #include "ibtk/PETScSAMRAIVectorReal.h"
 #include "ibtk/PoissonSolver.h"
+#include "ibtk/PoissonUtilities.h"
 #include "ibtk/SCPoissonSolverManager.h"
 #include "ibtk/ibtk_utilities.h"
 
@@ -349,6 +350,11 @@ CIBSaddlePointSolver::setVelocityPoissonSpecifications(const PoissonSpecificatio
 {
     d_A->setVelocityPoissonSpecifications(u_problem_coefs);
     d_LInv->setVelocityPoissonSpecifications(u_problem_coefs);
+    if (d_recycled_subspace)
+    {
+        d_recycled_subspace->setOperatorFingerprint(
+            PoissonUtilities::computeOperatorFingerprint(u_problem_coefs, {}, nullptr));
+    }
     d_velocity_solver->setPoissonSpecifications(u_problem_coefs);
     d_mob_solver->setVelocityPoissonSpecifications(u_problem_coefs);
 
@@ -445,21 +451,40 @@ CIBSaddlePointSolver::solveSystem(Vec x, Vec b)
     d_A->modifyRhsForBcs(d_petsc_b);
     d_A->setHomogeneousBc(true);
 
+    // Compute an initial guess from the retained solution subspace unless the
+    // caller has supplied one.
+    const bool use_recycled_guess =
+        d_recycled_subspace && !d_initial_guess_nonzero && d_recycled_subspace->getNumberOfVectors() > 0;
+    if (use_recycled_guess)
+    {
+        d_recycled_subspace->guess(d_petsc_x, d_petsc_b);
+        KSPSetInitialGuessNonzero(d_petsc_ksp, PETSC_TRUE);
+    }
+
     // Solve the system.
     KSPSolve(d_petsc_ksp, d_petsc_b, d_petsc_x);
     KSPGetIterationNumber(d_petsc_ksp, &d_current_iterations);
     KSPGetResidualNorm(d_petsc_ksp, &d_current_residual_norm);
 
-    // Impose Solution Bcs.
-    d_A->setHomogeneousBc(false);
-    d_A->imposeSolBcs(d_petsc_x);
-
     // Determine the convergence reason.
     KSPConvergedReason reason;
     KSPGetConvergedReason(d_petsc_ksp, &reason);
     const bool converged = (static_cast<int>(reason) > 0);
     if (d_enable_logging) reportKSPConvergedReason(reason, plog);
 
+    // Update the retained solution subspace.
+    if (d_recycled_subspace)
+    {
+        if (use_recycled_guess) KSPSetInitialGuessNonzero(d_petsc_ksp, PETSC_FALSE);
+        if (d_recycle_refresh_interval > 0 && ++d_num_recycled_solves % d_recycle_refresh_interval == 0)
+            d_recycled_subspace->clear();
+        if (converged) d_recycled_subspace->submit(d_petsc_x, d_petsc_b);
+    }
+
+    // Impose Solution Bcs.
+    d_A->setHomogeneousBc(false);
+    d_A->imposeSolBcs(d_petsc_x);
+
     // Invalidate d_petsc_x Vec.
     d_petsc_x = nullptr;
 
@@ -498,6 +523,9 @@ CIBSaddlePointSolver::initializeSolverState(Vec x, Vec b)
     const int coarsest_ln = vx0->getCoarsestLevelNumber();
     const int finest_ln = vx0->getFinestLevelNumber();
 
+    // Discard the retained solution subspace if the grid has changed.
+    if (d_recycled_subspace) d_recycled_subspace->setPatchHierarchy(d_hierarchy, coarsest_ln, finest_ln);
+
     // Initialize various operators and solvers.
     d_A->initializeOperatorState(*vx0, *vb0);
     initializeStokesSolver(*vx0, *vb0);
@@ -595,6 +623,12 @@ CIBSaddlePointSolver::getFromInput(Pointer<Database> input_db)
     if (input_db->keyExists("regularize_mob_factor")) d_reg_mob_factor = input_db->getDouble("regularize_mob_factor");
     if (input_db->keyExists("normalize_spread_force"))
         d_normalize_spread_force = input_db->getBool("normalize_spread_force");
+    if (input_db->keyExists("recycle_subspace_size"))
+        d_recycle_subspace_size = input_db->getInteger("recycle_subspace_size");
+    if (input_db->keyExists("recycle_refresh_interval"))
+        d_recycle_refresh_interval = input_db->getInteger("recycle_refresh_interval");
+    if (d_recycle_subspace_size > 0)
+        d_recycled_subspace.reset(new IBTK::PETScFischerGuess(d_recycle_subspace_size));
 
     return;
 } // getFromInput
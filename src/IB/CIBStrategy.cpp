@@ -826,6 +826,22 @@ CIBStrategy::constructMobilityMatrix(const std::string& /*mat_name*/,
     return;
 } // constructMobilityMatrix
 
+std::function<double(int, int)>
+CIBStrategy::getMobilityMatrixEntryFunction(const std::string& /*mat_name*/,
+                                            MobilityMatrixType /*mat_type*/,
+                                            const std::vector<unsigned>& /*prototype_struct_ids*/,
+                                            const double* /*grid_dx*/,
+                                            const double* /*domain_extents*/,
+                                            const bool /*initial_time*/,
+                                            double /*rho*/,
+                                            double /*mu*/,
+                                            const std::pair<double, double>& /*scale*/,
+                                            double /*f_periodic_corr*/,
+                                            const int /*managing_rank*/)
+{
+    return {};
+} // getMobilityMatrixEntryFunction
+
 void
 CIBStrategy::constructGeometricMatrix(const std::string& /*mat_name*/,
                                       Mat& /*geometric_mat*/,
@@ -50,6 +50,7 @@
 #include "CellIndex.h"
 #include "CellIterator.h"
 #include "ComponentSelector.h"
+#include "GriddingAlgorithm.h"
 #include "HierarchyDataOpsManager.h"
 #include "HierarchyDataOpsReal.h"
 #include "Patch.h"
@@ -77,8 +78,11 @@ IBTK_DISABLE_EXTRA_WARNINGS
 IBTK_ENABLE_EXTRA_WARNINGS
 
 #include <algorithm>
+#include <array>
+#include <iterator>
 #include <limits>
 #include <utility>
+#include <vector>
 
 namespace SAMRAI
 {
@@ -670,6 +674,7 @@ ConstraintIBMethod::registerConstraintIBKinematics(const std::vector<Pointer<Con
         const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
         d_tagged_pt_lag_idx[struct_no] = struct_param.getTaggedPtIdx();
     }
+    d_local_node_structures.clear();
     return;
 
 } // registerConstraintIBKinematics
@@ -769,6 +774,18 @@ ConstraintIBMethod::postprocessIntegrateData(double current_time, double new_tim
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void
+ConstraintIBMethod::endDataRedistribution(Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                          Pointer<GriddingAlgorithm<NDIM> > gridding_alg)
+{
+    IBMethod::endDataRedistribution(hierarchy, gridding_alg);
+
+    // The local nodes have been redistributed, so the cached structure
+    // membership of the local nodes is no longer valid.
+    d_local_node_structures.clear();
+    return;
+} // endDataRedistribution
+
 void
 ConstraintIBMethod::getFromInput(Pointer<Database> input_db, const bool from_restart)
 {
@@ -864,8 +881,6 @@ ConstraintIBMethod::getFromRestart()
 void
 ConstraintIBMethod::setInitialLagrangianVelocity()
 {
-    using StructureParameters = ConstraintIBKinematics::StructureParameters;
-
     const bool from_restart = RestartManager::getManager()->isFromRestart();
     if (!from_restart) calculateCOMandMOIOfStructures();
 
@@ -877,12 +892,13 @@ ConstraintIBMethod::setInitialLagrangianVelocity()
                                                           d_tagged_pt_position[struct_no]);
         d_ib_kinematics[struct_no]->setShape(d_FuRMoRP_current_time,
                                              d_incremented_angle_from_reference_axis[struct_no]);
+    }
 
-        if (!from_restart)
+    if (!from_restart)
+    {
+        calculateMomentumOfKinematicsVelocity();
+        for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
         {
-            const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
-            if (struct_param.getStructureIsSelfTranslating()) calculateMomentumOfKinematicsVelocity(struct_no);
-
             d_vel_com_def_current[struct_no] = d_vel_com_def_new[struct_no];
             d_omega_com_def_current[struct_no] = d_omega_com_def_new[struct_no];
         }
@@ -890,6 +906,52 @@ ConstraintIBMethod::setInitialLagrangianVelocity()
     return;
 } // setInitialLagrangianVelocity
 
+const std::vector<std::pair<int, int> >&
+ConstraintIBMethod::getLocalNodeStructures(const int ln)
+{
+    // The structure membership of the local nodes only changes when the
+    // Lagrangian data are redistributed.
+    const auto cached_it = d_local_node_structures.find(ln);
+    if (cached_it != d_local_node_structures.end())
+    {
+#if !defined(NDEBUG)
+        TBOX_ASSERT(cached_it->second.size() == d_l_data_manager->getLMesh(ln)->getLocalNodes().size());
+#endif
+        return cached_it->second;
+    }
+
+    // Collect the Lagrangian index ranges of the structures on this level,
+    // sorted so that the structure that contains a node can be found by a
+    // binary search.
+    std::vector<std::array<int, 3> > struct_ranges;
+    for (const int struct_id : d_l_data_manager->getLagrangianStructureIDs(ln))
+    {
+        const std::pair<int, int> lag_idx_range = d_l_data_manager->getLagrangianStructureIndexRange(struct_id, ln);
+        const auto it =
+            std::find_if(d_ib_kinematics.begin(), d_ib_kinematics.end(), find_struct_handle(lag_idx_range));
+        if (it == d_ib_kinematics.end()) continue;
+        const int location_struct_handle = static_cast<int>(std::distance(d_ib_kinematics.begin(), it));
+        struct_ranges.push_back({ { lag_idx_range.first, lag_idx_range.second, location_struct_handle } });
+    }
+    std::sort(struct_ranges.begin(), struct_ranges.end());
+
+    const std::vector<LNode*>& local_nodes = d_l_data_manager->getLMesh(ln)->getLocalNodes();
+    std::vector<std::pair<int, int> >& node_structures = d_local_node_structures[ln];
+    node_structures.assign(local_nodes.size(), std::make_pair(-1, -1));
+    for (unsigned int k = 0; k < local_nodes.size(); ++k)
+    {
+        const int lag_idx = local_nodes[k]->getLagrangianIndex();
+        auto it = std::upper_bound(
+            struct_ranges.begin(), struct_ranges.end(), lag_idx, [](const int idx, const std::array<int, 3>& range) {
+                return idx < range[0];
+            });
+        if (it == struct_ranges.begin()) continue;
+        --it;
+        if (lag_idx < (*it)[1]) node_structures[k] = std::make_pair((*it)[2], (*it)[0]);
+    }
+    return node_structures;
+} // getLocalNodeStructures
+
 void
 ConstraintIBMethod::calculateCOMandMOIOfStructures()
 {
@@ -897,17 +959,12 @@ ConstraintIBMethod::calculateCOMandMOIOfStructures()
     const int coarsest_ln = 0;
     const int finest_ln = d_hierarchy->getFinestLevelNumber();
 
-    // Zero out the COM vector.
-    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
-    {
-        for (int d = 0; d < 3; ++d)
-        {
-            d_center_of_mass_current[struct_no][d] = 0.0;
-            d_center_of_mass_new[struct_no][d] = 0.0;
-        }
-    }
-    std::vector<std::vector<double> > tagged_position(d_no_structures, std::vector<double>(3, 0.0));
-
+    // Compute the local contributions to the centers of mass and the tagged
+    // point positions of all structures in a single pass over the local nodes.
+    // For each structure, the values are stored as (X_com_current, X_com_new,
+    // X_tagged) so that they can be summed by a single reduction.
+    static const int NUM_COM_VALS = 9;
+    std::vector<double> com_vals(NUM_COM_VALS * d_no_structures, 0.0);
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
@@ -929,78 +986,52 @@ ConstraintIBMethod::calculateCOMandMOIOfStructures()
         const boost::multi_array_ref<double, 2>& X_data_new = *ptr_x_lag_data_new->getLocalFormVecArray();
         const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
         const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
+        const std::vector<std::pair<int, int> >& node_structures = getLocalNodeStructures(ln);
 
-        // Get structures on this level.
-        const std::vector<int> structIDs = d_l_data_manager->getLagrangianStructureIDs(ln);
-        const size_t structs_on_this_ln = structIDs.size();
-
-        for (size_t struct_no = 0; struct_no < structs_on_this_ln; ++struct_no)
+        for (unsigned int k = 0; k < local_nodes.size(); ++k)
         {
-            std::pair<int, int> lag_idx_range =
-                d_l_data_manager->getLagrangianStructureIndexRange(structIDs[struct_no], ln);
-            Pointer<ConstraintIBKinematics> ptr_ib_kinematics =
-                *std::find_if(d_ib_kinematics.begin(), d_ib_kinematics.end(), find_struct_handle(lag_idx_range));
-            const int location_struct_handle =
-                find_struct_handle_position(d_ib_kinematics.begin(), d_ib_kinematics.end(), ptr_ib_kinematics);
-
-            double X_com_current[NDIM] = { 0.0 }, X_com_new[NDIM] = { 0.0 };
-            for (const auto& node_idx : local_nodes)
+            const int location_struct_handle = node_structures[k].first;
+            if (location_struct_handle < 0) continue;
+
+            const int lag_idx = local_nodes[k]->getLagrangianIndex();
+            const int local_idx = local_nodes[k]->getLocalPETScIndex();
+            const double* const X_current = &X_data_current[local_idx][0];
+            const double* const X_new = &X_data_new[local_idx][0];
+            double* const vals = &com_vals[NUM_COM_VALS * location_struct_handle];
+            for (unsigned int d = 0; d < NDIM; ++d)
             {
-                const int lag_idx = node_idx->getLagrangianIndex();
-                if (lag_idx_range.first <= lag_idx && lag_idx < lag_idx_range.second)
-                {
-                    const int local_idx = node_idx->getLocalPETScIndex();
-                    const double* const X_current = &X_data_current[local_idx][0];
-                    const double* const X_new = &X_data_new[local_idx][0];
-                    for (unsigned int d = 0; d < NDIM; ++d)
-                    {
-                        X_com_current[d] += X_current[d];
-                        X_com_new[d] += X_new[d];
-                    }
-                    if (lag_idx == d_tagged_pt_lag_idx[location_struct_handle])
-                    {
-                        for (unsigned int d = 0; d < NDIM; ++d) tagged_position[location_struct_handle][d] = X_new[d];
-                    }
-                }
+                vals[d] += X_current[d];
+                vals[3 + d] += X_new[d];
             }
-            for (int d = 0; d < NDIM; ++d)
+            if (lag_idx == d_tagged_pt_lag_idx[location_struct_handle])
             {
-                d_center_of_mass_current[location_struct_handle][d] += X_com_current[d];
-                d_center_of_mass_new[location_struct_handle][d] += X_com_new[d];
+                for (unsigned int d = 0; d < NDIM; ++d) vals[6 + d] = X_new[d];
             }
         }
         ptr_x_lag_data_current->restoreArrays();
         ptr_x_lag_data_new->restoreArrays();
     }
+    IBTK_MPI::sumReduction(com_vals.data(), static_cast<int>(com_vals.size()));
 
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
         const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
         const int total_nodes = struct_param.getTotalNodes();
-
-        IBTK_MPI::sumReduction(d_center_of_mass_current[struct_no].data(), d_center_of_mass_current[struct_no].size());
-        IBTK_MPI::sumReduction(d_center_of_mass_new[struct_no].data(), d_center_of_mass_new[struct_no].size());
-
-        for (int i = 0; i < 3; ++i)
+        const double* const vals = &com_vals[NUM_COM_VALS * struct_no];
+        for (int d = 0; d < 3; ++d)
         {
-            d_center_of_mass_current[struct_no][i] /= total_nodes;
-            d_center_of_mass_new[struct_no][i] /= total_nodes;
+            d_center_of_mass_current[struct_no][d] = vals[d] / total_nodes;
+            d_center_of_mass_new[struct_no][d] = vals[3 + d] / total_nodes;
         }
+        d_tagged_pt_position[struct_no] = std::vector<double>(vals + 6, vals + 9);
     }
 
-    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
-    {
-        IBTK_MPI::sumReduction(&tagged_position[struct_no][0], 3);
-        d_tagged_pt_position[struct_no] = tagged_position[struct_no];
-    }
-
-    // Zero out the moment of inertia tensor.
-    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
-    {
-        d_moment_of_inertia_current[struct_no].setZero();
-        d_moment_of_inertia_new[struct_no].setZero();
-    }
-
+    // Compute the local contributions to the moments of inertia of all
+    // self-rotating structures in a single pass over the local nodes.  For
+    // each structure, the values are stored as (I_current, I_new) so that they
+    // can be summed by a single reduction.
+    static const int NUM_MOI_VALS = 18;
+    std::vector<double> moi_vals(NUM_MOI_VALS * d_no_structures, 0.0);
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
@@ -1021,85 +1052,65 @@ ConstraintIBMethod::calculateCOMandMOIOfStructures()
         const boost::multi_array_ref<double, 2>& X_data_new = *ptr_x_lag_data_new->getLocalFormVecArray();
         const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
         const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
+        const std::vector<std::pair<int, int> >& node_structures = getLocalNodeStructures(ln);
 
-        // Get structures on this level.
-        const std::vector<int> structIDs = d_l_data_manager->getLagrangianStructureIDs(ln);
-        const size_t structs_on_this_ln = structIDs.size();
-
-        for (size_t struct_no = 0; struct_no < structs_on_this_ln; ++struct_no)
+        for (unsigned int k = 0; k < local_nodes.size(); ++k)
         {
-            std::pair<int, int> lag_idx_range =
-                d_l_data_manager->getLagrangianStructureIndexRange(structIDs[struct_no], ln);
-            Pointer<ConstraintIBKinematics> ptr_ib_kinematics =
-                *std::find_if(d_ib_kinematics.begin(), d_ib_kinematics.end(), find_struct_handle(lag_idx_range));
-            const StructureParameters& struct_param = ptr_ib_kinematics->getStructureParameters();
+            const int location_struct_handle = node_structures[k].first;
+            if (location_struct_handle < 0) continue;
+            const StructureParameters& struct_param =
+                d_ib_kinematics[location_struct_handle]->getStructureParameters();
             if (!struct_param.getStructureIsSelfRotating()) continue;
 
-            const int location_struct_handle =
-                find_struct_handle_position(d_ib_kinematics.begin(), d_ib_kinematics.end(), ptr_ib_kinematics);
             const std::vector<double>& X_com_current = d_center_of_mass_current[location_struct_handle];
             const std::vector<double>& X_com_new = d_center_of_mass_new[location_struct_handle];
+            Eigen::Map<Eigen::Matrix3d> Inertia_current(&moi_vals[NUM_MOI_VALS * location_struct_handle]);
+            Eigen::Map<Eigen::Matrix3d> Inertia_new(&moi_vals[NUM_MOI_VALS * location_struct_handle + 9]);
 
-            Eigen::Matrix3d Inertia_current(3, 3), Inertia_new(3, 3);
-            Inertia_current.setZero();
-            Inertia_new.setZero();
-
-            for (const auto& node_idx : local_nodes)
-            {
-                const int lag_idx = node_idx->getLagrangianIndex();
-                if (lag_idx_range.first <= lag_idx && lag_idx < lag_idx_range.second)
-                {
-                    const int local_idx = node_idx->getLocalPETScIndex();
-                    const double* const X_current = &X_data_current[local_idx][0];
-                    const double* const X_new = &X_data_new[local_idx][0];
+            const int local_idx = local_nodes[k]->getLocalPETScIndex();
+            const double* const X_current = &X_data_current[local_idx][0];
+            const double* const X_new = &X_data_new[local_idx][0];
 #if (NDIM == 2)
-                    Inertia_current(0, 0) += std::pow(X_current[1] - X_com_current[1], 2);
-                    Inertia_current(0, 1) += -(X_current[0] - X_com_current[0]) * (X_current[1] - X_com_current[1]);
-                    Inertia_current(1, 1) += std::pow(X_current[0] - X_com_current[0], 2);
-                    Inertia_current(2, 2) +=
-                        std::pow(X_current[0] - X_com_current[0], 2) + std::pow(X_current[1] - X_com_current[1], 2);
-
-                    Inertia_new(0, 0) += std::pow(X_new[1] - X_com_new[1], 2);
-                    Inertia_new(0, 1) += -(X_new[0] - X_com_new[0]) * (X_new[1] - X_com_new[1]);
-                    Inertia_new(1, 1) += std::pow(X_new[0] - X_com_new[0], 2);
-                    Inertia_new(2, 2) += std::pow(X_new[0] - X_com_new[0], 2) + std::pow(X_new[1] - X_com_new[1], 2);
+            Inertia_current(0, 0) += std::pow(X_current[1] - X_com_current[1], 2);
+            Inertia_current(0, 1) += -(X_current[0] - X_com_current[0]) * (X_current[1] - X_com_current[1]);
+            Inertia_current(1, 1) += std::pow(X_current[0] - X_com_current[0], 2);
+            Inertia_current(2, 2) +=
+                std::pow(X_current[0] - X_com_current[0], 2) + std::pow(X_current[1] - X_com_current[1], 2);
+
+            Inertia_new(0, 0) += std::pow(X_new[1] - X_com_new[1], 2);
+            Inertia_new(0, 1) += -(X_new[0] - X_com_new[0]) * (X_new[1] - X_com_new[1]);
+            Inertia_new(1, 1) += std::pow(X_new[0] - X_com_new[0], 2);
+            Inertia_new(2, 2) += std::pow(X_new[0] - X_com_new[0], 2) + std::pow(X_new[1] - X_com_new[1], 2);
 #endif
 
 #if (NDIM == 3)
-                    Inertia_current(0, 0) +=
-                        std::pow(X_current[1] - X_com_current[1], 2) + std::pow(X_current[2] - X_com_current[2], 2);
-                    Inertia_current(0, 1) += -(X_current[0] - X_com_current[0]) * (X_current[1] - X_com_current[1]);
-                    Inertia_current(0, 2) += -(X_current[0] - X_com_current[0]) * (X_current[2] - X_com_current[2]);
-                    Inertia_current(1, 1) +=
-                        std::pow(X_current[0] - X_com_current[0], 2) + std::pow(X_current[2] - X_com_current[2], 2);
-                    Inertia_current(1, 2) += -(X_current[1] - X_com_current[1]) * (X_current[2] - X_com_current[2]);
-                    Inertia_current(2, 2) +=
-                        std::pow(X_current[0] - X_com_current[0], 2) + std::pow(X_current[1] - X_com_current[1], 2);
-
-                    Inertia_new(0, 0) += std::pow(X_new[1] - X_com_new[1], 2) + std::pow(X_new[2] - X_com_new[2], 2);
-                    Inertia_new(0, 1) += -(X_new[0] - X_com_new[0]) * (X_new[1] - X_com_new[1]);
-                    Inertia_new(0, 2) += -(X_new[0] - X_com_new[0]) * (X_new[2] - X_com_new[2]);
-                    Inertia_new(1, 1) += std::pow(X_new[0] - X_com_new[0], 2) + std::pow(X_new[2] - X_com_new[2], 2);
-                    Inertia_new(1, 2) += -(X_new[1] - X_com_new[1]) * (X_new[2] - X_com_new[2]);
-                    Inertia_new(2, 2) += std::pow(X_new[0] - X_com_new[0], 2) + std::pow(X_new[1] - X_com_new[1], 2);
+            Inertia_current(0, 0) +=
+                std::pow(X_current[1] - X_com_current[1], 2) + std::pow(X_current[2] - X_com_current[2], 2);
+            Inertia_current(0, 1) += -(X_current[0] - X_com_current[0]) * (X_current[1] - X_com_current[1]);
+            Inertia_current(0, 2) += -(X_current[0] - X_com_current[0]) * (X_current[2] - X_com_current[2]);
+            Inertia_current(1, 1) +=
+                std::pow(X_current[0] - X_com_current[0], 2) + std::pow(X_current[2] - X_com_current[2], 2);
+            Inertia_current(1, 2) += -(X_current[1] - X_com_current[1]) * (X_current[2] - X_com_current[2]);
+            Inertia_current(2, 2) +=
+                std::pow(X_current[0] - X_com_current[0], 2) + std::pow(X_current[1] - X_com_current[1], 2);
+
+            Inertia_new(0, 0) += std::pow(X_new[1] - X_com_new[1], 2) + std::pow(X_new[2] - X_com_new[2], 2);
+            Inertia_new(0, 1) += -(X_new[0] - X_com_new[0]) * (X_new[1] - X_com_new[1]);
+            Inertia_new(0, 2) += -(X_new[0] - X_com_new[0]) * (X_new[2] - X_com_new[2]);
+            Inertia_new(1, 1) += std::pow(X_new[0] - X_com_new[0], 2) + std::pow(X_new[2] - X_com_new[2], 2);
+            Inertia_new(1, 2) += -(X_new[1] - X_com_new[1]) * (X_new[2] - X_com_new[2]);
+            Inertia_new(2, 2) += std::pow(X_new[0] - X_com_new[0], 2) + std::pow(X_new[1] - X_com_new[1], 2);
 #endif
-                }
-            }
-            d_moment_of_inertia_current[location_struct_handle] += Inertia_current;
-            d_moment_of_inertia_new[location_struct_handle] += Inertia_new;
-        } // all structs
+        } // all nodes on a level
         ptr_x_lag_data_current->restoreArrays();
         ptr_x_lag_data_new->restoreArrays();
     } // all levels
+    IBTK_MPI::sumReduction(moi_vals.data(), static_cast<int>(moi_vals.size()));
 
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
-        const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
-        if (struct_param.getStructureIsSelfRotating())
-        {
-            IBTK_MPI::sumReduction(&d_moment_of_inertia_current[struct_no](0, 0), 9);
-            IBTK_MPI::sumReduction(&d_moment_of_inertia_new[struct_no](0, 0), 9);
-        }
+        d_moment_of_inertia_current[struct_no] = Eigen::Map<Eigen::Matrix3d>(&moi_vals[NUM_MOI_VALS * struct_no]);
+        d_moment_of_inertia_new[struct_no] = Eigen::Map<Eigen::Matrix3d>(&moi_vals[NUM_MOI_VALS * struct_no + 9]);
     }
 
     // Fill-in symmetric part of inertia tensor.
@@ -1149,13 +1160,10 @@ ConstraintIBMethod::calculateCOMandMOIOfStructures()
 void
 ConstraintIBMethod::calculateKinematicsVelocity()
 {
-    using StructureParameters = ConstraintIBKinematics::StructureParameters;
     const double dt = d_FuRMoRP_new_time - d_FuRMoRP_current_time;
     // Theta_new = Theta_old + Omega_old*dt
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
-        const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
-
         for (int d = 0; d < 3; ++d)
             d_incremented_angle_from_reference_axis[struct_no][d] +=
                 (d_rigid_rot_vel_current[struct_no][d] - d_omega_com_def_current[struct_no][d]) * dt;
@@ -1166,151 +1174,124 @@ ConstraintIBMethod::calculateKinematicsVelocity()
                                                           d_tagged_pt_position[struct_no]);
 
         d_ib_kinematics[struct_no]->setShape(d_FuRMoRP_new_time, d_incremented_angle_from_reference_axis[struct_no]);
-
-        if (struct_param.getStructureIsSelfTranslating()) calculateMomentumOfKinematicsVelocity(struct_no);
     }
+    calculateMomentumOfKinematicsVelocity();
 
     return;
 } // calculateKinematicsVelocity
 
 void
-ConstraintIBMethod::calculateMomentumOfKinematicsVelocity(const int position_handle)
+ConstraintIBMethod::calculateMomentumOfKinematicsVelocity()
 {
     using StructureParameters = ConstraintIBKinematics::StructureParameters;
-    Pointer<ConstraintIBKinematics> ptr_ib_kinematics = d_ib_kinematics[position_handle];
-    const StructureParameters& struct_param = ptr_ib_kinematics->getStructureParameters();
-    tbox::Array<int> calculate_trans_mom = struct_param.getCalculateTranslationalMomentum();
-    tbox::Array<int> calculate_rot_mom = struct_param.getCalculateRotationalMomentum();
-    const int coarsest_ln = struct_param.getCoarsestLevelNumber();
-    const int finest_ln = struct_param.getFinestLevelNumber();
-    const std::vector<std::pair<int, int> >& range = struct_param.getLagIdxRange();
-    const int total_nodes = struct_param.getTotalNodes();
-
-    // Zero out linear momentum of kinematics velocity of the structure.
-    for (int d = 0; d < 3; ++d) d_vel_com_def_new[position_handle][d] = 0.0;
+    const int coarsest_ln = 0;
+    const int finest_ln = d_hierarchy->getFinestLevelNumber();
 
-    // Calculate linear momentum
-    for (int ln = coarsest_ln, itr = 0; ln <= finest_ln && static_cast<unsigned int>(itr) < range.size(); ++ln, ++itr)
+    // Compute the local contributions to the linear and angular momenta of the
+    // kinematics velocities of all self-translating structures in a single pass
+    // over the local nodes.  For each structure, the values are stored as
+    // (U_com_def, R_cross_U_def) so that they can be summed by a single
+    // reduction.
+    static const int NUM_MOM_VALS = 6;
+    std::vector<double> mom_vals(NUM_MOM_VALS * d_no_structures, 0.0);
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
-#if !defined(NDEBUG)
-        TBOX_ASSERT(d_l_data_manager->levelContainsLagrangianData(ln));
-#endif
-
-        std::pair<int, int> lag_idx_range = range[itr];
-        const int offset = lag_idx_range.first;
-        double U_com_def[NDIM] = { 0.0 };
-
-        // Get LMesh corresponding to the present position of the structures
-        // on this level.
-        const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
-        const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
-        const std::vector<std::vector<double> >& def_vel = ptr_ib_kinematics->getKinematicsVelocity(ln);
+        if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
 
-        for (const auto& node_idx : local_nodes)
+        // Get LData corresponding to the present position of the structures.
+        Pointer<LData> ptr_x_lag_data;
+        if (MathUtilities<double>::equalEps(d_FuRMoRP_current_time, 0.0))
         {
-            const int lag_idx = node_idx->getLagrangianIndex();
-            if (lag_idx_range.first <= lag_idx && lag_idx < lag_idx_range.second)
-            {
-                for (unsigned int d = 0; d < NDIM; ++d)
-                {
-                    U_com_def[d] += def_vel[d][lag_idx - offset];
-                }
-            }
+            ptr_x_lag_data = d_l_data_manager->getLData("X", ln);
         }
-        for (int d = 0; d < NDIM; ++d)
+        else
         {
-            d_vel_com_def_new[position_handle][d] += U_com_def[d];
+            ptr_x_lag_data = d_l_data_X_half_Euler[ln];
         }
-    }
-    IBTK_MPI::sumReduction(d_vel_com_def_new[position_handle].data(), d_vel_com_def_new[position_handle].size());
-
-    for (int d = 0; d < 3; ++d)
-    {
-        if (calculate_trans_mom[d])
-            d_vel_com_def_new[position_handle][d] /= total_nodes;
-        else
-            d_vel_com_def_new[position_handle][d] = 0.0;
-    }
 
-    // Calculate angular momentum.
-    if (struct_param.getStructureIsSelfRotating())
-    {
-        // Zero out angular momentum of kinematics velocity of the structure.
-        for (int d = 0; d < 3; ++d) d_omega_com_def_new[position_handle][d] = 0.0;
+        const boost::multi_array_ref<double, 2>& X_data = *ptr_x_lag_data->getLocalFormVecArray();
+        const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
+        const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
+        const std::vector<std::pair<int, int> >& node_structures = getLocalNodeStructures(ln);
 
-        for (int ln = coarsest_ln, itr = 0; ln <= finest_ln && static_cast<unsigned int>(itr) < range.size();
-             ++ln, ++itr)
+        for (unsigned int k = 0; k < local_nodes.size(); ++k)
         {
-#if !defined(NDEBUG)
-            TBOX_ASSERT(d_l_data_manager->levelContainsLagrangianData(ln));
-#endif
-
-            std::pair<int, int> lag_idx_range = range[itr];
-            const int offset = lag_idx_range.first;
-            double R_cross_U_def[3] = { 0.0 };
+            const int position_handle = node_structures[k].first;
+            if (position_handle < 0) continue;
+            Pointer<ConstraintIBKinematics> ptr_ib_kinematics = d_ib_kinematics[position_handle];
+            const StructureParameters& struct_param = ptr_ib_kinematics->getStructureParameters();
+            if (!struct_param.getStructureIsSelfTranslating()) continue;
 
-            // Get LData corresponding to the present position of the structures.
-            Pointer<LData> ptr_x_lag_data;
-            if (MathUtilities<double>::equalEps(d_FuRMoRP_current_time, 0.0))
-            {
-                ptr_x_lag_data = d_l_data_manager->getLData("X", ln);
-            }
-            else
+            const int lag_idx = local_nodes[k]->getLagrangianIndex();
+            const int offset = node_structures[k].second;
+            const std::vector<std::vector<double> >& def_vel = ptr_ib_kinematics->getKinematicsVelocity(ln);
+            double* const U_com_def = &mom_vals[NUM_MOM_VALS * position_handle];
+            for (unsigned int d = 0; d < NDIM; ++d)
             {
-                ptr_x_lag_data = d_l_data_X_half_Euler[ln];
+                U_com_def[d] += def_vel[d][lag_idx - offset];
             }
 
-            const boost::multi_array_ref<double, 2>& X_data = *ptr_x_lag_data->getLocalFormVecArray();
-            const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
-            const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
-            const std::vector<std::vector<double> >& def_vel = ptr_ib_kinematics->getKinematicsVelocity(ln);
-
-            for (const auto& node_idx : local_nodes)
-            {
-                const int lag_idx = node_idx->getLagrangianIndex();
-                if (lag_idx_range.first <= lag_idx && lag_idx < lag_idx_range.second)
-                {
-                    const int local_idx = node_idx->getLocalPETScIndex();
-                    const double* const X = &X_data[local_idx][0];
+            if (!struct_param.getStructureIsSelfRotating()) continue;
+            double* const R_cross_U_def = &mom_vals[NUM_MOM_VALS * position_handle + 3];
+            const int local_idx = local_nodes[k]->getLocalPETScIndex();
+            const double* const X = &X_data[local_idx][0];
 #if (NDIM == 2)
-                    double x = X[0] - d_center_of_mass_new[position_handle][0];
-                    double y = X[1] - d_center_of_mass_new[position_handle][1];
-                    R_cross_U_def[2] += (x * (def_vel[1][lag_idx - offset]) - y * (def_vel[0][lag_idx - offset]));
-
+            double x = X[0] - d_center_of_mass_new[position_handle][0];
+            double y = X[1] - d_center_of_mass_new[position_handle][1];
+            R_cross_U_def[2] += (x * (def_vel[1][lag_idx - offset]) - y * (def_vel[0][lag_idx - offset]));
 #endif
 
 #if (NDIM == 3)
-                    double x = X[0] - d_center_of_mass_new[position_handle][0];
-                    double y = X[1] - d_center_of_mass_new[position_handle][1];
-                    double z = X[2] - d_center_of_mass_new[position_handle][2];
+            double x = X[0] - d_center_of_mass_new[position_handle][0];
+            double y = X[1] - d_center_of_mass_new[position_handle][1];
+            double z = X[2] - d_center_of_mass_new[position_handle][2];
 
-                    R_cross_U_def[0] += (y * (def_vel[2][lag_idx - offset]) - z * (def_vel[1][lag_idx - offset]));
+            R_cross_U_def[0] += (y * (def_vel[2][lag_idx - offset]) - z * (def_vel[1][lag_idx - offset]));
 
-                    R_cross_U_def[1] += (-x * (def_vel[2][lag_idx - offset]) + z * (def_vel[0][lag_idx - offset]));
+            R_cross_U_def[1] += (-x * (def_vel[2][lag_idx - offset]) + z * (def_vel[0][lag_idx - offset]));
 
-                    R_cross_U_def[2] += (x * (def_vel[1][lag_idx - offset]) - y * (def_vel[0][lag_idx - offset]));
+            R_cross_U_def[2] += (x * (def_vel[1][lag_idx - offset]) - y * (def_vel[0][lag_idx - offset]));
 #endif
-                }
-            }
-            for (int d = 0; d < 3; ++d)
-            {
-                d_omega_com_def_new[position_handle][d] += R_cross_U_def[d];
-            }
-            ptr_x_lag_data->restoreArrays();
-        } // all levels
-        IBTK_MPI::sumReduction(&d_omega_com_def_new[position_handle][0], 3);
+        } // all nodes on a level
+        ptr_x_lag_data->restoreArrays();
+    } // all levels
+    IBTK_MPI::sumReduction(mom_vals.data(), static_cast<int>(mom_vals.size()));
+
+    for (int position_handle = 0; position_handle < d_no_structures; ++position_handle)
+    {
+        const StructureParameters& struct_param = d_ib_kinematics[position_handle]->getStructureParameters();
+        if (!struct_param.getStructureIsSelfTranslating()) continue;
+        tbox::Array<int> calculate_trans_mom = struct_param.getCalculateTranslationalMomentum();
+        tbox::Array<int> calculate_rot_mom = struct_param.getCalculateRotationalMomentum();
+        const int total_nodes = struct_param.getTotalNodes();
+        const double* const vals = &mom_vals[NUM_MOM_VALS * position_handle];
+
+        // Calculate linear momentum.
+        for (int d = 0; d < 3; ++d)
+        {
+            if (calculate_trans_mom[d])
+                d_vel_com_def_new[position_handle][d] = vals[d] / total_nodes;
+            else
+                d_vel_com_def_new[position_handle][d] = 0.0;
+        }
+
+        // Calculate angular momentum.
+        if (struct_param.getStructureIsSelfRotating())
+        {
+            for (int d = 0; d < 3; ++d) d_omega_com_def_new[position_handle][d] = vals[3 + d];
 
 // Find angular velocity of deformational velocity.
 #if (NDIM == 2)
-        d_omega_com_def_new[position_handle][2] /= d_moment_of_inertia_new[position_handle](2, 2);
+            d_omega_com_def_new[position_handle][2] /= d_moment_of_inertia_new[position_handle](2, 2);
 #endif
 
 #if (NDIM == 3)
-        solveSystemOfEqns(d_omega_com_def_new[position_handle], d_moment_of_inertia_new[position_handle]);
-        for (int d = 0; d < 3; ++d)
-            if (!calculate_rot_mom[d]) d_omega_com_def_new[position_handle][d] = 0.0;
+            solveSystemOfEqns(d_omega_com_def_new[position_handle], d_moment_of_inertia_new[position_handle]);
+            for (int d = 0; d < 3; ++d)
+                if (!calculate_rot_mom[d]) d_omega_com_def_new[position_handle][d] = 0.0;
 #endif
-    } // if struct is rotating
+        } // if struct is rotating
+    }
 
     return;
 } // calculateMomentumOfKinematicsVelocity
@@ -1465,17 +1446,14 @@ ConstraintIBMethod::calculateVolumeElement()
 void
 ConstraintIBMethod::calculateRigidTranslationalMomentum()
 {
-    // Zero out new rigid momentum.
-    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
-    {
-        for (int d = 0; d < 3; ++d) d_rigid_trans_vel_new[struct_no][d] = 0.0;
-    }
-
     using StructureParameters = ConstraintIBKinematics::StructureParameters;
     const int coarsest_ln = 0;
     const int finest_ln = d_hierarchy->getFinestLevelNumber();
 
-    // Calculate rigid translational velocity.
+    // Compute the local contributions to the rigid translational velocities
+    // of all self-translating structures in a single pass over the local
+    // nodes, and sum them with a single reduction.
+    std::vector<double> U_rigid_vals(3 * d_no_structures, 0.0);
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
@@ -1484,53 +1462,40 @@ ConstraintIBMethod::calculateRigidTranslationalMomentum()
         const boost::multi_array_ref<double, 2>& U_interp_data = *d_l_data_U_interp[ln]->getLocalFormVecArray();
         const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
         const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
+        const std::vector<std::pair<int, int> >& node_structures = getLocalNodeStructures(ln);
 
-        // Get structures on this level.
-        const std::vector<int> structIDs = d_l_data_manager->getLagrangianStructureIDs(ln);
-        const size_t structs_on_this_ln = structIDs.size();
-
-        for (size_t struct_no = 0; struct_no < structs_on_this_ln; ++struct_no)
+        for (unsigned int k = 0; k < local_nodes.size(); ++k)
         {
-            std::pair<int, int> lag_idx_range =
-                d_l_data_manager->getLagrangianStructureIndexRange(structIDs[struct_no], ln);
-            Pointer<ConstraintIBKinematics> ptr_ib_kinematics =
-                *std::find_if(d_ib_kinematics.begin(), d_ib_kinematics.end(), find_struct_handle(lag_idx_range));
-            const StructureParameters& struct_param = ptr_ib_kinematics->getStructureParameters();
+            const int location_struct_handle = node_structures[k].first;
+            if (location_struct_handle < 0) continue;
+            const StructureParameters& struct_param =
+                d_ib_kinematics[location_struct_handle]->getStructureParameters();
             if (!struct_param.getStructureIsSelfTranslating()) continue;
 
-            const int location_struct_handle =
-                find_struct_handle_position(d_ib_kinematics.begin(), d_ib_kinematics.end(), ptr_ib_kinematics);
-
-            double U_rigid[NDIM] = { 0.0 };
-            for (const auto& node_idx : local_nodes)
+            const int local_idx = local_nodes[k]->getLocalPETScIndex();
+            const double* const U = &U_interp_data[local_idx][0];
+            double* const U_rigid = &U_rigid_vals[3 * location_struct_handle];
+            for (int d = 0; d < NDIM; ++d)
             {
-                const int lag_idx = node_idx->getLagrangianIndex();
-                if (lag_idx_range.first <= lag_idx && lag_idx < lag_idx_range.second)
-                {
-                    const int local_idx = node_idx->getLocalPETScIndex();
-                    const double* const U = &U_interp_data[local_idx][0];
-                    for (int d = 0; d < NDIM; ++d)
-                    {
-                        U_rigid[d] += U[d];
-                    }
-                }
+                U_rigid[d] += U[d];
             }
-            for (int d = 0; d < NDIM; ++d) d_rigid_trans_vel_new[location_struct_handle][d] += U_rigid[d];
-        } // all structs
+        } // all nodes on a level
         d_l_data_U_interp[ln]->restoreArrays();
     } // all levels
+    IBTK_MPI::sumReduction(U_rigid_vals.data(), static_cast<int>(U_rigid_vals.size()));
 
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
+        for (int d = 0; d < 3; ++d) d_rigid_trans_vel_new[struct_no][d] = 0.0;
         const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
         if (struct_param.getStructureIsSelfTranslating())
         {
-            IBTK_MPI::sumReduction(d_rigid_trans_vel_new[struct_no].data(), d_rigid_trans_vel_new[struct_no].size());
             tbox::Array<int> calculate_trans_mom = struct_param.getCalculateTranslationalMomentum();
             for (int d = 0; d < NDIM; ++d)
             {
                 if (calculate_trans_mom[d])
-                    d_rigid_trans_vel_new[struct_no][d] /= struct_param.getTotalNodes();
+                    d_rigid_trans_vel_new[struct_no][d] =
+                        U_rigid_vals[3 * struct_no + d] / struct_param.getTotalNodes();
                 else
                     d_rigid_trans_vel_new[struct_no][d] = 0.0;
             }
@@ -1556,17 +1521,14 @@ ConstraintIBMethod::calculateRigidTranslationalMomentum()
 void
 ConstraintIBMethod::calculateRigidRotationalMomentum()
 {
-    // Zero out new rigid momentum.
-    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
-    {
-        for (int d = 0; d < 3; ++d) d_rigid_rot_vel_new[struct_no][d] = 0.0;
-    }
-
     using StructureParameters = ConstraintIBKinematics::StructureParameters;
     const int coarsest_ln = 0;
     const int finest_ln = d_hierarchy->getFinestLevelNumber();
 
-    // Calculate rigid rotational velocity.
+    // Compute the local contributions to the rigid angular momenta of all
+    // self-rotating structures in a single pass over the local nodes, and sum
+    // them with a single reduction.
+    std::vector<double> Omega_rigid_vals(3 * d_no_structures, 0.0);
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
@@ -1576,60 +1538,47 @@ ConstraintIBMethod::calculateRigidRotationalMomentum()
         const boost::multi_array_ref<double, 2>& X_data = *d_l_data_X_half_Euler[ln]->getLocalFormVecArray();
         const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
         const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
+        const std::vector<std::pair<int, int> >& node_structures = getLocalNodeStructures(ln);
 
-        // Get structures on this level.
-        const std::vector<int> structIDs = d_l_data_manager->getLagrangianStructureIDs(ln);
-        const size_t structs_on_this_ln = structIDs.size();
-
-        for (size_t struct_no = 0; struct_no < structs_on_this_ln; ++struct_no)
+        for (unsigned int k = 0; k < local_nodes.size(); ++k)
         {
-            std::pair<int, int> lag_idx_range =
-                d_l_data_manager->getLagrangianStructureIndexRange(structIDs[struct_no], ln);
-            Pointer<ConstraintIBKinematics> ptr_ib_kinematics =
-                *std::find_if(d_ib_kinematics.begin(), d_ib_kinematics.end(), find_struct_handle(lag_idx_range));
-            const StructureParameters& struct_param = ptr_ib_kinematics->getStructureParameters();
+            const int location_struct_handle = node_structures[k].first;
+            if (location_struct_handle < 0) continue;
+            const StructureParameters& struct_param =
+                d_ib_kinematics[location_struct_handle]->getStructureParameters();
             if (!struct_param.getStructureIsSelfRotating()) continue;
 
-            const int location_struct_handle =
-                find_struct_handle_position(d_ib_kinematics.begin(), d_ib_kinematics.end(), ptr_ib_kinematics);
-
-            double Omega_rigid[3] = { 0.0 };
-            for (const auto& node_idx : local_nodes)
-            {
-                const int lag_idx = node_idx->getLagrangianIndex();
-                if (lag_idx_range.first <= lag_idx && lag_idx < lag_idx_range.second)
-                {
-                    const int local_idx = node_idx->getLocalPETScIndex();
-                    const double* const U = &U_interp_data[local_idx][0];
-                    const double* const X = &X_data[local_idx][0];
+            const int local_idx = local_nodes[k]->getLocalPETScIndex();
+            const double* const U = &U_interp_data[local_idx][0];
+            const double* const X = &X_data[local_idx][0];
+            double* const Omega_rigid = &Omega_rigid_vals[3 * location_struct_handle];
 #if (NDIM == 2)
-                    const double x = X[0] - d_center_of_mass_new[location_struct_handle][0];
-                    const double y = X[1] - d_center_of_mass_new[location_struct_handle][1];
-                    Omega_rigid[2] += x * U[1] - y * U[0];
+            const double x = X[0] - d_center_of_mass_new[location_struct_handle][0];
+            const double y = X[1] - d_center_of_mass_new[location_struct_handle][1];
+            Omega_rigid[2] += x * U[1] - y * U[0];
 #endif
 
 #if (NDIM == 3)
-                    const double x = X[0] - d_center_of_mass_new[location_struct_handle][0];
-                    const double y = X[1] - d_center_of_mass_new[location_struct_handle][1];
-                    const double z = X[2] - d_center_of_mass_new[location_struct_handle][2];
-                    Omega_rigid[0] += y * U[2] - z * U[1];
-                    Omega_rigid[1] += -x * U[2] + z * U[0];
-                    Omega_rigid[2] += x * U[1] - y * U[0];
+            const double x = X[0] - d_center_of_mass_new[location_struct_handle][0];
+            const double y = X[1] - d_center_of_mass_new[location_struct_handle][1];
+            const double z = X[2] - d_center_of_mass_new[location_struct_handle][2];
+            Omega_rigid[0] += y * U[2] - z * U[1];
+            Omega_rigid[1] += -x * U[2] + z * U[0];
+            Omega_rigid[2] += x * U[1] - y * U[0];
 #endif
-                }
-            }
-            for (int d = 0; d < 3; ++d) d_rigid_rot_vel_new[location_struct_handle][d] += Omega_rigid[d];
-        } // all structs
+        } // all nodes on a level
         d_l_data_U_interp[ln]->restoreArrays();
         d_l_data_X_half_Euler[ln]->restoreArrays();
     } // all levels
+    IBTK_MPI::sumReduction(Omega_rigid_vals.data(), static_cast<int>(Omega_rigid_vals.size()));
 
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
+        for (int d = 0; d < 3; ++d) d_rigid_rot_vel_new[struct_no][d] = 0.0;
         const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
         if (struct_param.getStructureIsSelfRotating())
         {
-            IBTK_MPI::sumReduction(&d_rigid_rot_vel_new[struct_no][0], 3);
+            for (int d = 0; d < 3; ++d) d_rigid_rot_vel_new[struct_no][d] = Omega_rigid_vals[3 * struct_no + d];
 #if (NDIM == 2)
             d_rigid_rot_vel_new[struct_no][2] /= d_moment_of_inertia_new[struct_no](2, 2);
 #endif
@@ -1681,79 +1630,66 @@ ConstraintIBMethod::calculateCurrentLagrangianVelocity()
         const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
         const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
 
-        // Get structures on this level.
-        const std::vector<int> structIDs = d_l_data_manager->getLagrangianStructureIDs(ln);
-        const size_t structs_on_this_ln = structIDs.size();
+        const std::vector<std::pair<int, int> >& node_structures = getLocalNodeStructures(ln);
 
-        for (size_t struct_no = 0; struct_no < structs_on_this_ln; ++struct_no)
+        for (unsigned int k = 0; k < local_nodes.size(); ++k)
         {
-            std::pair<int, int> lag_idx_range =
-                d_l_data_manager->getLagrangianStructureIndexRange(structIDs[struct_no], ln);
-            const int offset = lag_idx_range.first;
-            Pointer<ConstraintIBKinematics> ptr_ib_kinematics =
-                *std::find_if(d_ib_kinematics.begin(), d_ib_kinematics.end(), find_struct_handle(lag_idx_range));
-            const int location_struct_handle =
-                find_struct_handle_position(d_ib_kinematics.begin(), d_ib_kinematics.end(), ptr_ib_kinematics);
+            const int location_struct_handle = node_structures[k].first;
+            if (location_struct_handle < 0) continue;
+            const int offset = node_structures[k].second;
+            Pointer<ConstraintIBKinematics> ptr_ib_kinematics = d_ib_kinematics[location_struct_handle];
             const StructureParameters& struct_param = ptr_ib_kinematics->getStructureParameters();
             const std::vector<std::vector<double> >& current_vel = ptr_ib_kinematics->getKinematicsVelocity(ln);
+            const LNode* const node_idx = local_nodes[k];
+            const int lag_idx = node_idx->getLagrangianIndex();
+            const int local_idx = node_idx->getLocalPETScIndex();
+            double* const U_current = &U_current_data[local_idx][0];
+            const double* const X = &X_data[local_idx][0];
 
-            for (const auto& node_idx : local_nodes)
+            // Imposed velocity
+            for (int d = 0; d < NDIM; ++d)
             {
-                const int lag_idx = node_idx->getLagrangianIndex();
+                U_current[d] = current_vel[d][lag_idx - offset];
+            }
 
-                if (lag_idx_range.first <= lag_idx && lag_idx < lag_idx_range.second)
+            // Translational velocity
+            if (struct_param.getStructureIsSelfTranslating())
+            {
+                for (int d = 0; d < NDIM; ++d)
                 {
-                    const int local_idx = node_idx->getLocalPETScIndex();
-                    double* const U_current = &U_current_data[local_idx][0];
-                    const double* const X = &X_data[local_idx][0];
-
-                    // Imposed velocity
-                    for (int d = 0; d < NDIM; ++d)
-                    {
-                        U_current[d] = current_vel[d][lag_idx - offset];
-                    }
-
-                    // Translational velocity
-                    if (struct_param.getStructureIsSelfTranslating())
-                    {
-                        for (int d = 0; d < NDIM; ++d)
-                        {
-                            U_current[d] += d_rigid_trans_vel_current[location_struct_handle][d] -
-                                            d_vel_com_def_current[location_struct_handle][d];
-                        }
-                    }
-
-                    // Rotational velocity
-                    if (struct_param.getStructureIsSelfRotating())
-                    {
-                        for (int d = 0; d < NDIM; ++d)
-                        {
-                            R[d] = X[d] - d_center_of_mass_current[location_struct_handle][d];
-                        }
+                    U_current[d] += d_rigid_trans_vel_current[location_struct_handle][d] -
+                                    d_vel_com_def_current[location_struct_handle][d];
+                }
+            }
 
-                        WxR[0] = R[2] * (d_rigid_rot_vel_current[location_struct_handle][1] -
-                                         d_omega_com_def_current[location_struct_handle][1]) -
-                                 R[1] * (d_rigid_rot_vel_current[location_struct_handle][2] -
-                                         d_omega_com_def_current[location_struct_handle][2]);
+            // Rotational velocity
+            if (struct_param.getStructureIsSelfRotating())
+            {
+                for (int d = 0; d < NDIM; ++d)
+                {
+                    R[d] = X[d] - d_center_of_mass_current[location_struct_handle][d];
+                }
 
-                        WxR[1] = -R[2] * (d_rigid_rot_vel_current[location_struct_handle][0] -
-                                          d_omega_com_def_current[location_struct_handle][0]) +
-                                 R[0] * (d_rigid_rot_vel_current[location_struct_handle][2] -
-                                         d_omega_com_def_current[location_struct_handle][2]);
+                WxR[0] = R[2] * (d_rigid_rot_vel_current[location_struct_handle][1] -
+                                 d_omega_com_def_current[location_struct_handle][1]) -
+                         R[1] * (d_rigid_rot_vel_current[location_struct_handle][2] -
+                                 d_omega_com_def_current[location_struct_handle][2]);
 
-                        WxR[2] = R[1] * (d_rigid_rot_vel_current[location_struct_handle][0] -
-                                         d_omega_com_def_current[location_struct_handle][0]) -
-                                 R[0] * (d_rigid_rot_vel_current[location_struct_handle][1] -
-                                         d_omega_com_def_current[location_struct_handle][1]);
-                        for (int d = 0; d < NDIM; ++d)
-                        {
-                            U_current[d] += WxR[d];
-                        }
-                    }
+                WxR[1] = -R[2] * (d_rigid_rot_vel_current[location_struct_handle][0] -
+                                  d_omega_com_def_current[location_struct_handle][0]) +
+                         R[0] * (d_rigid_rot_vel_current[location_struct_handle][2] -
+                                 d_omega_com_def_current[location_struct_handle][2]);
 
-                } // choose a struct
-            }     // all nodes on a level
-        }         // all structs
+                WxR[2] = R[1] * (d_rigid_rot_vel_current[location_struct_handle][0] -
+                                 d_omega_com_def_current[location_struct_handle][0]) -
+                         R[0] * (d_rigid_rot_vel_current[location_struct_handle][1] -
+                                 d_omega_com_def_current[location_struct_handle][1]);
+                for (int d = 0; d < NDIM; ++d)
+                {
+                    U_current[d] += WxR[d];
+                }
+            }
+        } // all nodes on a level
         d_l_data_U_current[ln]->restoreArrays();
         d_l_data_manager->getLData("X", ln)->restoreArrays();
     } // all levels
@@ -1783,85 +1719,73 @@ ConstraintIBMethod::correctVelocityOnLagrangianMesh()
         const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
         const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
 
-        // Get structures on this level.
-        const std::vector<int> structIDs = d_l_data_manager->getLagrangianStructureIDs(ln);
-        const size_t structs_on_this_ln = structIDs.size();
+        const std::vector<std::pair<int, int> >& node_structures = getLocalNodeStructures(ln);
 
-        for (size_t struct_no = 0; struct_no < structs_on_this_ln; ++struct_no)
+        for (unsigned int k = 0; k < local_nodes.size(); ++k)
         {
-            std::pair<int, int> lag_idx_range =
-                d_l_data_manager->getLagrangianStructureIndexRange(structIDs[struct_no], ln);
-            const int offset = lag_idx_range.first;
-            Pointer<ConstraintIBKinematics> ptr_ib_kinematics =
-                *std::find_if(d_ib_kinematics.begin(), d_ib_kinematics.end(), find_struct_handle(lag_idx_range));
-            const int location_struct_handle =
-                find_struct_handle_position(d_ib_kinematics.begin(), d_ib_kinematics.end(), ptr_ib_kinematics);
+            const int location_struct_handle = node_structures[k].first;
+            if (location_struct_handle < 0) continue;
+            const int offset = node_structures[k].second;
+            Pointer<ConstraintIBKinematics> ptr_ib_kinematics = d_ib_kinematics[location_struct_handle];
             const StructureParameters& struct_param = ptr_ib_kinematics->getStructureParameters();
             const std::vector<std::vector<double> >& new_vel = ptr_ib_kinematics->getKinematicsVelocity(ln);
+            const LNode* const node_idx = local_nodes[k];
+            const int lag_idx = node_idx->getLagrangianIndex();
+            const int local_idx = node_idx->getLocalPETScIndex();
+            const double* const U = &U_interp_data[local_idx][0];
+            double* const U_corr = &U_corr_data[local_idx][0];
+            double* const U_new = &U_new_data[local_idx][0];
+            const double* const X = &X_data[local_idx][0];
 
-            for (const auto& node_idx : local_nodes)
+            // Imposed velocity
+            for (int d = 0; d < NDIM; ++d)
             {
-                const int lag_idx = node_idx->getLagrangianIndex();
-                if (lag_idx_range.first <= lag_idx && lag_idx < lag_idx_range.second)
-                {
-                    const int local_idx = node_idx->getLocalPETScIndex();
-                    const double* const U = &U_interp_data[local_idx][0];
-                    double* const U_corr = &U_corr_data[local_idx][0];
-                    double* const U_new = &U_new_data[local_idx][0];
-                    const double* const X = &X_data[local_idx][0];
-
-                    // Imposed velocity
-                    for (int d = 0; d < NDIM; ++d)
-                    {
-                        U_new[d] = new_vel[d][lag_idx - offset];
-                    }
-
-                    // Translational velocity
-                    if (struct_param.getStructureIsSelfTranslating())
-                    {
-                        for (int d = 0; d < NDIM; ++d)
-                        {
-                            U_new[d] += d_rigid_trans_vel_new[location_struct_handle][d] -
-                                        d_vel_com_def_new[location_struct_handle][d];
-                        }
-                    }
+                U_new[d] = new_vel[d][lag_idx - offset];
+            }
 
-                    // Rotational velocity
-                    if (struct_param.getStructureIsSelfRotating())
-                    {
-                        for (int d = 0; d < NDIM; ++d)
-                        {
-                            R[d] = X[d] - d_center_of_mass_new[location_struct_handle][d];
-                        }
-                        WxR[0] = R[2] * (d_rigid_rot_vel_new[location_struct_handle][1] -
-                                         d_omega_com_def_new[location_struct_handle][1]) -
-                                 R[1] * (d_rigid_rot_vel_new[location_struct_handle][2] -
-                                         d_omega_com_def_new[location_struct_handle][2]);
+            // Translational velocity
+            if (struct_param.getStructureIsSelfTranslating())
+            {
+                for (int d = 0; d < NDIM; ++d)
+                {
+                    U_new[d] +=
+                        d_rigid_trans_vel_new[location_struct_handle][d] - d_vel_com_def_new[location_struct_handle][d];
+                }
+            }
 
-                        WxR[1] = -R[2] * (d_rigid_rot_vel_new[location_struct_handle][0] -
-                                          d_omega_com_def_new[location_struct_handle][0]) +
-                                 R[0] * (d_rigid_rot_vel_new[location_struct_handle][2] -
-                                         d_omega_com_def_new[location_struct_handle][2]);
+            // Rotational velocity
+            if (struct_param.getStructureIsSelfRotating())
+            {
+                for (int d = 0; d < NDIM; ++d)
+                {
+                    R[d] = X[d] - d_center_of_mass_new[location_struct_handle][d];
+                }
+                WxR[0] = R[2] * (d_rigid_rot_vel_new[location_struct_handle][1] -
+                                 d_omega_com_def_new[location_struct_handle][1]) -
+                         R[1] * (d_rigid_rot_vel_new[location_struct_handle][2] -
+                                 d_omega_com_def_new[location_struct_handle][2]);
 
-                        WxR[2] = R[1] * (d_rigid_rot_vel_new[location_struct_handle][0] -
-                                         d_omega_com_def_new[location_struct_handle][0]) -
-                                 R[0] * (d_rigid_rot_vel_new[location_struct_handle][1] -
-                                         d_omega_com_def_new[location_struct_handle][1]);
+                WxR[1] = -R[2] * (d_rigid_rot_vel_new[location_struct_handle][0] -
+                                  d_omega_com_def_new[location_struct_handle][0]) +
+                         R[0] * (d_rigid_rot_vel_new[location_struct_handle][2] -
+                                 d_omega_com_def_new[location_struct_handle][2]);
 
-                        for (int d = 0; d < NDIM; ++d)
-                        {
-                            U_new[d] += WxR[d];
-                        }
-                    }
+                WxR[2] = R[1] * (d_rigid_rot_vel_new[location_struct_handle][0] -
+                                 d_omega_com_def_new[location_struct_handle][0]) -
+                         R[0] * (d_rigid_rot_vel_new[location_struct_handle][1] -
+                                 d_omega_com_def_new[location_struct_handle][1]);
 
-                    for (int d = 0; d < NDIM; ++d)
-                    {
-                        U_corr[d] = (U_new[d] - U[d]) * d_vol_element[location_struct_handle];
-                    }
+                for (int d = 0; d < NDIM; ++d)
+                {
+                    U_new[d] += WxR[d];
+                }
+            }
 
-                } // choose a struct
-            }     // all nodes on a level
-        }         // all structs
+            for (int d = 0; d < NDIM; ++d)
+            {
+                U_corr[d] = (U_new[d] - U[d]) * d_vol_element[location_struct_handle];
+            }
+        } // all nodes on a level
         d_l_data_U_interp[ln]->restoreArrays();
         d_l_data_U_correction[ln]->restoreArrays();
         d_l_data_U_new[ln]->restoreArrays();
@@ -2692,6 +2616,10 @@ ConstraintIBMethod::calculateStructureMomentum()
     const int coarsest_ln = 0;
     const int finest_ln = d_hierarchy->getFinestLevelNumber();
 
+    // Compute the local contributions to the linear momenta of all structures
+    // in a single pass over the local nodes, and sum them with a single
+    // reduction.
+    std::vector<double> mom_vals(3 * d_no_structures, 0.0);
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
@@ -2699,44 +2627,31 @@ ConstraintIBMethod::calculateStructureMomentum()
         const boost::multi_array_ref<double, 2>& U_new_data = *d_l_data_U_new[ln]->getLocalFormVecArray();
         const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
         const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
+        const std::vector<std::pair<int, int> >& node_structures = getLocalNodeStructures(ln);
 
-        // Get structures on this level.
-        const std::vector<int> structIDs = d_l_data_manager->getLagrangianStructureIDs(ln);
-        const size_t structs_on_this_ln = structIDs.size();
-
-        for (size_t struct_no = 0; struct_no < structs_on_this_ln; ++struct_no)
+        for (unsigned int k = 0; k < local_nodes.size(); ++k)
         {
-            std::pair<int, int> lag_idx_range =
-                d_l_data_manager->getLagrangianStructureIndexRange(structIDs[struct_no], ln);
-            Pointer<ConstraintIBKinematics> ptr_ib_kinematics =
-                *std::find_if(d_ib_kinematics.begin(), d_ib_kinematics.end(), find_struct_handle(lag_idx_range));
-            const int location_struct_handle =
-                find_struct_handle_position(d_ib_kinematics.begin(), d_ib_kinematics.end(), ptr_ib_kinematics);
+            const int location_struct_handle = node_structures[k].first;
+            if (location_struct_handle < 0) continue;
 
-            for (const auto& node_idx : local_nodes)
+            const int local_idx = local_nodes[k]->getLocalPETScIndex();
+            const double* const U_new = &U_new_data[local_idx][0];
+            double* const mom = &mom_vals[3 * location_struct_handle];
+            for (int d = 0; d < NDIM; ++d)
             {
-                const int lag_idx = node_idx->getLagrangianIndex();
-                if (lag_idx_range.first <= lag_idx && lag_idx < lag_idx_range.second)
-                {
-                    const int local_idx = node_idx->getLocalPETScIndex();
-                    const double* const U_new = &U_new_data[local_idx][0];
-
-                    for (int d = 0; d < NDIM; ++d)
-                    {
-                        d_structure_mom[location_struct_handle][d] += U_new[d];
-                    }
-                }
+                mom[d] += U_new[d];
             }
-        } // all structs
+        } // all nodes on a level
         d_l_data_U_new[ln]->restoreArrays();
-    }
+    } // all levels
+    IBTK_MPI::sumReduction(mom_vals.data(), static_cast<int>(mom_vals.size()));
 
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
-        IBTK_MPI::sumReduction(&d_structure_mom[struct_no][0], 3);
-        for (int d = 0; d < NDIM; ++d)
+        for (int d = 0; d < 3; ++d)
         {
-            d_structure_mom[struct_no][d] *= d_rho_solid[struct_no] * d_vol_element[struct_no];
+            d_structure_mom[struct_no][d] =
+                d_rho_solid[struct_no] * d_vol_element[struct_no] * mom_vals[3 * struct_no + d];
         }
     }
 
@@ -2749,73 +2664,55 @@ ConstraintIBMethod::calculateStructureRotationalMomentum()
     const int coarsest_ln = 0;
     const int finest_ln = d_hierarchy->getFinestLevelNumber();
 
-    double R_cross_U[3] = { 0.0 };
-
+    // Compute the local contributions to the angular momenta of all
+    // structures in a single pass over the local nodes, and sum them with a
+    // single reduction.
+    std::vector<double> rot_mom_vals(3 * d_no_structures, 0.0);
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
 
         const boost::multi_array_ref<double, 2>& U_new_data = *d_l_data_U_new[ln]->getLocalFormVecArray();
         const boost::multi_array_ref<double, 2>& X_data = *d_X_new_data[ln]->getLocalFormVecArray();
-
         const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
         const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
+        const std::vector<std::pair<int, int> >& node_structures = getLocalNodeStructures(ln);
 
-        // Get structures on this level.
-        const std::vector<int> structIDs = d_l_data_manager->getLagrangianStructureIDs(ln);
-        const size_t structs_on_this_ln = structIDs.size();
-
-        for (size_t struct_no = 0; struct_no < structs_on_this_ln; ++struct_no)
+        for (unsigned int k = 0; k < local_nodes.size(); ++k)
         {
-            std::pair<int, int> lag_idx_range =
-                d_l_data_manager->getLagrangianStructureIndexRange(structIDs[struct_no], ln);
-            Pointer<ConstraintIBKinematics> ptr_ib_kinematics =
-                *std::find_if(d_ib_kinematics.begin(), d_ib_kinematics.end(), find_struct_handle(lag_idx_range));
-            const int location_struct_handle =
-                find_struct_handle_position(d_ib_kinematics.begin(), d_ib_kinematics.end(), ptr_ib_kinematics);
+            const int location_struct_handle = node_structures[k].first;
+            if (location_struct_handle < 0) continue;
 
-            for (const auto& node_idx : local_nodes)
-            {
-                const int lag_idx = node_idx->getLagrangianIndex();
-                if (lag_idx_range.first <= lag_idx && lag_idx < lag_idx_range.second)
-                {
-                    const int local_idx = node_idx->getLocalPETScIndex();
-                    const double* const U_new = &U_new_data[local_idx][0];
-                    const double* const X = &X_data[local_idx][0];
+            const int local_idx = local_nodes[k]->getLocalPETScIndex();
+            const double* const U_new = &U_new_data[local_idx][0];
+            const double* const X = &X_data[local_idx][0];
+            double* const rot_mom = &rot_mom_vals[3 * location_struct_handle];
 #if (NDIM == 2)
-                    double x = X[0] - d_center_of_mass_new[location_struct_handle][0];
-                    double y = X[1] - d_center_of_mass_new[location_struct_handle][1];
-                    R_cross_U[2] = (x * (U_new[1]) - y * (U_new[0]));
+            const double x = X[0] - d_center_of_mass_new[location_struct_handle][0];
+            const double y = X[1] - d_center_of_mass_new[location_struct_handle][1];
+            rot_mom[2] += x * U_new[1] - y * U_new[0];
 #endif
 
 #if (NDIM == 3)
-                    double x = X[0] - d_center_of_mass_new[location_struct_handle][0];
-                    double y = X[1] - d_center_of_mass_new[location_struct_handle][1];
-                    double z = X[2] - d_center_of_mass_new[location_struct_handle][2];
-
-                    R_cross_U[0] = (y * (U_new[2]) - z * (U_new[1]));
-
-                    R_cross_U[1] = (-x * (U_new[2]) + z * (U_new[0]));
-
-                    R_cross_U[2] = (x * (U_new[1]) - y * (U_new[0]));
+            const double x = X[0] - d_center_of_mass_new[location_struct_handle][0];
+            const double y = X[1] - d_center_of_mass_new[location_struct_handle][1];
+            const double z = X[2] - d_center_of_mass_new[location_struct_handle][2];
+            rot_mom[0] += y * U_new[2] - z * U_new[1];
+            rot_mom[1] += -x * U_new[2] + z * U_new[0];
+            rot_mom[2] += x * U_new[1] - y * U_new[0];
 #endif
-
-                    for (int d = 0; d < 3; ++d)
-                    {
-                        d_structure_rotational_mom[location_struct_handle][d] += R_cross_U[d];
-                    }
-                }
-            }
-        } // all structs
+        } // all nodes on a level
         d_l_data_U_new[ln]->restoreArrays();
         d_X_new_data[ln]->restoreArrays();
-    }
+    } // all levels
+    IBTK_MPI::sumReduction(rot_mom_vals.data(), static_cast<int>(rot_mom_vals.size()));
+
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
-        IBTK_MPI::sumReduction(&d_structure_rotational_mom[struct_no][0], 3);
         for (int d = 0; d < 3; ++d)
         {
-            d_structure_rotational_mom[struct_no][d] *= d_rho_solid[struct_no] * d_vol_element[struct_no];
+            d_structure_rotational_mom[struct_no][d] =
+                d_rho_solid[struct_no] * d_vol_element[struct_no] * rot_mom_vals[3 * struct_no + d];
         }
     }
 
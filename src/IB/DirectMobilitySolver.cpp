@@ -15,6 +15,7 @@
 
 #include "ibamr/CIBStrategy.h"
 #include "ibamr/DirectMobilitySolver.h"
+#include "ibamr/HODLRMatrix.h"
 #include "ibamr/StokesSpecifications.h"
 #include "ibamr/ibamr_enums.h"
 #include "ibamr/ibamr_utilities.h"
@@ -44,6 +45,7 @@
 #include <algorithm>
 #include <cmath>
 #include <map>
+#include <memory>
 #include <ostream>
 #include <string>
 #include <utility>
@@ -200,6 +202,12 @@ DirectMobilitySolver::registerMobilityMat(const std::string& mat_name,
     TBOX_ASSERT(inv_type.first != UNKNOWN_MOBILITY_MATRIX_INVERSE_TYPE);
     TBOX_ASSERT(inv_type.second != UNKNOWN_MOBILITY_MATRIX_INVERSE_TYPE);
 #endif
+    if (inv_type.second == HODLR)
+    {
+        TBOX_ERROR("DirectMobilitySolver::registerMobilityMat(): HODLR inversion is only supported "
+                   << "for the mobility matrix, not for the body mobility matrix of handle " << mat_name
+                   << std::endl);
+    }
 
     unsigned int num_nodes = 0;
     for (const auto& prototype_struct_id : prototype_struct_ids)
@@ -229,12 +237,18 @@ DirectMobilitySolver::registerMobilityMat(const std::string& mat_name,
 
     if (rank == managing_proc)
     {
-        d_mat_map[mat_name].first.resize(mobility_mat_size * mobility_mat_size);
-        MatCreateSeqDense(PETSC_COMM_SELF,
-                          mobility_mat_size,
-                          mobility_mat_size,
-                          d_mat_map[mat_name].first.data(),
-                          &d_petsc_mat_map[mat_name].first);
+        // A HODLR approximation is compressed directly from the entries of the
+        // mobility matrix, so the dense matrix is only needed when it is read
+        // from a file.
+        if (inv_type.first != HODLR || mat_type == READ_FROM_FILE)
+        {
+            d_mat_map[mat_name].first.resize(mobility_mat_size * mobility_mat_size);
+            MatCreateSeqDense(PETSC_COMM_SELF,
+                              mobility_mat_size,
+                              mobility_mat_size,
+                              d_mat_map[mat_name].first.data(),
+                              &d_petsc_mat_map[mat_name].first);
+        }
 
         d_mat_map[mat_name].second.resize(body_mobility_mat_size * body_mobility_mat_size);
         MatCreateSeqDense(PETSC_COMM_SELF,
@@ -349,7 +363,9 @@ DirectMobilitySolver::solveSystem(Vec x, Vec b)
                                             managing_proc,
                                             data_depth);
             }
-            if (rank == managing_proc) computeSolution(mat, inv_type, d_ipiv_map[mat_name].first.data(), rhs.data());
+            if (rank == managing_proc)
+                computeSolution(
+                    mat, inv_type, d_ipiv_map[mat_name].first.data(), rhs.data(), d_hodlr_mat_map[mat_name].get());
             if (!d_recompute_mob_mat)
             {
                 d_cib_strategy->rotateArray(rhs.data(),
@@ -482,6 +498,26 @@ DirectMobilitySolver::initializeSolverState(Vec x, Vec /*b*/)
 
                 read_files[file_counter] = true;
             }
+            else if (d_mat_inv_type_map[mat_name].first == HODLR && mat_type != READ_FROM_FILE)
+            {
+                d_mobility_entry_map[mat_name] = d_cib_strategy->getMobilityMatrixEntryFunction(mat_name,
+                                                                                                mat_type,
+                                                                                                struct_ids,
+                                                                                                dx,
+                                                                                                domain_extents,
+                                                                                                initial_time,
+                                                                                                d_rho,
+                                                                                                d_mu,
+                                                                                                scale,
+                                                                                                d_f_periodic_corr,
+                                                                                                managing_proc);
+                if (rank == managing_proc && !d_mobility_entry_map[mat_name])
+                {
+                    TBOX_ERROR("DirectMobilitySolver::initializeSolverState(): HODLR inversion of the mobility "
+                               << "matrix with handle " << mat_name
+                               << " requires CIBStrategy::getMobilityMatrixEntryFunction()." << std::endl);
+                }
+            }
             else
             {
                 d_cib_strategy->constructMobilityMatrix(mat_name,
@@ -555,6 +591,13 @@ DirectMobilitySolver::getFromInput(Pointer<Database> input_db)
         d_svd_replace_value = comp_db->getDouble("eigenvalue_replace_value");
         d_svd_eps = comp_db->getDouble("min_eigenvalue_threshold");
     }
+    comp_db = input_db->isDatabase("HODLR") ? input_db->getDatabase("HODLR") : Pointer<Database>(nullptr);
+    if (comp_db)
+    {
+        d_hodlr_leaf_size = comp_db->getIntegerWithDefault("leaf_size", d_hodlr_leaf_size);
+        d_hodlr_rel_tol = comp_db->getDoubleWithDefault("rel_tol", d_hodlr_rel_tol);
+        d_hodlr_max_rank = comp_db->getIntegerWithDefault("max_rank", d_hodlr_max_rank);
+    }
 
     // Other parameters
     d_f_periodic_corr = input_db->getDoubleWithDefault("f_periodic_correction", d_f_periodic_corr);
@@ -575,6 +618,13 @@ DirectMobilitySolver::factorizeMobilityMatrix()
         Mat& mat = d_petsc_mat_map[mat_name].first;
         const MobilityMatrixInverseType& inv_type = d_mat_inv_type_map[mat_name].first;
         const int mat_size = d_mat_nodes_map[mat_name] * NDIM;
+        if (!mat)
+        {
+            // The mobility matrix is not assembled.
+            factorizeHODLRMatrix(d_mobility_entry_map[mat_name], mat_size, mat_name, "Mobility");
+            d_mobility_entry_map[mat_name] = nullptr;
+            continue;
+        }
         double* mat_data = nullptr;
         MatDenseGetArray(mat, &mat_data);
         factorizeDenseMatrix(mat_data, mat_size, inv_type, d_ipiv_map[mat_name].first.data(), mat_name, "Mobility");
@@ -612,8 +662,11 @@ DirectMobilitySolver::constructBodyMobilityMatrix()
         {
             double* col_data;
             MatDenseGetArray(product_mat, &col_data);
-            computeSolution(
-                mobility_mat, mobility_inv_type, d_ipiv_map[mat_name].first.data(), &col_data[col * row_size]);
+            computeSolution(mobility_mat,
+                            mobility_inv_type,
+                            d_ipiv_map[mat_name].first.data(),
+                            &col_data[col * row_size],
+                            d_hodlr_mat_map[mat_name].get());
             MatDenseRestoreArray(product_mat, &col_data);
         }
         MatTransposeMatMult(geometric_mat, product_mat, MAT_REUSE_MATRIX, PETSC_DEFAULT, &body_mob_mat);
@@ -793,6 +846,12 @@ DirectMobilitySolver::factorizeDenseMatrix(double* mat_data,
              << " eigenvalues for dense matrix with handle " << mat_name
              << "have been changed. Number of zero eigenvalues placed are " << counter_zero << std::endl;
     }
+    else if (inv_type == HODLR)
+    {
+        // The dense matrix is left unmodified.
+        factorizeHODLRMatrix(
+            [mat_data, mat_size](int i, int j) { return mat_data[j * mat_size + i]; }, mat_size, mat_name, err_msg);
+    }
     else
     {
         TBOX_ERROR("DirectMobilityMatrix::factorizeDenseMatrix(): Unsupported dense "
@@ -803,8 +862,41 @@ DirectMobilitySolver::factorizeDenseMatrix(double* mat_data,
 } // factorizeDenseMatrix
 
 void
-DirectMobilitySolver::computeSolution(Mat& mat, const MobilityMatrixInverseType& inv_type, int* ipiv, double* rhs)
+DirectMobilitySolver::factorizeHODLRMatrix(const HODLRMatrix::EntryFcn& entry,
+                                           const int mat_size,
+                                           const std::string& mat_name,
+                                           const std::string& err_msg)
+{
+    std::unique_ptr<HODLRMatrix>& hodlr_mat = d_hodlr_mat_map[mat_name];
+    hodlr_mat.reset(new HODLRMatrix(d_hodlr_leaf_size, d_hodlr_rel_tol, d_hodlr_max_rank));
+    hodlr_mat->compress(mat_size, entry);
+    hodlr_mat->factorize();
+
+    plog << "DirectMobilityMatrix::factorizeHODLRMatrix(): For " << err_msg << " matrix with handle " << mat_name
+         << " the HODLR approximation has maximum off-diagonal rank " << hodlr_mat->getMaxRank() << " and uses "
+         << hodlr_mat->getStorageSize() << " values." << std::endl;
+
+    return;
+} // factorizeHODLRMatrix
+
+void
+DirectMobilitySolver::computeSolution(Mat& mat,
+                                      const MobilityMatrixInverseType& inv_type,
+                                      int* ipiv,
+                                      double* rhs,
+                                      const HODLRMatrix* hodlr_mat)
 {
+    // The HODLR approximation does not need the dense matrix, which is not
+    // allocated unless the mobility matrix is read from a file.
+    if (inv_type == HODLR)
+    {
+#if !defined(NDEBUG)
+        TBOX_ASSERT(hodlr_mat);
+#endif
+        hodlr_mat->solve(rhs);
+        return;
+    }
+
     // Get pointer to matrix.
     int mat_size;
     double* mat_data = nullptr;
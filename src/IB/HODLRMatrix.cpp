@@ -0,0 +1,442 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibamr/HODLRMatrix.h"
+
+#include "tbox/Utilities.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <ostream>
+#include <vector>
+
+#include "ibamr/app_namespaces.h" // IWYU pragma: keep
+
+extern "C"
+{
+    // LAPACK function to do LU factorization.
+    int dgetrf_(const int& n1, const int& n2, double* a, const int& lda, int* ipiv, int& info);
+
+    // LAPACK function to find soultion using the LU factorization.
+    int dgetrs_(const char* trans,
+                const int& n,
+                const int& nrhs,
+                const double* a,
+                const int& lda,
+                const int* ipiv,
+                double* b,
+                const int& ldb,
+                int& info);
+
+    // BLAS function to compute C = alpha*op(A)*op(B) + beta*C.
+    void dgemm_(const char* transa,
+                const char* transb,
+                const int& m,
+                const int& n,
+                const int& k,
+                const double& alpha,
+                const double* a,
+                const int& lda,
+                const double* b,
+                const int& ldb,
+                const double& beta,
+                double* c,
+                const int& ldc);
+}
+
+namespace IBAMR
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// Compute C = alpha*op(A)*op(B) + beta*C, skipping empty products.
+inline void
+gemm(const char* transa,
+     const char* transb,
+     const int m,
+     const int n,
+     const int k,
+     const double alpha,
+     const double* a,
+     const int lda,
+     const double* b,
+     const int ldb,
+     const double beta,
+     double* c,
+     const int ldc)
+{
+    if (m == 0 || n == 0) return;
+    if (k == 0)
+    {
+        for (int j = 0; j < n; ++j)
+        {
+            for (int i = 0; i < m; ++i) c[j * ldc + i] = beta == 0.0 ? 0.0 : beta * c[j * ldc + i];
+        }
+        return;
+    }
+    dgemm_(transa, transb, m, n, k, alpha, a, std::max(lda, 1), b, std::max(ldb, 1), beta, c, std::max(ldc, 1));
+    return;
+} // gemm
+} // namespace
+
+struct HODLRMatrix::Node
+{
+    int size = 0;
+
+    // Children of the node. Both are null for leaf nodes.
+    std::unique_ptr<Node> left, right;
+
+    // Leaf nodes: the dense diagonal block and its LU factorization.
+    std::vector<double> D, D_lu;
+    std::vector<int> D_ipiv;
+
+    // Internal nodes: the off-diagonal blocks A12 = U12 V12^T and
+    // A21 = U21 V21^T, the solves Y12 = inv(A11) U12 and Y21 = inv(A22) U21,
+    // and the LU factorization of the Woodbury capacitance matrix
+    //
+    //     K = [ I             V12^T Y21 ]
+    //         [ V21^T Y12     I         ]
+    int r12 = 0, r21 = 0;
+    std::vector<double> U12, V12, U21, V21;
+    std::vector<double> Y12, Y21;
+    std::vector<double> K;
+    std::vector<int> K_ipiv;
+
+    bool isLeaf() const
+    {
+        return !left;
+    }
+};
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+HODLRMatrix::HODLRMatrix(const int leaf_size, const double rel_tol, const int max_rank)
+    : d_leaf_size(leaf_size), d_rel_tol(rel_tol), d_max_rank(max_rank)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_leaf_size > 0);
+    TBOX_ASSERT(d_rel_tol >= 0.0);
+    TBOX_ASSERT(d_max_rank > 0);
+#endif
+    return;
+} // HODLRMatrix
+
+HODLRMatrix::~HODLRMatrix() = default;
+
+void
+HODLRMatrix::compress(const int n, const EntryFcn& entry)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(n >= 0);
+#endif
+    d_size = n;
+    d_is_factorized = false;
+    d_root = n > 0 ? buildNode(0, n, entry) : nullptr;
+    return;
+} // compress
+
+void
+HODLRMatrix::factorize()
+{
+    if (d_root) factorizeNode(*d_root);
+    d_is_factorized = true;
+    return;
+} // factorize
+
+void
+HODLRMatrix::apply(const double* const x, double* const y) const
+{
+    if (d_root) applyNode(*d_root, x, y);
+    return;
+} // apply
+
+void
+HODLRMatrix::solve(double* const rhs) const
+{
+    if (!d_is_factorized)
+    {
+        TBOX_ERROR("HODLRMatrix::solve(): the matrix has not been factorized." << std::endl);
+    }
+    if (d_root) solveNode(*d_root, rhs, 1, d_size);
+    return;
+} // solve
+
+int
+HODLRMatrix::getSize() const
+{
+    return d_size;
+} // getSize
+
+int
+HODLRMatrix::getMaxRank() const
+{
+    int max_rank = 0;
+    std::vector<const Node*> nodes;
+    if (d_root) nodes.push_back(d_root.get());
+    while (!nodes.empty())
+    {
+        const Node* node = nodes.back();
+        nodes.pop_back();
+        if (node->isLeaf()) continue;
+        max_rank = std::max({ max_rank, node->r12, node->r21 });
+        nodes.push_back(node->left.get());
+        nodes.push_back(node->right.get());
+    }
+    return max_rank;
+} // getMaxRank
+
+std::size_t
+HODLRMatrix::getStorageSize() const
+{
+    std::size_t storage = 0;
+    std::vector<const Node*> nodes;
+    if (d_root) nodes.push_back(d_root.get());
+    while (!nodes.empty())
+    {
+        const Node* node = nodes.back();
+        nodes.pop_back();
+        storage += node->D.size() + node->D_lu.size() + node->U12.size() + node->V12.size() + node->U21.size() +
+                   node->V21.size() + node->Y12.size() + node->Y21.size() + node->K.size();
+        if (node->isLeaf()) continue;
+        nodes.push_back(node->left.get());
+        nodes.push_back(node->right.get());
+    }
+    return storage;
+} // getStorageSize
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+std::unique_ptr<HODLRMatrix::Node>
+HODLRMatrix::buildNode(const int begin, const int size, const EntryFcn& entry)
+{
+    std::unique_ptr<Node> node(new Node());
+    node->size = size;
+    if (size <= d_leaf_size)
+    {
+        node->D.resize(size * size);
+        for (int j = 0; j < size; ++j)
+        {
+            for (int i = 0; i < size; ++i)
+            {
+                node->D[j * size + i] = entry(begin + i, begin + j);
+            }
+        }
+        return node;
+    }
+
+    const int n1 = size / 2, n2 = size - n1;
+    node->left = buildNode(begin, n1, entry);
+    node->right = buildNode(begin + n1, n2, entry);
+    compressBlock(begin, n1, begin + n1, n2, entry, node->r12, node->U12, node->V12);
+    compressBlock(begin + n1, n2, begin, n1, entry, node->r21, node->U21, node->V21);
+    return node;
+} // buildNode
+
+void
+HODLRMatrix::compressBlock(const int row_begin,
+                           const int m,
+                           const int col_begin,
+                           const int n,
+                           const EntryFcn& entry,
+                           int& rank,
+                           std::vector<double>& U,
+                           std::vector<double>& V) const
+{
+    // Adaptive cross approximation with partial pivoting: the block is
+    // approximated by sum_k u_k v_k^T, where the crosses are chosen from the
+    // rows and columns of the residual block.
+    rank = 0;
+    U.clear();
+    V.clear();
+    const int max_rank = std::min({ d_max_rank, m, n });
+    std::vector<bool> used_rows(m, false);
+    std::vector<double> row(n), col(m);
+    double frob_norm_sq = 0.0;
+    int pivot_row = 0;
+    while (rank < max_rank)
+    {
+        // Compute the pivot row of the residual.
+        used_rows[pivot_row] = true;
+        for (int j = 0; j < n; ++j)
+        {
+            row[j] = entry(row_begin + pivot_row, col_begin + j);
+            for (int k = 0; k < rank; ++k) row[j] -= U[k * m + pivot_row] * V[k * n + j];
+        }
+        int pivot_col = 0;
+        for (int j = 1; j < n; ++j)
+        {
+            if (std::abs(row[j]) > std::abs(row[pivot_col])) pivot_col = j;
+        }
+
+        // Skip rows of the residual that vanish.
+        if (row[pivot_col] == 0.0)
+        {
+            const auto it = std::find(used_rows.begin(), used_rows.end(), false);
+            if (it == used_rows.end()) break;
+            pivot_row = static_cast<int>(it - used_rows.begin());
+            continue;
+        }
+
+        // Compute the pivot column of the residual.
+        for (int i = 0; i < m; ++i)
+        {
+            col[i] = entry(row_begin + i, col_begin + pivot_col);
+            for (int k = 0; k < rank; ++k) col[i] -= U[k * m + i] * V[k * n + pivot_col];
+        }
+        const double inv_pivot = 1.0 / row[pivot_col];
+        for (int j = 0; j < n; ++j) row[j] *= inv_pivot;
+
+        // Update the estimate of the Frobenius norm of the approximation.
+        double u_norm_sq = 0.0, v_norm_sq = 0.0;
+        for (int i = 0; i < m; ++i) u_norm_sq += col[i] * col[i];
+        for (int j = 0; j < n; ++j) v_norm_sq += row[j] * row[j];
+        for (int k = 0; k < rank; ++k)
+        {
+            double uu = 0.0, vv = 0.0;
+            for (int i = 0; i < m; ++i) uu += col[i] * U[k * m + i];
+            for (int j = 0; j < n; ++j) vv += row[j] * V[k * n + j];
+            frob_norm_sq += 2.0 * uu * vv;
+        }
+        frob_norm_sq += u_norm_sq * v_norm_sq;
+        U.insert(U.end(), col.begin(), col.end());
+        V.insert(V.end(), row.begin(), row.end());
+        ++rank;
+
+        // Stop when the last cross is small relative to the approximation.
+        if (std::sqrt(u_norm_sq * v_norm_sq) <= d_rel_tol * std::sqrt(std::abs(frob_norm_sq))) break;
+
+        // The next pivot row is the one in which the last column is largest.
+        pivot_row = -1;
+        for (int i = 0; i < m; ++i)
+        {
+            if (used_rows[i]) continue;
+            if (pivot_row < 0 || std::abs(col[i]) > std::abs(col[pivot_row])) pivot_row = i;
+        }
+        if (pivot_row < 0) break;
+    }
+    return;
+} // compressBlock
+
+void
+HODLRMatrix::factorizeNode(Node& node)
+{
+    int err = 0;
+    if (node.isLeaf())
+    {
+        const int n = node.size;
+        node.D_lu = node.D;
+        node.D_ipiv.resize(n);
+        dgetrf_(n, n, node.D_lu.data(), n, node.D_ipiv.data(), err);
+        if (err)
+        {
+            TBOX_ERROR("HODLRMatrix::factorizeNode(): LU factorization of a diagonal block of size "
+                       << n << " failed with error code " << err << std::endl);
+        }
+        return;
+    }
+
+    factorizeNode(*node.left);
+    factorizeNode(*node.right);
+    const int n1 = node.left->size, n2 = node.right->size;
+    const int r12 = node.r12, r21 = node.r21, r = r12 + r21;
+
+    // Y12 = inv(A11) U12 and Y21 = inv(A22) U21.
+    node.Y12 = node.U12;
+    node.Y21 = node.U21;
+    if (r12 > 0) solveNode(*node.left, node.Y12.data(), r12, n1);
+    if (r21 > 0) solveNode(*node.right, node.Y21.data(), r21, n2);
+
+    // Form and factorize the capacitance matrix.
+    node.K.assign(r * r, 0.0);
+    node.K_ipiv.resize(r);
+    if (r == 0) return;
+    for (int k = 0; k < r; ++k) node.K[k * r + k] = 1.0;
+    gemm("T", "N", r12, r21, n2, 1.0, node.V12.data(), n2, node.Y21.data(), n2, 0.0, &node.K[r12 * r], r);
+    gemm("T", "N", r21, r12, n1, 1.0, node.V21.data(), n1, node.Y12.data(), n1, 0.0, &node.K[r12], r);
+    dgetrf_(r, r, node.K.data(), r, node.K_ipiv.data(), err);
+    if (err)
+    {
+        TBOX_ERROR("HODLRMatrix::factorizeNode(): LU factorization of the capacitance matrix of size "
+                   << r << " failed with error code " << err << std::endl);
+    }
+    return;
+} // factorizeNode
+
+void
+HODLRMatrix::applyNode(const Node& node, const double* const x, double* const y) const
+{
+    if (node.isLeaf())
+    {
+        gemm("N", "N", node.size, 1, node.size, 1.0, node.D.data(), node.size, x, node.size, 0.0, y, node.size);
+        return;
+    }
+
+    const int n1 = node.left->size, n2 = node.right->size;
+    applyNode(*node.left, x, y);
+    applyNode(*node.right, x + n1, y + n1);
+    std::vector<double> w(std::max(node.r12, node.r21));
+    gemm("T", "N", node.r12, 1, n2, 1.0, node.V12.data(), n2, x + n1, n2, 0.0, w.data(), node.r12);
+    gemm("N", "N", n1, 1, node.r12, 1.0, node.U12.data(), n1, w.data(), node.r12, 1.0, y, n1);
+    gemm("T", "N", node.r21, 1, n1, 1.0, node.V21.data(), n1, x, n1, 0.0, w.data(), node.r21);
+    gemm("N", "N", n2, 1, node.r21, 1.0, node.U21.data(), n2, w.data(), node.r21, 1.0, y + n1, n2);
+    return;
+} // applyNode
+
+void
+HODLRMatrix::solveNode(const Node& node, double* const rhs, const int nrhs, const int ld) const
+{
+    int err = 0;
+    if (node.isLeaf())
+    {
+        dgetrs_("N", node.size, nrhs, node.D_lu.data(), node.size, node.D_ipiv.data(), rhs, ld, err);
+        if (err)
+        {
+            TBOX_ERROR("HODLRMatrix::solveNode(): LU solve failed with error code " << err << std::endl);
+        }
+        return;
+    }
+
+    // Solve with the block diagonal part: z = inv(D) rhs.
+    const int n1 = node.left->size;
+    const int r12 = node.r12, r21 = node.r21, r = r12 + r21;
+    double* const z1 = rhs;
+    double* const z2 = rhs + n1;
+    solveNode(*node.left, z1, nrhs, ld);
+    solveNode(*node.right, z2, nrhs, ld);
+    if (r == 0) return;
+
+    // Apply the Woodbury correction: x = z - Y inv(K) W z.
+    const int n2 = node.right->size;
+    std::vector<double> w(r * nrhs);
+    gemm("T", "N", r12, nrhs, n2, 1.0, node.V12.data(), n2, z2, ld, 0.0, w.data(), r);
+    gemm("T", "N", r21, nrhs, n1, 1.0, node.V21.data(), n1, z1, ld, 0.0, w.data() + r12, r);
+    dgetrs_("N", r, nrhs, node.K.data(), r, node.K_ipiv.data(), w.data(), r, err);
+    if (err)
+    {
+        TBOX_ERROR("HODLRMatrix::solveNode(): capacitance matrix solve failed with error code " << err << std::endl);
+    }
+    gemm("N", "N", n1, nrhs, r12, -1.0, node.Y12.data(), n1, w.data(), r, 1.0, z1, ld);
+    gemm("N", "N", n2, nrhs, r21, -1.0, node.Y21.data(), n2, w.data() + r12, r, 1.0, z2, ld);
+    return;
+} // solveNode
+
+//////////////////////////////////////////////////////////////////////////////
+
+} // namespace IBAMR
+
+//////////////////////////////////////////////////////////////////////////////
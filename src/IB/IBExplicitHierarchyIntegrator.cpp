@@ -21,6 +21,7 @@
 
 #include "ibtk/CartGridFunction.h"
 #include "ibtk/IBTK_MPI.h"
+#include "ibtk/PatchDataMemoryPool.h"
 #include "ibtk/RobinPhysBdryPatchStrategy.h"
 #include "ibtk/ibtk_enums.h"
 
@@ -119,8 +120,8 @@ IBExplicitHierarchyIntegrator::preprocessIntegrateHierarchy(const double current
             level->allocatePatchData(d_p_idx, current_time);
             level->allocatePatchData(d_q_idx, current_time);
         }
-        level->allocatePatchData(d_scratch_data, current_time);
-        level->allocatePatchData(d_new_data, new_time);
+        level->allocatePatchData(d_scratch_data, current_time, PatchDataMemoryPool::getArena());
+        level->allocatePatchData(d_new_data, new_time, PatchDataMemoryPool::getArena());
     }
 
     // Initialize IB data.
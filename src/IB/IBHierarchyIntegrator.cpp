@@ -27,6 +27,7 @@
 #include "ibtk/IBTK_MPI.h"
 #include "ibtk/LMarkerSetVariable.h"
 #include "ibtk/LMarkerUtilities.h"
+#include "ibtk/PatchDataMemoryPool.h"
 #include "ibtk/RobinPhysBdryPatchStrategy.h"
 #include "ibtk/ibtk_utilities.h"
 
@@ -470,7 +471,7 @@ IBHierarchyIntegrator::initializePatchHierarchy(Pointer<PatchHierarchy<NDIM> > h
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
         level->allocatePatchData(d_u_idx, d_integrator_time);
-        level->allocatePatchData(d_scratch_data, d_integrator_time);
+        level->allocatePatchData(d_scratch_data, d_integrator_time, PatchDataMemoryPool::getArena());
     }
     VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
     const int u_current_idx = var_db->mapVariableAndContextToIndex(d_u_var, getCurrentContext());
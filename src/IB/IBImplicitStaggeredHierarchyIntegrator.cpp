@@ -32,6 +32,7 @@
 #include "ibtk/IBTK_MPI.h"
 #include "ibtk/KrylovLinearSolver.h"
 #include "ibtk/PETScSAMRAIVectorReal.h"
+#include "ibtk/PatchDataMemoryPool.h"
 #include "ibtk/RobinPhysBdryPatchStrategy.h"
 #include "ibtk/ibtk_enums.h"
 
@@ -205,8 +206,8 @@ IBImplicitStaggeredHierarchyIntegrator::preprocessIntegrateHierarchy(const doubl
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
         level->allocatePatchData(d_u_idx, current_time);
         level->allocatePatchData(d_f_idx, current_time);
-        level->allocatePatchData(d_scratch_data, current_time);
-        level->allocatePatchData(d_new_data, new_time);
+        level->allocatePatchData(d_scratch_data, current_time, PatchDataMemoryPool::getArena());
+        level->allocatePatchData(d_new_data, new_time, PatchDataMemoryPool::getArena());
         if (!d_solve_for_position && ln == finest_ln)
         {
             level->allocatePatchData(d_u_dof_index_idx, current_time);
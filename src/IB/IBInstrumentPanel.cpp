@@ -26,20 +26,19 @@
 #include "ibtk/LNode.h"
 #include "ibtk/ibtk_utilities.h"
 
+#include "ArrayData.h"
 #include "BasePatchLevel.h"
 #include "Box.h"
 #include "BoxArray.h"
 #include "CartesianGridGeometry.h"
 #include "CartesianPatchGeometry.h"
 #include "CellData.h"
-#include "CellIndex.h"
 #include "Index.h"
 #include "IntVector.h"
 #include "Patch.h"
 #include "PatchHierarchy.h"
 #include "PatchLevel.h"
 #include "SideData.h"
-#include "SideIndex.h"
 #include "tbox/Database.h"
 #include "tbox/MathUtilities.h"
 #include "tbox/PIO.h"
@@ -302,193 +301,74 @@ build_meter_web(DBfile* dbfile,
 } // build_meter_web
 #endif
 
-double
-linear_interp(const Point& X,
-              const hier::Index<NDIM>& i_cell,
-              const Point& X_cell,
-              const CellData<NDIM, double>& v,
-              const hier::Index<NDIM>& /*patch_lower*/,
-              const hier::Index<NDIM>& /*patch_upper*/,
-              const double* const /*x_lower*/,
-              const double* const /*x_upper*/,
-              const double* const dx)
+// Compute the lower corner and the one-dimensional weights of the linear
+// interpolation stencil for the point X in the cell i_cell, whose center is
+// X_cell.  If axis is negative, the stencil interpolates cell-centered data;
+// otherwise, it interpolates the side-centered data of the specified component.
+void
+init_linear_stencil(hier::Index<NDIM>& lower,
+                    std::array<std::array<double, 2>, NDIM>& wgt,
+                    const Point& X,
+                    const hier::Index<NDIM>& i_cell,
+                    const Point& X_cell,
+                    const double* const dx,
+                    const int axis = -1)
 {
-    std::array<bool, NDIM> is_lower;
-    for (unsigned int d = 0; d < NDIM; ++d)
-    {
-        is_lower[d] = X[d] < X_cell[d];
-    }
-    double U = 0.0;
-#if (NDIM == 3)
-    for (int i_shift2 = (is_lower[2] ? -1 : 0); i_shift2 <= (is_lower[2] ? 0 : 1); ++i_shift2)
+    for (int d = 0; d < NDIM; ++d)
     {
-#endif
-        for (int i_shift1 = (is_lower[1] ? -1 : 0); i_shift1 <= (is_lower[1] ? 0 : 1); ++i_shift1)
+        double offset;
+        if (d == axis)
         {
-            for (int i_shift0 = (is_lower[0] ? -1 : 0); i_shift0 <= (is_lower[0] ? 0 : 1); ++i_shift0)
-            {
-                const Point X_center(X_cell[0] + static_cast<double>(i_shift0) * dx[0],
-                                     X_cell[1] + static_cast<double>(i_shift1) * dx[1]
-#if (NDIM == 3)
-                                     ,
-                                     X_cell[2] + static_cast<double>(i_shift2) * dx[2]
-#endif
-                );
-                const double wgt =
-                    (((X[0] < X_center[0] ? X[0] - (X_center[0] - dx[0]) : (X_center[0] + dx[0]) - X[0]) / dx[0]) *
-                     ((X[1] < X_center[1] ? X[1] - (X_center[1] - dx[1]) : (X_center[1] + dx[1]) - X[1]) / dx[1])
-#if (NDIM == 3)
-                     * ((X[2] < X_center[2] ? X[2] - (X_center[2] - dx[2]) : (X_center[2] + dx[2]) - X[2]) / dx[2])
-#endif
-                    );
-                const hier::Index<NDIM> i(i_shift0 + i_cell(0),
-                                          i_shift1 + i_cell(1)
-#if (NDIM == 3)
-                                              ,
-                                          i_shift2 + i_cell(2)
-#endif
-                );
-                const CellIndex<NDIM> i_c(i);
-                U += v(i_c) * wgt;
-            }
+            lower(d) = i_cell(d);
+            offset = -0.5;
+        }
+        else
+        {
+            const int shift = X[d] < X_cell[d] ? -1 : 0;
+            lower(d) = i_cell(d) + shift;
+            offset = static_cast<double>(shift);
+        }
+        for (int k = 0; k < 2; ++k)
+        {
+            const double X_center = X_cell[d] + (offset + static_cast<double>(k)) * dx[d];
+            wgt[d][k] = (X[d] < X_center ? X[d] - (X_center - dx[d]) : (X_center + dx[d]) - X[d]) / dx[d];
         }
-#if (NDIM == 3)
     }
-#endif
-    return U;
-} // linear_interp
-
-template <int N>
-Eigen::Matrix<double, N, 1>
-linear_interp(const Point& X,
-              const hier::Index<NDIM>& i_cell,
-              const Point& X_cell,
-              const CellData<NDIM, double>& v,
-              const hier::Index<NDIM>& /*patch_lower*/,
-              const hier::Index<NDIM>& /*patch_upper*/,
-              const double* const /*x_lower*/,
-              const double* const /*x_upper*/,
-              const double* const dx)
+    return;
+} // init_linear_stencil
+
+// Apply a linear interpolation stencil to the specified component of the data.
+double
+apply_linear_stencil(const ArrayData<NDIM, double>& v,
+                     const int depth,
+                     const hier::Index<NDIM>& lower,
+                     const std::array<std::array<double, 2>, NDIM>& wgt)
 {
-#if !defined(NDEBUG)
-    TBOX_ASSERT(v.getDepth() == N);
-#endif
-    std::array<bool, NDIM> is_lower;
-    for (unsigned int d = 0; d < NDIM; ++d)
-    {
-        is_lower[d] = X[d] < X_cell[d];
-    }
-    Eigen::Matrix<double, N, 1> U(Eigen::Matrix<double, N, 1>::Zero());
+    double U = 0.0;
+    hier::Index<NDIM> i;
 #if (NDIM == 3)
-    for (int i_shift2 = (is_lower[2] ? -1 : 0); i_shift2 <= (is_lower[2] ? 0 : 1); ++i_shift2)
+    for (int k2 = 0; k2 < 2; ++k2)
     {
+        i(2) = lower(2) + k2;
 #endif
-        for (int i_shift1 = (is_lower[1] ? -1 : 0); i_shift1 <= (is_lower[1] ? 0 : 1); ++i_shift1)
+        for (int k1 = 0; k1 < 2; ++k1)
         {
-            for (int i_shift0 = (is_lower[0] ? -1 : 0); i_shift0 <= (is_lower[0] ? 0 : 1); ++i_shift0)
+            i(1) = lower(1) + k1;
+            for (int k0 = 0; k0 < 2; ++k0)
             {
-                const Point X_center(X_cell[0] + static_cast<double>(i_shift0) * dx[0],
-                                     X_cell[1] + static_cast<double>(i_shift1) * dx[1]
-#if (NDIM == 3)
-                                     ,
-                                     X_cell[2] + static_cast<double>(i_shift2) * dx[2]
-#endif
-                );
-                const double wgt =
-                    (((X[0] < X_center[0] ? X[0] - (X_center[0] - dx[0]) : (X_center[0] + dx[0]) - X[0]) / dx[0]) *
-                     ((X[1] < X_center[1] ? X[1] - (X_center[1] - dx[1]) : (X_center[1] + dx[1]) - X[1]) / dx[1])
-#if (NDIM == 3)
-                     * ((X[2] < X_center[2] ? X[2] - (X_center[2] - dx[2]) : (X_center[2] + dx[2]) - X[2]) / dx[2])
-#endif
-                    );
-                const hier::Index<NDIM> i(i_shift0 + i_cell(0),
-                                          i_shift1 + i_cell(1)
+                i(0) = lower(0) + k0;
+                U += v(i, depth) * (wgt[0][k0] * wgt[1][k1]
 #if (NDIM == 3)
-                                              ,
-                                          i_shift2 + i_cell(2)
+                                    * wgt[2][k2]
 #endif
-                );
-                const CellIndex<NDIM> i_c(i);
-                for (int k = 0; k < N; ++k)
-                {
-                    U[k] += v(i_c, k) * wgt;
-                }
+                                   );
             }
         }
 #if (NDIM == 3)
     }
 #endif
     return U;
-} // linear_interp
-
-Vector
-linear_interp(const Point& X,
-              const hier::Index<NDIM>& i_cell,
-              const Point& X_cell,
-              const SideData<NDIM, double>& v,
-              const hier::Index<NDIM>& /*patch_lower*/,
-              const hier::Index<NDIM>& /*patch_upper*/,
-              const double* const /*x_lower*/,
-              const double* const /*x_upper*/,
-              const double* const dx)
-{
-#if !defined(NDEBUG)
-    TBOX_ASSERT(v.getDepth() == 1);
-#endif
-    Vector U(Vector::Zero());
-    for (unsigned int axis = 0; axis < NDIM; ++axis)
-    {
-        std::array<bool, NDIM> is_lower;
-        for (unsigned int d = 0; d < NDIM; ++d)
-        {
-            if (d == axis)
-            {
-                is_lower[d] = false;
-            }
-            else
-            {
-                is_lower[d] = X[d] < X_cell[d];
-            }
-        }
-#if (NDIM == 3)
-        for (int i_shift2 = (is_lower[2] ? -1 : 0); i_shift2 <= (is_lower[2] ? 0 : 1); ++i_shift2)
-        {
-#endif
-            for (int i_shift1 = (is_lower[1] ? -1 : 0); i_shift1 <= (is_lower[1] ? 0 : 1); ++i_shift1)
-            {
-                for (int i_shift0 = (is_lower[0] ? -1 : 0); i_shift0 <= (is_lower[0] ? 0 : 1); ++i_shift0)
-                {
-                    const Point X_side(X_cell[0] + (static_cast<double>(i_shift0) + (axis == 0 ? -0.5 : 0.0)) * dx[0],
-                                       X_cell[1] + (static_cast<double>(i_shift1) + (axis == 1 ? -0.5 : 0.0)) * dx[1]
-#if (NDIM == 3)
-                                       ,
-                                       X_cell[2] + (static_cast<double>(i_shift2) + (axis == 2 ? -0.5 : 0.0)) * dx[2]
-#endif
-                    );
-                    const double wgt =
-                        (((X[0] < X_side[0] ? X[0] - (X_side[0] - dx[0]) : (X_side[0] + dx[0]) - X[0]) / dx[0]) *
-                         ((X[1] < X_side[1] ? X[1] - (X_side[1] - dx[1]) : (X_side[1] + dx[1]) - X[1]) / dx[1])
-#if (NDIM == 3)
-                         * ((X[2] < X_side[2] ? X[2] - (X_side[2] - dx[2]) : (X_side[2] + dx[2]) - X[2]) / dx[2])
-#endif
-                        );
-                    const hier::Index<NDIM> i(i_shift0 + i_cell(0),
-                                              i_shift1 + i_cell(1)
-#if (NDIM == 3)
-                                                  ,
-                                              i_shift2 + i_cell(2)
-#endif
-                    );
-                    const SideIndex<NDIM> i_s(i, axis, SideIndex<NDIM>::Lower);
-                    U[axis] += v(i_s) * wgt;
-                }
-            }
-#if (NDIM == 3)
-        }
-#endif
-    }
-    return U;
-} // linear_interp
+} // apply_linear_stencil
 } // namespace
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -760,6 +640,16 @@ IBInstrumentPanel::initializeHierarchyDependentData(const Pointer<PatchHierarchy
         }
     }
     IBTK_MPI::sumReduction(&X_perimeter_flattened[0], static_cast<int>(X_perimeter_flattened.size()));
+
+    // The meter webs and their interpolation stencils only need to be rebuilt
+    // if the patch hierarchy has changed or if the meters have moved since they
+    // were last built.
+    if (!d_web_data_is_stale && X_perimeter_flattened == d_web_X_perimeter)
+    {
+        IBAMR_TIMER_STOP(t_initialize_hierarchy_dependent_data);
+        return;
+    }
+    d_web_X_perimeter = X_perimeter_flattened;
     for (unsigned int m = 0, k = 0; m < d_num_meters; ++m)
     {
         for (int n = 0; n < d_num_perimeter_nodes[m]; ++n, ++k)
@@ -821,8 +711,8 @@ IBInstrumentPanel::initializeHierarchyDependentData(const Pointer<PatchHierarchy
         init_meter_elements(d_X_web[m], d_dA_web[m], d_X_perimeter[m], d_X_centroid[m]);
     }
 
-    // Setup the mappings from cell indices to the web patch and web centroid
-    // data.
+    // Setup the interpolation stencils of the web patches and web centroids
+    // that are located in the local patches.
     //
     // NOTE: Each meter web patch/centroid is assigned to precisely one
     // Cartesian grid cell in precisely one level.  In particular, each web
@@ -860,58 +750,90 @@ IBInstrumentPanel::initializeHierarchyDependentData(const Pointer<PatchHierarchy
             finer_dx[d] = dx_coarsest[d] / static_cast<double>(finer_ratio(d));
         }
 
-        for (unsigned int l = 0; l < d_num_meters; ++l)
-        {
-            // Setup the web patch mapping.
-            for (unsigned int m = 0; m < d_X_web[l].shape()[0]; ++m)
+        // Determine the local patch (if any) in which the point X is located
+        // on this level, and compute the center of the cell that contains X.
+        auto find_local_patch = [&](const Point& X, hier::Index<NDIM>& i, Point& X_cell) {
+            i = IndexUtilities::getCellIndex(
+                X, domainXLower, domainXUpper, dx.data(), domain_box_level_lower, domain_box_level_upper);
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
             {
-                for (unsigned int n = 0; n < d_X_web[l].shape()[1]; ++n)
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                const Box<NDIM>& patch_box = patch->getBox();
+                if (!patch_box.contains(i)) continue;
+                if (ln < finest_ln)
                 {
-                    const Point& X = d_X_web[l][m][n];
-                    const hier::Index<NDIM> i = IndexUtilities::getCellIndex(
-                        X, domainXLower, domainXUpper, dx.data(), domain_box_level_lower, domain_box_level_upper);
                     const hier::Index<NDIM> finer_i = IndexUtilities::getCellIndex(X,
                                                                                    domainXLower,
                                                                                    domainXUpper,
                                                                                    finer_dx.data(),
                                                                                    finer_domain_box_level_lower,
                                                                                    finer_domain_box_level_upper);
-                    if (level->getBoxes().contains(i) &&
-                        (ln == finest_ln || !finer_level->getBoxes().contains(finer_i)))
+                    if (finer_level->getBoxes().contains(finer_i)) return -1;
+                }
+                const hier::Index<NDIM>& patch_lower = patch_box.lower();
+                const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+                const double* const x_lower = pgeom->getXLower();
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    X_cell[d] = x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
+                }
+                return p();
+            }
+            return -1;
+        };
+
+        for (unsigned int l = 0; l < d_num_meters; ++l)
+        {
+            hier::Index<NDIM> i;
+            Point X_cell;
+
+            // Setup the web patch stencils.
+            for (unsigned int m = 0; m < d_X_web[l].shape()[0]; ++m)
+            {
+                for (unsigned int n = 0; n < d_X_web[l].shape()[1]; ++n)
+                {
+                    const Point& X = d_X_web[l][m][n];
+                    const int patch_num = find_local_patch(X, i, X_cell);
+                    if (patch_num < 0) continue;
+                    WebPatch p;
+                    p.meter_num = l;
+                    p.dA = &d_dA_web[l][m][n];
+                    init_linear_stencil(p.cc_stencil.lower, p.cc_stencil.wgt, X, i, X_cell, dx.data());
+                    for (unsigned int axis = 0; axis < NDIM; ++axis)
                     {
-                        WebPatch p;
-                        p.meter_num = l;
-                        p.X = &d_X_web[l][m][n];
-                        p.dA = &d_dA_web[l][m][n];
-                        d_web_patch_map[ln].insert(std::make_pair(i, p));
+                        init_linear_stencil(
+                            p.sc_stencil[axis].lower, p.sc_stencil[axis].wgt, X, i, X_cell, dx.data(), axis);
                     }
+                    d_web_patch_map[ln][patch_num].push_back(p);
                 }
             }
 
-            // Setup the web centroid mapping.
+            // Setup the web centroid stencil.
             const Point& X = d_X_centroid[l];
-            const hier::Index<NDIM> i = IndexUtilities::getCellIndex(
-                X, domainXLower, domainXUpper, dx.data(), domain_box_level_lower, domain_box_level_upper);
-            const hier::Index<NDIM> finer_i = IndexUtilities::getCellIndex(X,
-                                                                           domainXLower,
-                                                                           domainXUpper,
-                                                                           finer_dx.data(),
-                                                                           finer_domain_box_level_lower,
-                                                                           finer_domain_box_level_upper);
-            if (level->getBoxes().contains(i) && (ln == finest_ln || !finer_level->getBoxes().contains(finer_i)))
+            const int patch_num = find_local_patch(X, i, X_cell);
+            if (patch_num >= 0)
             {
                 WebCentroid c;
                 c.meter_num = l;
-                c.X = &d_X_centroid[l];
-                d_web_centroid_map[ln].insert(std::make_pair(i, c));
+                init_linear_stencil(c.cc_stencil.lower, c.cc_stencil.wgt, X, i, X_cell, dx.data());
+                d_web_centroid_map[ln][patch_num].push_back(c);
             }
         }
     }
 
+    d_web_data_is_stale = false;
+
     IBAMR_TIMER_STOP(t_initialize_hierarchy_dependent_data);
     return;
 } // initializeHierarchyDependentData
 
+void
+IBInstrumentPanel::invalidateHierarchyDependentData()
+{
+    d_web_data_is_stale = true;
+    return;
+} // invalidateHierarchyDependentData
+
 void
 IBInstrumentPanel::readInstrumentData(const int U_data_idx,
                                       const int P_data_idx,
@@ -952,101 +874,68 @@ IBInstrumentPanel::readInstrumentData(const int U_data_idx,
     // Compute the local contributions to the flux of U through the flow meter,
     // the average value of P in the flow meter, and the pointwise value of P at
     // the centroid of the meter.
+    //
+    // NOTE: Only the local patches that contain web patches or web centroids
+    // are visited, and the interpolation stencils are precomputed by
+    // initializeHierarchyDependentData().
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        for (const auto& patch_web_patches : d_web_patch_map[ln])
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-            const Box<NDIM>& patch_box = patch->getBox();
-            const hier::Index<NDIM>& patch_lower = patch_box.lower();
-            const hier::Index<NDIM>& patch_upper = patch_box.upper();
-
-            const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
-            const double* const x_lower = pgeom->getXLower();
-            const double* const x_upper = pgeom->getXUpper();
-            const double* const dx = pgeom->getDx();
-
+            Pointer<Patch<NDIM> > patch = level->getPatch(patch_web_patches.first);
             Pointer<CellData<NDIM, double> > U_cc_data = patch->getPatchData(U_data_idx);
             Pointer<SideData<NDIM, double> > U_sc_data = patch->getPatchData(U_data_idx);
             Pointer<CellData<NDIM, double> > P_cc_data = patch->getPatchData(P_data_idx);
-
-            for (Box<NDIM>::Iterator b(patch_box); b; b++)
+#if !defined(NDEBUG)
+            if (U_cc_data) TBOX_ASSERT(U_cc_data->getDepth() == NDIM);
+            if (U_sc_data) TBOX_ASSERT(U_sc_data->getDepth() == 1);
+            if (P_cc_data) TBOX_ASSERT(P_cc_data->getDepth() == 1);
+#endif
+            for (const WebPatch& web_patch : patch_web_patches.second)
             {
-                const hier::Index<NDIM>& i = b();
-                std::pair<WebPatchMap::const_iterator, WebPatchMap::const_iterator> patch_range =
-                    d_web_patch_map[ln].equal_range(i);
-                if (patch_range.first != patch_range.second)
+                const int meter_num = web_patch.meter_num;
+                const Vector& dA = *web_patch.dA;
+                if (U_cc_data)
                 {
-                    const Point X_cell(x_lower[0] + dx[0] * (static_cast<double>(i(0) - patch_lower(0)) + 0.5),
-                                       x_lower[1] + dx[1] * (static_cast<double>(i(1) - patch_lower(1)) + 0.5)
-#if (NDIM == 3)
-                                           ,
-                                       x_lower[2] + dx[2] * (static_cast<double>(i(2) - patch_lower(2)) + 0.5)
-#endif
-                    );
-                    if (U_cc_data)
+                    Vector U;
+                    for (unsigned int d = 0; d < NDIM; ++d)
                     {
-                        for (auto it = patch_range.first; it != patch_range.second; ++it)
-                        {
-                            const int& meter_num = it->second.meter_num;
-                            const Point& X = *(it->second.X);
-                            const Vector& dA = *(it->second.dA);
-                            const Vector U = linear_interp<NDIM>(
-                                X, i, X_cell, *U_cc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
-                            d_flow_values[meter_num] += U.dot(dA);
-                        }
-                    }
-                    if (U_sc_data)
-                    {
-                        for (auto it = patch_range.first; it != patch_range.second; ++it)
-                        {
-                            const int& meter_num = it->second.meter_num;
-                            const Point& X = *(it->second.X);
-                            const Vector& dA = *(it->second.dA);
-                            const Vector U =
-                                linear_interp(X, i, X_cell, *U_sc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
-                            d_flow_values[meter_num] += U.dot(dA);
-                        }
-                    }
-                    if (P_cc_data)
-                    {
-                        for (auto it = patch_range.first; it != patch_range.second; ++it)
-                        {
-                            const int& meter_num = it->second.meter_num;
-                            const Point& X = *(it->second.X);
-                            const Vector& dA = *(it->second.dA);
-                            double P =
-                                linear_interp(X, i, X_cell, *P_cc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
-                            d_mean_pres_values[meter_num] += P * dA.norm();
-                            A[meter_num] += dA.norm();
-                        }
+                        U[d] = apply_linear_stencil(
+                            U_cc_data->getArrayData(), d, web_patch.cc_stencil.lower, web_patch.cc_stencil.wgt);
                     }
+                    d_flow_values[meter_num] += U.dot(dA);
                 }
-
-                std::pair<WebCentroidMap::const_iterator, WebCentroidMap::const_iterator> centroid_range =
-                    d_web_centroid_map[ln].equal_range(i);
-                if (centroid_range.first != centroid_range.second)
+                if (U_sc_data)
                 {
-                    const Point X_cell(x_lower[0] + dx[0] * (static_cast<double>(i(0) - patch_lower(0)) + 0.5),
-                                       x_lower[1] + dx[1] * (static_cast<double>(i(1) - patch_lower(1)) + 0.5)
-#if (NDIM == 3)
-                                           ,
-                                       x_lower[2] + dx[2] * (static_cast<double>(i(2) - patch_lower(2)) + 0.5)
-#endif
-                    );
-                    if (P_cc_data)
+                    Vector U;
+                    for (unsigned int axis = 0; axis < NDIM; ++axis)
                     {
-                        for (auto it = centroid_range.first; it != centroid_range.second; ++it)
-                        {
-                            const int& meter_num = it->second.meter_num;
-                            const Point& X = *(it->second.X);
-                            const double P =
-                                linear_interp(X, i, X_cell, *P_cc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
-                            d_point_pres_values[meter_num] = P;
-                        }
+                        U[axis] = apply_linear_stencil(U_sc_data->getArrayData(axis),
+                                                       0,
+                                                       web_patch.sc_stencil[axis].lower,
+                                                       web_patch.sc_stencil[axis].wgt);
                     }
+                    d_flow_values[meter_num] += U.dot(dA);
                 }
+                if (P_cc_data)
+                {
+                    const double P = apply_linear_stencil(
+                        P_cc_data->getArrayData(), 0, web_patch.cc_stencil.lower, web_patch.cc_stencil.wgt);
+                    d_mean_pres_values[meter_num] += P * dA.norm();
+                    A[meter_num] += dA.norm();
+                }
+            }
+        }
+        for (const auto& patch_web_centroids : d_web_centroid_map[ln])
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(patch_web_centroids.first);
+            Pointer<CellData<NDIM, double> > P_cc_data = patch->getPatchData(P_data_idx);
+            if (!P_cc_data) continue;
+            for (const WebCentroid& web_centroid : patch_web_centroids.second)
+            {
+                d_point_pres_values[web_centroid.meter_num] = apply_linear_stencil(
+                    P_cc_data->getArrayData(), 0, web_centroid.cc_stencil.lower, web_centroid.cc_stencil.wgt);
             }
         }
     }
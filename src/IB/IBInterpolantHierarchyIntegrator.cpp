@@ -24,6 +24,7 @@
 
 #include "ibtk/CartGridFunction.h"
 #include "ibtk/IBTK_MPI.h"
+#include "ibtk/PatchDataMemoryPool.h"
 #include "ibtk/ibtk_enums.h"
 
 #include "CartesianPatchGeometry.h"
@@ -112,8 +113,8 @@ IBInterpolantHierarchyIntegrator::preprocessIntegrateHierarchy(const double curr
     for (int level_num = coarsest_level_num; level_num <= finest_level_num; ++level_num)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_num);
-        level->allocatePatchData(d_scratch_data, current_time);
-        level->allocatePatchData(d_new_data, new_time);
+        level->allocatePatchData(d_scratch_data, current_time, PatchDataMemoryPool::getArena());
+        level->allocatePatchData(d_new_data, new_time, PatchDataMemoryPool::getArena());
     }
 
     // Initialize IB data.
@@ -1589,6 +1589,9 @@ IBMethod::resetHierarchyConfiguration(Pointer<BasePatchHierarchy<NDIM> > hierarc
     d_l_data_manager->setPatchLevels(0, finest_hier_level);
     d_l_data_manager->resetHierarchyConfiguration(hierarchy, coarsest_level, finest_level);
 
+    // The flow meter interpolation stencils depend on the patch hierarchy.
+    d_instrument_panel->invalidateHierarchyDependentData();
+
     // If we have added or removed a level, resize the anchor point vectors.
     d_anchor_point_local_idxs.clear();
     d_anchor_point_local_idxs.resize(finest_hier_level + 1);
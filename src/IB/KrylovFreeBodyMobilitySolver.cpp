@@ -78,7 +78,13 @@ KrylovFreeBodyMobilitySolver::KrylovFreeBodyMobilitySolver(std::string object_na
         if (input_db->keyExists("initial_guess_nonzero"))
             d_initial_guess_nonzero = input_db->getBool("initial_guess_nonzero");
         if (input_db->keyExists("enable_logging")) d_enable_logging = input_db->getBool("enable_logging");
+        if (input_db->keyExists("recycle_subspace_size"))
+            d_recycle_subspace_size = input_db->getInteger("recycle_subspace_size");
+        if (input_db->keyExists("recycle_refresh_interval"))
+            d_recycle_refresh_interval = input_db->getInteger("recycle_refresh_interval");
     }
+    if (d_recycle_subspace_size > 0)
+        d_recycled_subspace.reset(new IBTK::PETScFischerGuess(d_recycle_subspace_size));
 
     IBAMR_DO_ONCE(
         t_solve_system = TimerManager::getManager()->getTimer("IBAMR::KrylovFreeBodyMobilitySolver::solveSystem()");
@@ -129,6 +135,10 @@ KrylovFreeBodyMobilitySolver::setSpreadScale(const double spread_scale)
 void
 KrylovFreeBodyMobilitySolver::setStokesSpecifications(const StokesSpecifications& stokes_spec)
 {
+    if (d_recycled_subspace && (stokes_spec.getRho() != d_rho || stokes_spec.getMu() != d_mu))
+    {
+        d_recycled_subspace->clear();
+    }
     d_rho = stokes_spec.getRho();
     d_mu = stokes_spec.getMu();
 } // setStokesSpecifications
@@ -175,6 +185,18 @@ KrylovFreeBodyMobilitySolver::solveSystem(Vec x, Vec b)
     if (deallocate_after_solve) initializeSolverState(x, b);
 
     VecCopy(b, d_petsc_b);
+
+    // Compute an initial guess from the retained solution subspace unless the
+    // caller has supplied one.
+    const bool use_recycled_guess =
+        d_recycled_subspace && !d_initial_guess_nonzero && d_recycled_subspace->getNumberOfVectors() > 0;
+    if (use_recycled_guess)
+    {
+        d_recycled_subspace->guess(x, d_petsc_b);
+        KSPSetInitialGuessNonzero(d_petsc_ksp, PETSC_TRUE);
+    }
+
+    // Solve the system using a PETSc KSP object.
     KSPSolve(d_petsc_ksp, d_petsc_b, x);
     KSPGetIterationNumber(d_petsc_ksp, &d_current_iterations);
     KSPGetResidualNorm(d_petsc_ksp, &d_current_residual_norm);
@@ -185,6 +207,15 @@ KrylovFreeBodyMobilitySolver::solveSystem(Vec x, Vec b)
     const bool converged = (static_cast<int>(reason) > 0);
     if (d_enable_logging) reportKSPConvergedReason(reason, plog);
 
+    // Update the retained solution subspace.
+    if (d_recycled_subspace)
+    {
+        if (use_recycled_guess) KSPSetInitialGuessNonzero(d_petsc_ksp, PETSC_FALSE);
+        if (d_recycle_refresh_interval > 0 && ++d_num_recycled_solves % d_recycle_refresh_interval == 0)
+            d_recycled_subspace->clear();
+        if (converged) d_recycled_subspace->submit(x, d_petsc_b);
+    }
+
     // Deallocate the solver, when necessary.
     if (deallocate_after_solve) deallocateSolverState();
 
@@ -30,6 +30,7 @@
 #include "ibtk/NewtonKrylovSolver.h"
 #include "ibtk/PETScSAMRAIVectorReal.h"
 #include "ibtk/PoissonSolver.h"
+#include "ibtk/PoissonUtilities.h"
 #include "ibtk/SCPoissonSolverManager.h"
 #include "ibtk/ibtk_utilities.h"
 
@@ -379,6 +380,11 @@ KrylovMobilitySolver::setVelocityPoissonSpecifications(const PoissonSpecificatio
 {
     d_LInv->setVelocityPoissonSpecifications(u_problem_coefs);
     d_velocity_solver->setPoissonSpecifications(u_problem_coefs);
+    if (d_recycled_subspace)
+    {
+        d_recycled_subspace->setOperatorFingerprint(
+            PoissonUtilities::computeOperatorFingerprint(u_problem_coefs, {}, nullptr));
+    }
 } // setVelocityPoissonSpecifications
 
 void
@@ -433,6 +439,16 @@ KrylovMobilitySolver::solveSystem(Vec x, Vec b)
     d_petsc_x = x;
     VecCopy(b, d_petsc_b);
 
+    // Compute an initial guess from the retained solution subspace unless the
+    // caller has supplied one.
+    const bool use_recycled_guess =
+        d_recycled_subspace && !d_initial_guess_nonzero && d_recycled_subspace->getNumberOfVectors() > 0;
+    if (use_recycled_guess)
+    {
+        d_recycled_subspace->guess(d_petsc_x, d_petsc_b);
+        KSPSetInitialGuessNonzero(d_petsc_ksp, PETSC_TRUE);
+    }
+
     // Solve the system using a PETSc KSP object.
     KSPSolve(d_petsc_ksp, d_petsc_b, d_petsc_x);
     KSPGetIterationNumber(d_petsc_ksp, &d_current_iterations);
@@ -444,6 +460,15 @@ KrylovMobilitySolver::solveSystem(Vec x, Vec b)
     const bool converged = (static_cast<int>(reason) > 0);
     if (d_enable_logging) reportKSPConvergedReason(reason, plog);
 
+    // Update the retained solution subspace.
+    if (d_recycled_subspace)
+    {
+        if (use_recycled_guess) KSPSetInitialGuessNonzero(d_petsc_ksp, PETSC_FALSE);
+        if (d_recycle_refresh_interval > 0 && ++d_num_recycled_solves % d_recycle_refresh_interval == 0)
+            d_recycled_subspace->clear();
+        if (converged) d_recycled_subspace->submit(d_petsc_x, d_petsc_b);
+    }
+
     // Deallocate the solver, when necessary.
     d_petsc_x = nullptr;
     if (deallocate_after_solve) deallocateSolverState();
@@ -498,6 +523,9 @@ KrylovMobilitySolver::initializeSolverState(Vec x, Vec b)
     IBTK::PETScSAMRAIVectorReal::restoreSAMRAIVector(vx[0], &vx0);
     IBTK::PETScSAMRAIVectorReal::restoreSAMRAIVector(vb[0], &vb0);
 
+    // Discard the retained solution subspace if the grid has changed.
+    if (d_recycled_subspace) d_recycled_subspace->setPatchHierarchy(d_hierarchy, coarsest_ln, finest_ln);
+
     // Setup the interpolation transaction information.
     d_fill_pattern = nullptr;
     using InterpolationTransactionComponent = IBTK::HierarchyGhostCellInterpolation::InterpolationTransactionComponent;
@@ -580,6 +608,12 @@ KrylovMobilitySolver::getFromInput(Pointer<Database> input_db)
     if (input_db->keyExists("normalize_pressure")) d_normalize_pressure = input_db->getBool("normalize_pressure");
     if (input_db->keyExists("normalize_velocity")) d_normalize_velocity = input_db->getBool("normalize_velocity");
     if (input_db->keyExists("enable_logging")) d_enable_logging = input_db->getBool("enable_logging");
+    if (input_db->keyExists("recycle_subspace_size"))
+        d_recycle_subspace_size = input_db->getInteger("recycle_subspace_size");
+    if (input_db->keyExists("recycle_refresh_interval"))
+        d_recycle_refresh_interval = input_db->getInteger("recycle_refresh_interval");
+    if (d_recycle_subspace_size > 0)
+        d_recycled_subspace.reset(new IBTK::PETScFischerGuess(d_recycle_subspace_size));
 } // getFromInput
 
 void
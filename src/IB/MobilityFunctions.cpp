@@ -17,6 +17,7 @@
 
 #include "tbox/Utilities.h"
 
+#include <algorithm>
 #include <cmath>
 #include <cstdlib>
 #include <cstring>
@@ -558,6 +559,27 @@ getEmpiricalMobilityComponents(const char* IBKernelName,
     }
     return;
 } // getEmpiricalMobilityComponents
+
+// Computes the (idir, jdir) component of the RPY tensor for two distinct
+// blobs separated by r_vec, with rsq = |r_vec|^2 and r = |r_vec|.
+double
+getRPYMobilityComponent(const double* r_vec,
+                        const double rsq,
+                        const double r,
+                        const int idir,
+                        const int jdir,
+                        const double mu_tt,
+                        const double PERIODIC_CORRECTION)
+{
+    if (r <= 2.0 * HRad)
+    {
+        return (mu_tt * (1 - 9.0 / 32.0 * r / HRad) - PERIODIC_CORRECTION) * KRON(idir, jdir) +
+               mu_tt * r_vec[idir] * r_vec[jdir] / rsq * 3.0 * r / 32. / HRad;
+    }
+    double cube = HRad * HRad * HRad / r / r / r;
+    return (mu_tt * (3.0 / 4.0 * HRad / r + 1.0 / 2.0 * cube) - PERIODIC_CORRECTION) * KRON(idir, jdir) +
+           mu_tt * r_vec[idir] * r_vec[jdir] / rsq * (3.0 / 4.0 * HRad / r - 3.0 / 2.0 * cube);
+} // getRPYMobilityComponent
 } // namespace
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -654,30 +676,12 @@ MobilityFunctions::constructRPYMobilityMatrix(const char* IBKernelName,
                     for (jdir = 0; jdir <= idir; jdir++)
                     {
                         const int index = (col * NDIM + jdir) * size + row * NDIM + idir; // column-major for LAPACK
-                        if (r <= 2.0 * HRad)
-                        {
-                            MM[index] = (mu_tt * (1 - 9.0 / 32.0 * r / HRad) - PERIODIC_CORRECTION) * KRON(idir, jdir) +
-                                        mu_tt * r_vec[idir] * r_vec[jdir] / rsq * 3.0 * r / 32. / HRad;
-                            MM[(row * NDIM + idir) * size + col * NDIM + jdir] = MM[index];
-                            if (idir != jdir)
-                            {
-                                MM[(col * NDIM + idir) * size + row * NDIM + jdir] = MM[index];
-                                MM[(row * NDIM + jdir) * size + col * NDIM + idir] = MM[index];
-                            }
-                        }
-                        else
+                        MM[index] = getRPYMobilityComponent(r_vec, rsq, r, idir, jdir, mu_tt, PERIODIC_CORRECTION);
+                        MM[(row * NDIM + idir) * size + col * NDIM + jdir] = MM[index];
+                        if (idir != jdir)
                         {
-                            double cube = HRad * HRad * HRad / r / r / r;
-                            MM[index] =
-                                (mu_tt * (3.0 / 4.0 * HRad / r + 1.0 / 2.0 * cube) - PERIODIC_CORRECTION) *
-                                    KRON(idir, jdir) +
-                                mu_tt * r_vec[idir] * r_vec[jdir] / rsq * (3.0 / 4.0 * HRad / r - 3.0 / 2.0 * cube);
-                            MM[(row * NDIM + idir) * size + col * NDIM + jdir] = MM[index];
-                            if (idir != jdir)
-                            {
-                                MM[(col * NDIM + idir) * size + row * NDIM + jdir] = MM[index];
-                                MM[(row * NDIM + jdir) * size + col * NDIM + idir] = MM[index];
-                            }
+                            MM[(col * NDIM + idir) * size + row * NDIM + jdir] = MM[index];
+                            MM[(row * NDIM + jdir) * size + col * NDIM + idir] = MM[index];
                         }
                     } // jdir
             }
@@ -685,6 +689,62 @@ MobilityFunctions::constructRPYMobilityMatrix(const char* IBKernelName,
     return;
 } // constructRPYMobilityMatrix
 
+double
+MobilityFunctions::getEmpiricalMobilityMatrixEntry(const char* IBKernelName,
+                                                   const double MU,
+                                                   const double rho,
+                                                   const double Dt,
+                                                   const double DX,
+                                                   const double* X,
+                                                   const int i,
+                                                   const int j,
+                                                   const double L_domain)
+{
+    // Evaluate the entry in the same order as the lower triangle of the
+    // assembled matrix so that both give identical values.
+    const int row = std::max(i / NDIM, j / NDIM), col = std::min(i / NDIM, j / NDIM);
+    const int idir = std::max(i % NDIM, j % NDIM), jdir = std::min(i % NDIM, j % NDIM);
+    double r_vec[NDIM];
+    for (int cdir = 0; cdir < NDIM; cdir++)
+    {
+        r_vec[cdir] = X[row * NDIM + cdir] - X[col * NDIM + cdir]; // r(i) - r(j)
+    }
+    const double rsq = get_sqnorm(r_vec);
+    const double r = std::sqrt(rsq);
+    double F_R, G_R;
+    getEmpiricalMobilityComponents(IBKernelName, MU, rho, Dt, r, DX, 0, L_domain, &F_R, &G_R);
+
+    double entry = F_R * KRON(idir, jdir);
+    if (row != col) entry += G_R * r_vec[idir] * r_vec[jdir] / rsq;
+    return entry;
+} // getEmpiricalMobilityMatrixEntry
+
+double
+MobilityFunctions::getRPYMobilityMatrixEntry(const char* IBKernelName,
+                                             const double MU,
+                                             const double DX,
+                                             const double* X,
+                                             const int i,
+                                             const int j,
+                                             const double PERIODIC_CORRECTION)
+{
+    HRad = getHydroRadius(IBKernelName) * DX;
+    const double mu_tt = 1. / (6.0 * M_PI * MU * HRad);
+
+    const int row = std::max(i / NDIM, j / NDIM), col = std::min(i / NDIM, j / NDIM);
+    const int idir = std::max(i % NDIM, j % NDIM), jdir = std::min(i % NDIM, j % NDIM);
+    if (row == col) return (mu_tt - PERIODIC_CORRECTION) * KRON(idir, jdir);
+
+    double r_vec[NDIM];
+    for (int cdir = 0; cdir < NDIM; cdir++)
+    {
+        r_vec[cdir] = X[row * NDIM + cdir] - X[col * NDIM + cdir]; // r(i) - r(j)
+    }
+    const double rsq = get_sqnorm(r_vec);
+    const double r = std::sqrt(rsq);
+    return getRPYMobilityComponent(r_vec, rsq, r, idir, jdir, mu_tt, PERIODIC_CORRECTION);
+} // getRPYMobilityMatrixEntry
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBAMR
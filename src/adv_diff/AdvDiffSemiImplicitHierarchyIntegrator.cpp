@@ -23,6 +23,7 @@
 #include "ibtk/CartGridFunction.h"
 #include "ibtk/IBTK_MPI.h"
 #include "ibtk/LaplaceOperator.h"
+#include "ibtk/PatchDataMemoryPool.h"
 #include "ibtk/PoissonSolver.h"
 
 #include "BasePatchHierarchy.h"
@@ -480,8 +481,8 @@ AdvDiffSemiImplicitHierarchyIntegrator::preprocessIntegrateHierarchy(const doubl
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->allocatePatchData(d_scratch_data, current_time);
-        level->allocatePatchData(d_new_data, new_time);
+        level->allocatePatchData(d_scratch_data, current_time, PatchDataMemoryPool::getArena());
+        level->allocatePatchData(d_new_data, new_time, PatchDataMemoryPool::getArena());
     }
 
     // Update the advection velocity.
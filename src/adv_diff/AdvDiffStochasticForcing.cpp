@@ -66,24 +66,6 @@
 
 namespace IBAMR
 {
-/////////////////////////////// STATIC ///////////////////////////////////////
-
-namespace
-{
-void
-genrandn(ArrayData<NDIM, double>& data, const Box<NDIM>& box)
-{
-    for (int depth = 0; depth < data.getDepth(); ++depth)
-    {
-        for (Box<NDIM>::Iterator i(box); i; i++)
-        {
-            RNG::genrandn(&data(i(), depth));
-        }
-    }
-    return;
-} // genrandn
-} // namespace
-
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 AdvDiffStochasticForcing::AdvDiffStochasticForcing(std::string object_name,
@@ -232,9 +214,13 @@ AdvDiffStochasticForcing::setDataOnPatchHierarchy(const int data_idx,
                                         "TRAPEZOIDAL_RULE\n");
         }
 
-        // Generate random components.
+        // Generate random components.  The values are generated by a
+        // counter-based generator and hence do not depend on the patch layout.
+        // Each sample k and each side axis is assigned its own substream.
         if (cycle_num == 0)
         {
+            const unsigned int stream_key = RNG::counter_stream_key(d_object_name);
+            const auto step_num = static_cast<unsigned int>(d_adv_diff_solver->getIntegratorStep());
             for (int k = 0; k < d_num_rand_vals; ++k)
             {
                 for (int level_num = coarsest_ln; level_num <= finest_ln; ++level_num)
@@ -246,7 +232,12 @@ AdvDiffStochasticForcing::setDataOnPatchHierarchy(const int data_idx,
                         Pointer<SideData<NDIM, double> > F_sc_data = patch->getPatchData(d_F_sc_idxs[k]);
                         for (int d = 0; d < NDIM; ++d)
                         {
-                            genrandn(F_sc_data->getArrayData(d), SideGeometry<NDIM>::toSideBox(F_sc_data->getBox(), d));
+                            RNG::genrandn(F_sc_data->getArrayData(d),
+                                          SideGeometry<NDIM>::toSideBox(F_sc_data->getBox(), d),
+                                          stream_key,
+                                          step_num,
+                                          NDIM * k + d,
+                                          level_num);
                         }
                     }
                 }
@@ -16,6 +16,7 @@
 #include "ibamr/CFOldroydBRelaxation.h"
 #include "ibamr/CFRelaxationOperator.h"
 #include "ibamr/CFRoliePolyRelaxation.h"
+#include "ibamr/CFTensorUtilities.h"
 #include "ibamr/ConvectiveOperator.h"
 #include "ibamr/INSHierarchyIntegrator.h"
 
@@ -50,8 +51,6 @@
 IBTK_DISABLE_EXTRA_WARNINGS
 #include <Eigen/Cholesky>
 #include <Eigen/Core>
-#include <Eigen/Eigenvalues>
-#include <unsupported/Eigen/MatrixFunctions>
 IBTK_ENABLE_EXTRA_WARNINGS
 
 #include <algorithm>
@@ -812,22 +811,7 @@ CFINSForcing::exponentiateMatrix(const int data_idx,
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
             Pointer<CellData<NDIM, double> > data = patch->getPatchData(data_idx);
             const Box<NDIM>& box = extended_box ? data->getGhostBox() : patch->getBox();
-            for (CellIterator<NDIM> it(box); it; it++)
-            {
-                CellIndex<NDIM> i = *it;
-                MatrixNd tens;
-                for (int k = 0; k < NDIM * (NDIM + 1) / 2; ++k)
-                {
-                    const std::pair<int, int>& idx = voigt_to_tensor_idx(k);
-                    tens(idx.first, idx.second) = tens(idx.second, idx.first) = (*data)(i, k);
-                }
-                tens = tens.exp();
-                for (int k = 0; k < NDIM * (NDIM + 1) / 2; ++k)
-                {
-                    const std::pair<int, int>& idx = voigt_to_tensor_idx(k);
-                    (*data)(i, k) = tens(idx.first, idx.second);
-                }
-            }
+            symmetric_tensor_exp(*data, *data, box);
         }
     }
     return;
@@ -850,30 +834,7 @@ CFINSForcing::projectTensor(const int data_idx,
             if (initial_time) return;
             Pointer<CellData<NDIM, double> > data = patch->getPatchData(data_idx);
             const Box<NDIM>& box = extended_box ? data->getGhostBox() : patch->getBox();
-            for (CellIterator<NDIM> it(box); it; it++)
-            {
-                CellIndex<NDIM> i = *it;
-                MatrixNd tens;
-                Eigen::SelfAdjointEigenSolver<MatrixNd> eigs;
-                for (int k = 0; k < NDIM * (NDIM + 1) / 2; ++k)
-                {
-                    const std::pair<int, int>& idx = voigt_to_tensor_idx(k);
-                    tens(idx.first, idx.second) = tens(idx.second, idx.first) = (*data)(i, k);
-                }
-                eigs.computeDirect(tens);
-                MatrixNd eig_vals(MatrixNd::Zero());
-                for (int d = 0; d < NDIM; ++d)
-                {
-                    eig_vals(d, d) = std::max(eigs.eigenvalues()(d), 0.0);
-                }
-                MatrixNd eig_vecs = eigs.eigenvectors();
-                tens = eig_vecs * eig_vals * eig_vecs.transpose();
-                for (int k = 0; k < NDIM * (NDIM + 1) / 2; ++k)
-                {
-                    const std::pair<int, int>& idx = voigt_to_tensor_idx(k);
-                    (*data)(i, k) = tens(idx.first, idx.second);
-                }
-            }
+            symmetric_tensor_positive_part(*data, *data, box);
         }
     }
     return;
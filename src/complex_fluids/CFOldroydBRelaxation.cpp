@@ -17,6 +17,7 @@
 
 #include "CellData.h"
 #include "CellIterator.h"
+#include "IntVector.h"
 #include "Patch.h"
 #include "tbox/Database.h"
 
@@ -62,24 +63,29 @@ CFOldroydBRelaxation::setDataOnPatch(const int data_idx,
     ret_data->fillAll(0.0);
     if (initial_time) return;
     const double l_inv = 1.0 / d_lambda;
+    // Either convert each tensor inside the loop or convert all tensors of the
+    // patch at once into ret_data, which is then overwritten cell by cell.
+    const bool convert_each_tensor = usesSingleTensorConversion();
+    if (!convert_each_tensor) convertToConformation(*in_data, *ret_data, patch_box);
+    const CellData<NDIM, double>& conform_data = convert_each_tensor ? *in_data : *ret_data;
     for (CellIterator<NDIM> i(patch_box); i; i++)
     {
         const CellIndex<NDIM>& idx = i();
         MatrixNd mat;
 #if (NDIM == 2)
-        mat(0, 0) = (*in_data)(idx, 0);
-        mat(1, 1) = (*in_data)(idx, 1);
-        mat(0, 1) = mat(1, 0) = (*in_data)(idx, 2);
+        mat(0, 0) = conform_data(idx, 0);
+        mat(1, 1) = conform_data(idx, 1);
+        mat(0, 1) = mat(1, 0) = conform_data(idx, 2);
 #endif
 #if (NDIM == 3)
-        mat(0, 0) = (*in_data)(idx, 0);
-        mat(1, 1) = (*in_data)(idx, 1);
-        mat(2, 2) = (*in_data)(idx, 2);
-        mat(1, 2) = mat(2, 1) = (*in_data)(idx, 3);
-        mat(0, 2) = mat(2, 0) = (*in_data)(idx, 4);
-        mat(0, 1) = mat(1, 0) = (*in_data)(idx, 5);
+        mat(0, 0) = conform_data(idx, 0);
+        mat(1, 1) = conform_data(idx, 1);
+        mat(2, 2) = conform_data(idx, 2);
+        mat(1, 2) = mat(2, 1) = conform_data(idx, 3);
+        mat(0, 2) = mat(2, 0) = conform_data(idx, 4);
+        mat(0, 1) = mat(1, 0) = conform_data(idx, 5);
 #endif
-        mat = convertToConformation(mat);
+        if (convert_each_tensor) mat = convertToConformation(mat);
 #if (NDIM == 2)
         (*ret_data)(idx, 0) = l_inv * (1.0 - mat(0, 0));
         (*ret_data)(idx, 1) = l_inv * (1.0 - mat(1, 1));
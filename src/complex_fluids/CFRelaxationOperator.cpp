@@ -12,14 +12,18 @@
 // ---------------------------------------------------------------------
 
 #include "ibamr/CFRelaxationOperator.h"
+#include "ibamr/CFTensorUtilities.h"
 
 #include "ibtk/ibtk_utilities.h"
 
+#include "ArrayData.h"
+#include "Box.h"
+#include "CellData.h"
+#include "CellIndex.h"
+#include "CellIterator.h"
 #include "tbox/Utilities.h"
 
-IBTK_DISABLE_EXTRA_WARNINGS
-#include <unsupported/Eigen/MatrixFunctions>
-IBTK_ENABLE_EXTRA_WARNINGS
+#include <utility>
 
 #include "ibamr/app_namespaces.h" // IWYU pragma: keep
 
@@ -60,7 +64,7 @@ CFRelaxationOperator::convertToConformation(const MatrixNd& mat)
     case SQUARE_ROOT:
         return mat * mat;
     case LOGARITHM:
-        return mat.exp();
+        return symmetric_tensor_exp(mat);
     case STANDARD:
         return mat;
     case UNKNOWN_TENSOR_EVOLUTION_TYPE:
@@ -72,6 +76,54 @@ CFRelaxationOperator::convertToConformation(const MatrixNd& mat)
         break;
     }
     return mat;
-}
+} // convertToConformation
+
+bool
+CFRelaxationOperator::usesSingleTensorConversion() const
+{
+    return false;
+} // usesSingleTensorConversion
+
+void
+CFRelaxationOperator::convertToConformation(const CellData<NDIM, double>& in_data,
+                                            CellData<NDIM, double>& conform_data,
+                                            const Box<NDIM>& box)
+{
+    if (!usesSingleTensorConversion())
+    {
+        switch (d_evolve_type)
+        {
+        case SQUARE_ROOT:
+            symmetric_tensor_square(in_data, conform_data, box);
+            return;
+        case LOGARITHM:
+            symmetric_tensor_exp(in_data, conform_data, box);
+            return;
+        case STANDARD:
+            if (&in_data != &conform_data) conform_data.getArrayData().copy(in_data.getArrayData(), box);
+            return;
+        default:
+            // Report unknown evolution types through the single tensor conversion below.
+            break;
+        }
+    }
+    for (CellIterator<NDIM> ic(box); ic; ic++)
+    {
+        const CellIndex<NDIM>& i = ic();
+        MatrixNd mat;
+        for (int k = 0; k < NDIM * (NDIM + 1) / 2; ++k)
+        {
+            const std::pair<int, int> idx = voigt_to_tensor_idx(k);
+            mat(idx.first, idx.second) = mat(idx.second, idx.first) = in_data(i, k);
+        }
+        mat = convertToConformation(mat);
+        for (int k = 0; k < NDIM * (NDIM + 1) / 2; ++k)
+        {
+            const std::pair<int, int> idx = voigt_to_tensor_idx(k);
+            conform_data(i, k) = mat(idx.first, idx.second);
+        }
+    }
+    return;
+} // convertToConformation
 
 } // namespace IBAMR
@@ -0,0 +1,244 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2019 - 2019 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+#include "ibamr/CFTensorUtilities.h"
+
+#include "ibtk/ibtk_utilities.h"
+
+#include "Box.h"
+#include "CellData.h"
+#include "CellIndex.h"
+#include "CellIterator.h"
+#include "tbox/Utilities.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+IBTK_DISABLE_EXTRA_WARNINGS
+#include <Eigen/Core>
+#include <Eigen/Eigenvalues>
+IBTK_ENABLE_EXTRA_WARNINGS
+
+#include "ibamr/app_namespaces.h" // IWYU pragma: keep
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBAMR
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+static const int NUM_TENSOR_COMPONENTS = NDIM * (NDIM + 1) / 2;
+
+// Relative lower bound on the half-separation of the eigenvalues used by the
+// two dimensional kernel.
+static const double EIG_SEP_REL_TOL = 1.0e-7;
+
+/*!
+ * Evaluate f(A) for n symmetric tensors A stored in Voigt notation, with
+ * component k of tensor j stored in in[k][j].  The results are stored in the
+ * same manner in out, which may alias in.
+ */
+template <class Function>
+inline void
+apply_to_tensors(const double* const* const in, double* const* const out, const int n, Function f)
+{
+#if (NDIM == 2)
+    for (int j = 0; j < n; ++j)
+    {
+        // Write A = m I + [d b; b -d], whose eigenvalues are m +/- r with
+        // r = sqrt(d^2 + b^2).  By Sylvester's formula,
+        //
+        //    f(A) = (f(m+r) + f(m-r))/2 I + (f(m+r) - f(m-r))/(2 r) (A - m I).
+        //
+        // Bounding r from below keeps the formula well defined for (nearly)
+        // isotropic tensors, for which A - m I vanishes.
+        const double a = in[0][j], c = in[1][j], b = in[2][j];
+        const double m = 0.5 * (a + c);
+        const double d = 0.5 * (a - c);
+        const double r =
+            std::max(std::sqrt(d * d + b * b), EIG_SEP_REL_TOL * std::abs(m) + std::numeric_limits<double>::min());
+        const double f_plus = f(m + r);
+        const double f_minus = f(m - r);
+        const double alpha = 0.5 * (f_plus + f_minus);
+        const double beta = 0.5 * (f_plus - f_minus) / r;
+        out[0][j] = alpha + beta * d;
+        out[1][j] = alpha - beta * d;
+        out[2][j] = beta * b;
+    }
+#endif
+#if (NDIM == 3)
+    Eigen::SelfAdjointEigenSolver<Matrix3d> eigs;
+    for (int j = 0; j < n; ++j)
+    {
+        Matrix3d A;
+        for (int k = 0; k < NUM_TENSOR_COMPONENTS; ++k)
+        {
+            const std::pair<int, int> idx = voigt_to_tensor_idx(k);
+            A(idx.first, idx.second) = A(idx.second, idx.first) = in[k][j];
+        }
+        eigs.computeDirect(A);
+        Vector3d f_eig_vals;
+        for (int d = 0; d < 3; ++d) f_eig_vals(d) = f(eigs.eigenvalues()(d));
+        const Matrix3d& V = eigs.eigenvectors();
+        const Matrix3d f_A = V * f_eig_vals.asDiagonal() * V.transpose();
+        for (int k = 0; k < NUM_TENSOR_COMPONENTS; ++k)
+        {
+            const std::pair<int, int> idx = voigt_to_tensor_idx(k);
+            out[k][j] = f_A(idx.first, idx.second);
+        }
+    }
+#endif
+    return;
+} // apply_to_tensors
+
+/*!
+ * Compute A^2 for n symmetric tensors A stored in the same manner as in
+ * apply_to_tensors().
+ */
+inline void
+square_tensors(const double* const* const in, double* const* const out, const int n)
+{
+    for (int j = 0; j < n; ++j)
+    {
+#if (NDIM == 2)
+        const double a = in[0][j], c = in[1][j], b = in[2][j];
+        out[0][j] = a * a + b * b;
+        out[1][j] = c * c + b * b;
+        out[2][j] = b * (a + c);
+#endif
+#if (NDIM == 3)
+        const double xx = in[0][j], yy = in[1][j], zz = in[2][j];
+        const double yz = in[3][j], xz = in[4][j], xy = in[5][j];
+        out[0][j] = xx * xx + xy * xy + xz * xz;
+        out[1][j] = xy * xy + yy * yy + yz * yz;
+        out[2][j] = xz * xz + yz * yz + zz * zz;
+        out[3][j] = xy * xz + yy * yz + yz * zz;
+        out[4][j] = xx * xz + xy * yz + xz * zz;
+        out[5][j] = xx * xy + xy * yy + xz * yz;
+#endif
+    }
+    return;
+} // square_tensors
+
+/*!
+ * Apply a function that acts on rows of tensors, with the same arguments as
+ * square_tensors(), to each row of the box.
+ */
+template <class RowFunction>
+void
+apply_to_patch_data(const CellData<NDIM, double>& in_data,
+                    CellData<NDIM, double>& out_data,
+                    const Box<NDIM>& box,
+                    RowFunction row_fcn)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(in_data.getDepth() >= NUM_TENSOR_COMPONENTS);
+    TBOX_ASSERT(out_data.getDepth() >= NUM_TENSOR_COMPONENTS);
+    TBOX_ASSERT(in_data.getGhostBox() * box == box);
+    TBOX_ASSERT(out_data.getGhostBox() * box == box);
+#endif
+    if (box.empty()) return;
+
+    // Cell data are stored component by component with the first index
+    // varying fastest, so each row of the box is a contiguous array for every
+    // tensor component.
+    Box<NDIM> row_start_box = box;
+    row_start_box.upper(0) = box.lower(0);
+    const int row_length = box.numberCells(0);
+    const double* in[NUM_TENSOR_COMPONENTS];
+    double* out[NUM_TENSOR_COMPONENTS];
+    for (CellIterator<NDIM> ic(row_start_box); ic; ic++)
+    {
+        const CellIndex<NDIM>& i = ic();
+        for (int k = 0; k < NUM_TENSOR_COMPONENTS; ++k)
+        {
+            in[k] = &in_data(i, k);
+            out[k] = &out_data(i, k);
+        }
+        row_fcn(in, out, row_length);
+    }
+    return;
+} // apply_to_patch_data
+
+inline double
+exp_fcn(const double x)
+{
+    return std::exp(x);
+}
+
+inline double
+positive_part_fcn(const double x)
+{
+    return std::max(x, 0.0);
+}
+} // namespace
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+MatrixNd
+symmetric_tensor_exp(const MatrixNd& A)
+{
+    double A_vals[NUM_TENSOR_COMPONENTS];
+    double* A_ptrs[NUM_TENSOR_COMPONENTS];
+    for (int k = 0; k < NUM_TENSOR_COMPONENTS; ++k)
+    {
+        const std::pair<int, int> idx = voigt_to_tensor_idx(k);
+        A_vals[k] = A(idx.first, idx.second);
+        A_ptrs[k] = &A_vals[k];
+    }
+    apply_to_tensors(A_ptrs, A_ptrs, 1, exp_fcn);
+    MatrixNd exp_A;
+    for (int k = 0; k < NUM_TENSOR_COMPONENTS; ++k)
+    {
+        const std::pair<int, int> idx = voigt_to_tensor_idx(k);
+        exp_A(idx.first, idx.second) = exp_A(idx.second, idx.first) = A_vals[k];
+    }
+    return exp_A;
+} // symmetric_tensor_exp
+
+void
+symmetric_tensor_exp(const CellData<NDIM, double>& in_data, CellData<NDIM, double>& out_data, const Box<NDIM>& box)
+{
+    apply_to_patch_data(in_data, out_data, box, [](const double* const* in, double* const* out, const int n) {
+        apply_to_tensors(in, out, n, exp_fcn);
+    });
+    return;
+} // symmetric_tensor_exp
+
+void
+symmetric_tensor_square(const CellData<NDIM, double>& in_data, CellData<NDIM, double>& out_data, const Box<NDIM>& box)
+{
+    apply_to_patch_data(in_data, out_data, box, square_tensors);
+    return;
+} // symmetric_tensor_square
+
+void
+symmetric_tensor_positive_part(const CellData<NDIM, double>& in_data,
+                               CellData<NDIM, double>& out_data,
+                               const Box<NDIM>& box)
+{
+    apply_to_patch_data(in_data, out_data, box, [](const double* const* in, double* const* out, const int n) {
+        apply_to_tensors(in, out, n, positive_part_fcn);
+    });
+    return;
+} // symmetric_tensor_positive_part
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBAMR
+
+//////////////////////////////////////////////////////////////////////////////
@@ -19,18 +19,23 @@
 
 #include "ibtk/HierarchyGhostCellInterpolation.h"
 #include "ibtk/HierarchyMathOps.h"
+#include "ibtk/IBTK_MPI.h"
 
 #include "BasePatchLevel.h"
+#include "ArrayData.h"
 #include "Box.h"
 #include "BoxArray.h"
+#include "BoxTree.h"
 #include "CartesianPatchGeometry.h"
 #include "CellData.h"
+#include "CellIterator.h"
 #include "CellVariable.h"
 #include "HierarchyCellDataOpsReal.h"
 #include "IntVector.h"
 #include "Patch.h"
 #include "PatchHierarchy.h"
 #include "PatchLevel.h"
+#include "ProcessorMapping.h"
 #include "Variable.h"
 #include "VariableContext.h"
 #include "VariableDatabase.h"
@@ -40,6 +45,9 @@
 #include "tbox/Pointer.h"
 #include "tbox/Utilities.h"
 
+#include <algorithm>
+#include <cmath>
+#include <map>
 #include <ostream>
 #include <string>
 #include <utility>
@@ -88,6 +96,17 @@ namespace IBAMR
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
+namespace
+{
+double
+max_abs_difference(const double* const a, const double* const b, const int n)
+{
+    double max_diff = 0.0;
+    for (int k = 0; k < n; ++k) max_diff = std::max(max_diff, std::abs(a[k] - b[k]));
+    return max_diff;
+} // max_abs_difference
+} // namespace
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 FastSweepingLSMethod::FastSweepingLSMethod(std::string object_name, Pointer<Database> db, bool register_for_restart)
@@ -153,10 +172,15 @@ FastSweepingLSMethod::initializeLSData(int D_idx,
         (*d_locate_interface_fcns[k])(D_scratch_idx, hier_math_ops, time, initial_time, d_locate_interface_fcns_ctx[k]);
     }
 
-    // Set hierarchy objects.
+    // Determine the narrow band about the interface, if requested.
+    const bool use_narrow_band = d_narrow_band_width > 0;
+    initializeNarrowBand(D_scratch_idx, hier_math_ops, time);
+
+    // Set hierarchy objects.  In narrow band mode, only the ghost cells of the
+    // patches that intersect the band are filled.
     using InterpolationTransactionComponent = HierarchyGhostCellInterpolation::InterpolationTransactionComponent;
     InterpolationTransactionComponent D_transaction(
-        D_scratch_idx, "LINEAR_REFINE", true, "NONE", "LINEAR", false, d_bc_coef);
+        D_scratch_idx, "LINEAR_REFINE", true, "NONE", "LINEAR", false, d_bc_coef, getNarrowBandFillPattern());
     Pointer<HierarchyGhostCellInterpolation> fill_op = new HierarchyGhostCellInterpolation();
     fill_op->initializeOperatorState(D_transaction, hierarchy);
     HierarchyCellDataOpsReal<NDIM, double> hier_cc_data_ops(hierarchy, coarsest_ln, finest_ln);
@@ -166,15 +190,65 @@ FastSweepingLSMethod::initializeLSData(int D_idx,
     int outer_iter = 0;
     const int cc_wgt_idx = hier_math_ops->getCellWeightPatchDescriptorIndex();
 
+    if (d_use_front_propagation)
+    {
+        // Exchange the fronts between the patches through the ghost cells and
+        // sweep only those patches whose incoming front has changed.  The
+        // fronts are first exchanged between the patches of each process until
+        // they no longer change, and only then between all processes.
+        //
+        // NOTE: If the local exchanges stop after max_local_iterations before
+        // the local patches have converged, the remaining exchanges are done
+        // in the next outer iteration, so that the result does not depend on
+        // this bound.
+        std::vector<std::map<int, std::vector<double> > > patch_fronts(finest_ln + 1);
+        std::vector<std::vector<LocalGhostCopy> > local_ghost_copies;
+        buildLocalGhostCopies(hierarchy, D_scratch_idx, local_ghost_copies);
+        int num_changed_patches = 1;
+        while (num_changed_patches > 0 && outer_iter < d_max_its)
+        {
+            fill_op->fillData(time);
+            int num_local_changed_patches = 0;
+            for (int local_iter = 0; local_iter < d_max_local_its; ++local_iter)
+            {
+                const int num_changed = sweepPatchesWithChangedFronts(hier_math_ops, D_scratch_idx, patch_fronts);
+                if (use_narrow_band) capNarrowBandData(D_scratch_idx, hierarchy);
+                if (num_changed == 0) break;
+                num_local_changed_patches += num_changed;
+                copyLocalGhostData(hierarchy, D_scratch_idx, local_ghost_copies);
+            }
+            num_changed_patches = IBTK_MPI::sumReduction(num_local_changed_patches);
+
+            outer_iter += 1;
+
+            if (d_enable_logging)
+            {
+                plog << d_object_name << "::initializeLSData(): After iteration # " << outer_iter << std::endl;
+                plog << d_object_name << "::initializeLSData(): number of changed patches = " << num_changed_patches
+                     << std::endl;
+            }
+        }
+        if (num_changed_patches == 0) diff_L2_norm = 0.0;
+    }
+
     while (diff_L2_norm > d_abs_tol && outer_iter < d_max_its)
     {
-        hier_cc_data_ops.copyData(D_iter_idx, D_scratch_idx);
         fill_op->fillData(time);
 
-        fastSweep(hier_math_ops, D_scratch_idx);
-
-        hier_cc_data_ops.axmy(D_iter_idx, 1.0, D_iter_idx, D_scratch_idx);
-        diff_L2_norm = hier_cc_data_ops.L2Norm(D_iter_idx, cc_wgt_idx);
+        if (use_narrow_band)
+        {
+            copyNarrowBandData(D_iter_idx, D_scratch_idx, hierarchy);
+            fastSweep(hier_math_ops, D_scratch_idx);
+            capNarrowBandData(D_scratch_idx, hierarchy);
+            diff_L2_norm = computeNarrowBandDifferenceNorm(D_scratch_idx, D_iter_idx, cc_wgt_idx, hierarchy);
+        }
+        else
+        {
+            hier_cc_data_ops.copyData(D_iter_idx, D_scratch_idx);
+            fastSweep(hier_math_ops, D_scratch_idx);
+            hier_cc_data_ops.axmy(D_iter_idx, 1.0, D_iter_idx, D_scratch_idx);
+            diff_L2_norm = hier_cc_data_ops.L2Norm(D_iter_idx, cc_wgt_idx);
+        }
 
         outer_iter += 1;
 
@@ -194,6 +268,7 @@ FastSweepingLSMethod::initializeLSData(int D_idx,
         }
     }
 
+    d_num_outer_its = outer_iter;
     if (outer_iter >= d_max_its)
     {
         if (d_enable_logging)
@@ -222,6 +297,12 @@ FastSweepingLSMethod::initializeLSData(int D_idx,
     return;
 } // initializeLSData
 
+int
+FastSweepingLSMethod::getNumberOfIterations() const
+{
+    return d_num_outer_its;
+} // getNumberOfIterations
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
 void
@@ -241,6 +322,7 @@ FastSweepingLSMethod::fastSweep(Pointer<HierarchyMathOps> hier_math_ops, int dis
 
         for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
+            if (!patchIntersectsNarrowBand(ln, p())) continue;
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
             Pointer<CellData<NDIM, double> > dist_data = patch->getPatchData(dist_idx);
             fastSweep(dist_data, patch, domain_boxes[0]);
@@ -250,6 +332,141 @@ FastSweepingLSMethod::fastSweep(Pointer<HierarchyMathOps> hier_math_ops, int dis
 
 } // fastSweep
 
+int
+FastSweepingLSMethod::sweepPatchesWithChangedFronts(
+    Pointer<HierarchyMathOps> hier_math_ops,
+    int dist_idx,
+    std::vector<std::map<int, std::vector<double> > >& patch_fronts) const
+{
+    Pointer<PatchHierarchy<NDIM> > hierarchy = hier_math_ops->getPatchHierarchy();
+    const int coarsest_ln = 0;
+    const int finest_ln = hierarchy->getFinestLevelNumber();
+
+    int num_changed_patches = 0;
+    std::vector<double> front, D_prev;
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        const BoxArray<NDIM>& domain_boxes = level->getPhysicalDomain();
+#if !defined(NDEBUG)
+        TBOX_ASSERT(domain_boxes.size() == 1);
+#endif
+
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            if (!patchIntersectsNarrowBand(ln, p())) continue;
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, double> > dist_data = patch->getPatchData(dist_idx);
+            const Box<NDIM>& patch_box = patch->getBox();
+            const Box<NDIM>& ghost_box = dist_data->getGhostBox();
+
+            // Collect the front entering the patch through its ghost cells.
+            front.clear();
+            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            {
+                for (int upperlower = 0; upperlower < 2; ++upperlower)
+                {
+                    Box<NDIM> ghost_slab = ghost_box;
+                    if (upperlower == 0)
+                        ghost_slab.upper(axis) = patch_box.lower(axis) - 1;
+                    else
+                        ghost_slab.lower(axis) = patch_box.upper(axis) + 1;
+                    for (CellIterator<NDIM> ic(ghost_slab); ic; ic++) front.push_back((*dist_data)(ic()));
+                }
+            }
+
+            // A converged patch does not need to be swept again unless its
+            // incoming front has changed.
+            auto it = patch_fronts[ln].find(p());
+            if (it != patch_fronts[ln].end() &&
+                max_abs_difference(it->second.data(), front.data(), static_cast<int>(front.size())) <= d_front_tol)
+            {
+                continue;
+            }
+
+            double* const D = dist_data->getPointer(0);
+            const int D_size = ghost_box.size();
+            D_prev.resize(D_size);
+            bool patch_changed = false, patch_converged = false;
+            for (int k = 0; k < d_max_patch_sweeps && !patch_converged; ++k)
+            {
+                std::copy(D, D + D_size, D_prev.begin());
+                fastSweep(dist_data, patch, domain_boxes[0]);
+                patch_converged = max_abs_difference(D, D_prev.data(), D_size) <= d_front_tol;
+                patch_changed = patch_changed || !patch_converged;
+            }
+            if (patch_converged)
+            {
+                patch_fronts[ln][p()] = front;
+            }
+            else
+            {
+                patch_fronts[ln].erase(p());
+            }
+            if (patch_changed) ++num_changed_patches;
+        }
+    }
+    return num_changed_patches;
+} // sweepPatchesWithChangedFronts
+
+void
+FastSweepingLSMethod::buildLocalGhostCopies(Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                            const int dist_idx,
+                                            std::vector<std::vector<LocalGhostCopy> >& local_ghost_copies) const
+{
+    const int coarsest_ln = 0;
+    const int finest_ln = hierarchy->getFinestLevelNumber();
+    local_ghost_copies.clear();
+    local_ghost_copies.resize(finest_ln + 1);
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        Pointer<BoxTree<NDIM> > box_tree = level->getBoxTree();
+        const BoxArray<NDIM>& boxes = level->getBoxes();
+        const ProcessorMapping& processor_mapping = level->getProcessorMapping();
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            if (!patchIntersectsNarrowBand(ln, p())) continue;
+            Pointer<Patch<NDIM> > dst_patch = level->getPatch(p());
+            Pointer<CellData<NDIM, double> > dst_data = dst_patch->getPatchData(dist_idx);
+            const Box<NDIM> dst_ghost_box = Box<NDIM>::grow(dst_patch->getBox(), dst_data->getGhostCellWidth());
+            Array<int> src_patch_nums;
+            box_tree->findOverlapIndices(src_patch_nums, dst_ghost_box);
+            for (int k = 0; k < src_patch_nums.size(); ++k)
+            {
+                const int q = src_patch_nums[k];
+                if (q == p() || !processor_mapping.isMappingLocal(q)) continue;
+                const Box<NDIM> overlap = dst_ghost_box * boxes[q];
+                if (overlap.empty()) continue;
+                local_ghost_copies[ln].push_back({ p(), q, overlap });
+            }
+        }
+    }
+    return;
+} // buildLocalGhostCopies
+
+void
+FastSweepingLSMethod::copyLocalGhostData(Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                         const int dist_idx,
+                                         const std::vector<std::vector<LocalGhostCopy> >& local_ghost_copies) const
+{
+    const int coarsest_ln = 0;
+    const int finest_ln = hierarchy->getFinestLevelNumber();
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        for (const LocalGhostCopy& ghost_copy : local_ghost_copies[ln])
+        {
+            Pointer<CellData<NDIM, double> > dst_data =
+                level->getPatch(ghost_copy.dst_patch_num)->getPatchData(dist_idx);
+            Pointer<CellData<NDIM, double> > src_data =
+                level->getPatch(ghost_copy.src_patch_num)->getPatchData(dist_idx);
+            dst_data->getArrayData().copy(src_data->getArrayData(), ghost_copy.overlap);
+        }
+    }
+    return;
+} // copyLocalGhostData
+
 void
 FastSweepingLSMethod::fastSweep(Pointer<CellData<NDIM, double> > dist_data,
                                 const Pointer<Patch<NDIM> > patch,
@@ -331,6 +548,31 @@ FastSweepingLSMethod::getFromInput(Pointer<Database> input_db)
 
     d_reinit_interval = input_db->getIntegerWithDefault("reinit_interval", d_reinit_interval);
 
+    d_narrow_band_width = input_db->getIntegerWithDefault("narrow_band_width", d_narrow_band_width);
+
+    d_use_front_propagation = input_db->getBoolWithDefault("front_propagation", d_use_front_propagation);
+    d_max_patch_sweeps = input_db->getIntegerWithDefault("max_patch_sweeps", d_max_patch_sweeps);
+    d_max_local_its = input_db->getIntegerWithDefault("max_local_iterations", d_max_local_its);
+    if (d_max_local_its < 1)
+    {
+        TBOX_ERROR(d_object_name << "::getFromInput():\n"
+                                 << "  max_local_iterations must be at least 1, but " << d_max_local_its
+                                 << " was specified" << std::endl);
+    }
+    if (d_max_patch_sweeps < 1)
+    {
+        TBOX_ERROR(d_object_name << "::getFromInput():\n"
+                                 << "  max_patch_sweeps must be at least 1, but " << d_max_patch_sweeps
+                                 << " was specified" << std::endl);
+    }
+    d_front_tol = input_db->getDoubleWithDefault("front_tol", d_front_tol);
+    if (d_front_tol < 0.0)
+    {
+        TBOX_ERROR(d_object_name << "::getFromInput():\n"
+                                 << "  front_tol must be nonnegative, but " << d_front_tol << " was specified"
+                                 << std::endl);
+    }
+
     d_consider_phys_bdry_wall = input_db->getBoolWithDefault("physical_bdry_wall", d_consider_phys_bdry_wall);
     Array<int> wall_loc_idices;
     if (input_db->keyExists("physical_bdry_wall_loc_idx"))
@@ -15,10 +15,40 @@
 
 #include "ibamr/LSInitStrategy.h"
 
+#include "ibtk/HierarchyGhostCellInterpolation.h"
+#include "ibtk/HierarchyMathOps.h"
+#include "ibtk/IBTK_MPI.h"
+
+#include "Box.h"
+#include "BoxArray.h"
+#include "BoxGeometry.h"
+#include "BoxList.h"
+#include "BoxOverlap.h"
+#include "CartesianPatchGeometry.h"
+#include "CellData.h"
+#include "CellIndex.h"
+#include "CellIterator.h"
+#include "CellOverlap.h"
+#include "CellVariable.h"
+#include "HierarchyCellDataOpsReal.h"
+#include "IntVector.h"
+#include "Patch.h"
+#include "PatchHierarchy.h"
+#include "PatchLevel.h"
+#include "VariableContext.h"
+#include "VariableDatabase.h"
+#include "VariableFillPattern.h"
 #include "tbox/Database.h"
 #include "tbox/RestartManager.h"
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <map>
+#include <set>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "ibamr/namespaces.h"
 
@@ -28,6 +58,91 @@ namespace IBAMR
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
+namespace
+{
+static const std::string NARROW_BAND_PATTERN_NAME = "NARROW_BAND_FILL_PATTERN";
+
+using BoxCorners = std::array<int, 2 * NDIM>;
+
+inline BoxCorners
+get_box_corners(const Box<NDIM>& box)
+{
+    BoxCorners corners;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        corners[d] = box.lower()(d);
+        corners[NDIM + d] = box.upper()(d);
+    }
+    return corners;
+} // get_box_corners
+
+/*!
+ * Fill pattern that does not fill the ghost cells of the patches that do not
+ * intersect the narrow band.  The skipped patches are identified by their boxes
+ * so that every process computes the same overlaps.  Only the ghost cells that
+ * are filled from the same level are skipped.
+ */
+class NarrowBandFillPattern : public VariableFillPattern<NDIM>
+{
+public:
+    NarrowBandFillPattern(std::vector<std::set<BoxCorners> > skipped_patch_boxes)
+        : d_skipped_patch_boxes(std::move(skipped_patch_boxes))
+    {
+        // intentionally blank
+        return;
+    } // NarrowBandFillPattern
+
+    Pointer<BoxOverlap<NDIM> > calculateOverlap(const BoxGeometry<NDIM>& dst_geometry,
+                                                const BoxGeometry<NDIM>& src_geometry,
+                                                const Box<NDIM>& /*dst_patch_box*/,
+                                                const Box<NDIM>& src_mask,
+                                                const bool overwrite_interior,
+                                                const IntVector<NDIM>& src_offset) const override
+    {
+        return dst_geometry.calculateOverlap(src_geometry, src_mask, overwrite_interior, src_offset);
+    } // calculateOverlap
+
+    Pointer<BoxOverlap<NDIM> > calculateOverlapOnLevel(const BoxGeometry<NDIM>& dst_geometry,
+                                                       const BoxGeometry<NDIM>& src_geometry,
+                                                       const Box<NDIM>& dst_patch_box,
+                                                       const Box<NDIM>& src_mask,
+                                                       const bool overwrite_interior,
+                                                       const IntVector<NDIM>& src_offset,
+                                                       const int dst_level_num,
+                                                       const int src_level_num) const override
+    {
+        if (dst_level_num == d_target_level_num && src_level_num == d_target_level_num && d_target_level_num >= 0 &&
+            d_target_level_num < static_cast<int>(d_skipped_patch_boxes.size()) &&
+            d_skipped_patch_boxes[d_target_level_num].count(get_box_corners(dst_patch_box)))
+        {
+            return new CellOverlap<NDIM>(BoxList<NDIM>(), src_offset);
+        }
+        return dst_geometry.calculateOverlap(src_geometry, src_mask, overwrite_interior, src_offset);
+    } // calculateOverlapOnLevel
+
+    void setTargetPatchLevelNumber(const int level_num) override
+    {
+        d_target_level_num = level_num;
+        return;
+    } // setTargetPatchLevelNumber
+
+    IntVector<NDIM>& getStencilWidth() override
+    {
+        return d_stencil_width;
+    } // getStencilWidth
+
+    const std::string& getPatternName() const override
+    {
+        return NARROW_BAND_PATTERN_NAME;
+    } // getPatternName
+
+private:
+    std::vector<std::set<BoxCorners> > d_skipped_patch_boxes;
+    IntVector<NDIM> d_stencil_width = IntVector<NDIM>(0);
+    int d_target_level_num = -1;
+};
+} // namespace
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 LSInitStrategy::LSInitStrategy(std::string object_name, bool register_for_restart)
@@ -49,6 +164,12 @@ LSInitStrategy::~LSInitStrategy()
     }
     d_registered_for_restart = false;
 
+    if (d_narrow_band_phi_idx != -1)
+    {
+        VariableDatabase<NDIM>::getDatabase()->removePatchDataIndex(d_narrow_band_phi_idx);
+    }
+
+    return;
 } // ~LSInitStrategy
 
 void
@@ -80,6 +201,201 @@ void LSInitStrategy::putToDatabase(Pointer<Database> /*db*/)
     return;
 } // putToDatabase
 
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+void
+LSInitStrategy::initializeNarrowBand(const int phi_idx, Pointer<HierarchyMathOps> hier_math_ops, const double time)
+{
+    d_narrow_band_idxs.clear();
+    d_narrow_band_cap.clear();
+    d_narrow_band_fill_pattern.setNull();
+    if (d_narrow_band_width <= 0) return;
+
+    Pointer<PatchHierarchy<NDIM> > hierarchy = hier_math_ops->getPatchHierarchy();
+    const int coarsest_ln = 0;
+    const int finest_ln = hierarchy->getFinestLevelNumber();
+    d_narrow_band_idxs.resize(finest_ln + 1);
+    d_narrow_band_cap.resize(finest_ln + 1);
+
+    // Create a copy of the level set with enough ghost cells to detect the
+    // interface in neighboring patches.  The width of the band does not change
+    // after construction, so the copy only needs to be registered once.
+    const int band_width = d_narrow_band_width;
+    if (d_narrow_band_phi_idx == -1)
+    {
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        d_narrow_band_phi_var = new CellVariable<NDIM, double>(d_object_name + "::phi_narrow_band");
+        d_narrow_band_phi_idx = var_db->registerVariableAndContext(d_narrow_band_phi_var,
+                                                                   var_db->getContext(d_object_name + "::NARROW_BAND"),
+                                                                   IntVector<NDIM>(band_width + 1));
+    }
+    const int phi_band_idx = d_narrow_band_phi_idx;
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        hierarchy->getPatchLevel(ln)->allocatePatchData(phi_band_idx, time);
+    }
+    HierarchyCellDataOpsReal<NDIM, double> hier_cc_data_ops(hierarchy, coarsest_ln, finest_ln);
+    hier_cc_data_ops.copyData(phi_band_idx, phi_idx);
+    using InterpolationTransactionComponent = HierarchyGhostCellInterpolation::InterpolationTransactionComponent;
+    InterpolationTransactionComponent phi_transaction(
+        phi_band_idx, "LINEAR_REFINE", false, "NONE", "LINEAR", false, d_bc_coef);
+    Pointer<HierarchyGhostCellInterpolation> fill_op = new HierarchyGhostCellInterpolation();
+    fill_op->initializeOperatorState(phi_transaction, hierarchy);
+    fill_op->fillData(time);
+
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+            const double* const dx = pgeom->getDx();
+            d_narrow_band_cap[ln] = (band_width + 1) * std::sqrt(static_cast<double>(NDIM)) *
+                                    (*std::max_element(dx, dx + NDIM));
+
+            // Mark all cells of the patch that are within band_width cells of
+            // a sign change of the level set.  Sign changes in the ghost cell
+            // region are also considered so that the band extends across patch
+            // boundaries.
+            Pointer<CellData<NDIM, double> > phi_data = patch->getPatchData(phi_band_idx);
+            CellData<NDIM, int> band_mask(patch_box, 1, IntVector<NDIM>(0));
+            band_mask.fillAll(0);
+            for (CellIterator<NDIM> ic(Box<NDIM>::grow(patch_box, IntVector<NDIM>(band_width))); ic; ic++)
+            {
+                const CellIndex<NDIM>& i = ic();
+                bool is_interface_cell = false;
+                for (unsigned int axis = 0; axis < NDIM && !is_interface_cell; ++axis)
+                {
+                    for (int shift = -1; shift <= 1 && !is_interface_cell; shift += 2)
+                    {
+                        CellIndex<NDIM> i_nbr = i;
+                        i_nbr(axis) += shift;
+                        is_interface_cell = (*phi_data)(i) * (*phi_data)(i_nbr) <= 0.0;
+                    }
+                }
+                if (!is_interface_cell) continue;
+                Box<NDIM> nbhd(i, i);
+                nbhd.grow(IntVector<NDIM>(band_width));
+                band_mask.fill(1, nbhd * patch_box);
+            }
+
+            std::vector<hier::Index<NDIM> > band_idxs;
+            for (CellIterator<NDIM> ic(patch_box); ic; ic++)
+            {
+                if (band_mask(ic())) band_idxs.push_back(ic());
+            }
+            if (!band_idxs.empty()) d_narrow_band_idxs[ln][p()] = std::move(band_idxs);
+
+            // Cap the level set on all patches.
+            Pointer<CellData<NDIM, double> > phi_dst_data = patch->getPatchData(phi_idx);
+            double* const phi = phi_dst_data->getPointer();
+            const double cap = d_narrow_band_cap[ln];
+            for (int k = 0; k < phi_dst_data->getGhostBox().size(); ++k)
+            {
+                phi[k] = std::max(-cap, std::min(cap, phi[k]));
+            }
+        }
+    }
+
+    // Determine the patches that do not intersect the band on any process, so
+    // that their ghost cells can be skipped.
+    std::vector<std::set<BoxCorners> > skipped_patch_boxes(finest_ln + 1);
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        std::vector<int> patch_in_band(level->getNumberOfPatches(), 0);
+        for (const auto& patch_band_idxs : d_narrow_band_idxs[ln]) patch_in_band[patch_band_idxs.first] = 1;
+        IBTK_MPI::sumReduction(patch_in_band.data(), static_cast<int>(patch_in_band.size()));
+        const BoxArray<NDIM>& level_boxes = level->getBoxes();
+        for (int k = 0; k < static_cast<int>(patch_in_band.size()); ++k)
+        {
+            if (!patch_in_band[k]) skipped_patch_boxes[ln].insert(get_box_corners(level_boxes[k]));
+        }
+        level->deallocatePatchData(phi_band_idx);
+    }
+    d_narrow_band_fill_pattern = new NarrowBandFillPattern(std::move(skipped_patch_boxes));
+    return;
+} // initializeNarrowBand
+
+bool
+LSInitStrategy::patchIntersectsNarrowBand(const int ln, const int patch_num) const
+{
+    if (d_narrow_band_width <= 0) return true;
+    return ln < static_cast<int>(d_narrow_band_idxs.size()) && d_narrow_band_idxs[ln].count(patch_num) > 0;
+} // patchIntersectsNarrowBand
+
+Pointer<VariableFillPattern<NDIM> >
+LSInitStrategy::getNarrowBandFillPattern() const
+{
+    return d_narrow_band_fill_pattern;
+} // getNarrowBandFillPattern
+
+void
+LSInitStrategy::capNarrowBandData(const int phi_idx, Pointer<PatchHierarchy<NDIM> > hierarchy) const
+{
+    for (int ln = 0; ln < static_cast<int>(d_narrow_band_idxs.size()); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        const double cap = d_narrow_band_cap[ln];
+        for (const auto& patch_band_idxs : d_narrow_band_idxs[ln])
+        {
+            Pointer<CellData<NDIM, double> > phi_data = level->getPatch(patch_band_idxs.first)->getPatchData(phi_idx);
+            double* const phi = phi_data->getPointer();
+            for (int k = 0; k < phi_data->getGhostBox().size(); ++k)
+            {
+                phi[k] = std::max(-cap, std::min(cap, phi[k]));
+            }
+        }
+    }
+    return;
+} // capNarrowBandData
+
+void
+LSInitStrategy::copyNarrowBandData(const int dst_idx, const int src_idx, Pointer<PatchHierarchy<NDIM> > hierarchy) const
+{
+    for (int ln = 0; ln < static_cast<int>(d_narrow_band_idxs.size()); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        for (const auto& patch_band_idxs : d_narrow_band_idxs[ln])
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(patch_band_idxs.first);
+            Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
+            Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
+            dst_data->copy(*src_data);
+        }
+    }
+    return;
+} // copyNarrowBandData
+
+double
+LSInitStrategy::computeNarrowBandDifferenceNorm(const int phi_idx,
+                                                const int phi_prev_idx,
+                                                const int wgt_idx,
+                                                Pointer<PatchHierarchy<NDIM> > hierarchy) const
+{
+    double diff_norm_sq = 0.0;
+    for (int ln = 0; ln < static_cast<int>(d_narrow_band_idxs.size()); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        for (const auto& patch_band_idxs : d_narrow_band_idxs[ln])
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(patch_band_idxs.first);
+            Pointer<CellData<NDIM, double> > phi_data = patch->getPatchData(phi_idx);
+            Pointer<CellData<NDIM, double> > phi_prev_data = patch->getPatchData(phi_prev_idx);
+            Pointer<CellData<NDIM, double> > wgt_data = patch->getPatchData(wgt_idx);
+            for (const hier::Index<NDIM>& idx : patch_band_idxs.second)
+            {
+                const CellIndex<NDIM> i(idx);
+                const double diff = (*phi_data)(i) - (*phi_prev_data)(i);
+                diff_norm_sq += diff * diff * (*wgt_data)(i);
+            }
+        }
+    }
+    return std::sqrt(IBTK_MPI::sumReduction(diff_norm_sq));
+} // computeNarrowBandDifferenceNorm
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBAMR
@@ -30,6 +30,7 @@
 #include "IntVector.h"
 #include "Patch.h"
 #include "PatchHierarchy.h"
+#include "PatchCellDataOpsReal.h"
 #include "PatchLevel.h"
 #include "Variable.h"
 #include "VariableContext.h"
@@ -260,6 +261,15 @@ RelaxationLSMethod::initializeLSData(int D_idx,
     }
     const bool constrain_ls_mass = (d_apply_mass_constraint && !initial_time);
 
+    const bool use_narrow_band = d_narrow_band_width > 0;
+    if (use_narrow_band && (d_apply_mass_constraint || d_apply_volume_shift))
+    {
+        TBOX_ERROR(d_object_name << "::initializeLSData():\n"
+                                 << " narrow band reinitialization is not compatible with the mass constraint or "
+                                    "the volume shift"
+                                 << std::endl);
+    }
+
     VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
     Pointer<Variable<NDIM> > data_var;
     var_db->mapIndexToVariable(D_idx, data_var);
@@ -338,10 +348,20 @@ RelaxationLSMethod::initializeLSData(int D_idx,
         (*d_locate_interface_fcns[k])(D_scratch_idx, hier_math_ops, time, initial_time, d_locate_interface_fcns_ctx[k]);
     }
 
-    // Set hierarchy objects.
+    // Determine the narrow band about the interface, if requested.
+    initializeNarrowBand(D_scratch_idx, hier_math_ops, time);
+
+    // Set hierarchy objects.  In narrow band mode, only the ghost cells of the
+    // patches that intersect the band are filled.
     using InterpolationTransactionComponent = HierarchyGhostCellInterpolation::InterpolationTransactionComponent;
-    InterpolationTransactionComponent D_transaction(
-        D_scratch_idx, "CONSERVATIVE_LINEAR_REFINE", true, "CONSERVATIVE_COARSEN", "LINEAR", false, d_bc_coef);
+    InterpolationTransactionComponent D_transaction(D_scratch_idx,
+                                                    "CONSERVATIVE_LINEAR_REFINE",
+                                                    true,
+                                                    "CONSERVATIVE_COARSEN",
+                                                    "LINEAR",
+                                                    false,
+                                                    d_bc_coef,
+                                                    getNarrowBandFillPattern());
     Pointer<HierarchyGhostCellInterpolation> D_fill_op = new HierarchyGhostCellInterpolation();
     InterpolationTransactionComponent H_transcation(
         H_init_idx, "CONSERVATIVE_LINEAR_REFINE", true, "CONSERVATIVE_COARSEN", "LINEAR", false, nullptr);
@@ -381,6 +401,45 @@ RelaxationLSMethod::initializeLSData(int D_idx,
 
     while (diff_L2_norm > d_abs_tol && outer_iter < d_max_its)
     {
+        if (use_narrow_band)
+        {
+            // Only the patches that intersect the narrow band are relaxed, so
+            // the remaining patches are left untouched.
+            copyNarrowBandData(D_iter_idx, D_scratch_idx, hierarchy);
+            D_fill_op->fillData(time);
+            relax(hier_math_ops, D_scratch_idx, D_init_idx, outer_iter);
+            PatchCellDataOpsReal<NDIM, double> patch_cc_data_ops;
+            for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+            {
+                Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+                for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+                {
+                    if (!patchIntersectsNarrowBand(ln, p())) continue;
+                    Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                    Pointer<CellData<NDIM, double> > D_scratch_data = patch->getPatchData(D_scratch_idx);
+                    Pointer<CellData<NDIM, double> > D_iter_data = patch->getPatchData(D_iter_idx);
+                    patch_cc_data_ops.linearSum(
+                        D_scratch_data, d_alpha, D_scratch_data, 1.0 - d_alpha, D_iter_data, patch->getBox());
+                }
+            }
+            capNarrowBandData(D_scratch_idx, hierarchy);
+            diff_L2_norm = computeNarrowBandDifferenceNorm(D_scratch_idx, D_iter_idx, cc_wgt_idx, hierarchy);
+            outer_iter += 1;
+
+            if (d_enable_logging)
+            {
+                plog << d_object_name << "::initializeLSData(): After iteration # " << outer_iter << std::endl;
+                plog << d_object_name
+                     << "::initializeLSData(): L2-norm between successive iterations in the narrow band = "
+                     << diff_L2_norm << std::endl;
+            }
+            if (diff_L2_norm <= d_abs_tol && d_enable_logging)
+            {
+                plog << d_object_name << "::initializeLSData(): Relaxation converged in the narrow band" << std::endl;
+            }
+            continue;
+        }
+
         // Refill ghost data and relax
         hier_cc_data_ops.copyData(D_iter_idx, D_scratch_idx);
         D_fill_op->fillData(time);
@@ -414,16 +473,16 @@ RelaxationLSMethod::initializeLSData(int D_idx,
         hier_cc_data_ops.axmy(D_iter_idx, 1.0, D_iter_idx, D_scratch_idx);
         diff_L2_norm = hier_cc_data_ops.L2Norm(D_iter_idx, cc_wgt_idx);
 
-        // Compute difference between |grad phi| and 1
-        D_fill_op->fillData(time);
-        computeInitialHamiltonian(hier_math_ops, H_scratch_idx, D_scratch_idx);
-        hier_cc_data_ops.addScalar(H_scratch_idx, H_scratch_idx, -1.0);
-        const double grad_norm = hier_cc_data_ops.L2Norm(H_scratch_idx, cc_wgt_idx);
-
         outer_iter += 1;
 
         if (d_enable_logging)
         {
+            // Compute difference between |grad phi| and 1
+            D_fill_op->fillData(time);
+            computeInitialHamiltonian(hier_math_ops, H_scratch_idx, D_scratch_idx);
+            hier_cc_data_ops.addScalar(H_scratch_idx, H_scratch_idx, -1.0);
+            const double grad_norm = hier_cc_data_ops.L2Norm(H_scratch_idx, cc_wgt_idx);
+
             plog << d_object_name << "::initializeLSData(): After iteration # " << outer_iter << std::endl;
             plog << d_object_name << "::initializeLSData(): L2-norm between successive iterations = " << diff_L2_norm
                  << std::endl;
@@ -536,6 +595,7 @@ RelaxationLSMethod::relax(Pointer<HierarchyMathOps> hier_math_ops,
         Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
         for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
+            if (!patchIntersectsNarrowBand(ln, p())) continue;
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
             Pointer<CellData<NDIM, double> > dist_data = patch->getPatchData(dist_idx);
             const Pointer<CellData<NDIM, double> > dist_init_data = patch->getPatchData(dist_init_idx);
@@ -1014,6 +1074,15 @@ RelaxationLSMethod::getFromInput(Pointer<Database> input_db)
 
     d_apply_volume_shift = input_db->getBoolWithDefault("apply_volume_shift", d_apply_volume_shift);
 
+    d_narrow_band_width = input_db->getIntegerWithDefault("narrow_band_width", d_narrow_band_width);
+    if (d_narrow_band_width > 0 && (d_apply_mass_constraint || d_apply_volume_shift))
+    {
+        TBOX_ERROR(d_object_name << "::getFromInput():\n"
+                                 << " narrow band reinitialization is not compatible with the mass constraint or "
+                                    "the volume shift"
+                                 << std::endl);
+    }
+
     return;
 } // getFromInput
 
@@ -33,6 +33,7 @@
 #include "ibtk/HierarchyMathOps.h"
 #include "ibtk/IBTK_MPI.h"
 #include "ibtk/LinearSolver.h"
+#include "ibtk/PatchDataMemoryPool.h"
 #include "ibtk/PoissonSolver.h"
 #include "ibtk/ibtk_enums.h"
 #include "ibtk/ibtk_utilities.h"
@@ -896,8 +897,8 @@ INSCollocatedHierarchyIntegrator::preprocessIntegrateHierarchy(const double curr
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->allocatePatchData(d_scratch_data, current_time);
-        level->allocatePatchData(d_new_data, new_time);
+        level->allocatePatchData(d_scratch_data, current_time, PatchDataMemoryPool::getArena());
+        level->allocatePatchData(d_new_data, new_time, PatchDataMemoryPool::getArena());
     }
 
     // Setup the operators and solvers.
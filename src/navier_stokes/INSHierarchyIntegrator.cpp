@@ -28,6 +28,7 @@
 #include "ibtk/IBTK_MPI.h"
 #include "ibtk/PoissonSolver.h"
 
+#include "BoxArray.h"
 #include "FaceVariable.h"
 #include "IntVector.h"
 #include "LocationIndexRobinBcCoefs.h"
@@ -394,6 +395,25 @@ INSHierarchyIntegrator::getNumberOfCycles() const
     return num_cycles;
 } // getNumberOfCycles
 
+std::vector<double>
+INSHierarchyIntegrator::getLevelMaximumTimeStepSizes() const
+{
+    const int finest_ln = d_hierarchy->getFinestLevelNumber();
+    std::vector<double> level_dt(finest_ln + 1);
+    for (int ln = 0; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        level_dt[ln] = d_cfl_max * getStableTimestep(level);
+    }
+    return level_dt;
+} // getLevelMaximumTimeStepSizes
+
+double
+INSHierarchyIntegrator::getEstimatedSubcyclingWorkReduction() const
+{
+    return getEstimatedSubcyclingWorkReduction(getLevelMaximumTimeStepSizes());
+} // getEstimatedSubcyclingWorkReduction
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 INSHierarchyIntegrator::INSHierarchyIntegrator(std::string object_name,
@@ -488,10 +508,15 @@ double
 INSHierarchyIntegrator::getMaximumTimeStepSizeSpecialized()
 {
     double dt = HierarchyIntegrator::getMaximumTimeStepSizeSpecialized();
-    for (int ln = 0; ln <= d_hierarchy->getFinestLevelNumber(); ++ln)
+    const std::vector<double> level_dt = getLevelMaximumTimeStepSizes();
+    for (const double level_dt_ln : level_dt)
     {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        dt = std::min(dt, d_cfl_max * getStableTimestep(level));
+        dt = std::min(dt, level_dt_ln);
+    }
+    if (d_enable_logging && d_hierarchy->getFinestLevelNumber() > 0)
+    {
+        plog << d_object_name << "::getMaximumTimeStepSizeSpecialized(): estimated work reduction from time "
+             << "subcycling = " << getEstimatedSubcyclingWorkReduction(level_dt) << "\n";
     }
     return dt;
 } // getMaximumTimeStepSizeSpecialized
@@ -815,6 +840,48 @@ INSHierarchyIntegrator::getFromRestart()
     return;
 } // getFromRestart
 
+double
+INSHierarchyIntegrator::getEstimatedSubcyclingWorkReduction(const std::vector<double>& level_dt) const
+{
+    const int finest_ln = d_hierarchy->getFinestLevelNumber();
+#if !defined(NDEBUG)
+    TBOX_ASSERT(static_cast<int>(level_dt.size()) == finest_ln + 1);
+#endif
+
+    // Determine the number of cells on each level and the total refinement
+    // ratio between each level and the coarsest level.
+    std::vector<double> n_cells(finest_ln + 1, 0.0), ratio_to_coarsest(finest_ln + 1, 1.0);
+    for (int ln = 0; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        const BoxArray<NDIM>& boxes = level->getBoxes();
+        for (int k = 0; k < boxes.getNumberOfBoxes(); ++k)
+        {
+            n_cells[ln] += static_cast<double>(boxes[k].size());
+        }
+        if (ln > 0) ratio_to_coarsest[ln] = ratio_to_coarsest[ln - 1] * level->getRatioToCoarserLevel().max();
+    }
+
+    // With subcycling, the coarsest level time step size is limited by the
+    // stability constraints on all finer levels scaled by the refinement
+    // ratios, and each finer level takes ratio_to_coarsest[ln] steps for each
+    // coarsest level step.
+    double dt_sync = std::numeric_limits<double>::max();
+    double dt_coarsest = std::numeric_limits<double>::max();
+    for (int ln = 0; ln <= finest_ln; ++ln)
+    {
+        dt_sync = std::min(dt_sync, level_dt[ln]);
+        dt_coarsest = std::min(dt_coarsest, level_dt[ln] * ratio_to_coarsest[ln]);
+    }
+    double work_sync = 0.0, work_subcycled = 0.0;
+    for (int ln = 0; ln <= finest_ln; ++ln)
+    {
+        work_sync += n_cells[ln] / dt_sync;
+        work_subcycled += n_cells[ln] * ratio_to_coarsest[ln] / dt_coarsest;
+    }
+    return work_subcycled > 0.0 ? work_sync / work_subcycled : 1.0;
+} // getEstimatedSubcyclingWorkReduction
+
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBAMR
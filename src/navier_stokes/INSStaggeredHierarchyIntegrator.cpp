@@ -45,6 +45,7 @@
 #include "ibtk/KrylovLinearSolver.h"
 #include "ibtk/LinearSolver.h"
 #include "ibtk/NewtonKrylovSolver.h"
+#include "ibtk/PatchDataMemoryPool.h"
 #include "ibtk/PoissonSolver.h"
 #include "ibtk/SCPoissonSolverManager.h"
 #include "ibtk/SideDataSynchronization.h"
@@ -541,6 +542,11 @@ INSStaggeredHierarchyIntegrator::INSStaggeredHierarchyIntegrator(std::string obj
     if (input_db->keyExists("explicitly_remove_nullspace"))
         d_explicitly_remove_nullspace = input_db->getBool("explicitly_remove_nullspace");
 
+    // Order of the extrapolation used to compute initial guesses for the
+    // Stokes solver.
+    if (input_db->keyExists("stokes_initial_guess_extrapolation_order"))
+        setStokesInitialGuessExtrapolationOrder(input_db->getInteger("stokes_initial_guess_extrapolation_order"));
+
     // Setup physical boundary conditions objects.
     d_bc_helper = new StaggeredStokesPhysicalBoundaryHelper();
     d_U_bc_coefs.resize(NDIM);
@@ -628,6 +634,7 @@ INSStaggeredHierarchyIntegrator::~INSStaggeredHierarchyIntegrator()
     {
         if (U_nul_vec) U_nul_vec->freeVectorComponents();
     }
+    clearStokesSolutionHistory();
     return;
 } // ~INSStaggeredHierarchyIntegrator
 
@@ -739,6 +746,34 @@ INSStaggeredHierarchyIntegrator::setStokesSolverNeedsInit()
     return;
 }
 
+void
+INSStaggeredHierarchyIntegrator::setStokesInitialGuessExtrapolationOrder(const int order)
+{
+    if (order < 0 || order > 2)
+    {
+        TBOX_ERROR(d_object_name << "::setStokesInitialGuessExtrapolationOrder():\n"
+                                 << "  unsupported extrapolation order: " << order << "\n"
+                                 << "  valid choices are: 0, 1, 2\n");
+    }
+    d_stokes_initial_guess_extrap_order = order;
+    if (static_cast<int>(d_stokes_sol_history.size()) > order + 1)
+    {
+        for (auto it = d_stokes_sol_history.begin() + (order + 1); it != d_stokes_sol_history.end(); ++it)
+        {
+            (*it)->freeVectorComponents();
+        }
+        d_stokes_sol_history.resize(order + 1);
+        d_stokes_sol_history_times.resize(order + 1);
+    }
+    return;
+} // setStokesInitialGuessExtrapolationOrder
+
+int
+INSStaggeredHierarchyIntegrator::getNumberOfStoredStokesSolutions() const
+{
+    return static_cast<int>(d_stokes_sol_history.size());
+} // getNumberOfStoredStokesSolutions
+
 void
 INSStaggeredHierarchyIntegrator::initializeHierarchyIntegrator(Pointer<PatchHierarchy<NDIM> > hierarchy,
                                                                Pointer<GriddingAlgorithm<NDIM> > gridding_alg)
@@ -1226,8 +1261,8 @@ INSStaggeredHierarchyIntegrator::preprocessIntegrateHierarchy(const double curre
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->allocatePatchData(d_scratch_data, current_time);
-        level->allocatePatchData(d_new_data, new_time);
+        level->allocatePatchData(d_scratch_data, current_time, PatchDataMemoryPool::getArena());
+        level->allocatePatchData(d_new_data, new_time, PatchDataMemoryPool::getArena());
     }
 
     // Setup the operators and solvers.
@@ -1417,6 +1452,14 @@ INSStaggeredHierarchyIntegrator::integrateHierarchy(const double current_time,
     // Setup the solution and right-hand-side vectors.
     setupSolverVectors(d_sol_vec, d_rhs_vec, current_time, new_time, cycle_num);
 
+    // During the first cycle, use the solutions from previous time steps to
+    // compute an improved initial guess.  Subsequent cycles use the solution
+    // from the previous cycle.
+    if (cycle_num == 0 && d_stokes_initial_guess_extrap_order > 0)
+    {
+        extrapolateStokesSolution(d_sol_vec, current_time, new_time);
+    }
+
     // Solve for u(n+1), p(n+1/2).
     d_stokes_solver->solveSystem(*d_sol_vec, *d_rhs_vec);
     if (d_enable_logging && d_enable_logging_solver_iterations)
@@ -1429,6 +1472,12 @@ INSStaggeredHierarchyIntegrator::integrateHierarchy(const double current_time,
              << "\n";
     if (d_explicitly_remove_nullspace) removeNullSpace(d_sol_vec);
 
+    // Store the final solution of the time step.
+    if (cycle_num == d_current_num_cycles - 1 && d_stokes_initial_guess_extrap_order > 0)
+    {
+        storeStokesSolution(d_sol_vec, current_time, new_time);
+    }
+
     // Reset the solution and right-hand-side vectors.
     resetSolverVectors(d_sol_vec, d_rhs_vec, current_time, new_time, cycle_num);
 
@@ -2237,6 +2286,10 @@ INSStaggeredHierarchyIntegrator::resetHierarchyConfigurationSpecialized(
     d_velocity_solver_needs_init = true;
     d_pressure_solver_needs_init = true;
     d_stokes_solver_needs_init = true;
+
+    // Solutions stored on the old hierarchy configuration can no longer be
+    // used to compute initial guesses.
+    clearStokesSolutionHistory();
     return;
 } // resetHierarchyConfigurationSpecialized
 
@@ -2975,6 +3028,86 @@ INSStaggeredHierarchyIntegrator::computeDivSourceTerm(const int F_idx, const int
     return;
 } // computeDivSourceTerm
 
+void
+INSStaggeredHierarchyIntegrator::extrapolateStokesSolution(const Pointer<SAMRAIVectorReal<NDIM, double> >& sol_vec,
+                                                           const double current_time,
+                                                           const double new_time)
+{
+    // A single stored solution corresponds to the current state, which is
+    // already used as the initial guess.
+    const int n_sols =
+        std::min(d_stokes_initial_guess_extrap_order + 1, static_cast<int>(d_stokes_sol_history.size()));
+    if (n_sols < 2) return;
+
+    // The velocity is defined at the end of each time step and the pressure is
+    // defined at the midpoint of each time step, so that we use separate
+    // Lagrange interpolation weights for the two components.
+    const double U_time = new_time;
+    const double P_time = 0.5 * (current_time + new_time);
+    std::vector<double> U_times(n_sols), P_times(n_sols);
+    for (int k = 0; k < n_sols; ++k)
+    {
+        U_times[k] = d_stokes_sol_history_times[k].second;
+        P_times[k] = 0.5 * (d_stokes_sol_history_times[k].first + d_stokes_sol_history_times[k].second);
+    }
+    const std::vector<double> U_weights = IBTK::lagrange_interpolation_weights(U_times, U_time);
+    const std::vector<double> P_weights = IBTK::lagrange_interpolation_weights(P_times, P_time);
+
+    const int U_sol_idx = sol_vec->getComponentDescriptorIndex(0);
+    const int P_sol_idx = sol_vec->getComponentDescriptorIndex(1);
+    d_hier_sc_data_ops->setToScalar(U_sol_idx, 0.0);
+    d_hier_cc_data_ops->setToScalar(P_sol_idx, 0.0);
+    for (int k = 0; k < n_sols; ++k)
+    {
+        d_hier_sc_data_ops->axpy(U_sol_idx,
+                                 U_weights[k],
+                                 d_stokes_sol_history[k]->getComponentDescriptorIndex(0),
+                                 U_sol_idx);
+        d_hier_cc_data_ops->axpy(P_sol_idx,
+                                 P_weights[k],
+                                 d_stokes_sol_history[k]->getComponentDescriptorIndex(1),
+                                 P_sol_idx);
+    }
+    return;
+} // extrapolateStokesSolution
+
+void
+INSStaggeredHierarchyIntegrator::storeStokesSolution(const Pointer<SAMRAIVectorReal<NDIM, double> >& sol_vec,
+                                                     const double current_time,
+                                                     const double new_time)
+{
+    // Recycle the storage of the oldest solution once the history is full.
+    Pointer<SAMRAIVectorReal<NDIM, double> > stored_sol_vec;
+    if (static_cast<int>(d_stokes_sol_history.size()) == d_stokes_initial_guess_extrap_order + 1)
+    {
+        stored_sol_vec = d_stokes_sol_history.back();
+        d_stokes_sol_history.pop_back();
+        d_stokes_sol_history_times.pop_back();
+    }
+    else
+    {
+        stored_sol_vec = sol_vec->cloneVector(d_object_name + "::stokes_sol_history_vec_" +
+                                              std::to_string(d_stokes_sol_history.size()));
+        stored_sol_vec->allocateVectorData(new_time);
+    }
+    stored_sol_vec->copyVector(sol_vec);
+    d_stokes_sol_history.push_front(stored_sol_vec);
+    d_stokes_sol_history_times.emplace_front(current_time, new_time);
+    return;
+} // storeStokesSolution
+
+void
+INSStaggeredHierarchyIntegrator::clearStokesSolutionHistory()
+{
+    for (const auto& stored_sol_vec : d_stokes_sol_history)
+    {
+        stored_sol_vec->freeVectorComponents();
+    }
+    d_stokes_sol_history.clear();
+    d_stokes_sol_history_times.clear();
+    return;
+} // clearStokesSolutionHistory
+
 TimeSteppingType
 INSStaggeredHierarchyIntegrator::getConvectiveTimeSteppingType(const int cycle_num)
 {
@@ -23,7 +23,7 @@
 
 #include "Box.h"
 #include "CartesianPatchGeometry.h"
-#include "FaceData.h"
+#include "FaceGeometry.h"
 #include "Index.h"
 #include "IntVector.h"
 #include "MultiblockDataTranslator.h"
@@ -44,6 +44,7 @@
 #include "tbox/Utilities.h"
 
 #include <array>
+#include <cstddef>
 #include <ostream>
 #include <string>
 #include <utility>
@@ -441,6 +442,15 @@ namespace
 // Kamm).
 static const int GADVECTG = 4;
 
+// Return a pointer to a buffer that can store at least n values, enlarging the
+// buffer if necessary.
+inline double*
+getScratchBuffer(std::vector<double>& buffer, const std::size_t n)
+{
+    if (buffer.size() < n) buffer.resize(n);
+    return buffer.data();
+} // getScratchBuffer
+
 // Timers.
 static Timer* t_apply_convective_operator;
 static Timer* t_apply;
@@ -567,15 +577,24 @@ INSStaggeredPPMConvectiveOperator::applyConvectiveOperator(const int U_idx, cons
             Pointer<SideData<NDIM, double> > N_data = patch->getPatchData(N_idx);
             Pointer<SideData<NDIM, double> > U_data = patch->getPatchData(d_U_scratch_idx);
 
+            // The face-centered advection velocities and the predicted
+            // velocities, and the work arrays used by the Godunov predictor,
+            // are stored in buffers that are reused across axes, patches, and
+            // calls, rather than in patch data objects that are allocated and
+            // deallocated for each patch.
             const IntVector<NDIM> ghosts = IntVector<NDIM>(1);
             std::array<Box<NDIM>, NDIM> side_boxes;
-            std::array<Pointer<FaceData<NDIM, double> >, NDIM> U_adv_data;
-            std::array<Pointer<FaceData<NDIM, double> >, NDIM> U_half_data;
+            std::array<std::array<double*, NDIM>, NDIM> U_adv, U_half;
             for (unsigned int axis = 0; axis < NDIM; ++axis)
             {
                 side_boxes[axis] = SideGeometry<NDIM>::toSideBox(patch_box, axis);
-                U_adv_data[axis] = new FaceData<NDIM, double>(side_boxes[axis], 1, ghosts);
-                U_half_data[axis] = new FaceData<NDIM, double>(side_boxes[axis], 1, ghosts);
+                const Box<NDIM> side_ghost_box = Box<NDIM>::grow(side_boxes[axis], ghosts);
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    const std::size_t face_size = FaceGeometry<NDIM>::toFaceBox(side_ghost_box, d).size();
+                    U_adv[axis][d] = getScratchBuffer(d_U_adv_buffers[axis][d], face_size);
+                    U_half[axis][d] = getScratchBuffer(d_U_half_buffers[axis][d], face_size);
+                }
             }
 #if (NDIM == 2)
             NAVIER_STOKES_INTERP_COMPS_FC(patch_lower(0),
@@ -590,18 +609,18 @@ INSStaggeredPPMConvectiveOperator::applyConvectiveOperator(const int U_idx, cons
                                           side_boxes[0].upper(0),
                                           side_boxes[0].lower(1),
                                           side_boxes[0].upper(1),
-                                          U_adv_data[0]->getGhostCellWidth()(0),
-                                          U_adv_data[0]->getGhostCellWidth()(1),
-                                          U_adv_data[0]->getPointer(0),
-                                          U_adv_data[0]->getPointer(1),
+                                          ghosts(0),
+                                          ghosts(1),
+                                          U_adv[0][0],
+                                          U_adv[0][1],
                                           side_boxes[1].lower(0),
                                           side_boxes[1].upper(0),
                                           side_boxes[1].lower(1),
                                           side_boxes[1].upper(1),
-                                          U_adv_data[1]->getGhostCellWidth()(0),
-                                          U_adv_data[1]->getGhostCellWidth()(1),
-                                          U_adv_data[1]->getPointer(0),
-                                          U_adv_data[1]->getPointer(1));
+                                          ghosts(0),
+                                          ghosts(1),
+                                          U_adv[1][0],
+                                          U_adv[1][1]);
 #endif
 #if (NDIM == 3)
             NAVIER_STOKES_INTERP_COMPS_FC(patch_lower(0),
@@ -622,50 +641,48 @@ INSStaggeredPPMConvectiveOperator::applyConvectiveOperator(const int U_idx, cons
                                           side_boxes[0].upper(1),
                                           side_boxes[0].lower(2),
                                           side_boxes[0].upper(2),
-                                          U_adv_data[0]->getGhostCellWidth()(0),
-                                          U_adv_data[0]->getGhostCellWidth()(1),
-                                          U_adv_data[0]->getGhostCellWidth()(2),
-                                          U_adv_data[0]->getPointer(0),
-                                          U_adv_data[0]->getPointer(1),
-                                          U_adv_data[0]->getPointer(2),
+                                          ghosts(0),
+                                          ghosts(1),
+                                          ghosts(2),
+                                          U_adv[0][0],
+                                          U_adv[0][1],
+                                          U_adv[0][2],
                                           side_boxes[1].lower(0),
                                           side_boxes[1].upper(0),
                                           side_boxes[1].lower(1),
                                           side_boxes[1].upper(1),
                                           side_boxes[1].lower(2),
                                           side_boxes[1].upper(2),
-                                          U_adv_data[1]->getGhostCellWidth()(0),
-                                          U_adv_data[1]->getGhostCellWidth()(1),
-                                          U_adv_data[1]->getGhostCellWidth()(2),
-                                          U_adv_data[1]->getPointer(0),
-                                          U_adv_data[1]->getPointer(1),
-                                          U_adv_data[1]->getPointer(2),
+                                          ghosts(0),
+                                          ghosts(1),
+                                          ghosts(2),
+                                          U_adv[1][0],
+                                          U_adv[1][1],
+                                          U_adv[1][2],
                                           side_boxes[2].lower(0),
                                           side_boxes[2].upper(0),
                                           side_boxes[2].lower(1),
                                           side_boxes[2].upper(1),
                                           side_boxes[2].lower(2),
                                           side_boxes[2].upper(2),
-                                          U_adv_data[2]->getGhostCellWidth()(0),
-                                          U_adv_data[2]->getGhostCellWidth()(1),
-                                          U_adv_data[2]->getGhostCellWidth()(2),
-                                          U_adv_data[2]->getPointer(0),
-                                          U_adv_data[2]->getPointer(1),
-                                          U_adv_data[2]->getPointer(2));
+                                          ghosts(0),
+                                          ghosts(1),
+                                          ghosts(2),
+                                          U_adv[2][0],
+                                          U_adv[2][1],
+                                          U_adv[2][2]);
 #endif
             for (unsigned int axis = 0; axis < NDIM; ++axis)
             {
-                Pointer<SideData<NDIM, double> > dU_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
-                Pointer<SideData<NDIM, double> > U_L_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
-                Pointer<SideData<NDIM, double> > U_R_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
-                Pointer<SideData<NDIM, double> > U_scratch1_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
+                // Only the work arrays for the component that is being
+                // extrapolated are required.
+                const std::size_t work_size = U_data->getArrayData(axis).getBox().size();
+                double* const dU = getScratchBuffer(d_dU_buffer, work_size);
+                double* const U_L = getScratchBuffer(d_U_L_buffer, work_size);
+                double* const U_R = getScratchBuffer(d_U_R_buffer, work_size);
+                double* const U_scratch1 = getScratchBuffer(d_U_scratch1_buffer, work_size);
 #if (NDIM == 3)
-                Pointer<SideData<NDIM, double> > U_scratch2_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
+                double* const U_scratch2 = getScratchBuffer(d_U_scratch2_buffer, work_size);
 #endif
 #if (NDIM == 2)
                 GODUNOV_EXTRAPOLATE_FC(side_boxes[axis].lower(0),
@@ -675,18 +692,18 @@ INSStaggeredPPMConvectiveOperator::applyConvectiveOperator(const int U_idx, cons
                                        U_data->getGhostCellWidth()(0),
                                        U_data->getGhostCellWidth()(1),
                                        U_data->getPointer(axis),
-                                       U_scratch1_data->getPointer(axis),
-                                       dU_data->getPointer(axis),
-                                       U_L_data->getPointer(axis),
-                                       U_R_data->getPointer(axis),
-                                       U_adv_data[axis]->getGhostCellWidth()(0),
-                                       U_adv_data[axis]->getGhostCellWidth()(1),
-                                       U_half_data[axis]->getGhostCellWidth()(0),
-                                       U_half_data[axis]->getGhostCellWidth()(1),
-                                       U_adv_data[axis]->getPointer(0),
-                                       U_adv_data[axis]->getPointer(1),
-                                       U_half_data[axis]->getPointer(0),
-                                       U_half_data[axis]->getPointer(1));
+                                       U_scratch1,
+                                       dU,
+                                       U_L,
+                                       U_R,
+                                       ghosts(0),
+                                       ghosts(1),
+                                       ghosts(0),
+                                       ghosts(1),
+                                       U_adv[axis][0],
+                                       U_adv[axis][1],
+                                       U_half[axis][0],
+                                       U_half[axis][1]);
 #endif
 #if (NDIM == 3)
                 GODUNOV_EXTRAPOLATE_FC(side_boxes[axis].lower(0),
@@ -699,23 +716,23 @@ INSStaggeredPPMConvectiveOperator::applyConvectiveOperator(const int U_idx, cons
                                        U_data->getGhostCellWidth()(1),
                                        U_data->getGhostCellWidth()(2),
                                        U_data->getPointer(axis),
-                                       U_scratch1_data->getPointer(axis),
-                                       U_scratch2_data->getPointer(axis),
-                                       dU_data->getPointer(axis),
-                                       U_L_data->getPointer(axis),
-                                       U_R_data->getPointer(axis),
-                                       U_adv_data[axis]->getGhostCellWidth()(0),
-                                       U_adv_data[axis]->getGhostCellWidth()(1),
-                                       U_adv_data[axis]->getGhostCellWidth()(2),
-                                       U_half_data[axis]->getGhostCellWidth()(0),
-                                       U_half_data[axis]->getGhostCellWidth()(1),
-                                       U_half_data[axis]->getGhostCellWidth()(2),
-                                       U_adv_data[axis]->getPointer(0),
-                                       U_adv_data[axis]->getPointer(1),
-                                       U_adv_data[axis]->getPointer(2),
-                                       U_half_data[axis]->getPointer(0),
-                                       U_half_data[axis]->getPointer(1),
-                                       U_half_data[axis]->getPointer(2));
+                                       U_scratch1,
+                                       U_scratch2,
+                                       dU,
+                                       U_L,
+                                       U_R,
+                                       ghosts(0),
+                                       ghosts(1),
+                                       ghosts(2),
+                                       ghosts(0),
+                                       ghosts(1),
+                                       ghosts(2),
+                                       U_adv[axis][0],
+                                       U_adv[axis][1],
+                                       U_adv[axis][2],
+                                       U_half[axis][0],
+                                       U_half[axis][1],
+                                       U_half[axis][2]);
 #endif
             }
 #if (NDIM == 2)
@@ -723,26 +740,26 @@ INSStaggeredPPMConvectiveOperator::applyConvectiveOperator(const int U_idx, cons
                                                 side_boxes[0].upper(0),
                                                 side_boxes[0].lower(1),
                                                 side_boxes[0].upper(1),
-                                                U_adv_data[0]->getGhostCellWidth()(0),
-                                                U_adv_data[0]->getGhostCellWidth()(1),
-                                                U_adv_data[0]->getPointer(0),
-                                                U_adv_data[0]->getPointer(1),
-                                                U_half_data[0]->getGhostCellWidth()(0),
-                                                U_half_data[0]->getGhostCellWidth()(1),
-                                                U_half_data[0]->getPointer(0),
-                                                U_half_data[0]->getPointer(1),
+                                                ghosts(0),
+                                                ghosts(1),
+                                                U_adv[0][0],
+                                                U_adv[0][1],
+                                                ghosts(0),
+                                                ghosts(1),
+                                                U_half[0][0],
+                                                U_half[0][1],
                                                 side_boxes[1].lower(0),
                                                 side_boxes[1].upper(0),
                                                 side_boxes[1].lower(1),
                                                 side_boxes[1].upper(1),
-                                                U_adv_data[1]->getGhostCellWidth()(0),
-                                                U_adv_data[1]->getGhostCellWidth()(1),
-                                                U_adv_data[1]->getPointer(0),
-                                                U_adv_data[1]->getPointer(1),
-                                                U_half_data[1]->getGhostCellWidth()(0),
-                                                U_half_data[1]->getGhostCellWidth()(1),
-                                                U_half_data[1]->getPointer(0),
-                                                U_half_data[1]->getPointer(1));
+                                                ghosts(0),
+                                                ghosts(1),
+                                                U_adv[1][0],
+                                                U_adv[1][1],
+                                                ghosts(0),
+                                                ghosts(1),
+                                                U_half[1][0],
+                                                U_half[1][1]);
 #endif
 #if (NDIM == 3)
             NAVIER_STOKES_RESET_ADV_VELOCITY_FC(side_boxes[0].lower(0),
@@ -751,54 +768,54 @@ INSStaggeredPPMConvectiveOperator::applyConvectiveOperator(const int U_idx, cons
                                                 side_boxes[0].upper(1),
                                                 side_boxes[0].lower(2),
                                                 side_boxes[0].upper(2),
-                                                U_adv_data[0]->getGhostCellWidth()(0),
-                                                U_adv_data[0]->getGhostCellWidth()(1),
-                                                U_adv_data[0]->getGhostCellWidth()(2),
-                                                U_adv_data[0]->getPointer(0),
-                                                U_adv_data[0]->getPointer(1),
-                                                U_adv_data[0]->getPointer(2),
-                                                U_half_data[0]->getGhostCellWidth()(0),
-                                                U_half_data[0]->getGhostCellWidth()(1),
-                                                U_half_data[0]->getGhostCellWidth()(2),
-                                                U_half_data[0]->getPointer(0),
-                                                U_half_data[0]->getPointer(1),
-                                                U_half_data[0]->getPointer(2),
+                                                ghosts(0),
+                                                ghosts(1),
+                                                ghosts(2),
+                                                U_adv[0][0],
+                                                U_adv[0][1],
+                                                U_adv[0][2],
+                                                ghosts(0),
+                                                ghosts(1),
+                                                ghosts(2),
+                                                U_half[0][0],
+                                                U_half[0][1],
+                                                U_half[0][2],
                                                 side_boxes[1].lower(0),
                                                 side_boxes[1].upper(0),
                                                 side_boxes[1].lower(1),
                                                 side_boxes[1].upper(1),
                                                 side_boxes[1].lower(2),
                                                 side_boxes[1].upper(2),
-                                                U_adv_data[1]->getGhostCellWidth()(0),
-                                                U_adv_data[1]->getGhostCellWidth()(1),
-                                                U_adv_data[1]->getGhostCellWidth()(2),
-                                                U_adv_data[1]->getPointer(0),
-                                                U_adv_data[1]->getPointer(1),
-                                                U_adv_data[1]->getPointer(2),
-                                                U_half_data[1]->getGhostCellWidth()(0),
-                                                U_half_data[1]->getGhostCellWidth()(1),
-                                                U_half_data[1]->getGhostCellWidth()(2),
-                                                U_half_data[1]->getPointer(0),
-                                                U_half_data[1]->getPointer(1),
-                                                U_half_data[1]->getPointer(2),
+                                                ghosts(0),
+                                                ghosts(1),
+                                                ghosts(2),
+                                                U_adv[1][0],
+                                                U_adv[1][1],
+                                                U_adv[1][2],
+                                                ghosts(0),
+                                                ghosts(1),
+                                                ghosts(2),
+                                                U_half[1][0],
+                                                U_half[1][1],
+                                                U_half[1][2],
                                                 side_boxes[2].lower(0),
                                                 side_boxes[2].upper(0),
                                                 side_boxes[2].lower(1),
                                                 side_boxes[2].upper(1),
                                                 side_boxes[2].lower(2),
                                                 side_boxes[2].upper(2),
-                                                U_adv_data[2]->getGhostCellWidth()(0),
-                                                U_adv_data[2]->getGhostCellWidth()(1),
-                                                U_adv_data[2]->getGhostCellWidth()(2),
-                                                U_adv_data[2]->getPointer(0),
-                                                U_adv_data[2]->getPointer(1),
-                                                U_adv_data[2]->getPointer(2),
-                                                U_half_data[2]->getGhostCellWidth()(0),
-                                                U_half_data[2]->getGhostCellWidth()(1),
-                                                U_half_data[2]->getGhostCellWidth()(2),
-                                                U_half_data[2]->getPointer(0),
-                                                U_half_data[2]->getPointer(1),
-                                                U_half_data[2]->getPointer(2));
+                                                ghosts(0),
+                                                ghosts(1),
+                                                ghosts(2),
+                                                U_adv[2][0],
+                                                U_adv[2][1],
+                                                U_adv[2][2],
+                                                ghosts(0),
+                                                ghosts(1),
+                                                ghosts(2),
+                                                U_half[2][0],
+                                                U_half[2][1],
+                                                U_half[2][2]);
 #endif
             for (unsigned int axis = 0; axis < NDIM; ++axis)
             {
@@ -811,14 +828,14 @@ INSStaggeredPPMConvectiveOperator::applyConvectiveOperator(const int U_idx, cons
                                           side_boxes[axis].upper(0),
                                           side_boxes[axis].lower(1),
                                           side_boxes[axis].upper(1),
-                                          U_adv_data[axis]->getGhostCellWidth()(0),
-                                          U_adv_data[axis]->getGhostCellWidth()(1),
-                                          U_half_data[axis]->getGhostCellWidth()(0),
-                                          U_half_data[axis]->getGhostCellWidth()(1),
-                                          U_adv_data[axis]->getPointer(0),
-                                          U_adv_data[axis]->getPointer(1),
-                                          U_half_data[axis]->getPointer(0),
-                                          U_half_data[axis]->getPointer(1),
+                                          ghosts(0),
+                                          ghosts(1),
+                                          ghosts(0),
+                                          ghosts(1),
+                                          U_adv[axis][0],
+                                          U_adv[axis][1],
+                                          U_half[axis][0],
+                                          U_half[axis][1],
                                           N_data->getGhostCellWidth()(0),
                                           N_data->getGhostCellWidth()(1),
                                           N_data->getPointer(axis));
@@ -831,18 +848,18 @@ INSStaggeredPPMConvectiveOperator::applyConvectiveOperator(const int U_idx, cons
                                           side_boxes[axis].upper(1),
                                           side_boxes[axis].lower(2),
                                           side_boxes[axis].upper(2),
-                                          U_adv_data[axis]->getGhostCellWidth()(0),
-                                          U_adv_data[axis]->getGhostCellWidth()(1),
-                                          U_adv_data[axis]->getGhostCellWidth()(2),
-                                          U_half_data[axis]->getGhostCellWidth()(0),
-                                          U_half_data[axis]->getGhostCellWidth()(1),
-                                          U_half_data[axis]->getGhostCellWidth()(2),
-                                          U_adv_data[axis]->getPointer(0),
-                                          U_adv_data[axis]->getPointer(1),
-                                          U_adv_data[axis]->getPointer(2),
-                                          U_half_data[axis]->getPointer(0),
-                                          U_half_data[axis]->getPointer(1),
-                                          U_half_data[axis]->getPointer(2),
+                                          ghosts(0),
+                                          ghosts(1),
+                                          ghosts(2),
+                                          ghosts(0),
+                                          ghosts(1),
+                                          ghosts(2),
+                                          U_adv[axis][0],
+                                          U_adv[axis][1],
+                                          U_adv[axis][2],
+                                          U_half[axis][0],
+                                          U_half[axis][1],
+                                          U_half[axis][2],
                                           N_data->getGhostCellWidth()(0),
                                           N_data->getGhostCellWidth()(1),
                                           N_data->getGhostCellWidth()(2),
@@ -856,14 +873,14 @@ INSStaggeredPPMConvectiveOperator::applyConvectiveOperator(const int U_idx, cons
                                          side_boxes[axis].upper(0),
                                          side_boxes[axis].lower(1),
                                          side_boxes[axis].upper(1),
-                                         U_adv_data[axis]->getGhostCellWidth()(0),
-                                         U_adv_data[axis]->getGhostCellWidth()(1),
-                                         U_half_data[axis]->getGhostCellWidth()(0),
-                                         U_half_data[axis]->getGhostCellWidth()(1),
-                                         U_adv_data[axis]->getPointer(0),
-                                         U_adv_data[axis]->getPointer(1),
-                                         U_half_data[axis]->getPointer(0),
-                                         U_half_data[axis]->getPointer(1),
+                                         ghosts(0),
+                                         ghosts(1),
+                                         ghosts(0),
+                                         ghosts(1),
+                                         U_adv[axis][0],
+                                         U_adv[axis][1],
+                                         U_half[axis][0],
+                                         U_half[axis][1],
                                          N_data->getGhostCellWidth()(0),
                                          N_data->getGhostCellWidth()(1),
                                          N_data->getPointer(axis));
@@ -876,18 +893,18 @@ INSStaggeredPPMConvectiveOperator::applyConvectiveOperator(const int U_idx, cons
                                          side_boxes[axis].upper(1),
                                          side_boxes[axis].lower(2),
                                          side_boxes[axis].upper(2),
-                                         U_adv_data[axis]->getGhostCellWidth()(0),
-                                         U_adv_data[axis]->getGhostCellWidth()(1),
-                                         U_adv_data[axis]->getGhostCellWidth()(2),
-                                         U_half_data[axis]->getGhostCellWidth()(0),
-                                         U_half_data[axis]->getGhostCellWidth()(1),
-                                         U_half_data[axis]->getGhostCellWidth()(2),
-                                         U_adv_data[axis]->getPointer(0),
-                                         U_adv_data[axis]->getPointer(1),
-                                         U_adv_data[axis]->getPointer(2),
-                                         U_half_data[axis]->getPointer(0),
-                                         U_half_data[axis]->getPointer(1),
-                                         U_half_data[axis]->getPointer(2),
+                                         ghosts(0),
+                                         ghosts(1),
+                                         ghosts(2),
+                                         ghosts(0),
+                                         ghosts(1),
+                                         ghosts(2),
+                                         U_adv[axis][0],
+                                         U_adv[axis][1],
+                                         U_adv[axis][2],
+                                         U_half[axis][0],
+                                         U_half[axis][1],
+                                         U_half[axis][2],
                                          N_data->getGhostCellWidth()(0),
                                          N_data->getGhostCellWidth()(1),
                                          N_data->getGhostCellWidth()(2),
@@ -901,14 +918,14 @@ INSStaggeredPPMConvectiveOperator::applyConvectiveOperator(const int U_idx, cons
                                            side_boxes[axis].upper(0),
                                            side_boxes[axis].lower(1),
                                            side_boxes[axis].upper(1),
-                                           U_adv_data[axis]->getGhostCellWidth()(0),
-                                           U_adv_data[axis]->getGhostCellWidth()(1),
-                                           U_half_data[axis]->getGhostCellWidth()(0),
-                                           U_half_data[axis]->getGhostCellWidth()(1),
-                                           U_adv_data[axis]->getPointer(0),
-                                           U_adv_data[axis]->getPointer(1),
-                                           U_half_data[axis]->getPointer(0),
-                                           U_half_data[axis]->getPointer(1),
+                                           ghosts(0),
+                                           ghosts(1),
+                                           ghosts(0),
+                                           ghosts(1),
+                                           U_adv[axis][0],
+                                           U_adv[axis][1],
+                                           U_half[axis][0],
+                                           U_half[axis][1],
                                            N_data->getGhostCellWidth()(0),
                                            N_data->getGhostCellWidth()(1),
                                            N_data->getPointer(axis));
@@ -921,18 +938,18 @@ INSStaggeredPPMConvectiveOperator::applyConvectiveOperator(const int U_idx, cons
                                            side_boxes[axis].upper(1),
                                            side_boxes[axis].lower(2),
                                            side_boxes[axis].upper(2),
-                                           U_adv_data[axis]->getGhostCellWidth()(0),
-                                           U_adv_data[axis]->getGhostCellWidth()(1),
-                                           U_adv_data[axis]->getGhostCellWidth()(2),
-                                           U_half_data[axis]->getGhostCellWidth()(0),
-                                           U_half_data[axis]->getGhostCellWidth()(1),
-                                           U_half_data[axis]->getGhostCellWidth()(2),
-                                           U_adv_data[axis]->getPointer(0),
-                                           U_adv_data[axis]->getPointer(1),
-                                           U_adv_data[axis]->getPointer(2),
-                                           U_half_data[axis]->getPointer(0),
-                                           U_half_data[axis]->getPointer(1),
-                                           U_half_data[axis]->getPointer(2),
+                                           ghosts(0),
+                                           ghosts(1),
+                                           ghosts(2),
+                                           ghosts(0),
+                                           ghosts(1),
+                                           ghosts(2),
+                                           U_adv[axis][0],
+                                           U_adv[axis][1],
+                                           U_adv[axis][2],
+                                           U_half[axis][0],
+                                           U_half[axis][1],
+                                           U_half[axis][2],
                                            N_data->getGhostCellWidth()(0),
                                            N_data->getGhostCellWidth()(1),
                                            N_data->getGhostCellWidth()(2),
@@ -147,19 +147,6 @@ compute_tangential_extension(const Box<NDIM>& box, const int data_axis)
     extended_box.upper()(data_axis) += 1;
     return extended_box;
 } // compute_tangential_extension
-
-void
-genrandn(ArrayData<NDIM, double>& data, const Box<NDIM>& box)
-{
-    for (int depth = 0; depth < data.getDepth(); ++depth)
-    {
-        for (Box<NDIM>::Iterator i(box); i; i++)
-        {
-            RNG::genrandn(&data(i(), depth));
-        }
-    }
-    return;
-} // genrandn
 } // namespace
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -262,9 +249,13 @@ INSStaggeredStochasticForcing::setDataOnPatchHierarchy(const int data_idx,
 #endif
         }
 
-        // Generate random components.
+        // Generate random components.  The values are generated by a
+        // counter-based generator and hence do not depend on the patch layout.
+        // Each sample k and each data centering is assigned its own substream.
         if (cycle_num == 0)
         {
+            const unsigned int stream_key = RNG::counter_stream_key(d_object_name);
+            const auto step_num = static_cast<unsigned int>(d_fluid_solver->getIntegratorStep());
             for (int k = 0; k < d_num_rand_vals; ++k)
             {
                 for (int level_num = coarsest_ln; level_num <= finest_ln; ++level_num)
@@ -274,16 +265,27 @@ INSStaggeredStochasticForcing::setDataOnPatchHierarchy(const int data_idx,
                     {
                         Pointer<Patch<NDIM> > patch = level->getPatch(p());
                         Pointer<CellData<NDIM, double> > W_cc_data = patch->getPatchData(d_W_cc_idxs[k]);
-                        genrandn(W_cc_data->getArrayData(), W_cc_data->getBox());
+                        RNG::genrandn(
+                            W_cc_data->getArrayData(), W_cc_data->getBox(), stream_key, step_num, 4 * k, level_num);
 #if (NDIM == 2)
                         Pointer<NodeData<NDIM, double> > W_nc_data = patch->getPatchData(d_W_nc_idxs[k]);
-                        genrandn(W_nc_data->getArrayData(), NodeGeometry<NDIM>::toNodeBox(W_nc_data->getBox()));
+                        RNG::genrandn(W_nc_data->getArrayData(),
+                                      NodeGeometry<NDIM>::toNodeBox(W_nc_data->getBox()),
+                                      stream_key,
+                                      step_num,
+                                      4 * k + 1,
+                                      level_num);
 #endif
 #if (NDIM == 3)
                         Pointer<EdgeData<NDIM, double> > W_ec_data = patch->getPatchData(d_W_ec_idxs[k]);
                         for (int d = 0; d < NDIM; ++d)
                         {
-                            genrandn(W_ec_data->getArrayData(d), EdgeGeometry<NDIM>::toEdgeBox(W_ec_data->getBox(), d));
+                            RNG::genrandn(W_ec_data->getArrayData(d),
+                                          EdgeGeometry<NDIM>::toEdgeBox(W_ec_data->getBox(), d),
+                                          stream_key,
+                                          step_num,
+                                          4 * k + 1 + d,
+                                          level_num);
                         }
 #endif
                     }
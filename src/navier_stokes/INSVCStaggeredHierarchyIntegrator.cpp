@@ -49,6 +49,7 @@
 #include "ibtk/NewtonKrylovSolver.h"
 #include "ibtk/PETScKrylovLinearSolver.h"
 #include "ibtk/PETScKrylovPoissonSolver.h"
+#include "ibtk/PatchDataMemoryPool.h"
 #include "ibtk/PoissonFACPreconditioner.h"
 #include "ibtk/PoissonSolver.h"
 #include "ibtk/SCPoissonSolverManager.h"
@@ -1186,8 +1187,8 @@ INSVCStaggeredHierarchyIntegrator::preprocessIntegrateHierarchy(const double cur
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->allocatePatchData(d_scratch_data, current_time);
-        level->allocatePatchData(d_new_data, new_time);
+        level->allocatePatchData(d_scratch_data, current_time, PatchDataMemoryPool::getArena());
+        level->allocatePatchData(d_new_data, new_time, PatchDataMemoryPool::getArena());
         level->allocatePatchData(d_velocity_C_idx, current_time);
         level->allocatePatchData(d_velocity_L_idx, current_time);
         level->allocatePatchData(d_velocity_rhs_C_idx, current_time);
@@ -35,6 +35,7 @@
 #include "ibtk/LinearSolver.h"
 #include "ibtk/PETScKrylovLinearSolver.h"
 #include "ibtk/PETScLevelSolver.h"
+#include "ibtk/PatchDataMemoryPool.h"
 #include "ibtk/RefinePatchStrategySet.h"
 #include "ibtk/SideNoCornersFillPattern.h"
 #include "ibtk/SideSynchCopyFillPattern.h"
@@ -719,8 +720,10 @@ StaggeredStokesFACPreconditionerStrategy::initializeOperatorState(const SAMRAIVe
     for (int ln = std::max(d_coarsest_ln, coarsest_reset_ln); ln <= finest_reset_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        if (!level->checkAllocated(d_side_scratch_idx)) level->allocatePatchData(d_side_scratch_idx);
-        if (!level->checkAllocated(d_cell_scratch_idx)) level->allocatePatchData(d_cell_scratch_idx);
+        if (!level->checkAllocated(d_side_scratch_idx))
+            level->allocatePatchData(d_side_scratch_idx, 0.0, PatchDataMemoryPool::getArena());
+        if (!level->checkAllocated(d_cell_scratch_idx))
+            level->allocatePatchData(d_cell_scratch_idx, 0.0, PatchDataMemoryPool::getArena());
     }
 
     // Get the transfer operators.
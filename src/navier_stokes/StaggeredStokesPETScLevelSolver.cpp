@@ -37,6 +37,7 @@
 #include "PatchHierarchy.h"
 #include "PatchLevel.h"
 #include "RefineSchedule.h"
+#include "RobinBcCoefStrategy.h"
 #include "SAMRAIVectorReal.h"
 #include "SideData.h"
 #include "SideVariable.h"
@@ -51,6 +52,7 @@
 #include <petsclog.h>
 
 #include <algorithm>
+#include <cstddef>
 #include <string>
 #include <vector>
 
@@ -318,6 +320,29 @@ StaggeredStokesPETScLevelSolver::setupKSPVecs(Vec& petsc_x,
     return;
 } // setupKSPVecs
 
+std::size_t
+StaggeredStokesPETScLevelSolver::computeOperatorFingerprint()
+{
+    std::vector<RobinBcCoefStrategy<NDIM>*> bc_coefs(d_U_bc_coefs);
+    bc_coefs.push_back(d_P_bc_coef);
+    return PoissonUtilities::computeOperatorFingerprint(d_U_problem_coefs, bc_coefs, d_level, d_solution_time);
+} // computeOperatorFingerprint
+
+bool
+StaggeredStokesPETScLevelSolver::refreshOperatorValues()
+{
+    StaggeredStokesPETScMatUtilities::refreshPatchLevelMACStokesOpValues(d_petsc_mat,
+                                                                         d_mat_values_plan,
+                                                                         d_U_problem_coefs,
+                                                                         d_U_bc_coefs,
+                                                                         d_new_time,
+                                                                         d_num_dofs_per_proc,
+                                                                         d_u_dof_index_idx,
+                                                                         d_p_dof_index_idx,
+                                                                         d_level);
+    return true;
+} // refreshOperatorValues
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
@@ -15,16 +15,20 @@
 
 #include "ibamr/RNG.h"
 
+#include "ArrayData.h"
+#include "Box.h"
 #include "tbox/PIO.h"
 #include "tbox/Utilities.h"
 
 #include <mpi.h>
 
 #include <cmath>
+#include <cstdint>
 #include <cstdlib>
 #include <ctime>
 #include <iostream>
 #include <set>
+#include <string>
 #include <vector>
 
 #include "ibamr/namespaces.h" // IWYU pragma: keep
@@ -251,6 +255,130 @@ RNG::genrandn(double* result)
     return;
 } // genrandn
 
+namespace
+{
+// Seed of the counter-based generator.
+unsigned int s_counter_seed = 0;
+
+// Philox4x32-10 (J. K. Salmon, M. A. Moraes, R. O. Dror, and D. E. Shaw,
+// "Parallel random numbers: As easy as 1, 2, 3", SC'11).
+static const std::uint32_t PHILOX_M0 = 0xD2511F53;
+static const std::uint32_t PHILOX_M1 = 0xCD9E8D57;
+static const std::uint32_t PHILOX_W0 = 0x9E3779B9;
+static const std::uint32_t PHILOX_W1 = 0xBB67AE85;
+
+inline void
+philox4x32_10(std::uint32_t ctr[4], std::uint32_t k0, std::uint32_t k1)
+{
+    for (int round = 0; round < 10; ++round)
+    {
+        const std::uint64_t p0 = static_cast<std::uint64_t>(PHILOX_M0) * ctr[0];
+        const std::uint64_t p1 = static_cast<std::uint64_t>(PHILOX_M1) * ctr[2];
+        const auto hi0 = static_cast<std::uint32_t>(p0 >> 32), lo0 = static_cast<std::uint32_t>(p0);
+        const auto hi1 = static_cast<std::uint32_t>(p1 >> 32), lo1 = static_cast<std::uint32_t>(p1);
+        ctr[0] = hi1 ^ ctr[1] ^ k0;
+        ctr[1] = lo1;
+        ctr[2] = hi0 ^ ctr[3] ^ k1;
+        ctr[3] = lo0;
+        k0 += PHILOX_W0;
+        k1 += PHILOX_W1;
+    }
+    return;
+} // philox4x32_10
+
+// Convert two 32-bit words to a uniformly distributed double in (0,1).
+inline double
+to_open_unit_interval(const std::uint32_t hi, const std::uint32_t lo)
+{
+    const std::uint64_t bits = ((static_cast<std::uint64_t>(hi) << 32) | lo) >> 11;
+    return (static_cast<double>(bits) + 0.5) * 1.1102230246251565e-16; // 2^-53
+} // to_open_unit_interval
+} // namespace
+
+void
+RNG::counter_seed(const unsigned int seed)
+{
+    s_counter_seed = seed;
+    return;
+} // counter_seed
+
+unsigned int
+RNG::counter_stream_key(const std::string& object_name)
+{
+    // 32-bit FNV-1a hash, which (unlike std::hash) is the same on all
+    // platforms.
+    std::uint32_t hash = 2166136261u;
+    for (const char c : object_name)
+    {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 16777619u;
+    }
+    return hash ^ (s_counter_seed * PHILOX_W1);
+} // counter_stream_key
+
+void
+RNG::genrandn(ArrayData<NDIM, double>& data,
+              const Box<NDIM>& box,
+              const unsigned int stream_key,
+              const unsigned int step_num,
+              const unsigned int substream_num,
+              const int level_num)
+{
+    const int depth = data.getDepth();
+#if !defined(NDEBUG)
+    TBOX_ASSERT(data.getBox().contains(box));
+    TBOX_ASSERT(substream_num < (1u << 16));
+    TBOX_ASSERT(level_num >= 0 && level_num < (1 << 8));
+    TBOX_ASSERT((depth + 1) / 2 <= (1 << 8));
+#endif
+    if (box.empty()) return;
+
+    // Each evaluation of the generator produces two normal variates (via the
+    // Box-Muller transform), which are used for a pair of depths at the same
+    // index.  The counter consists of the index and the substream, level, and
+    // depth pair numbers; the key consists of the stream key and the time step
+    // number.
+    const Box<NDIM>& data_box = data.getBox();
+    const int num_rows = box.size() / box.numberCells(0);
+    const int row_length = box.numberCells(0);
+    for (int d = 0; d < depth; d += 2)
+    {
+        double* const data_0 = data.getPointer(d);
+        double* const data_1 = d + 1 < depth ? data.getPointer(d + 1) : nullptr;
+        const std::uint32_t tag = substream_num | (static_cast<std::uint32_t>(level_num) << 16) |
+                                  (static_cast<std::uint32_t>(d / 2) << 24);
+        for (int row = 0; row < num_rows; ++row)
+        {
+            // Determine the index of the first entry of the row and its offset
+            // in the array data.
+            int idx[3] = { box.lower(0), 0, 0 };
+            int offset = box.lower(0) - data_box.lower(0), stride = 1, r = row;
+            for (int k = 1; k < NDIM; ++k)
+            {
+                stride *= data_box.numberCells(k - 1);
+                idx[k] = box.lower(k) + r % box.numberCells(k);
+                r /= box.numberCells(k);
+                offset += (idx[k] - data_box.lower(k)) * stride;
+            }
+            for (int i = 0; i < row_length; ++i)
+            {
+                std::uint32_t ctr[4] = { static_cast<std::uint32_t>(idx[0] + i),
+                                         static_cast<std::uint32_t>(idx[1]),
+                                         static_cast<std::uint32_t>(idx[2]),
+                                         tag };
+                philox4x32_10(ctr, stream_key, step_num);
+                const double u0 = to_open_unit_interval(ctr[0], ctr[1]);
+                const double u1 = to_open_unit_interval(ctr[2], ctr[3]);
+                const double radius = std::sqrt(-2.0 * std::log(u0));
+                const double theta = 2.0 * M_PI * u1;
+                data_0[offset + i] = radius * std::cos(theta);
+                if (data_1) data_1[offset + i] = radius * std::sin(theta);
+            }
+        }
+    }
+    return;
+} // genrandn
+
 void
 RNG::parallel_seed(int global_seed)
 {
@@ -275,6 +403,10 @@ RNG::parallel_seed(int global_seed)
         std::cout << "\nGlobal seed = " << seed << "\n\n";
     }
 
+    // All processes use the same seed for the counter-based generator.
+    MPI_Bcast(&seed, 1, MPI_INT, mpi_root, MPI_COMM_WORLD);
+    counter_seed(static_cast<unsigned int>(seed));
+
     if (size > 1)
     {
         // This is based on Mike Lijewski's code in LLNS/main.cpp
@@ -30,10 +30,13 @@
 #include "tbox/Utilities.h"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <fstream>
 #include <limits>
+#include <map>
 #include <utility>
+#include <vector>
 
 #include "ibamr/namespaces.h"
 
@@ -47,6 +50,11 @@ namespace
 {
 static const int EXTENSIONS_FILLABLE = 128;
 static const unsigned SEED = 1234567;
+
+// Maximum number of cached velocity coefficient tables.  The cache is reset
+// when this is exceeded, e.g., after the patch hierarchy has been regridded
+// many times.
+static const std::size_t MAX_CACHED_VELOCITY_TABLES = 256;
 } // namespace
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -196,8 +204,38 @@ IrregularWaveBcCoef::setBcCoefs(Pointer<ArrayData<NDIM, double> >& acoef_data,
         TBOX_ASSERT(!acoef_data || bc_coef_box == acoef_data->getBox());
         TBOX_ASSERT(!bcoef_data || bc_coef_box == bcoef_data->getBox());
         TBOX_ASSERT(!gcoef_data || bc_coef_box == gcoef_data->getBox());
+        TBOX_ASSERT(bc_coef_box.lower(bdry_normal_axis) == bc_coef_box.upper(bdry_normal_axis));
 #endif
 
+        // All boundary points are located at the same horizontal position, so
+        // the surface elevation is computed once per boundary box and the
+        // velocity only varies with the vertical position.  The velocities at
+        // the vertical positions of the box are obtained from the cached
+        // coefficient tables and the time phases of the component waves.
+        const double x_inlet = x_lower[bdry_normal_axis] +
+                               dx[bdry_normal_axis] * static_cast<double>(bc_coef_box.lower(bdry_normal_axis) -
+                                                                          patch_lower(bdry_normal_axis));
+        updateTimePhases(fill_time);
+        const double eta = getSurfaceElevation(x_inlet);
+        const int num_z = bc_coef_box.numberCells(dir);
+        std::vector<double> velocity(num_z, 0.0);
+        const bool has_velocity = (d_comp_idx == 0 || d_comp_idx == NDIM - 1);
+        if (gcoef_data && has_velocity)
+        {
+            const double z_lower =
+                x_lower[dir] + dx[dir] * (static_cast<double>(bc_coef_box.lower(dir) - patch_lower(dir)) + 0.5);
+            const std::vector<double>& velocity_table = getVelocityTable(x_inlet, z_lower, dx[dir], num_z);
+            for (int k = 0; k < num_z; ++k)
+            {
+                const double* const A = &velocity_table[2 * d_num_waves * k];
+                const double* const B = A + d_num_waves;
+                for (int l = 0; l < d_num_waves; ++l)
+                {
+                    velocity[k] += A[l] * d_cos_omega_t[l] + B[l] * d_sin_omega_t[l];
+                }
+            }
+        }
+
         for (Box<NDIM>::Iterator b(bc_coef_box); b; b++)
         {
             const SAMRAI::hier::Index<NDIM>& i = b();
@@ -221,7 +259,6 @@ IrregularWaveBcCoef::setBcCoefs(Pointer<ArrayData<NDIM, double> >& acoef_data,
             // Compute a numerical heaviside at the boundary from the analytical wave
             // elevation
             const double z_plus_d = dof_posn[dir];
-            const double eta = getSurfaceElevation(dof_posn[0], fill_time);
             const double phi = -eta + (z_plus_d - d_depth);
             double h_phi;
             if (phi < -alpha)
@@ -233,7 +270,7 @@ IrregularWaveBcCoef::setBcCoefs(Pointer<ArrayData<NDIM, double> >& acoef_data,
 
             if (gcoef_data)
             {
-                (*gcoef_data)(i, 0) = h_phi * getVelocity(dof_posn[0], z_plus_d, fill_time);
+                (*gcoef_data)(i, 0) = h_phi * velocity[i(dir) - bc_coef_box.lower(dir)];
             }
         }
     }
@@ -269,66 +306,82 @@ IrregularWaveBcCoef::getFromInput(Pointer<Database> input_db)
     return;
 } // getFromInput
 
+void
+IrregularWaveBcCoef::updateTimePhases(const double time) const
+{
+    if (time == d_time_phases_time) return;
+    d_cos_omega_t.resize(d_num_waves);
+    d_sin_omega_t.resize(d_num_waves);
+    for (int i = 0; i < d_num_waves; ++i)
+    {
+        d_cos_omega_t[i] = std::cos(d_omega[i] * time);
+        d_sin_omega_t[i] = std::sin(d_omega[i] * time);
+    }
+    d_time_phases_time = time;
+    return;
+} // updateTimePhases
+
 double
-IrregularWaveBcCoef::getSurfaceElevation(double x, double time) const
+IrregularWaveBcCoef::getSurfaceElevation(const double x) const
 {
+    // With theta = k x - omega t + phase, cos(theta) = cos(k x + phase) cos(omega t) + sin(k x + phase) sin(omega t).
     double eta = 0;
     for (int i = 0; i < d_num_waves; i++)
     {
-        const double theta = d_wave_number[i] * x - d_omega[i] * time + d_phase[i];
-        eta += d_amplitude[i] * cos(theta);
+        const double theta_x = d_wave_number[i] * x + d_phase[i];
+        eta += d_amplitude[i] * (std::cos(theta_x) * d_cos_omega_t[i] + std::sin(theta_x) * d_sin_omega_t[i]);
     }
 
     return eta;
 } // getSurfaceElevation
 
-double
-IrregularWaveBcCoef::getVelocity(double x, double z_plus_d, double time) const
+const std::vector<double>&
+IrregularWaveBcCoef::getVelocityTable(const double x, const double z_lower, const double dz, const int num_z) const
 {
-    if (d_comp_idx == 0)
-    {
-        double velocity_component = 0.0;
-        for (int i = 0; i < d_num_waves; i++)
-        {
-            const double theta = d_wave_number[i] * x - d_omega[i] * time + d_phase[i];
-            velocity_component += d_amplitude[i] * d_omega[i] * cosh(d_wave_number[i] * z_plus_d) * cos(theta) /
-                                  sinh(d_wave_number[i] * d_depth);
-        }
-        return velocity_component;
-    }
-    if (d_comp_idx == 1)
-    {
-#if (NDIM == 2)
-        double velocity_component = 0.0;
-        for (int i = 0; i < d_num_waves; i++)
-        {
-            const double theta = d_wave_number[i] * x - d_omega[i] * time + d_phase[i];
-            velocity_component += d_amplitude[i] * d_omega[i] * sinh(d_wave_number[i] * z_plus_d) * sin(theta) /
-                                  sinh(d_wave_number[i] * d_depth);
-        }
-        return velocity_component;
-
-#elif (NDIM == 3)
-        return 0.0;
-#endif
-    }
-#if (NDIM == 3)
-    if (d_comp_idx == 2)
+    const std::array<double, 4> key = { { x, z_lower, dz, static_cast<double>(num_z) } };
+    auto it = d_velocity_tables.find(key);
+    if (it != d_velocity_tables.end()) return it->second;
+    if (d_velocity_tables.size() >= MAX_CACHED_VELOCITY_TABLES) d_velocity_tables.clear();
+
+    // With theta = k x - omega t + phase, the horizontal velocity is
+    //
+    //    sum_i a_i omega_i cosh(k_i z) / sinh(k_i d) cos(theta_i)
+    //
+    // and the vertical velocity is
+    //
+    //    sum_i a_i omega_i sinh(k_i z) / sinh(k_i d) sin(theta_i).
+    //
+    // Expanding cos(theta_i) and sin(theta_i) separates these sums into
+    // position-dependent coefficients of cos(omega_i t) and sin(omega_i t).
+    std::vector<double>& table = d_velocity_tables[key];
+    table.resize(2 * d_num_waves * num_z);
+    for (int k = 0; k < num_z; ++k)
     {
-        double velocity_component = 0.0;
-        for (int i = 0; i < d_num_waves; i++)
+        const double z_plus_d = z_lower + static_cast<double>(k) * dz;
+        double* const A = &table[2 * d_num_waves * k];
+        double* const B = A + d_num_waves;
+        for (int i = 0; i < d_num_waves; ++i)
         {
-            const double theta = d_wave_number[i] * x - d_omega[i] * time + d_phase[i];
-            velocity_component += d_amplitude[i] * d_omega[i] * sinh(d_wave_number[i] * z_plus_d) * sin(theta) /
-                                  sinh(d_wave_number[i] * d_depth);
+            const double theta_x = d_wave_number[i] * x + d_phase[i];
+            const double cos_theta_x = std::cos(theta_x);
+            const double sin_theta_x = std::sin(theta_x);
+            const double scale = d_amplitude[i] * d_omega[i] / std::sinh(d_wave_number[i] * d_depth);
+            if (d_comp_idx == 0)
+            {
+                const double profile = scale * std::cosh(d_wave_number[i] * z_plus_d);
+                A[i] = profile * cos_theta_x;
+                B[i] = profile * sin_theta_x;
+            }
+            else
+            {
+                const double profile = scale * std::sinh(d_wave_number[i] * z_plus_d);
+                A[i] = profile * sin_theta_x;
+                B[i] = -profile * cos_theta_x;
+            }
         }
-        return velocity_component;
     }
-#endif
-
-    return std::numeric_limits<double>::signaling_NaN();
-    ;
-} // getVelocity
+    return table;
+} // getVelocityTable
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
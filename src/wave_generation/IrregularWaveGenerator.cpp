@@ -23,6 +23,11 @@
 
 #include <algorithm>
 #include <cmath>
+#include <iterator>
+#include <list>
+#include <map>
+#include <utility>
+#include <vector>
 
 #include "ibamr/app_namespaces.h" // IWYU pragma: keep
 
@@ -32,6 +37,12 @@ namespace IBAMR
 namespace
 {
 static const unsigned SEED = 1234567;
+
+// Maximum number of positions for which the horizontal factors and vertical
+// profiles of the component waves are cached.  Beyond this number, the least
+// recently used positions are evicted, so that positions that are evaluated
+// in every time step remain cached.
+static const std::size_t MAX_CACHED_POSITIONS = 4096;
 }
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
@@ -100,11 +111,15 @@ IrregularWaveGenerator::IrregularWaveGenerator(const std::string& object_name, P
 double
 IrregularWaveGenerator::getSurfaceElevation(const double x, const double time) const
 {
+    // With theta = k x - omega t + phase, cos(theta) = cos(k x + phase) cos(omega t) + sin(k x + phase) sin(omega t).
+    updateTimePhases(time);
+    const std::vector<double>& horizontal_factors = getHorizontalFactors(x);
+    const double* const cos_theta_x = &horizontal_factors[0];
+    const double* const sin_theta_x = &horizontal_factors[d_num_waves];
     double eta = 0;
     for (int i = 0; i < d_num_waves; i++)
     {
-        const double theta = d_wave_number[i] * x - d_omega[i] * time + d_phase[i];
-        eta += d_amplitude[i] * cos(theta);
+        eta += d_amplitude[i] * (cos_theta_x[i] * d_cos_omega_t[i] + sin_theta_x[i] * d_sin_omega_t[i]);
     }
 
     return eta;
@@ -113,49 +128,41 @@ IrregularWaveGenerator::getSurfaceElevation(const double x, const double time) c
 double
 IrregularWaveGenerator::getVelocity(const double x, const double z_plus_d, const double time, const int comp_idx) const
 {
-    if (comp_idx == 0)
+    if (comp_idx != 0 && comp_idx != NDIM - 1)
     {
-        double velocity_component = 0.0;
-        for (int i = 0; i < d_num_waves; i++)
-        {
-            const double theta = d_wave_number[i] * x - d_omega[i] * time + d_phase[i];
-            velocity_component += d_amplitude[i] * d_omega[i] * cosh(d_wave_number[i] * z_plus_d) * cos(theta) /
-                                  sinh(d_wave_number[i] * d_depth);
-        }
-        return velocity_component;
+#if (NDIM == 3)
+        if (comp_idx == 1) return 0.0;
+#endif
+        return std::numeric_limits<double>::signaling_NaN();
     }
-    if (comp_idx == 1)
+
+    updateTimePhases(time);
+    const std::vector<double>& horizontal_factors = getHorizontalFactors(x);
+    const double* const cos_theta_x = &horizontal_factors[0];
+    const double* const sin_theta_x = &horizontal_factors[d_num_waves];
+    const std::vector<double>& depth_profiles = getDepthProfiles(z_plus_d);
+    double velocity_component = 0.0;
+    if (comp_idx == 0)
     {
-#if (NDIM == 2)
-        double velocity_component = 0.0;
+        // Horizontal velocity: sum of a omega cosh(k z) / sinh(k d) cos(theta).
+        const double* const profile = &depth_profiles[0];
         for (int i = 0; i < d_num_waves; i++)
         {
-            const double theta = d_wave_number[i] * x - d_omega[i] * time + d_phase[i];
-            velocity_component += d_amplitude[i] * d_omega[i] * sinh(d_wave_number[i] * z_plus_d) * sin(theta) /
-                                  sinh(d_wave_number[i] * d_depth);
+            velocity_component +=
+                profile[i] * (cos_theta_x[i] * d_cos_omega_t[i] + sin_theta_x[i] * d_sin_omega_t[i]);
         }
-        return velocity_component;
-
-#elif (NDIM == 3)
-        return 0.0;
-#endif
     }
-#if (NDIM == 3)
-    if (comp_idx == 2)
+    else
     {
-        double velocity_component = 0.0;
+        // Vertical velocity: sum of a omega sinh(k z) / sinh(k d) sin(theta).
+        const double* const profile = &depth_profiles[d_num_waves];
         for (int i = 0; i < d_num_waves; i++)
         {
-            const double theta = d_wave_number[i] * x - d_omega[i] * time + d_phase[i];
-            velocity_component += d_amplitude[i] * d_omega[i] * sinh(d_wave_number[i] * z_plus_d) * sin(theta) /
-                                  sinh(d_wave_number[i] * d_depth);
+            velocity_component +=
+                profile[i] * (sin_theta_x[i] * d_cos_omega_t[i] - cos_theta_x[i] * d_sin_omega_t[i]);
         }
-        return velocity_component;
     }
-#endif
-
-    return std::numeric_limits<double>::signaling_NaN();
-
+    return velocity_component;
 } // getVelocity
 
 void
@@ -194,4 +201,79 @@ IrregularWaveGenerator::getFromInput(Pointer<Database> input_db)
     return;
 } // getFromInput
 
+void
+IrregularWaveGenerator::updateTimePhases(const double time) const
+{
+    if (time == d_time_phases_time) return;
+    d_cos_omega_t.resize(d_num_waves);
+    d_sin_omega_t.resize(d_num_waves);
+    for (int i = 0; i < d_num_waves; ++i)
+    {
+        d_cos_omega_t[i] = std::cos(d_omega[i] * time);
+        d_sin_omega_t[i] = std::sin(d_omega[i] * time);
+    }
+    d_time_phases_time = time;
+    return;
+} // updateTimePhases
+
+const std::vector<double>&
+IrregularWaveGenerator::getHorizontalFactors(const double x) const
+{
+    bool is_cached;
+    std::vector<double>& factors = getCachedValues(d_horizontal_factors, x, is_cached);
+    if (is_cached) return factors;
+
+    for (int i = 0; i < d_num_waves; ++i)
+    {
+        const double theta_x = d_wave_number[i] * x + d_phase[i];
+        factors[i] = std::cos(theta_x);
+        factors[d_num_waves + i] = std::sin(theta_x);
+    }
+    return factors;
+} // getHorizontalFactors
+
+const std::vector<double>&
+IrregularWaveGenerator::getDepthProfiles(const double z_plus_d) const
+{
+    bool is_cached;
+    std::vector<double>& profiles = getCachedValues(d_depth_profiles, z_plus_d, is_cached);
+    if (is_cached) return profiles;
+
+    for (int i = 0; i < d_num_waves; ++i)
+    {
+        const double scale = d_amplitude[i] * d_omega[i] / std::sinh(d_wave_number[i] * d_depth);
+        profiles[i] = scale * std::cosh(d_wave_number[i] * z_plus_d);
+        profiles[d_num_waves + i] = scale * std::sinh(d_wave_number[i] * z_plus_d);
+    }
+    return profiles;
+} // getDepthProfiles
+
+std::vector<double>&
+IrregularWaveGenerator::getCachedValues(PositionCache& cache, const double position, bool& is_cached) const
+{
+    auto it = cache.index.find(position);
+    is_cached = it != cache.index.end();
+    if (is_cached)
+    {
+        // Move the entry to the front of the list, which is ordered from the
+        // most to the least recently used position.
+        cache.entries.splice(cache.entries.begin(), cache.entries, it->second);
+        return it->second->second;
+    }
+
+    if (cache.entries.size() >= MAX_CACHED_POSITIONS)
+    {
+        // Reuse the entry of the least recently used position.
+        cache.index.erase(cache.entries.back().first);
+        cache.entries.splice(cache.entries.begin(), cache.entries, std::prev(cache.entries.end()));
+        cache.entries.front().first = position;
+    }
+    else
+    {
+        cache.entries.emplace_front(position, std::vector<double>(2 * d_num_waves));
+    }
+    cache.index[position] = cache.entries.begin();
+    return cache.entries.front().second;
+} // getCachedValues
+
 } // namespace IBAMR
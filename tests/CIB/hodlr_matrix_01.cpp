@@ -0,0 +1,155 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+#include <ibamr/HODLRMatrix.h>
+#include <ibamr/MobilityFunctions.h>
+
+#include <ibtk/IBTKInit.h>
+
+#include <cmath>
+#include <cstddef>
+#include <fstream>
+#include <vector>
+
+// Test the HODLR approximation of a Rotne-Prager-Yamakawa mobility matrix for
+// markers placed along a helix by comparing its matrix-vector products and
+// solutions to those computed with the dense matrix. Also check that the
+// entries of the mobility matrix evaluated one at a time by MobilityFunctions
+// match the assembled matrix, and compress the HODLR approximation directly
+// from them, as DirectMobilitySolver does.
+
+namespace
+{
+double
+rpy_entry(const std::vector<double>& X, const double a, const int row, const int col)
+{
+    const int i = row / 3, j = col / 3, di = row % 3, dj = col % 3;
+    if (i == j) return di == dj ? 1.0 : 0.0;
+    double r[3], r_norm_sq = 0.0;
+    for (int d = 0; d < 3; ++d)
+    {
+        r[d] = X[3 * i + d] - X[3 * j + d];
+        r_norm_sq += r[d] * r[d];
+    }
+    const double r_norm = std::sqrt(r_norm_sq);
+    const double c1 = 3.0 * a / (4.0 * r_norm) * (1.0 + 2.0 * a * a / (3.0 * r_norm_sq));
+    const double c2 = 3.0 * a / (4.0 * r_norm) * (1.0 - 2.0 * a * a / r_norm_sq);
+    return (di == dj ? c1 : 0.0) + c2 * r[di] * r[dj] / r_norm_sq;
+}
+} // namespace
+
+int
+main(int argc, char** argv)
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTK::IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    std::ofstream out("output");
+
+    for (const int num_markers : { 10, 200, 1000 })
+    {
+        std::vector<double> X(3 * num_markers);
+        for (int k = 0; k < num_markers; ++k)
+        {
+            const double t = 20.0 * k / num_markers;
+            X[3 * k] = std::cos(t);
+            X[3 * k + 1] = std::sin(t);
+            X[3 * k + 2] = 0.1 * t;
+        }
+        const double a = 0.01;
+        const int n = 3 * num_markers;
+        auto entry = [&](int i, int j) { return rpy_entry(X, a, i, j); };
+
+        IBAMR::HODLRMatrix hodlr_mat(/*leaf_size*/ 48, /*rel_tol*/ 1.0e-10, /*max_rank*/ 256);
+        hodlr_mat.compress(n, entry);
+        hodlr_mat.factorize();
+
+        std::vector<double> x(n), b(n, 0.0), y(n);
+        for (int i = 0; i < n; ++i) x[i] = std::sin(1.0 + i);
+        for (int i = 0; i < n; ++i)
+        {
+            for (int j = 0; j < n; ++j) b[i] += entry(i, j) * x[j];
+        }
+
+        hodlr_mat.apply(x.data(), y.data());
+        double apply_err = 0.0, b_norm = 0.0;
+        for (int i = 0; i < n; ++i)
+        {
+            apply_err += (y[i] - b[i]) * (y[i] - b[i]);
+            b_norm += b[i] * b[i];
+        }
+
+        y = b;
+        hodlr_mat.solve(y.data());
+        double solve_err = 0.0, x_norm = 0.0;
+        for (int i = 0; i < n; ++i)
+        {
+            solve_err += (y[i] - x[i]) * (y[i] - x[i]);
+            x_norm += x[i] * x[i];
+        }
+
+        out << "matrix size: " << n << '\n'
+            << "compressed: " << (hodlr_mat.getMaxRank() > 0) << '\n'
+            << "apply error < 1e-7: " << (std::sqrt(apply_err / b_norm) < 1.0e-7) << '\n'
+            << "solve error < 1e-6: " << (std::sqrt(solve_err / x_norm) < 1.0e-6) << '\n'
+            << "smaller than dense: " << (hodlr_mat.getStorageSize() < static_cast<std::size_t>(n) * n) << '\n';
+    }
+
+    for (const int num_markers : { 200, 1000 })
+    {
+        // Place the markers along a circle, two grid cells apart.
+        std::vector<double> X(NDIM * num_markers, 0.0);
+        for (int k = 0; k < num_markers; ++k)
+        {
+            const double t = 2.0 * M_PI * k / num_markers;
+            X[NDIM * k] = std::cos(t);
+            X[NDIM * k + 1] = std::sin(t);
+        }
+        const double mu = 1.0, dx = M_PI / num_markers;
+        const int n = NDIM * num_markers;
+        auto entry = [&](int i, int j) {
+            return IBAMR::MobilityFunctions::getRPYMobilityMatrixEntry("IB_4", mu, dx, X.data(), i, j, 0.0);
+        };
+
+        std::vector<double> mobility_mat(n * n);
+        IBAMR::MobilityFunctions::constructRPYMobilityMatrix(
+            "IB_4", mu, dx, X.data(), num_markers, 0.0, mobility_mat.data());
+        bool entries_match = true;
+        for (int j = 0; j < n; ++j)
+        {
+            for (int i = 0; i < n; ++i) entries_match = entries_match && (entry(i, j) == mobility_mat[j * n + i]);
+        }
+
+        IBAMR::HODLRMatrix hodlr_mat(/*leaf_size*/ 48, /*rel_tol*/ 1.0e-10, /*max_rank*/ 256);
+        hodlr_mat.compress(n, entry);
+        hodlr_mat.factorize();
+
+        std::vector<double> x(n), y(n, 0.0);
+        for (int i = 0; i < n; ++i) x[i] = std::sin(1.0 + i);
+        for (int j = 0; j < n; ++j)
+        {
+            for (int i = 0; i < n; ++i) y[i] += mobility_mat[j * n + i] * x[j];
+        }
+        hodlr_mat.solve(y.data());
+        double solve_err = 0.0, x_norm = 0.0;
+        for (int i = 0; i < n; ++i)
+        {
+            solve_err += (y[i] - x[i]) * (y[i] - x[i]);
+            x_norm += x[i] * x[i];
+        }
+
+        out << "RPY mobility matrix size: " << n << '\n'
+            << "entries match assembled matrix: " << entries_match << '\n'
+            << "solve error < 1e-6: " << (std::sqrt(solve_err / x_norm) < 1.0e-6) << '\n';
+    }
+}
@@ -0,0 +1,356 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/ConstraintIBKinematics.h>
+#include <ibamr/ConstraintIBMethod.h>
+#include <ibamr/IBExplicitHierarchyIntegrator.h>
+#include <ibamr/IBStandardForceGen.h>
+#include <ibamr/IBStandardInitializer.h>
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+#include <ibtk/LData.h>
+#include <ibtk/LDataManager.h>
+#include <ibtk/LMesh.h>
+#include <ibtk/LNode.h>
+
+#include <boost/multi_array.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// Check that the center of mass, the moment of inertia, and the momenta that
+// ConstraintIBMethod computes for a translating ring remain correct when the
+// patch hierarchy is regridded, and the Lagrangian nodes are redistributed,
+// in every time step.
+namespace
+{
+// Kinematics of a rigid body that moves with a constant velocity.
+class ConstantVelocityKinematics : public ConstraintIBKinematics
+{
+public:
+    ConstantVelocityKinematics(const std::string& object_name,
+                               Pointer<Database> input_db,
+                               LDataManager* l_data_manager)
+        : ConstraintIBKinematics(object_name, input_db, l_data_manager, /*register_for_restart*/ false)
+    {
+        input_db->getDoubleArray("velocity", d_velocity, NDIM);
+        const StructureParameters& struct_param = getStructureParameters();
+        const std::vector<std::pair<int, int> >& idx_range = struct_param.getLagIdxRange();
+        d_kinematics_vel.resize(idx_range.size());
+        for (unsigned int k = 0; k < idx_range.size(); ++k)
+        {
+            d_kinematics_vel[k].resize(NDIM);
+            for (int d = 0; d < NDIM; ++d)
+            {
+                d_kinematics_vel[k][d].assign(idx_range[k].second - idx_range[k].first, d_velocity[d]);
+            }
+        }
+        return;
+    } // ConstantVelocityKinematics
+
+    void setKinematicsVelocity(const double /*time*/,
+                               const std::vector<double>& /*incremented_angle_from_reference_axis*/,
+                               const std::vector<double>& /*center_of_mass*/,
+                               const std::vector<double>& /*tagged_pt_position*/) override
+    {
+        // intentionally blank
+        return;
+    } // setKinematicsVelocity
+
+    const std::vector<std::vector<double> >& getKinematicsVelocity(const int level) const override
+    {
+        return d_kinematics_vel[level - getStructureParameters().getCoarsestLevelNumber()];
+    } // getKinematicsVelocity
+
+    void setShape(const double /*time*/, const std::vector<double>& /*incremented_angle_from_reference_axis*/) override
+    {
+        // intentionally blank
+        return;
+    } // setShape
+
+    const std::vector<std::vector<double> >& getShape(const int /*level*/) const override
+    {
+        return d_shape;
+    } // getShape
+
+private:
+    double d_velocity[NDIM];
+    std::vector<std::vector<std::vector<double> > > d_kinematics_vel;
+    std::vector<std::vector<double> > d_shape;
+};
+
+struct CheckContext
+{
+    ConstraintIBMethod* ib_method_ops;
+    Pointer<PatchHierarchy<NDIM> > patch_hierarchy;
+    double velocity[NDIM];
+    double rho_solid = 0.0;
+    std::vector<double> initial_center_of_mass;
+    int num_checks = 0;
+    bool center_of_mass_is_correct = true;
+    bool moment_of_inertia_is_correct = true;
+    bool linear_momentum_is_correct = true;
+    bool angular_momentum_is_correct = true;
+};
+
+// Compute the center of mass and the polar moment of inertia of all
+// Lagrangian nodes directly from the current node positions.
+void
+compute_center_of_mass_and_moment_of_inertia(LDataManager* l_data_manager,
+                                             Pointer<PatchHierarchy<NDIM> > patch_hierarchy,
+                                             int& num_nodes,
+                                             std::vector<double>& center_of_mass,
+                                             double& moment_of_inertia)
+{
+    const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+    std::vector<double> sums(NDIM + 1, 0.0);
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        for (int ln = 0; ln <= finest_ln; ++ln)
+        {
+            if (!l_data_manager->levelContainsLagrangianData(ln)) continue;
+            Pointer<LData> X_data = l_data_manager->getLData("X", ln);
+            const boost::multi_array_ref<double, 2>& X_array = *X_data->getLocalFormVecArray();
+            for (const LNode* const node : l_data_manager->getLMesh(ln)->getLocalNodes())
+            {
+                const double* const X = &X_array[node->getLocalPETScIndex()][0];
+                if (pass == 0)
+                {
+                    for (int d = 0; d < NDIM; ++d) sums[d] += X[d];
+                    sums[NDIM] += 1.0;
+                }
+                else
+                {
+                    for (int d = 0; d < 2; ++d) sums[d] += std::pow(X[d] - center_of_mass[d], 2);
+                }
+            }
+            X_data->restoreArrays();
+        }
+        IBTK_MPI::sumReduction(sums.data(), static_cast<int>(sums.size()));
+        if (pass == 0)
+        {
+            num_nodes = static_cast<int>(sums[NDIM]);
+            center_of_mass.assign(3, 0.0);
+            for (int d = 0; d < NDIM; ++d) center_of_mass[d] = sums[d] / num_nodes;
+        }
+        else
+        {
+            moment_of_inertia = sums[0] + sums[1];
+        }
+        std::fill(sums.begin(), sums.end(), 0.0);
+    }
+    return;
+} // compute_center_of_mass_and_moment_of_inertia
+
+// Compare the values computed by ConstraintIBMethod with the ones that are
+// computed directly from the node positions and the prescribed velocity.
+void
+check_structure_values(const double current_time, const double /*new_time*/, const int /*cycle_num*/, void* ctx)
+{
+    auto* check_ctx = static_cast<CheckContext*>(ctx);
+    ConstraintIBMethod* ib_method_ops = check_ctx->ib_method_ops;
+
+    int num_nodes;
+    std::vector<double> center_of_mass;
+    double moment_of_inertia;
+    compute_center_of_mass_and_moment_of_inertia(
+        ib_method_ops->getLDataManager(), check_ctx->patch_hierarchy, num_nodes, center_of_mass, moment_of_inertia);
+
+    const double tol = 1.0e-10;
+    const std::vector<double>& com = ib_method_ops->getCurrentStructureCOM()[0];
+    double U_norm = 0.0;
+    for (int d = 0; d < NDIM; ++d)
+    {
+        const double expected_com = check_ctx->initial_center_of_mass[d] + check_ctx->velocity[d] * current_time;
+        check_ctx->center_of_mass_is_correct = check_ctx->center_of_mass_is_correct &&
+                                               std::abs(com[d] - center_of_mass[d]) <= tol &&
+                                               std::abs(com[d] - expected_com) <= tol;
+        U_norm += std::pow(check_ctx->velocity[d], 2);
+    }
+    U_norm = std::sqrt(U_norm);
+
+    const double moi = ib_method_ops->getCurrentStructureMOI()[0](2, 2);
+    check_ctx->moment_of_inertia_is_correct =
+        check_ctx->moment_of_inertia_is_correct && std::abs(moi - moment_of_inertia) <= tol * moment_of_inertia;
+
+    // The ring only translates with the prescribed velocity, and the rigid
+    // rotation that is computed from the fluid velocity vanishes by symmetry.
+    const double rho_vol = check_ctx->rho_solid * ib_method_ops->getVolumeElement()[0];
+    const double momentum_scale = rho_vol * num_nodes * U_norm;
+    const std::vector<double>& mom = ib_method_ops->getStructureMomentum()[0];
+    for (int d = 0; d < NDIM; ++d)
+    {
+        const double expected_mom = rho_vol * num_nodes * check_ctx->velocity[d];
+        check_ctx->linear_momentum_is_correct =
+            check_ctx->linear_momentum_is_correct && std::abs(mom[d] - expected_mom) <= tol * momentum_scale;
+    }
+    const double radius = std::sqrt(moment_of_inertia / num_nodes);
+    const std::vector<double>& ang_mom = ib_method_ops->getStructureRotationalMomentum()[0];
+    check_ctx->angular_momentum_is_correct =
+        check_ctx->angular_momentum_is_correct && std::abs(ang_mom[2]) <= 1.0e-6 * momentum_scale * radius;
+
+    ++check_ctx->num_checks;
+    return;
+} // check_structure_values
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+    SAMRAIManager::setMaxNumberPatchDataEntries(2500);
+
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "IB.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Several parts of the code (such as LDataManager) expect mesh files,
+        // specified in the input file, to exist in the current working
+        // directory.  Write a ring of nodes that is symmetric about the
+        // horizontal line through its center.
+        if (IBTK_MPI::getRank() == 0)
+        {
+            const int num_nodes = input_db->getInteger("NUM_NODES");
+            const double radius = input_db->getDouble("RADIUS");
+            std::vector<double> center(NDIM);
+            input_db->getDoubleArray("CENTER", center.data(), NDIM);
+            std::ofstream vertex_stream("ring2d.vertex");
+            vertex_stream << num_nodes << "\n" << std::setprecision(16);
+            for (int k = 0; k < num_nodes; ++k)
+            {
+                const double theta = 2.0 * M_PI * k / num_nodes;
+                vertex_stream << center[0] + radius * std::cos(theta) << " " << center[1] + radius * std::sin(theta)
+                              << "\n";
+            }
+        }
+        IBTK_MPI::barrier();
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<INSHierarchyIntegrator> navier_stokes_integrator = new INSStaggeredHierarchyIntegrator(
+            "INSStaggeredHierarchyIntegrator",
+            app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"));
+        Pointer<ConstraintIBMethod> ib_method_ops = new ConstraintIBMethod(
+            "ConstraintIBMethod", app_initializer->getComponentDatabase("ConstraintIBMethod"), /*no_structures*/ 1);
+        Pointer<IBHierarchyIntegrator> time_integrator =
+            new IBExplicitHierarchyIntegrator("IBHierarchyIntegrator",
+                                              app_initializer->getComponentDatabase("IBHierarchyIntegrator"),
+                                              ib_method_ops,
+                                              navier_stokes_integrator);
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               time_integrator,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Configure the IB solver.
+        Pointer<IBStandardInitializer> ib_initializer = new IBStandardInitializer(
+            "IBStandardInitializer", app_initializer->getComponentDatabase("IBStandardInitializer"));
+        ib_method_ops->registerLInitStrategy(ib_initializer);
+        Pointer<IBStandardForceGen> ib_force_fcn = new IBStandardForceGen();
+        ib_method_ops->registerIBLagrangianForceFunction(ib_force_fcn);
+
+        // Initialize hierarchy configuration and data on all patches.
+        time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+
+        // Register the kinematics of the ring.
+        std::vector<Pointer<ConstraintIBKinematics> > ib_kinematics_ops;
+        ib_kinematics_ops.push_back(new ConstantVelocityKinematics(
+            "Ring",
+            app_initializer->getComponentDatabase("ConstraintIBKinematics")->getDatabase("Ring"),
+            ib_method_ops->getLDataManager()));
+        ib_method_ops->registerConstraintIBKinematics(ib_kinematics_ops);
+        ib_method_ops->setVolumeElement(input_db->getDouble("VOL_ELEM"), 0);
+        ib_method_ops->initializeHierarchyOperatorsandData();
+
+        // Check the structure values after each fluid solve.
+        CheckContext check_ctx;
+        check_ctx.ib_method_ops = ib_method_ops.getPointer();
+        check_ctx.patch_hierarchy = patch_hierarchy;
+        app_initializer->getComponentDatabase("ConstraintIBKinematics")
+            ->getDatabase("Ring")
+            ->getDoubleArray("velocity", check_ctx.velocity, NDIM);
+        check_ctx.rho_solid = input_db->getDouble("RHO");
+        check_ctx.initial_center_of_mass = ib_method_ops->getCurrentStructureCOM()[0];
+        ib_method_ops->registerPostProcessSolveFluidEquationsCallBackFunction(&check_structure_values,
+                                                                             static_cast<void*>(&check_ctx));
+
+        // Deallocate initialization objects.
+        ib_method_ops->freeLInitStrategy();
+        ib_initializer.setNull();
+        app_initializer.setNull();
+
+        // Main time step loop.  The hierarchy is regridded in every time step.
+        int num_regrids = 0;
+        double loop_time = time_integrator->getIntegratorTime();
+        const double loop_time_end = time_integrator->getEndTime();
+        while (!MathUtilities<double>::equalEps(loop_time, loop_time_end) && time_integrator->stepsRemaining())
+        {
+            if (time_integrator->atRegridPoint()) ++num_regrids;
+            const double dt = time_integrator->getMaximumTimeStepSize();
+            time_integrator->advanceHierarchy(dt);
+            loop_time += dt;
+        }
+
+        if (IBTK_MPI::getRank() == 0)
+        {
+            std::ofstream out("output");
+            out << "number of regrids: " << num_regrids << "\n";
+            out << "number of checks: " << check_ctx.num_checks << "\n";
+            out << "center of mass is correct: " << check_ctx.center_of_mass_is_correct << "\n";
+            out << "moment of inertia is correct: " << check_ctx.moment_of_inertia_is_correct << "\n";
+            out << "linear momentum is correct: " << check_ctx.linear_momentum_is_correct << "\n";
+            out << "angular momentum is correct: " << check_ctx.angular_momentum_is_correct << "\n";
+            const std::vector<double>& com = ib_method_ops->getCurrentStructureCOM()[0];
+            out << std::setprecision(6) << "final center of mass: " << com[0] << " " << com[1] << "\n";
+        }
+    } // cleanup dynamically allocated objects prior to shutdown
+} // main
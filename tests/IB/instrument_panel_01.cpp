@@ -0,0 +1,340 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CartesianPatchGeometry.h>
+#include <CellData.h>
+#include <CellIterator.h>
+#include <CellVariable.h>
+#include <LoadBalancer.h>
+#include <SideData.h>
+#include <SideIterator.h>
+#include <SideVariable.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/IBExplicitHierarchyIntegrator.h>
+#include <ibamr/IBInstrumentPanel.h>
+#include <ibamr/IBMethod.h>
+#include <ibamr/IBStandardForceGen.h>
+#include <ibamr/IBStandardInitializer.h>
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+#include <ibtk/IndexUtilities.h>
+#include <ibtk/LData.h>
+#include <ibtk/LDataManager.h>
+
+#include <cmath>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// Check the flow rate, mean pressure, and pointwise pressure computed by the
+// instrument panel for a flow meter whose perimeter is a regular polygon.  The
+// velocity and pressure are linear functions, which the linear interpolation
+// used by the instrument panel reproduces exactly, so that the values computed
+// from the meter web agree with the values at the centroid of the polygon: the
+// flow rate is the normal velocity relative to the meter at the centroid times
+// the area of the polygon, and the mean and pointwise pressures are the
+// pressure at the centroid.  The values are checked when the meter is first
+// set up, after the meter moves without a change in the patch hierarchy, and
+// after the patch hierarchy is regridded without a change in the position of
+// the meter, so that the interpolation stencils must be rebuilt in both cases.
+namespace
+{
+double
+exact_U(const unsigned int axis, const Point& X)
+{
+    switch (axis)
+    {
+    case 0:
+        return 0.3 + 0.5 * X[1];
+    case 1:
+        return -0.2 + 0.25 * X[2];
+    default:
+        return 1.0 + 0.5 * X[0] - 0.75 * X[1] + 0.25 * X[2];
+    }
+} // exact_U
+
+double
+exact_P(const Point& X)
+{
+    return 2.0 + X[0] - 0.5 * X[1] + 0.75 * X[2];
+} // exact_P
+
+// Set the velocity and pressure, including their ghost cell values, to the
+// exact values on every level of the hierarchy.
+void
+fill_data(Pointer<PatchHierarchy<NDIM> > patch_hierarchy, const int U_idx, const int P_idx)
+{
+    for (int ln = 0; ln <= patch_hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const hier::Index<NDIM>& patch_lower = patch->getBox().lower();
+            Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+            const double* const x_lower = pgeom->getXLower();
+            const double* const dx = pgeom->getDx();
+            Pointer<SideData<NDIM, double> > U_data = patch->getPatchData(U_idx);
+            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            {
+                for (SideIterator<NDIM> is(U_data->getGhostBox(), axis); is; is++)
+                {
+                    Point X;
+                    for (unsigned int d = 0; d < NDIM; ++d)
+                    {
+                        X[d] = x_lower[d] + dx[d] * (is()(d) - patch_lower(d) + (d == axis ? 0.0 : 0.5));
+                    }
+                    (*U_data)(is()) = exact_U(axis, X);
+                }
+            }
+            Pointer<CellData<NDIM, double> > P_data = patch->getPatchData(P_idx);
+            for (CellIterator<NDIM> ic(P_data->getGhostBox()); ic; ic++)
+            {
+                Point X;
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    X[d] = x_lower[d] + dx[d] * (ic()(d) - patch_lower(d) + 0.5);
+                }
+                (*P_data)(ic()) = exact_P(X);
+            }
+        }
+    }
+    return;
+} // fill_data
+
+// Add the given vector to the position or set the velocity of every local node.
+void
+update_nodes(LDataManager* l_data_manager,
+             const int finest_ln,
+             const std::string& data_name,
+             const Vector& value,
+             const bool add)
+{
+    for (int ln = 0; ln <= finest_ln; ++ln)
+    {
+        if (!l_data_manager->levelContainsLagrangianData(ln)) continue;
+        Pointer<LData> data = l_data_manager->getLData(data_name, ln);
+        boost::multi_array_ref<double, 2>& array = *data->getVecArray();
+        for (unsigned int k = 0; k < array.shape()[0]; ++k)
+        {
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                array[k][d] = (add ? array[k][d] : 0.0) + value[d];
+            }
+        }
+        data->restoreArrays();
+    }
+    return;
+} // update_nodes
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+    for (const std::string extension : { ".vertex", ".inst" })
+    {
+        std::ifstream structure_stream(SOURCE_DIR "/ring3d_16" + extension);
+        std::ofstream structure_cwd("ring3d_16" + extension);
+        structure_cwd << structure_stream.rdbuf();
+    }
+
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    { // cleanup dynamically allocated objects prior to shutdown
+        TimerManager::createManager(nullptr);
+
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "IB.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create major algorithm and data objects that comprise the
+        // application.
+        Pointer<INSHierarchyIntegrator> navier_stokes_integrator = new INSStaggeredHierarchyIntegrator(
+            "INSStaggeredHierarchyIntegrator",
+            app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"));
+        Pointer<IBMethod> ib_method_ops = new IBMethod("IBMethod", app_initializer->getComponentDatabase("IBMethod"));
+        Pointer<IBHierarchyIntegrator> time_integrator =
+            new IBExplicitHierarchyIntegrator("IBHierarchyIntegrator",
+                                              app_initializer->getComponentDatabase("IBHierarchyIntegrator"),
+                                              ib_method_ops,
+                                              navier_stokes_integrator);
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               time_integrator,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Configure the IB solver.
+        Pointer<IBStandardInitializer> ib_initializer = new IBStandardInitializer(
+            "IBStandardInitializer", app_initializer->getComponentDatabase("IBStandardInitializer"));
+        ib_method_ops->registerLInitStrategy(ib_initializer);
+        Pointer<IBStandardForceGen> ib_force_fcn = new IBStandardForceGen();
+        ib_method_ops->registerIBLagrangianForceFunction(ib_force_fcn);
+
+        // Initialize hierarchy configuration and data on all patches.
+        time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+
+        // Deallocate initialization objects.
+        ib_method_ops->freeLInitStrategy();
+        ib_initializer.setNull();
+
+        LDataManager* l_data_manager = ib_method_ops->getLDataManager();
+        Pointer<IBInstrumentPanel> instrument_panel = ib_method_ops->getIBInstrumentPanel();
+
+        // Create the velocity and pressure fields that are read by the
+        // instrument panel.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("instrument_panel_01");
+        Pointer<SideVariable<NDIM, double> > U_var = new SideVariable<NDIM, double>("U_instrument");
+        Pointer<CellVariable<NDIM, double> > P_var = new CellVariable<NDIM, double>("P_instrument");
+        const int U_idx = var_db->registerVariableAndContext(U_var, ctx, IntVector<NDIM>(1));
+        const int P_idx = var_db->registerVariableAndContext(P_var, ctx, IntVector<NDIM>(1));
+        auto allocate_data = [&](const bool allocate) {
+            for (int ln = 0; ln <= patch_hierarchy->getFinestLevelNumber(); ++ln)
+            {
+                Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+                if (allocate)
+                {
+                    level->allocatePatchData(U_idx, 0.0);
+                    level->allocatePatchData(P_idx, 0.0);
+                }
+                else
+                {
+                    level->deallocatePatchData(U_idx);
+                    level->deallocatePatchData(P_idx);
+                }
+            }
+        };
+        allocate_data(true);
+        fill_data(patch_hierarchy, U_idx, P_idx);
+
+        const int num_ring_nodes = input_db->getInteger("NUM_RING_NODES");
+        const double ring_radius = input_db->getDouble("RING_RADIUS");
+        const double area = 0.5 * num_ring_nodes * ring_radius * ring_radius * std::sin(2.0 * M_PI / num_ring_nodes);
+        Point X_centroid, shift;
+        input_db->getDoubleArray("RING_CENTER", X_centroid.data(), NDIM);
+        input_db->getDoubleArray("RING_SHIFT", shift.data(), NDIM);
+        const double W = input_db->getDouble("RING_NORMAL_VELOCITY");
+        const double tol = input_db->getDouble("TOL");
+
+        // The meter moves in the direction of its normal, so that the flow rate
+        // is reduced by the velocity of the meter.
+        update_nodes(l_data_manager,
+                     patch_hierarchy->getFinestLevelNumber(),
+                     LDataManager::VEL_DATA_NAME,
+                     Vector(0.0, 0.0, W),
+                     false);
+
+        std::ofstream out;
+        if (IBTK_MPI::getRank() == 0) out.open("output");
+        if (IBTK_MPI::getRank() == 0)
+        {
+            out << "instrument names:";
+            for (const std::string& name : instrument_panel->getInstrumentNames()) out << " " << name;
+            out << "\n";
+        }
+
+        int timestep_num = 0;
+        auto check_instrument_data = [&](const std::string& label) {
+            const double data_time = 0.0;
+            instrument_panel->initializeHierarchyDependentData(
+                patch_hierarchy, l_data_manager, timestep_num, data_time);
+            instrument_panel->readInstrumentData(
+                U_idx, P_idx, patch_hierarchy, l_data_manager, timestep_num, data_time);
+            ++timestep_num;
+            const double flow = instrument_panel->getFlowValues()[0];
+            const double mean_pres = instrument_panel->getMeanPressureValues()[0];
+            const double point_pres = instrument_panel->getPointwisePressureValues()[0];
+            const double exact_flow = (exact_U(2, X_centroid) - W) * area;
+            const double exact_pres = exact_P(X_centroid);
+            if (IBTK_MPI::getRank() == 0)
+            {
+                out << "\n" << label << ":\n";
+                out << "flow rate is correct: " << (std::abs(flow - exact_flow) <= tol * std::abs(exact_flow))
+                    << "\n";
+                out << "mean pressure is correct: " << (std::abs(mean_pres - exact_pres) <= tol * exact_pres)
+                    << "\n";
+                out << "pointwise pressure is correct: " << (std::abs(point_pres - exact_pres) <= tol * exact_pres)
+                    << "\n";
+            }
+        };
+
+        // Determine whether a node of the moved meter lies in the finest level.
+        const Point X_node = X_centroid + shift + Vector(ring_radius, 0.0, 0.0);
+        auto node_is_on_finest_level = [&]() {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(patch_hierarchy->getFinestLevelNumber());
+            const hier::Index<NDIM> i = IndexUtilities::getCellIndex(X_node, grid_geometry, level->getRatio());
+            return level->getBoxes().contains(i);
+        };
+
+        check_instrument_data("initial meter position");
+
+        // Move the meter without changing the patch hierarchy.
+        update_nodes(
+            l_data_manager, patch_hierarchy->getFinestLevelNumber(), LDataManager::POSN_DATA_NAME, shift, true);
+        X_centroid += shift;
+        if (IBTK_MPI::getRank() == 0)
+        {
+            out << "\nmoved meter lies in the finest level before regridding: " << node_is_on_finest_level() << "\n";
+        }
+        check_instrument_data("moved meter");
+
+        // Regrid the hierarchy so that the finest level follows the meter,
+        // which does not move.
+        allocate_data(false);
+        time_integrator->regridHierarchy();
+        allocate_data(true);
+        fill_data(patch_hierarchy, U_idx, P_idx);
+        update_nodes(l_data_manager,
+                     patch_hierarchy->getFinestLevelNumber(),
+                     LDataManager::VEL_DATA_NAME,
+                     Vector(0.0, 0.0, W),
+                     false);
+        if (IBTK_MPI::getRank() == 0)
+        {
+            out << "\nmoved meter lies in the finest level after regridding: " << node_is_on_finest_level() << "\n";
+        }
+        check_instrument_data("regridded hierarchy");
+
+        allocate_data(false);
+    } // cleanup dynamically allocated objects prior to shutdown
+} // main
@@ -0,0 +1,125 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+#include <ibtk/AsynchronousCheckpointWriter.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+
+#include <tbox/Database.h>
+#include <tbox/MemoryDatabase.h>
+#include <tbox/Pointer.h>
+#include <tbox/RestartManager.h>
+#include <tbox/Serializable.h>
+#include <tbox/Utilities.h>
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Set up application namespace declarations
+#include <ibtk/app_namespaces.h>
+
+// Write restart data through the aggregators of an AsynchronousCheckpointWriter
+// and check that the restart data that are read back after extracting the
+// checkpoint are the data at the time at which the checkpoint was written.
+namespace
+{
+class TestData : public Serializable
+{
+public:
+    void putToDatabase(Pointer<Database> db) override
+    {
+        db->putInteger("rank", d_rank);
+        db->putDoubleArray("values", d_values.data(), static_cast<int>(d_values.size()));
+        return;
+    } // putToDatabase
+
+    int d_rank = 0;
+    std::vector<double> d_values;
+};
+
+bool
+file_exists(const std::string& file_name)
+{
+    std::ifstream is(file_name.c_str());
+    return is.good();
+} // file_exists
+} // namespace
+
+int
+main(int argc, char** argv)
+{
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    const int rank = IBTK_MPI::getRank();
+    const int nodes = IBTK_MPI::getNodes();
+
+    // Use different amounts of data on each process so that an aggregator
+    // receives the data of its group in several batches.
+    TestData data;
+    data.d_rank = rank;
+    data.d_values.resize(100 * (rank + 1));
+    for (unsigned int k = 0; k < data.d_values.size(); ++k) data.d_values[k] = rank + 0.5 * k;
+    const std::vector<double> checkpoint_values = data.d_values;
+    RestartManager::getManager()->registerRestartItem("TestData", &data);
+
+    const std::string restart_dirname = "restart";
+    const std::string restore_dirname = restart_dirname + "/restore.000001";
+    const std::string proc_file_name =
+        restore_dirname + "/nodes." + Utilities::nodeToString(nodes) + "/proc." + Utilities::processorToString(rank);
+    {
+        Pointer<Database> input_db = new MemoryDatabase("AsynchronousCheckpointWriter");
+        input_db->putInteger("num_aggregators", 2);
+        input_db->putInteger("max_aggregator_buffer_size", 1024);
+        input_db->putString("staging_dirname", ".");
+        AsynchronousCheckpointWriter checkpoint_writer("AsynchronousCheckpointWriter", input_db);
+        checkpoint_writer.writeCheckpoint(restart_dirname, 1);
+
+        // Modifying the data after the checkpoint has been started does not
+        // change the checkpoint.
+        for (double& value : data.d_values) value = -1.0;
+        checkpoint_writer.advanceCommunication();
+        checkpoint_writer.waitForCompletion();
+    }
+    RestartManager::getManager()->unregisterRestartItem("TestData");
+
+    // The standard restart files only exist once the checkpoint has been
+    // extracted.
+    const int num_proc_files_before = IBTK_MPI::sumReduction(file_exists(proc_file_name) ? 1 : 0);
+    AsynchronousCheckpointWriter::extractCheckpoint(restart_dirname, 1);
+    const int num_proc_files_after = IBTK_MPI::sumReduction(file_exists(proc_file_name) ? 1 : 0);
+
+    RestartManager::getManager()->openRestartFile(restart_dirname, 1, nodes);
+    Pointer<Database> restart_db = RestartManager::getManager()->getRootDatabase()->getDatabase("TestData");
+    bool restored = restart_db->getInteger("rank") == rank &&
+                    restart_db->getArraySize("values") == static_cast<int>(checkpoint_values.size());
+    if (restored)
+    {
+        std::vector<double> values(checkpoint_values.size());
+        restart_db->getDoubleArray("values", values.data(), static_cast<int>(values.size()));
+        restored = values == checkpoint_values;
+    }
+    RestartManager::getManager()->closeRestartFile();
+    const int num_restored = IBTK_MPI::sumReduction(restored ? 1 : 0);
+
+    if (rank == 0)
+    {
+        std::ofstream out("output");
+        out << "aggregate files: " << file_exists(restore_dirname + "/aggregate.0000000") << " "
+            << file_exists(restore_dirname + "/aggregate.0000001") << "\n";
+        out << "checkpoint marked as complete: " << file_exists(restore_dirname + "/aggregate.info") << "\n";
+        out << "process files before extraction: " << num_proc_files_before << "\n";
+        out << "process files after extraction: " << num_proc_files_after << "\n";
+        out << "processes with restored data: " << num_restored << "\n";
+    }
+} // main
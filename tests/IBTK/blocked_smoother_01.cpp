@@ -0,0 +1,225 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <SAMRAI_config.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CartesianPatchGeometry.h>
+#include <CellData.h>
+#include <CellIterator.h>
+#include <CellVariable.h>
+#include <GriddingAlgorithm.h>
+#include <HierarchyCellDataOpsReal.h>
+#include <LoadBalancer.h>
+#include <PoissonSpecifications.h>
+#include <SAMRAIVectorReal.h>
+#include <SideData.h>
+#include <SideIterator.h>
+#include <SideVariable.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/CCPoissonPointRelaxationFACOperator.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Set up application namespace declarations
+#include <ibtk/app_namespaces.h>
+
+// Check that the blocked red-black Gauss-Seidel smoother, which performs
+// several color sweeps between ghost cell fills, gives the same result as the
+// red-black Gauss-Seidel smoother, which performs one color sweep per ghost
+// cell fill, for both constant and variable coefficients.  The right-hand side
+// is supported in the middle of each patch so that, for the number of sweeps
+// used here, the ghost cell values remain zero and the two smoothers must agree
+// up to roundoff.
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "blocked_smoother.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Create variables and register them with the variable database.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+        Pointer<CellVariable<NDIM, double> > u_var = new CellVariable<NDIM, double>("u");
+        Pointer<CellVariable<NDIM, double> > f_var = new CellVariable<NDIM, double>("f");
+        Pointer<CellVariable<NDIM, double> > u_ref_var = new CellVariable<NDIM, double>("u_ref");
+        Pointer<SideVariable<NDIM, double> > D_var = new SideVariable<NDIM, double>("D");
+        const int u_idx = var_db->registerVariableAndContext(u_var, ctx, IntVector<NDIM>(1));
+        const int f_idx = var_db->registerVariableAndContext(f_var, ctx, IntVector<NDIM>(1));
+        const int u_ref_idx = var_db->registerVariableAndContext(u_ref_var, ctx, IntVector<NDIM>(0));
+        const int D_idx = var_db->registerVariableAndContext(D_var, ctx, IntVector<NDIM>(0));
+
+        // Initialize the AMR patch hierarchy.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        int tag_buffer = 1;
+        int level_number = 0;
+        bool done = false;
+        while (!done && (gridding_algorithm->levelCanBeRefined(level_number)))
+        {
+            gridding_algorithm->makeFinerLevel(patch_hierarchy, 0.0, 0.0, tag_buffer);
+            done = !patch_hierarchy->finerLevelExists(level_number);
+            ++level_number;
+        }
+        const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+        for (int ln = 0; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            level->allocatePatchData(u_idx, 0.0);
+            level->allocatePatchData(f_idx, 0.0);
+            level->allocatePatchData(u_ref_idx, 0.0);
+            level->allocatePatchData(D_idx, 0.0);
+        }
+
+        // Set a right-hand side that is supported in the middle of each patch
+        // and a smoothly varying coefficient.
+        HierarchyCellDataOpsReal<NDIM, double> hier_cc_data_ops(patch_hierarchy, 0, finest_ln);
+        hier_cc_data_ops.setToScalar(f_idx, 0.0, false);
+        for (int ln = 0; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                const Box<NDIM>& patch_box = patch->getBox();
+                Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+                const double* const x_lower = pgeom->getXLower();
+                const double* const dx = pgeom->getDx();
+                Pointer<CellData<NDIM, double> > f_data = patch->getPatchData(f_idx);
+                Box<NDIM> support_box(patch_box);
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    const int mid = (patch_box.lower(d) + patch_box.upper(d)) / 2;
+                    support_box.lower(d) = mid;
+                    support_box.upper(d) = mid + 1;
+                }
+                int k = 0;
+                for (CellIterator<NDIM> ic(support_box); ic; ic++, ++k)
+                {
+                    (*f_data)(ic()) = 1.0 + 0.25 * k;
+                }
+                Pointer<SideData<NDIM, double> > D_data = patch->getPatchData(D_idx);
+                for (unsigned int axis = 0; axis < NDIM; ++axis)
+                {
+                    for (SideIterator<NDIM> is(patch_box, axis); is; is++)
+                    {
+                        double r = 0.0;
+                        for (unsigned int d = 0; d < NDIM; ++d)
+                        {
+                            const double offset = d == axis ? 0.0 : 0.5;
+                            r += x_lower[d] + dx[d] * (is()(d) - patch_box.lower(d) + offset);
+                        }
+                        (*D_data)(is()) = -(1.0 + 0.5 * std::sin(2.0 * r));
+                    }
+                }
+            }
+        }
+
+        SAMRAIVectorReal<NDIM, double> u_vec("u", patch_hierarchy, 0, finest_ln);
+        SAMRAIVectorReal<NDIM, double> f_vec("f", patch_hierarchy, 0, finest_ln);
+        u_vec.addComponent(u_var, u_idx);
+        f_vec.addComponent(f_var, f_idx);
+
+        const int num_sweeps = input_db->getInteger("NUM_SWEEPS");
+        const double tol = input_db->getDouble("TOL");
+        const std::vector<std::string> smoother_names = { "BlockedSmoother", "TiledBlockedSmoother" };
+        std::ofstream out;
+        if (IBTK_MPI::getRank() == 0) out.open("output");
+        for (const bool variable_coefficient : { false, true })
+        {
+            PoissonSpecifications poisson_spec("poisson_spec");
+            poisson_spec.setCConstant(input_db->getDouble("C"));
+            if (variable_coefficient)
+            {
+                poisson_spec.setDPatchDataId(D_idx);
+            }
+            else
+            {
+                poisson_spec.setDConstant(-1.0);
+            }
+
+            // Smooth the error with the given smoother, starting from zero.
+            auto smooth = [&](const std::string& smoother_name) {
+                CCPoissonPointRelaxationFACOperator fac_op(
+                    smoother_name, app_initializer->getComponentDatabase(smoother_name), "");
+                fac_op.setPoissonSpecifications(poisson_spec);
+                fac_op.initializeOperatorState(u_vec, f_vec);
+                hier_cc_data_ops.setToScalar(u_idx, 0.0, false);
+                fac_op.smoothError(u_vec, f_vec, 0, num_sweeps, false, false);
+                fac_op.deallocateOperatorState();
+            };
+
+            smooth("ReferenceSmoother");
+            hier_cc_data_ops.copyData(u_ref_idx, u_idx);
+            const double u_ref_norm = hier_cc_data_ops.maxNorm(u_ref_idx);
+            const std::string coef_type = variable_coefficient ? "variable" : "constant";
+            if (IBTK_MPI::getRank() == 0)
+            {
+                out << coef_type << " coefficient reference smoother changes the error: " << (u_ref_norm > 0.0)
+                    << "\n";
+            }
+            for (const std::string& smoother_name : smoother_names)
+            {
+                smooth(smoother_name);
+                hier_cc_data_ops.subtract(u_idx, u_idx, u_ref_idx);
+                const double max_diff = hier_cc_data_ops.maxNorm(u_idx);
+                if (IBTK_MPI::getRank() == 0)
+                {
+                    out << coef_type << " coefficient " << smoother_name
+                        << " matches reference smoother: " << (max_diff <= tol * u_ref_norm) << "\n";
+                }
+            }
+        }
+
+        for (int ln = 0; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            level->deallocatePatchData(u_idx);
+            level->deallocatePatchData(f_idx);
+            level->deallocatePatchData(u_ref_idx);
+            level->deallocatePatchData(D_idx);
+        }
+    } // cleanup dynamically allocated objects prior to shutdown
+} // main
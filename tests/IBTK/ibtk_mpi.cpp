@@ -39,6 +39,8 @@ bool sendAndRecv(T x, T exact);
 template <typename T>
 bool allGather(T x);
 
+bool sparseExchange();
+
 /*******************************************************************************
  * For each run, the input filename must be given on the command line.  In all *
  * cases, the command line is:                                                 *
@@ -94,6 +96,11 @@ main(int argc, char* argv[])
     passed = IBTK_MPI::maxReduction(passed ? 1 : 0);
     if (!rank) output_file << "all gather test " << (passed ? "passed" : "failed") << ".\n";
 
+    passed = sparseExchange();
+
+    passed = IBTK_MPI::maxReduction(passed ? 1 : 0);
+    if (!rank) output_file << "sparse exchange test " << (passed ? "passed" : "failed") << ".\n";
+
     if (!rank) output_file.close();
 } // main
 
@@ -191,3 +198,43 @@ allGather(T x)
         if (other[i] != i) passed = false;
     return passed;
 }
+
+// Return the data that the process with rank source sends to the process with
+// rank dest in the given round of sparseExchange(), which may be empty.
+std::vector<int>
+sparseExchangeMessage(int source, int dest, int round)
+{
+    int num_nodes = IBTK_MPI::getNodes();
+    std::vector<int> message;
+    // Only every other process sends data to the next process, and every
+    // process sends data to itself and to the process 3 ranks ahead of it.
+    if ((source % 2 == 0 && dest == (source + 1) % num_nodes) || dest == source ||
+        dest == (source + 3) % num_nodes)
+    {
+        for (int i = 0; i <= (source + dest + round) % 4; ++i) message.push_back(1000 * source + 10 * dest + round);
+    }
+    return message;
+}
+
+bool
+sparseExchange()
+{
+    int num_nodes = IBTK_MPI::getNodes();
+    int rank = IBTK_MPI::getRank();
+    bool passed = true;
+    // Consecutive exchanges must not receive each others' messages.
+    for (int round = 0; round < 3; ++round)
+    {
+        std::map<int, std::vector<int> > send_data, expected_data;
+        for (int k = 0; k < num_nodes; ++k)
+        {
+            std::vector<int> message = sparseExchangeMessage(rank, k, round);
+            if (!message.empty()) send_data[k] = message;
+            message = sparseExchangeMessage(k, rank, round);
+            if (!message.empty()) expected_data[k] = message;
+        }
+        std::map<int, std::vector<int> > recv_data = IBTK_MPI::sparseExchange(send_data);
+        if (recv_data != expected_data) passed = false;
+    }
+    return passed;
+}
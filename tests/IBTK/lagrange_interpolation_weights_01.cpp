@@ -0,0 +1,82 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+#include <ibtk/IBTKInit.h>
+#include <ibtk/ibtk_utilities.h>
+
+#include <cmath>
+#include <fstream>
+#include <utility>
+#include <vector>
+
+// Check that the extrapolation used to compute initial guesses for the Stokes
+// solver in INSStaggeredHierarchyIntegrator reproduces data that are
+// polynomial in time exactly.  As in the integrator, the velocity is stored at
+// the end of each previous time step and extrapolated to the end of the new
+// time step, and the pressure is stored at the midpoint of each previous time
+// step and extrapolated to the midpoint of the new time step.  The time step
+// sizes vary.
+namespace
+{
+double
+poly(const std::vector<double>& coefs, const double t)
+{
+    double val = 0.0;
+    for (auto it = coefs.rbegin(); it != coefs.rend(); ++it) val = val * t + *it;
+    return val;
+} // poly
+
+double
+extrapolation_error(const std::vector<double>& times, const double t, const std::vector<double>& coefs)
+{
+    const std::vector<double> weights = IBTK::lagrange_interpolation_weights(times, t);
+    double val = 0.0;
+    for (unsigned int k = 0; k < times.size(); ++k) val += weights[k] * poly(coefs, times[k]);
+    return std::abs(val - poly(coefs, t));
+} // extrapolation_error
+} // namespace
+
+int
+main(int argc, char** argv)
+{
+    IBTK::IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+    std::ofstream out("output");
+
+    // Time intervals of the previous time steps, most recent first, and of the
+    // new time step.
+    const std::vector<std::pair<double, double> > history = { { 0.25, 0.3 }, { 0.1, 0.25 }, { 0.0, 0.1 } };
+    const double current_time = 0.3, new_time = 0.42;
+    const double U_time = new_time;
+    const double P_time = 0.5 * (current_time + new_time);
+
+    const std::vector<double> coefs = { 1.5, -2.0, 3.0, 4.0 };
+    for (int order = 1; order <= 2; ++order)
+    {
+        const int n_sols = order + 1;
+        std::vector<double> U_times(n_sols), P_times(n_sols);
+        for (int k = 0; k < n_sols; ++k)
+        {
+            U_times[k] = history[k].second;
+            P_times[k] = 0.5 * (history[k].first + history[k].second);
+        }
+        out << "extrapolation order " << order << ":\n";
+        for (int degree = 0; degree <= order + 1; ++degree)
+        {
+            const std::vector<double> degree_coefs(coefs.begin(), coefs.begin() + degree + 1);
+            const bool U_exact = extrapolation_error(U_times, U_time, degree_coefs) < 1.0e-12;
+            const bool P_exact = extrapolation_error(P_times, P_time, degree_coefs) < 1.0e-12;
+            out << "  degree " << degree << " velocity exact: " << U_exact << " pressure exact: " << P_exact
+                << "\n";
+        }
+    }
+}
@@ -0,0 +1,200 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+
+#include <SAMRAI_config.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IBTK_CHKERRQ.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+#include <ibtk/LData.h>
+#include <ibtk/LSiloDataWriter.h>
+
+#include <petscao.h>
+
+#include <boost/multi_array.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+// Set up application namespace declarations
+#include <ibtk/app_namespaces.h>
+
+// Write marker clouds with an LSiloDataWriter whose number of output files is
+// set to two in the input database, so that the four processes write to two
+// group files, and check the names of the files, the process directories in
+// each group file, the paths in the summary file, and the coordinates that are
+// written.  Then make the clouds larger, permute the PETSc ordering, register
+// the new AO, and check that the data written again are the coordinates of the
+// larger clouds, which requires the cached local Vecs to be rebuilt.
+namespace
+{
+static const int NUM_LOCAL_NODES = 3;
+
+std::string
+read_file(const std::string& file_name)
+{
+    std::ifstream is(file_name.c_str(), std::ios::binary);
+    return std::string((std::istreambuf_iterator<char>(is)), std::istreambuf_iterator<char>());
+} // read_file
+
+bool
+file_exists(const std::string& file_name)
+{
+    std::ifstream is(file_name.c_str());
+    return is.good();
+} // file_exists
+
+std::string
+get_numbered_name(const std::string& prefix, const int number, const std::string& postfix)
+{
+    char buf[16];
+    std::snprintf(buf, sizeof(buf), "%04d", number);
+    return prefix + buf + postfix;
+} // get_numbered_name
+
+// The coordinates of the marker with the given Lagrangian index.
+double
+marker_position(const int lag_idx, const int d)
+{
+    return d == 0 ? lag_idx + 0.25 : 100.0 + lag_idx;
+} // marker_position
+
+// The bytes of the component of the coordinates of the markers with the given
+// Lagrangian indices, which are written contiguously in single precision.
+std::string
+get_coordinate_bytes(const int first_lag_idx, const int nmarks, const int d)
+{
+    std::vector<float> coords(nmarks);
+    for (int k = 0; k < nmarks; ++k) coords[k] = static_cast<float>(marker_position(first_lag_idx + k, d));
+    return std::string(reinterpret_cast<const char*>(coords.data()), nmarks * sizeof(float));
+} // get_coordinate_bytes
+
+// Build the AO in which the Lagrangian indices are shifted by the given
+// number of processes relative to the PETSc indices, and set the coordinates
+// in the corresponding PETSc ordering.
+AO
+build_ao(LData& X_data, const int shift)
+{
+    const int rank = IBTK_MPI::getRank();
+    const int num_nodes = NUM_LOCAL_NODES * IBTK_MPI::getNodes();
+    std::vector<int> lag_idxs(NUM_LOCAL_NODES), petsc_idxs(NUM_LOCAL_NODES);
+    boost::multi_array_ref<double, 2>& X_array = *X_data.getLocalFormVecArray();
+    for (int k = 0; k < NUM_LOCAL_NODES; ++k)
+    {
+        petsc_idxs[k] = NUM_LOCAL_NODES * rank + k;
+        lag_idxs[k] = (petsc_idxs[k] + NUM_LOCAL_NODES * shift) % num_nodes;
+        for (int d = 0; d < NDIM; ++d) X_array[k][d] = marker_position(lag_idxs[k], d);
+    }
+    X_data.restoreArrays();
+    AO ao;
+    int ierr = AOCreateMapping(PETSC_COMM_WORLD, NUM_LOCAL_NODES, lag_idxs.data(), petsc_idxs.data(), &ao);
+    IBTK_CHKERRQ(ierr);
+    return ao;
+} // build_ao
+} // namespace
+
+int
+main(int argc, char** argv)
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    std::vector<AO> aos;
+    { // cleanup dynamically allocated objects prior to shutdown
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "lsilo_data_writer.log");
+        Pointer<LSiloDataWriter> silo_data_writer = app_initializer->getLSiloDataWriter();
+        const std::string viz_dirname = app_initializer->getVizDumpDirectory();
+
+        const int rank = IBTK_MPI::getRank();
+        const int nodes = IBTK_MPI::getNodes();
+        std::ofstream out;
+        if (rank == 0) out.open("output");
+
+        Pointer<LData> X_data = new LData("X", NUM_LOCAL_NODES, NDIM);
+        silo_data_writer->registerCoordsData(X_data, 0);
+
+        // Each process writes one cloud that contains its first two markers,
+        // and then all of its markers.
+        const int num_groups = app_initializer->getComponentDatabase("Main")->getInteger("silo_number_output_files");
+        const int first_lag_idx = NUM_LOCAL_NODES * rank;
+        const std::string cloud_name = get_numbered_name("cloud_", rank, "");
+        for (int cycle = 0; cycle < 2; ++cycle)
+        {
+            const int nmarks = cycle == 0 ? NUM_LOCAL_NODES - 1 : NUM_LOCAL_NODES;
+            silo_data_writer->registerMarkerCloud(cloud_name, nmarks, first_lag_idx, 0);
+            aos.push_back(build_ao(*X_data, cycle));
+            silo_data_writer->registerLagrangianAO(aos.back(), 0);
+            silo_data_writer->writePlotData(cycle, static_cast<double>(cycle));
+            IBTK_MPI::barrier();
+            if (rank != 0) continue;
+
+            char buf[16];
+            std::snprintf(buf, sizeof(buf), "%06d", cycle);
+            const std::string dump_dirname = viz_dirname + "/lag_data.cycle_" + buf;
+            out << "cycle " << cycle << ":\n";
+            for (int proc = 0; proc < nodes; ++proc)
+            {
+                const std::string proc_file_name = get_numbered_name("lag_data.proc_", proc, ".silo");
+                out << proc_file_name << " exists: " << file_exists(dump_dirname + "/" + proc_file_name) << "\n";
+            }
+            for (int group = 0; group < num_groups; ++group)
+            {
+                const std::string group_file_name = get_numbered_name("lag_data.group_", group, ".silo");
+                out << group_file_name << " exists: " << file_exists(dump_dirname + "/" + group_file_name) << "\n";
+                const std::string group_file = read_file(dump_dirname + "/" + group_file_name);
+                for (int proc = 0; proc < nodes; ++proc)
+                {
+                    const std::string proc_dirname = get_numbered_name("proc_", proc, "");
+                    out << group_file_name << " contains " << proc_dirname << ": "
+                        << (group_file.find(proc_dirname) != std::string::npos) << "\n";
+                }
+                for (int proc = 0; proc < nodes; ++proc)
+                {
+                    if (proc * num_groups / nodes != group) continue;
+                    bool has_coords = true;
+                    for (int d = 0; d < NDIM; ++d)
+                    {
+                        const std::string coords = get_coordinate_bytes(NUM_LOCAL_NODES * proc, nmarks, d);
+                        has_coords = has_coords && group_file.find(coords) != std::string::npos;
+                    }
+                    out << group_file_name << " contains the coordinates of process " << proc << ": " << has_coords
+                        << "\n";
+                }
+            }
+
+            const std::string summary_file =
+                read_file(dump_dirname + "/lag_data.cycle_" + std::string(buf) + ".summary.silo");
+            for (int proc = 0; proc < nodes; ++proc)
+            {
+                const int group = proc * num_groups / nodes;
+                const std::string mesh_name = get_numbered_name("lag_data.group_", group, ".silo:") +
+                                              get_numbered_name("proc_", proc, "/level_0_cloud_0/mesh");
+                out << "summary file contains " << mesh_name << ": "
+                    << (summary_file.find(mesh_name) != std::string::npos) << "\n";
+            }
+        }
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    for (AO& ao : aos)
+    {
+        int ierr = AODestroy(&ao);
+        IBTK_CHKERRQ(ierr);
+    }
+} // main
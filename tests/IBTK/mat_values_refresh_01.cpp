@@ -0,0 +1,299 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc objects
+#include <petscmat.h>
+
+// Headers for major SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <GriddingAlgorithm.h>
+#include <HierarchyCellDataOpsReal.h>
+#include <LoadBalancer.h>
+#include <PoissonSpecifications.h>
+#include <SAMRAIVectorReal.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/StaggeredStokesPETScMatUtilities.h>
+#include <ibamr/StaggeredStokesPETScVecUtilities.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/CCPoissonPETScLevelSolver.h>
+#include <ibtk/HierarchyGhostCellInterpolation.h>
+#include <ibtk/HierarchyMathOps.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_CHKERRQ.h>
+#include <ibtk/IBTK_MPI.h>
+#include <ibtk/PETScMatUtilities.h>
+#include <ibtk/PETScVecUtilities.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+// Set up application namespace declarations
+#include <ibtk/app_namespaces.h>
+
+// Check that refreshing the values of a level operator matrix in place gives
+// exactly the matrix that is assembled from scratch for the same coefficients,
+// and that a level solver that refreshes its matrix and its additive or
+// multiplicative Schwarz preconditioner in place computes the same solution as
+// a level solver that is initialized from scratch.
+namespace
+{
+double
+max_difference(Mat A, Mat B)
+{
+    Mat D;
+    int ierr = MatDuplicate(A, MAT_COPY_VALUES, &D);
+    IBTK_CHKERRQ(ierr);
+    ierr = MatAXPY(D, -1.0, B, SAME_NONZERO_PATTERN);
+    IBTK_CHKERRQ(ierr);
+    double norm;
+    ierr = MatNorm(D, NORM_INFINITY, &norm);
+    IBTK_CHKERRQ(ierr);
+    ierr = MatDestroy(&D);
+    IBTK_CHKERRQ(ierr);
+    return norm;
+} // max_difference
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "mat_values_refresh.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Create variables and register them with the variable database.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+        Pointer<CellVariable<NDIM, int> > cc_dof_var = new CellVariable<NDIM, int>("cc_dof");
+        Pointer<SideVariable<NDIM, int> > sc_dof_var = new SideVariable<NDIM, int>("sc_dof");
+        Pointer<SideVariable<NDIM, int> > u_dof_var = new SideVariable<NDIM, int>("u_dof");
+        Pointer<CellVariable<NDIM, int> > p_dof_var = new CellVariable<NDIM, int>("p_dof");
+        Pointer<CellVariable<NDIM, double> > u_var = new CellVariable<NDIM, double>("u");
+        Pointer<CellVariable<NDIM, double> > v_var = new CellVariable<NDIM, double>("v");
+        Pointer<CellVariable<NDIM, double> > f_var = new CellVariable<NDIM, double>("f");
+        Pointer<CellVariable<NDIM, double> > c_var = new CellVariable<NDIM, double>("c");
+        Pointer<NodeVariable<NDIM, double> > mu_var = new NodeVariable<NDIM, double>("mu");
+        const int cc_dof_idx = var_db->registerVariableAndContext(cc_dof_var, ctx, IntVector<NDIM>(1));
+        const int sc_dof_idx = var_db->registerVariableAndContext(sc_dof_var, ctx, IntVector<NDIM>(1));
+        const int u_dof_idx = var_db->registerVariableAndContext(u_dof_var, ctx, IntVector<NDIM>(1));
+        const int p_dof_idx = var_db->registerVariableAndContext(p_dof_var, ctx, IntVector<NDIM>(1));
+        const int u_idx = var_db->registerVariableAndContext(u_var, ctx, IntVector<NDIM>(1));
+        const int v_idx = var_db->registerVariableAndContext(v_var, ctx, IntVector<NDIM>(1));
+        const int f_idx = var_db->registerVariableAndContext(f_var, ctx, IntVector<NDIM>(1));
+        const int c_idx = var_db->registerVariableAndContext(c_var, ctx, IntVector<NDIM>(0));
+        const int mu_idx = var_db->registerVariableAndContext(mu_var, ctx, IntVector<NDIM>(1));
+
+        // Initialize the AMR patch hierarchy.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(0);
+        level->allocatePatchData(cc_dof_idx, 0.0);
+        level->allocatePatchData(sc_dof_idx, 0.0);
+        level->allocatePatchData(u_dof_idx, 0.0);
+        level->allocatePatchData(p_dof_idx, 0.0);
+        level->allocatePatchData(u_idx, 0.0);
+        level->allocatePatchData(v_idx, 0.0);
+        level->allocatePatchData(f_idx, 0.0);
+        level->allocatePatchData(c_idx, 0.0);
+        level->allocatePatchData(mu_idx, 0.0);
+
+        std::vector<int> cc_num_dofs_per_proc, sc_num_dofs_per_proc, stokes_num_dofs_per_proc;
+        PETScVecUtilities::constructPatchLevelDOFIndices(cc_num_dofs_per_proc, cc_dof_idx, level);
+        PETScVecUtilities::constructPatchLevelDOFIndices(sc_num_dofs_per_proc, sc_dof_idx, level);
+        StaggeredStokesPETScVecUtilities::constructPatchLevelDOFIndices(
+            stokes_num_dofs_per_proc, u_dof_idx, p_dof_idx, level);
+
+        typedef HierarchyGhostCellInterpolation::InterpolationTransactionComponent InterpolationTransactionComponent;
+        InterpolationTransactionComponent mu_transaction(mu_idx,
+                                                         /*DATA_REFINE_TYPE*/ "LINEAR_REFINE",
+                                                         /*USE_CF_INTERPOLATION*/ false,
+                                                         /*DATA_COARSEN_TYPE*/ "CONSTANT_COARSEN",
+                                                         /*BDRY_EXTRAP_TYPE*/ "LINEAR",
+                                                         /*CONSISTENT_TYPE_2_BDRY*/ false,
+                                                         /*mu_bc_coef*/ NULL,
+                                                         Pointer<VariableFillPattern<NDIM> >(NULL));
+        HierarchyGhostCellInterpolation mu_bdry_fill;
+        mu_bdry_fill.initializeOperatorState(mu_transaction, patch_hierarchy, 0, 0);
+        PoissonSpecifications stokes_spec("stokes_spec");
+        std::vector<RobinBcCoefStrategy<NDIM>*> stokes_bc_coefs(NDIM, nullptr);
+        auto set_coefficients = [&](const int k) {
+            stokes_spec.setCConstant(input_db->getDoubleArray("STOKES_C")[k - 1]);
+            stokes_spec.setDConstant(input_db->getDoubleArray("STOKES_D")[k - 1]);
+            const std::string c_db_name = "c_" + std::to_string(k);
+            const std::string mu_db_name = "mu_" + std::to_string(k);
+            muParserCartGridFunction c_fcn(c_db_name, app_initializer->getComponentDatabase(c_db_name), grid_geometry);
+            c_fcn.setDataOnPatchHierarchy(c_idx, c_var, patch_hierarchy, 0.0);
+            muParserCartGridFunction mu_fcn(
+                mu_db_name, app_initializer->getComponentDatabase(mu_db_name), grid_geometry);
+            mu_fcn.setDataOnPatchHierarchy(mu_idx, mu_var, patch_hierarchy, 0.0);
+            mu_bdry_fill.fillData(0.0);
+        };
+
+        PoissonSpecifications cc_spec("cc_spec");
+        cc_spec.setCPatchDataId(c_idx);
+        cc_spec.setDConstant(-1.0);
+        std::vector<RobinBcCoefStrategy<NDIM>*> cc_bc_coefs(1, nullptr);
+        PoissonSpecifications sc_spec("sc_spec");
+        sc_spec.setCConstant(1.0);
+        sc_spec.setDPatchDataId(mu_idx);
+        std::vector<RobinBcCoefStrategy<NDIM>*> sc_bc_coefs(NDIM, nullptr);
+        const double alpha = 1.0, beta = 1.0;
+
+        // Assemble the matrices for the first set of coefficients and then
+        // refresh their values for the other sets.  The first refresh builds
+        // the plans and the later ones reuse them.
+        set_coefficients(1);
+        Mat cc_mat = nullptr, sc_mat = nullptr, stokes_mat = nullptr;
+        PETScMatUtilities::constructPatchLevelCCLaplaceOp(
+            cc_mat, cc_spec, cc_bc_coefs, 0.0, cc_num_dofs_per_proc, cc_dof_idx, level);
+        PETScMatUtilities::constructPatchLevelVCSCViscousOp(
+            sc_mat, sc_spec, alpha, beta, sc_bc_coefs, 0.0, sc_num_dofs_per_proc, sc_dof_idx, level);
+        StaggeredStokesPETScMatUtilities::constructPatchLevelMACStokesOp(
+            stokes_mat, stokes_spec, stokes_bc_coefs, 0.0, stokes_num_dofs_per_proc, u_dof_idx, p_dof_idx, level);
+        PETScMatUtilities::MatValuesPlan cc_plan, sc_plan, stokes_plan;
+        for (int k = 2; k <= 3; ++k)
+        {
+            set_coefficients(k);
+            PETScMatUtilities::refreshPatchLevelCCLaplaceOpValues(
+                cc_mat, cc_plan, cc_spec, cc_bc_coefs, 0.0, cc_num_dofs_per_proc, cc_dof_idx, level);
+            PETScMatUtilities::refreshPatchLevelVCSCViscousOpValues(
+                sc_mat, sc_plan, sc_spec, alpha, beta, sc_bc_coefs, 0.0, sc_num_dofs_per_proc, sc_dof_idx, level);
+            StaggeredStokesPETScMatUtilities::refreshPatchLevelMACStokesOpValues(stokes_mat,
+                                                                                 stokes_plan,
+                                                                                 stokes_spec,
+                                                                                 stokes_bc_coefs,
+                                                                                 0.0,
+                                                                                 stokes_num_dofs_per_proc,
+                                                                                 u_dof_idx,
+                                                                                 p_dof_idx,
+                                                                                 level);
+
+            Mat cc_ref_mat = nullptr, sc_ref_mat = nullptr, stokes_ref_mat = nullptr;
+            PETScMatUtilities::constructPatchLevelCCLaplaceOp(
+                cc_ref_mat, cc_spec, cc_bc_coefs, 0.0, cc_num_dofs_per_proc, cc_dof_idx, level);
+            PETScMatUtilities::constructPatchLevelVCSCViscousOp(
+                sc_ref_mat, sc_spec, alpha, beta, sc_bc_coefs, 0.0, sc_num_dofs_per_proc, sc_dof_idx, level);
+            StaggeredStokesPETScMatUtilities::constructPatchLevelMACStokesOp(stokes_ref_mat,
+                                                                             stokes_spec,
+                                                                             stokes_bc_coefs,
+                                                                             0.0,
+                                                                             stokes_num_dofs_per_proc,
+                                                                             u_dof_idx,
+                                                                             p_dof_idx,
+                                                                             level);
+            pout << "coefficient set " << k << ":\n";
+            pout << "  CC Laplace plan built: " << cc_plan.isInitialized(cc_mat) << "\n";
+            pout << "  CC Laplace refreshed matrix is identical: " << (max_difference(cc_mat, cc_ref_mat) == 0.0)
+                 << "\n";
+            pout << "  VC viscous plan built: " << sc_plan.isInitialized(sc_mat) << "\n";
+            pout << "  VC viscous refreshed matrix is identical: " << (max_difference(sc_mat, sc_ref_mat) == 0.0)
+                 << "\n";
+            pout << "  MAC Stokes plan built: " << stokes_plan.isInitialized(stokes_mat) << "\n";
+            pout << "  MAC Stokes refreshed matrix is identical: "
+                 << (max_difference(stokes_mat, stokes_ref_mat) == 0.0) << "\n";
+            int ierr = MatDestroy(&cc_ref_mat);
+            IBTK_CHKERRQ(ierr);
+            ierr = MatDestroy(&sc_ref_mat);
+            IBTK_CHKERRQ(ierr);
+            ierr = MatDestroy(&stokes_ref_mat);
+            IBTK_CHKERRQ(ierr);
+        }
+        int ierr = MatDestroy(&cc_mat);
+        IBTK_CHKERRQ(ierr);
+        ierr = MatDestroy(&sc_mat);
+        IBTK_CHKERRQ(ierr);
+        ierr = MatDestroy(&stokes_mat);
+        IBTK_CHKERRQ(ierr);
+
+        // Solve with a level solver that refreshes its matrix and extracts the
+        // submatrices of its Schwarz preconditioner again when the
+        // coefficients change, and compare the solutions to those computed by
+        // a level solver that is initialized from scratch for every solve.
+        HierarchyMathOps hier_math_ops("hier_math_ops", patch_hierarchy);
+        const int h_cc_idx = hier_math_ops.getCellWeightPatchDescriptorIndex();
+        HierarchyCellDataOpsReal<NDIM, double> cc_data_ops(patch_hierarchy, 0, 0);
+        SAMRAIVectorReal<NDIM, double> u_vec("u", patch_hierarchy, 0, 0);
+        SAMRAIVectorReal<NDIM, double> v_vec("v", patch_hierarchy, 0, 0);
+        SAMRAIVectorReal<NDIM, double> f_vec("f", patch_hierarchy, 0, 0);
+        u_vec.addComponent(u_var, u_idx, h_cc_idx);
+        v_vec.addComponent(v_var, v_idx, h_cc_idx);
+        f_vec.addComponent(f_var, f_idx, h_cc_idx);
+        muParserCartGridFunction f_fcn("f", app_initializer->getComponentDatabase("f"), grid_geometry);
+        f_fcn.setDataOnPatchHierarchy(f_idx, f_var, patch_hierarchy, 0.0);
+        auto solve = [&](CCPoissonPETScLevelSolver& solver, SAMRAIVectorReal<NDIM, double>& x) {
+            x.setToScalar(0.0);
+            solver.initializeSolverState(x, f_vec);
+            solver.solveSystem(x, f_vec);
+        };
+        const double tol = input_db->getDouble("TOL");
+        for (const std::string shell_pc_type : { "additive", "multiplicative" })
+        {
+            Pointer<Database> solver_db = input_db->getDatabase("solver_db");
+            solver_db->putString("shell_pc_type", shell_pc_type);
+            solver_db->putBool("reuse_solver_state", true);
+            CCPoissonPETScLevelSolver reusing_solver("reusing_solver", solver_db, "reusing_");
+            solver_db->putBool("reuse_solver_state", false);
+            CCPoissonPETScLevelSolver reference_solver("reference_solver", solver_db, "reference_");
+            for (CCPoissonPETScLevelSolver* solver : { &reusing_solver, &reference_solver })
+            {
+                solver->setPoissonSpecifications(cc_spec);
+                solver->setPhysicalBcCoefs(cc_bc_coefs);
+                solver->setSolutionTime(0.0);
+            }
+
+            set_coefficients(1);
+            solve(reusing_solver, u_vec);
+            for (int k = 2; k <= 3; ++k)
+            {
+                set_coefficients(k);
+                solve(reusing_solver, u_vec);
+                solve(reference_solver, v_vec);
+                reference_solver.deallocateSolverState();
+                cc_data_ops.subtract(v_idx, v_idx, u_idx);
+                const double rel_diff = cc_data_ops.maxNorm(v_idx, h_cc_idx) / cc_data_ops.maxNorm(u_idx, h_cc_idx);
+                pout << shell_pc_type << " Schwarz solver refreshed for coefficient set " << k
+                     << " matches rebuilt solver: " << (rel_diff < tol) << "\n";
+            }
+            reusing_solver.deallocateSolverState();
+        }
+
+    } // cleanup dynamically allocated objects prior to shutdown
+} // main
@@ -0,0 +1,314 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <SAMRAI_config.h>
+
+// Headers for basic SAMRAI objects
+#include <ArrayData.h>
+#include <BergerRigoutsos.h>
+#include <BoundaryBox.h>
+#include <CartesianGridGeometry.h>
+#include <CartesianPatchGeometry.h>
+#include <CellData.h>
+#include <CellIterator.h>
+#include <CellVariable.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <NodeData.h>
+#include <NodeIterator.h>
+#include <NodeVariable.h>
+#include <SideData.h>
+#include <SideIterator.h>
+#include <SideVariable.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+#include <ibtk/PhysicalBoundaryUtilities.h>
+#include <ibtk/muParserCartGridFunction.h>
+#include <ibtk/muParserRobinBcCoefs.h>
+
+#include <muParser.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Set up application namespace declarations
+#include <ibtk/app_namespaces.h>
+
+// Check that the bulk evaluation of muParserCartGridFunction and
+// muParserRobinBcCoefs agrees with evaluating the same expressions one location
+// at a time, both for time-dependent and time-independent expressions, and
+// that the values of time-independent expressions that are copied from the
+// cache agree with the ones that were computed.
+
+namespace
+{
+// Evaluate an expression at a single location, as was done before
+// muParserCartGridFunction and muParserRobinBcCoefs used muParser's bulk mode.
+// Copies share the storage of the variables, which must outlive the parser.
+class PointwiseParser
+{
+public:
+    PointwiseParser(const std::string& expr)
+    {
+        const double pi = 3.1415926535897932384626433832795;
+        d_parser.DefineConst("PI", pi);
+        d_parser.DefineVar("t", &(*d_vars)[NDIM]);
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            d_parser.DefineVar("X_" + std::to_string(d), &(*d_vars)[d]);
+        }
+        d_parser.SetExpr(expr);
+        return;
+    }
+
+    double eval(const std::array<double, NDIM>& posn, const double time)
+    {
+        std::copy(posn.begin(), posn.end(), d_vars->begin());
+        (*d_vars)[NDIM] = time;
+        return d_parser.Eval();
+    }
+
+private:
+    std::shared_ptr<std::array<double, NDIM + 1> > d_vars = std::make_shared<std::array<double, NDIM + 1> >();
+    mu::Parser d_parser;
+};
+
+std::array<double, NDIM>
+get_posn(const Patch<NDIM>& patch, const hier::Index<NDIM>& i, const std::array<double, NDIM>& offset)
+{
+    Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch.getPatchGeometry();
+    const double* const x_lower = pgeom->getXLower();
+    const double* const dx = pgeom->getDx();
+    std::array<double, NDIM> posn;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        posn[d] = x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch.getBox().lower(d)) + offset[d]);
+    }
+    return posn;
+}
+
+double
+relative_error(const double computed, const double expected)
+{
+    return std::abs(computed - expected) / std::max(std::abs(expected), 1.0);
+}
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "muparser.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Create variables and register them with the variable database.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+        Pointer<CellVariable<NDIM, double> > c_var = new CellVariable<NDIM, double>("c", 2);
+        Pointer<SideVariable<NDIM, double> > s_var = new SideVariable<NDIM, double>("s");
+        Pointer<NodeVariable<NDIM, double> > n_var = new NodeVariable<NDIM, double>("n");
+        const int c_idx = var_db->registerVariableAndContext(c_var, ctx, IntVector<NDIM>(0));
+        const int s_idx = var_db->registerVariableAndContext(s_var, ctx, IntVector<NDIM>(0));
+        const int n_idx = var_db->registerVariableAndContext(n_var, ctx, IntVector<NDIM>(0));
+
+        // Initialize the AMR patch hierarchy.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        int tag_buffer = 1;
+        int level_number = 0;
+        bool done = false;
+        while (!done && (gridding_algorithm->levelCanBeRefined(level_number)))
+        {
+            gridding_algorithm->makeFinerLevel(patch_hierarchy, 0.0, 0.0, tag_buffer);
+            done = !patch_hierarchy->finerLevelExists(level_number);
+            ++level_number;
+        }
+        const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+        for (int ln = 0; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            level->allocatePatchData(c_idx, 0.0);
+            level->allocatePatchData(s_idx, 0.0);
+            level->allocatePatchData(n_idx, 0.0);
+        }
+
+        Pointer<Database> steady_db = app_initializer->getComponentDatabase("SteadyFunction");
+        Pointer<Database> unsteady_db = app_initializer->getComponentDatabase("UnsteadyFunction");
+        Pointer<Database> bc_coefs_db = app_initializer->getComponentDatabase("BcCoefs");
+        muParserCartGridFunction steady_fcn("steady_fcn", steady_db, grid_geometry);
+        muParserCartGridFunction unsteady_fcn("unsteady_fcn", unsteady_db, grid_geometry);
+        muParserRobinBcCoefs bc_coefs("bc_coefs", bc_coefs_db, grid_geometry);
+        std::vector<PointwiseParser> steady_parsers = { PointwiseParser(steady_db->getString("function_0")),
+                                                        PointwiseParser(steady_db->getString("function_1")) };
+        PointwiseParser unsteady_parser(unsteady_db->getString("function"));
+
+        // Set the data on the entire hierarchy and compare it to the pointwise
+        // values.  The time-independent function is evaluated again in the
+        // second pass, which caches its values, and the third pass copies the
+        // values from the cache.
+        const double tol = input_db->getDouble("TOL");
+        const std::array<double, 3> times = { 0.0, 0.5, 0.25 };
+        double max_steady_err = 0.0, max_unsteady_err = 0.0;
+        for (const double time : times)
+        {
+            steady_fcn.setDataOnPatchHierarchy(c_idx, c_var, patch_hierarchy, time);
+            unsteady_fcn.setDataOnPatchHierarchy(s_idx, s_var, patch_hierarchy, time);
+            unsteady_fcn.setDataOnPatchHierarchy(n_idx, n_var, patch_hierarchy, time);
+            for (int ln = 0; ln <= finest_ln; ++ln)
+            {
+                Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+                for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+                {
+                    Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                    const Box<NDIM>& patch_box = patch->getBox();
+                    Pointer<CellData<NDIM, double> > c_data = patch->getPatchData(c_idx);
+                    Pointer<SideData<NDIM, double> > s_data = patch->getPatchData(s_idx);
+                    Pointer<NodeData<NDIM, double> > n_data = patch->getPatchData(n_idx);
+
+                    std::array<double, NDIM> offset;
+                    offset.fill(0.5);
+                    for (CellIterator<NDIM> ic(patch_box); ic; ic++)
+                    {
+                        const std::array<double, NDIM> posn = get_posn(*patch, ic(), offset);
+                        for (int depth = 0; depth < 2; ++depth)
+                        {
+                            const double expected = steady_parsers[depth].eval(posn, time);
+                            max_steady_err = std::max(max_steady_err, relative_error((*c_data)(ic(), depth), expected));
+                        }
+                    }
+                    for (unsigned int axis = 0; axis < NDIM; ++axis)
+                    {
+                        offset.fill(0.5);
+                        offset[axis] = 0.0;
+                        for (SideIterator<NDIM> is(patch_box, axis); is; is++)
+                        {
+                            const std::array<double, NDIM> posn = get_posn(*patch, is(), offset);
+                            const double expected = unsteady_parser.eval(posn, time);
+                            max_unsteady_err = std::max(max_unsteady_err, relative_error((*s_data)(is()), expected));
+                        }
+                    }
+                    offset.fill(0.0);
+                    for (NodeIterator<NDIM> in(patch_box); in; in++)
+                    {
+                        const std::array<double, NDIM> posn = get_posn(*patch, in(), offset);
+                        const double expected = unsteady_parser.eval(posn, time);
+                        max_unsteady_err = std::max(max_unsteady_err, relative_error((*n_data)(in()), expected));
+                    }
+                }
+            }
+        }
+        max_steady_err = IBTK_MPI::maxReduction(max_steady_err);
+        max_unsteady_err = IBTK_MPI::maxReduction(max_unsteady_err);
+
+        // Set the boundary coefficients on all of the physical boundaries and
+        // compare them to the pointwise values.  Only the coefficients on the
+        // lower side of the x axis depend on time.
+        std::vector<std::array<PointwiseParser, 3> > bc_parsers;
+        for (int location_index = 0; location_index < 2 * NDIM; ++location_index)
+        {
+            const std::string postfix = "_function_" + std::to_string(location_index);
+            bc_parsers.push_back({ PointwiseParser(bc_coefs_db->getString("acoef" + postfix)),
+                                   PointwiseParser(bc_coefs_db->getString("bcoef" + postfix)),
+                                   PointwiseParser(bc_coefs_db->getString("gcoef" + postfix)) });
+        }
+        double max_bc_err = 0.0;
+        for (const double time : times)
+        {
+            for (int ln = 0; ln <= finest_ln; ++ln)
+            {
+                Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+                for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+                {
+                    Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                    Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+                    if (!pgeom->getTouchesRegularBoundary()) continue;
+                    const Array<BoundaryBox<NDIM> > bdry_boxes =
+                        PhysicalBoundaryUtilities::getPhysicalBoundaryCodim1Boxes(*patch);
+                    for (int k = 0; k < bdry_boxes.size(); ++k)
+                    {
+                        const BoundaryBox<NDIM>& bdry_box = bdry_boxes[k];
+                        const int location_index = bdry_box.getLocationIndex();
+                        const unsigned int bdry_normal_axis = location_index / 2;
+                        const Box<NDIM> bc_coef_box = PhysicalBoundaryUtilities::makeSideBoundaryCodim1Box(bdry_box);
+                        Pointer<ArrayData<NDIM, double> > acoef_data = new ArrayData<NDIM, double>(bc_coef_box, 1);
+                        Pointer<ArrayData<NDIM, double> > bcoef_data = new ArrayData<NDIM, double>(bc_coef_box, 1);
+                        Pointer<ArrayData<NDIM, double> > gcoef_data = new ArrayData<NDIM, double>(bc_coef_box, 1);
+                        bc_coefs.setBcCoefs(acoef_data, bcoef_data, gcoef_data, s_var, *patch, bdry_box, time);
+
+                        std::array<double, NDIM> offset;
+                        offset.fill(0.5);
+                        offset[bdry_normal_axis] = 0.0;
+                        for (Box<NDIM>::Iterator b(bc_coef_box); b; b++)
+                        {
+                            const std::array<double, NDIM> posn = get_posn(*patch, b(), offset);
+                            std::array<PointwiseParser, 3>& parsers = bc_parsers[location_index];
+                            max_bc_err = std::max(max_bc_err,
+                                                  relative_error((*acoef_data)(b(), 0), parsers[0].eval(posn, time)));
+                            max_bc_err = std::max(max_bc_err,
+                                                  relative_error((*bcoef_data)(b(), 0), parsers[1].eval(posn, time)));
+                            max_bc_err = std::max(max_bc_err,
+                                                  relative_error((*gcoef_data)(b(), 0), parsers[2].eval(posn, time)));
+                        }
+                    }
+                }
+            }
+        }
+        max_bc_err = IBTK_MPI::maxReduction(max_bc_err);
+
+        if (IBTK_MPI::getRank() == 0)
+        {
+            std::ofstream out("output");
+            out << "time-independent function is time-dependent: " << steady_fcn.isTimeDependent() << "\n";
+            out << "time-dependent function is time-dependent: " << unsteady_fcn.isTimeDependent() << "\n";
+            out << "time-independent function matches pointwise evaluation: " << (max_steady_err <= tol) << "\n";
+            out << "time-dependent function matches pointwise evaluation: " << (max_unsteady_err <= tol) << "\n";
+            out << "boundary coefficients match pointwise evaluation: " << (max_bc_err <= tol) << "\n";
+        }
+
+        for (int ln = 0; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            level->deallocatePatchData(c_idx);
+            level->deallocatePatchData(s_idx);
+            level->deallocatePatchData(n_idx);
+        }
+    } // cleanup dynamically allocated objects prior to shutdown
+} // main
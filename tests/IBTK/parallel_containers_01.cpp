@@ -0,0 +1,157 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+#include <ibamr/IBAnchorPointSpec.h>
+
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+#include <ibtk/ParallelEdgeMap.h>
+#include <ibtk/ParallelMap.h>
+#include <ibtk/ParallelSet.h>
+
+#include <tbox/Pointer.h>
+
+#include <fstream>
+#include <map>
+#include <set>
+#include <utility>
+#include <vector>
+
+// Check that ParallelSet, ParallelMap, and ParallelEdgeMap store the same data
+// when they are replicated and when they are partitioned among the processes.
+// In both cases, additions to the same key are applied in the order of the
+// ranks of the processes that made them, and all additions are processed
+// before any removals.
+int
+main(int argc, char** argv)
+{
+    IBTK::IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+    IBAMR::IBAnchorPointSpec::registerWithStreamableManager();
+
+    using IBTK::IBTK_MPI;
+    const int rank = IBTK_MPI::getRank();
+    const int size = IBTK_MPI::getNodes();
+    std::ofstream out;
+    if (rank == 0) out.open("output");
+
+    // Every process asks for every key, including one that is never added.
+    std::vector<int> keys;
+    for (int key = 0; key < 3 * size; ++key) keys.push_back(key);
+    keys.push_back(100);
+    keys.push_back(200);
+    keys.push_back(1000);
+
+    for (const bool replicate_data : { true, false })
+    {
+        const std::string mode = replicate_data ? "replicated" : "partitioned";
+
+        // Each process adds its own keys and every process adds key 100.  Key
+        // 200 is added by the first process and removed by the last one during
+        // the same communication.  Keys 0 and 1 are removed afterwards.
+        IBTK::ParallelSet set(replicate_data);
+        for (int k = 0; k < 3; ++k) set.addItem(rank + k * size);
+        set.addItem(100);
+        if (rank == 0) set.addItem(200);
+        if (rank == size - 1) set.removeItem(200);
+        set.communicateData();
+        if (rank == 0) set.removeItem(1);
+        if (rank == 1) set.removeItem(0);
+        set.communicateData();
+
+        std::set<int> expected_set;
+        for (int key = 2; key < 3 * size; ++key) expected_set.insert(key);
+        expected_set.insert(100);
+        const std::set<int> set_view = set.getLocalView(keys);
+        const int set_passed = IBTK_MPI::minReduction(static_cast<int>(set_view == expected_set));
+        const int num_stored_keys = IBTK_MPI::sumReduction(static_cast<int>(set.getSet().size()));
+        if (rank == 0)
+        {
+            out << mode << " ParallelSet:\n";
+            out << "  local view:";
+            for (const int key : set_view) out << " " << key;
+            out << "\n  local views are correct: " << set_passed << "\n";
+            out << "  number of stored keys: " << num_stored_keys << "\n";
+        }
+
+        // Each process adds its own keys with values that depend on the keys
+        // and every process adds key 100 with a value that depends on its rank.
+        IBTK::ParallelMap map(replicate_data);
+        for (int k = 0; k < 3; ++k)
+        {
+            const int key = rank + k * size;
+            map.addItem(key, new IBAMR::IBAnchorPointSpec(10 * key));
+        }
+        map.addItem(100, new IBAMR::IBAnchorPointSpec(rank));
+        if (rank == 0) map.addItem(200, new IBAMR::IBAnchorPointSpec(200));
+        if (rank == size - 1) map.removeItem(200);
+        map.communicateData();
+        if (rank == 0) map.removeItem(1);
+        if (rank == 1) map.removeItem(0);
+        map.communicateData();
+
+        std::map<int, int> expected_map;
+        for (int key = 2; key < 3 * size; ++key) expected_map[key] = 10 * key;
+        expected_map[100] = size - 1;
+        std::map<int, int> map_view;
+        for (const auto& key_item : map.getLocalView(keys))
+        {
+            SAMRAI::tbox::Pointer<IBAMR::IBAnchorPointSpec> spec = key_item.second;
+            map_view[key_item.first] = spec->getNodeIndex();
+        }
+        const int map_passed = IBTK_MPI::minReduction(static_cast<int>(map_view == expected_map));
+        const int num_stored_items = IBTK_MPI::sumReduction(static_cast<int>(map.getMap().size()));
+        if (rank == 0)
+        {
+            out << mode << " ParallelMap:\n";
+            out << "  local view:";
+            for (const auto& key_value : map_view) out << " " << key_value.first << ":" << key_value.second;
+            out << "\n  local views are correct: " << map_passed << "\n";
+            out << "  number of stored items: " << num_stored_items << "\n";
+        }
+
+        // Each process adds the links from its rank to the next rank and to
+        // the rank that is size larger.  The link from 0 to 1 is removed
+        // afterwards.
+        IBTK::ParallelEdgeMap edge_map(replicate_data);
+        edge_map.addEdge(std::make_pair(rank, rank + 1));
+        edge_map.addEdge(std::make_pair(rank + size, rank));
+        edge_map.communicateData();
+        if (rank == size - 1) edge_map.removeEdge(std::make_pair(0, 1));
+        edge_map.communicateData();
+
+        std::multimap<int, std::pair<int, int> > expected_edge_map;
+        for (int k = 0; k < size; ++k)
+        {
+            if (k > 0) expected_edge_map.insert(std::make_pair(k, std::make_pair(k, k + 1)));
+            expected_edge_map.insert(std::make_pair(k, std::make_pair(k + size, k)));
+        }
+        const std::multimap<int, std::pair<int, int> > edge_map_view = edge_map.getLocalView(keys);
+        const std::set<std::pair<int, std::pair<int, int> > > edge_set(edge_map_view.begin(), edge_map_view.end());
+        const std::set<std::pair<int, std::pair<int, int> > > expected_edge_set(expected_edge_map.begin(),
+                                                                                expected_edge_map.end());
+        const int edge_map_passed = IBTK_MPI::minReduction(
+            static_cast<int>(edge_map_view.size() == expected_edge_map.size() && edge_set == expected_edge_set));
+        const int num_stored_edges = IBTK_MPI::sumReduction(static_cast<int>(edge_map.getEdgeMap().size()));
+        if (rank == 0)
+        {
+            out << mode << " ParallelEdgeMap:\n";
+            out << "  local view:";
+            for (const auto& edge : edge_set)
+            {
+                out << " " << edge.first << ":(" << edge.second.first << "," << edge.second.second << ")";
+            }
+            out << "\n  local views are correct: " << edge_map_passed << "\n";
+            out << "  number of stored edges: " << num_stored_edges << "\n";
+        }
+    }
+}
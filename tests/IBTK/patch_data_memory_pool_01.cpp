@@ -0,0 +1,73 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+#include <ibtk/IBTKInit.h>
+#include <ibtk/PatchDataMemoryPool.h>
+
+#include <tbox/Pointer.h>
+
+#include <fstream>
+
+// Check that the pool reuses blocks of the same size and that it releases the
+// least recently used blocks once the retained memory exceeds its limit.
+int
+main(int argc, char** argv)
+{
+    IBTK::IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+    std::ofstream out("output");
+
+    using IBTK::PatchDataMemoryPool;
+    out << "enabled by default: " << PatchDataMemoryPool::getEnabled() << "\n";
+    out << "null arena when disabled: " << PatchDataMemoryPool::getArena().isNull() << "\n";
+    PatchDataMemoryPool::setEnabled(true);
+    out << "arena when enabled: " << !PatchDataMemoryPool::getArena().isNull() << "\n";
+
+    SAMRAI::tbox::Pointer<PatchDataMemoryPool> pool = PatchDataMemoryPool::getPool();
+    pool->setMaxRetainedBytes(3000);
+
+    // A freed block is handed out again for a request of the same size.
+    void* p1 = pool->alloc(1000);
+    pool->free(p1);
+    void* p2 = pool->alloc(1000);
+    out << "block reused: " << (p1 == p2) << "\n";
+    out << "requests: " << pool->getNumberOfRequests() << " recycled: " << pool->getNumberOfRecycledRequests()
+        << "\n";
+    out << "allocated bytes: " << pool->getAllocatedBytes() << " retained bytes: " << pool->getRetainedBytes()
+        << "\n";
+    pool->free(p2);
+
+    // Retain blocks of two sizes and then use the smaller size again so that
+    // the larger one becomes the least recently used.
+    void* q = pool->alloc(2000);
+    pool->free(q);
+    out << "retained bytes: " << pool->getRetainedBytes() << "\n";
+    void* a = pool->alloc(1000);
+    pool->free(a);
+
+    // Exceeding the limit releases the 2000 byte block but keeps the others.
+    void* b = pool->alloc(1500);
+    pool->free(b);
+    out << "retained bytes after eviction: " << pool->getRetainedBytes() << "\n";
+    const unsigned long num_recycled = pool->getNumberOfRecycledRequests();
+    void* c = pool->alloc(2000);
+    out << "evicted size recycled: " << (pool->getNumberOfRecycledRequests() > num_recycled) << "\n";
+    void* d = pool->alloc(1000);
+    out << "retained size recycled: " << (pool->getNumberOfRecycledRequests() > num_recycled) << "\n";
+    pool->free(c);
+    pool->free(d);
+
+    // Disabling the pool releases all retained memory.
+    PatchDataMemoryPool::setEnabled(false);
+    out << "retained bytes when disabled: " << pool->getRetainedBytes() << "\n";
+    out << "allocated bytes when disabled: " << pool->getAllocatedBytes() << "\n";
+}
@@ -0,0 +1,185 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+#include <ibtk/PerformanceTrace.h>
+
+#include <tbox/Database.h>
+#include <tbox/Pointer.h>
+
+#include <cstddef>
+#include <fstream>
+#include <iterator>
+#include <regex>
+#include <string>
+#include <vector>
+
+// Set up application namespace declarations
+#include <ibtk/app_namespaces.h>
+
+// Record nested phases and values with a performance trace that is enabled
+// through the input database, and check the CSV, Chrome trace, and load summary
+// files that are written from it, including names that must be quoted.  Then
+// check that the records beyond the maximum number set in the input database
+// are discarded but are still counted in the load summary.
+namespace
+{
+// Split a line of a CSV file into its fields, removing the quotation marks
+// around quoted fields and undoubling the quotation marks inside them.
+std::vector<std::string>
+split_csv_line(const std::string& line)
+{
+    std::vector<std::string> fields(1);
+    bool in_quotes = false;
+    for (std::size_t k = 0; k < line.size(); ++k)
+    {
+        const char c = line[k];
+        if (in_quotes && c == '"' && k + 1 < line.size() && line[k + 1] == '"')
+        {
+            fields.back().push_back('"');
+            ++k;
+        }
+        else if (c == '"')
+        {
+            in_quotes = !in_quotes;
+        }
+        else if (c == ',' && !in_quotes)
+        {
+            fields.emplace_back();
+        }
+        else
+        {
+            fields.back().push_back(c);
+        }
+    }
+    return fields;
+} // split_csv_line
+
+std::vector<std::vector<std::string> >
+read_csv_file(const std::string& file_name)
+{
+    std::vector<std::vector<std::string> > lines;
+    std::ifstream is(file_name.c_str());
+    std::string line;
+    while (std::getline(is, line)) lines.push_back(split_csv_line(line));
+    return lines;
+} // read_csv_file
+
+void
+record_nested_phases()
+{
+    PerformanceTrace::setStep(1);
+    {
+        PerformanceTrace::ScopedPhase outer_phase("test::", "outer");
+        PerformanceTrace::recordValue("iterations", 3.0);
+        {
+            PerformanceTrace::ScopedPhase inner_phase("test::", "inner \"quoted\", with comma");
+            PerformanceTrace::recordValue("residual", 0.5);
+        }
+    }
+    PerformanceTrace::setStep(2);
+    {
+        PerformanceTrace::ScopedPhase outer_phase("test::", "outer");
+    }
+    return;
+} // record_nested_phases
+} // namespace
+
+int
+main(int argc, char** argv)
+{
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    { // cleanup dynamically allocated objects prior to shutdown
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "performance_trace.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        const int rank = IBTK_MPI::getRank();
+        std::ofstream out;
+        if (rank == 0) out.open("output");
+        if (rank == 0) out << "tracing enabled: " << PerformanceTrace::isEnabled() << "\n";
+
+        PerformanceTrace::clear();
+        record_nested_phases();
+        PerformanceTrace::writeCSV("trace.csv");
+        PerformanceTrace::writeChromeTrace("trace.json");
+        PerformanceTrace::writeLoadSummary("trace_summary.csv");
+        if (rank == 0)
+        {
+            // Print the CSV trace without the times, which vary from run to
+            // run, and check that the inner phase lies within the first outer
+            // phase.
+            const std::vector<std::vector<std::string> > trace = read_csv_file("trace.csv");
+            out << "\nCSV trace:\n";
+            double outer_start = -1.0, outer_end = -1.0, inner_start = 0.0, inner_end = 0.0;
+            for (const std::vector<std::string>& fields : trace)
+            {
+                out << fields[0] << "|" << fields[1] << "|" << fields[2] << "|" << fields[3] << "|" << fields[4]
+                    << "|" << fields[7] << "\n";
+                if (fields[2] != "phase") continue;
+                const double start = std::stod(fields[5]), end = start + std::stod(fields[6]);
+                if (fields[0] == "0" && fields[1] == "1" && fields[4] == "0")
+                {
+                    outer_start = start;
+                    outer_end = end;
+                }
+                if (fields[0] == "0" && fields[4] == "1")
+                {
+                    inner_start = start;
+                    inner_end = end;
+                }
+            }
+            out << "inner phase lies within outer phase: "
+                << (outer_start <= inner_start && inner_start <= inner_end && inner_end <= outer_end) << "\n";
+
+            // Print the Chrome trace with the times replaced by placeholders.
+            std::ifstream json_is("trace.json");
+            const std::string json((std::istreambuf_iterator<char>(json_is)), std::istreambuf_iterator<char>());
+            const std::regex time_regex("\"(ts|dur)\":[0-9.]+");
+            out << "\nChrome trace:\n" << std::regex_replace(json, time_regex, "\"$1\":T");
+
+            // Print the load summary without the times.
+            out << "\nload summary:\n";
+            for (const std::vector<std::string>& fields : read_csv_file("trace_summary.csv"))
+            {
+                out << fields[0] << "|" << fields[1] << "|" << fields[2] << "\n";
+            }
+        }
+
+        // The maximum number of records set in the input database is exactly
+        // the number of records made above.  Every phase recorded after that is
+        // discarded, but is still counted in the load summary.
+        PerformanceTrace::clear();
+        record_nested_phases();
+        const int num_extra_phases = input_db->getInteger("NUM_EXTRA_PHASES");
+        for (int k = 0; k < num_extra_phases; ++k)
+        {
+            PerformanceTrace::ScopedPhase extra_phase("test::", "extra");
+        }
+        const int num_discarded_records = PerformanceTrace::getNumberOfDiscardedRecords();
+        PerformanceTrace::writeCSV("trace.csv");
+        PerformanceTrace::writeLoadSummary("trace_summary.csv");
+        if (rank == 0)
+        {
+            out << "\nnumber of discarded records: " << num_discarded_records << "\n";
+            out << "number of CSV trace lines: " << read_csv_file("trace.csv").size() << "\n";
+            out << "\nload summary:\n";
+            for (const std::vector<std::string>& fields : read_csv_file("trace_summary.csv"))
+            {
+                out << fields[0] << "|" << fields[1] << "|" << fields[2] << "\n";
+            }
+        }
+    } // cleanup dynamically allocated objects prior to shutdown
+} // main
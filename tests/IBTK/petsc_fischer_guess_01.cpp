@@ -0,0 +1,173 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_CHKERRQ.h>
+#include <ibtk/PETScFischerGuess.h>
+
+#include <petscvec.h>
+
+#include <cmath>
+#include <fstream>
+#include <vector>
+
+namespace
+{
+Vec
+make_vec(const std::vector<double>& values)
+{
+    Vec v;
+    int ierr = VecCreateSeq(PETSC_COMM_SELF, static_cast<PetscInt>(values.size()), &v);
+    IBTK_CHKERRQ(ierr);
+    for (unsigned int i = 0; i < values.size(); ++i)
+    {
+        ierr = VecSetValue(v, i, values[i], INSERT_VALUES);
+        IBTK_CHKERRQ(ierr);
+    }
+    ierr = VecAssemblyBegin(v);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecAssemblyEnd(v);
+    IBTK_CHKERRQ(ierr);
+    return v;
+} // make_vec
+
+void
+print_vec(std::ostream& out, Vec v)
+{
+    PetscInt size;
+    int ierr = VecGetSize(v, &size);
+    IBTK_CHKERRQ(ierr);
+    const PetscScalar* a;
+    ierr = VecGetArrayRead(v, &a);
+    IBTK_CHKERRQ(ierr);
+    for (PetscInt i = 0; i < size; ++i)
+    {
+        // avoid printing -0
+        out << (std::abs(a[i]) < 1.0e-12 ? 0.0 : a[i]) << (i + 1 < size ? " " : "\n");
+    }
+    ierr = VecRestoreArrayRead(v, &a);
+    IBTK_CHKERRQ(ierr);
+} // print_vec
+
+void
+destroy_vecs(std::vector<Vec> vecs)
+{
+    for (Vec& v : vecs)
+    {
+        int ierr = VecDestroy(&v);
+        IBTK_CHKERRQ(ierr);
+    }
+} // destroy_vecs
+} // namespace
+
+int
+main(int argc, char** argv)
+{
+    IBTK::IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+    std::ofstream out("output");
+
+    // Make sure that we project onto a single vector
+    {
+        IBTK::PETScFischerGuess guess(1);
+        Vec solution = make_vec({ 1, 1, 1 });
+        Vec rhs = make_vec({ 1, 1, 0 });
+        guess.submit(solution, rhs);
+
+        Vec new_rhs = make_vec({ 1, 0, 0 });
+        guess.guess(solution, new_rhs);
+        print_vec(out, solution);
+        destroy_vecs({ solution, rhs, new_rhs });
+    }
+
+    // Same but submit the same pair over and over again: only one pair should
+    // be retained
+    {
+        IBTK::PETScFischerGuess guess(3);
+        for (int i = 0; i < 10; ++i)
+        {
+            Vec solution = make_vec({ 1, 1, 1 });
+            Vec rhs = make_vec({ 1, 1, 0 });
+            guess.submit(solution, rhs);
+            destroy_vecs({ solution, rhs });
+        }
+        out << "number of vectors: " << guess.getNumberOfVectors() << "\n";
+
+        Vec new_rhs = make_vec({ 1, 0, 0 });
+        Vec solution = make_vec({ 0, 0, 0 });
+        guess.guess(solution, new_rhs);
+        print_vec(out, solution);
+        destroy_vecs({ solution, new_rhs });
+    }
+
+    // Check with two vectors
+    {
+        IBTK::PETScFischerGuess guess(10);
+        Vec solution_1 = make_vec({ 1, 1, 1 });
+        Vec rhs_1 = make_vec({ 1, 1, 0 });
+        guess.submit(solution_1, rhs_1);
+        Vec solution_2 = make_vec({ 1, 2, 3 });
+        Vec rhs_2 = make_vec({ 1, -1, 0 });
+        guess.submit(solution_2, rhs_2);
+
+        Vec new_rhs = make_vec({ 1, 0, 0 });
+        Vec solution = make_vec({ 0, 0, 0 });
+        guess.guess(solution, new_rhs);
+        print_vec(out, solution);
+        destroy_vecs({ solution_1, rhs_1, solution_2, rhs_2, solution, new_rhs });
+    }
+
+    // When the subspace is full, the oldest pair is evicted and the remaining
+    // pairs still reproduce the solutions of A = diag(1, 2, 4) exactly
+    {
+        IBTK::PETScFischerGuess guess(2);
+        const std::vector<double> diag = { 1, 2, 4 };
+        for (int k = 0; k < 3; ++k)
+        {
+            std::vector<double> x_vals(3, 0.0), b_vals(3, 0.0);
+            b_vals[k] = 1.0;
+            x_vals[k] = 1.0 / diag[k];
+            Vec solution = make_vec(x_vals);
+            Vec rhs = make_vec(b_vals);
+            guess.submit(solution, rhs);
+            destroy_vecs({ solution, rhs });
+        }
+        out << "number of vectors: " << guess.getNumberOfVectors() << "\n";
+
+        Vec solution = make_vec({ 0, 0, 0 });
+        Vec new_rhs = make_vec({ 1, 1, 1 });
+        guess.guess(solution, new_rhs);
+        print_vec(out, solution);
+        destroy_vecs({ solution, new_rhs });
+    }
+
+    // The retained pairs are discarded when the operator or the vector layout
+    // changes
+    {
+        IBTK::PETScFischerGuess guess(5);
+        guess.setOperatorFingerprint(1);
+        Vec solution = make_vec({ 1, 1, 1 });
+        Vec rhs = make_vec({ 1, 1, 0 });
+        guess.submit(solution, rhs);
+        guess.setOperatorFingerprint(1);
+        out << "number of vectors with the same operator: " << guess.getNumberOfVectors() << "\n";
+        guess.setOperatorFingerprint(2);
+        out << "number of vectors with a new operator: " << guess.getNumberOfVectors() << "\n";
+
+        guess.submit(solution, rhs);
+        Vec long_solution = make_vec({ 1, 1, 1, 1 });
+        Vec long_rhs = make_vec({ 0, 0, 1, 1 });
+        guess.submit(long_solution, long_rhs);
+        out << "number of vectors with a new layout: " << guess.getNumberOfVectors() << "\n";
+        destroy_vecs({ solution, rhs, long_solution, long_rhs });
+    }
+}
@@ -0,0 +1,190 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc objects
+#include <petscsys.h>
+
+// Headers for major SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <GriddingAlgorithm.h>
+#include <HierarchySideDataOpsReal.h>
+#include <LoadBalancer.h>
+#include <PoissonSpecifications.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/HierarchyGhostCellInterpolation.h>
+#include <ibtk/HierarchyMathOps.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/VCSCViscousPETScLevelSolver.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+// Set up application namespace declarations
+#include <ibtk/app_namespaces.h>
+
+// Verify that a VCSCViscousPETScLevelSolver that reuses its solver state
+// reassembles the operator whenever the viscosity or the viscosity
+// interpolation type changes.  Each solution computed with the reused solver
+// is compared to the solution computed by a freshly initialized solver.
+int
+main(int argc, char* argv[])
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "vc_viscous_level_solver.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Create variables and register them with the variable database.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+
+        Pointer<SideVariable<NDIM, double> > u_sc_var = new SideVariable<NDIM, double>("u_sc");
+        Pointer<SideVariable<NDIM, double> > v_sc_var = new SideVariable<NDIM, double>("v_sc");
+        Pointer<SideVariable<NDIM, double> > w_sc_var = new SideVariable<NDIM, double>("w_sc");
+        Pointer<SideVariable<NDIM, double> > f_sc_var = new SideVariable<NDIM, double>("f_sc");
+        Pointer<NodeVariable<NDIM, double> > mu_nc_var = new NodeVariable<NDIM, double>("mu_node");
+        const int u_sc_idx = var_db->registerVariableAndContext(u_sc_var, ctx, IntVector<NDIM>(1));
+        const int v_sc_idx = var_db->registerVariableAndContext(v_sc_var, ctx, IntVector<NDIM>(1));
+        const int w_sc_idx = var_db->registerVariableAndContext(w_sc_var, ctx, IntVector<NDIM>(1));
+        const int f_sc_idx = var_db->registerVariableAndContext(f_sc_var, ctx, IntVector<NDIM>(1));
+        const int mu_nc_idx = var_db->registerVariableAndContext(mu_nc_var, ctx, IntVector<NDIM>(1));
+
+        // Initialize the AMR patch hierarchy.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(0);
+        level->allocatePatchData(u_sc_idx, 0.0);
+        level->allocatePatchData(v_sc_idx, 0.0);
+        level->allocatePatchData(w_sc_idx, 0.0);
+        level->allocatePatchData(f_sc_idx, 0.0);
+        level->allocatePatchData(mu_nc_idx, 0.0);
+
+        // Setup vector objects.
+        HierarchyMathOps hier_math_ops("hier_math_ops", patch_hierarchy);
+        const int h_sc_idx = hier_math_ops.getSideWeightPatchDescriptorIndex();
+        SAMRAIVectorReal<NDIM, double> u_vec("u", patch_hierarchy, 0, 0);
+        SAMRAIVectorReal<NDIM, double> v_vec("v", patch_hierarchy, 0, 0);
+        SAMRAIVectorReal<NDIM, double> f_vec("f", patch_hierarchy, 0, 0);
+        u_vec.addComponent(u_sc_var, u_sc_idx, h_sc_idx);
+        v_vec.addComponent(v_sc_var, v_sc_idx, h_sc_idx);
+        f_vec.addComponent(f_sc_var, f_sc_idx, h_sc_idx);
+        HierarchySideDataOpsReal<NDIM, double> sc_data_ops(patch_hierarchy, 0, 0);
+
+        muParserCartGridFunction f_fcn("f", app_initializer->getComponentDatabase("f"), grid_geometry);
+        f_fcn.setDataOnPatchHierarchy(f_sc_idx, f_sc_var, patch_hierarchy, 0.0);
+
+        typedef HierarchyGhostCellInterpolation::InterpolationTransactionComponent InterpolationTransactionComponent;
+        InterpolationTransactionComponent mu_transaction(mu_nc_idx,
+                                                         /*DATA_REFINE_TYPE*/ "LINEAR_REFINE",
+                                                         /*USE_CF_INTERPOLATION*/ false,
+                                                         /*DATA_COARSEN_TYPE*/ "CONSTANT_COARSEN",
+                                                         /*BDRY_EXTRAP_TYPE*/ "LINEAR",
+                                                         /*CONSISTENT_TYPE_2_BDRY*/ false,
+                                                         /*mu_bc_coef*/ NULL,
+                                                         Pointer<VariableFillPattern<NDIM> >(NULL));
+        HierarchyGhostCellInterpolation mu_bdry_fill;
+        mu_bdry_fill.initializeOperatorState(mu_transaction, patch_hierarchy, 0, 0);
+        auto set_viscosity = [&](const std::string& mu_db_name) {
+            muParserCartGridFunction mu_fcn(
+                mu_db_name, app_initializer->getComponentDatabase(mu_db_name), grid_geometry);
+            mu_fcn.setDataOnPatchHierarchy(mu_nc_idx, mu_nc_var, patch_hierarchy, 0.0);
+            mu_bdry_fill.fillData(0.0);
+        };
+
+        PoissonSpecifications vc_vel_spec("vc_vel_spec");
+        vc_vel_spec.setCConstant(input_db->getDouble("C"));
+        vc_vel_spec.setDPatchDataId(mu_nc_idx);
+        std::vector<RobinBcCoefStrategy<NDIM>*> u_bc_coefs(NDIM, nullptr);
+
+        // The reusing solver keeps its state between solves; the reference
+        // solver is reinitialized from scratch for every solve.
+        Pointer<Database> solver_db = input_db->getDatabase("solver_db");
+        solver_db->putBool("reuse_solver_state", true);
+        VCSCViscousPETScLevelSolver reusing_solver("reusing_solver", solver_db, "reusing_");
+        solver_db->putBool("reuse_solver_state", false);
+        VCSCViscousPETScLevelSolver reference_solver("reference_solver", solver_db, "reference_");
+        for (VCSCViscousPETScLevelSolver* solver : { &reusing_solver, &reference_solver })
+        {
+            solver->setPoissonSpecifications(vc_vel_spec);
+            solver->setPhysicalBcCoefs(u_bc_coefs);
+            solver->setSolutionTime(0.0);
+        }
+
+        auto solve = [&](VCSCViscousPETScLevelSolver& solver, SAMRAIVectorReal<NDIM, double>& x) {
+            x.setToScalar(0.0);
+            solver.initializeSolverState(x, f_vec);
+            solver.solveSystem(x, f_vec);
+        };
+        auto max_difference = [&](const int idx1, const int idx2) {
+            sc_data_ops.subtract(w_sc_idx, idx1, idx2);
+            return sc_data_ops.maxNorm(w_sc_idx, h_sc_idx) / sc_data_ops.maxNorm(idx2, h_sc_idx);
+        };
+        const double tol = input_db->getDouble("tol");
+
+        set_viscosity("mu_1");
+        solve(reusing_solver, u_vec);
+        sc_data_ops.copyData(v_sc_idx, u_sc_idx);
+
+        // Change the viscosity.
+        set_viscosity("mu_2");
+        solve(reusing_solver, u_vec);
+        pout << "solution changed with the viscosity: " << (max_difference(u_sc_idx, v_sc_idx) > tol) << "\n";
+        solve(reference_solver, v_vec);
+        pout << "reused solver matches reference solver: " << (max_difference(u_sc_idx, v_sc_idx) < tol) << "\n";
+        reference_solver.deallocateSolverState();
+
+        // Change only the viscosity interpolation type.
+        reusing_solver.setViscosityInterpolationType(VC_AVERAGE_INTERP);
+        reference_solver.setViscosityInterpolationType(VC_AVERAGE_INTERP);
+        solve(reusing_solver, u_vec);
+        pout << "solution changed with the interpolation type: " << (max_difference(u_sc_idx, v_sc_idx) > tol)
+             << "\n";
+        solve(reference_solver, v_vec);
+        pout << "reused solver matches reference solver: " << (max_difference(u_sc_idx, v_sc_idx) < tol) << "\n";
+        reference_solver.deallocateSolverState();
+
+        // Solve again without changing the operator.
+        sc_data_ops.copyData(v_sc_idx, u_sc_idx);
+        solve(reusing_solver, u_vec);
+        pout << "solution unchanged with the same operator: " << (max_difference(u_sc_idx, v_sc_idx) < tol) << "\n";
+        reusing_solver.deallocateSolverState();
+
+    } // cleanup dynamically allocated objects prior to shutdown
+} // main
@@ -0,0 +1,258 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+#include <ibamr/CFRelaxationOperator.h>
+#include <ibamr/CFTensorUtilities.h>
+
+#include <ibtk/IBTKInit.h>
+#include <ibtk/ibtk_utilities.h>
+
+#include <Box.h>
+#include <CellData.h>
+#include <CellIndex.h>
+#include <CellIterator.h>
+#include <IntVector.h>
+#include <Patch.h>
+#include <PatchLevel.h>
+#include <Variable.h>
+#include <tbox/MemoryDatabase.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <string>
+#include <utility>
+
+IBTK_DISABLE_EXTRA_WARNINGS
+#include <Eigen/Eigenvalues>
+#include <unsupported/Eigen/MatrixFunctions>
+IBTK_ENABLE_EXTRA_WARNINGS
+
+#include <ibamr/app_namespaces.h>
+
+// Check that the closed-form symmetric tensor functions agree with the
+// functions computed by Eigen, both for single tensors and for patch data,
+// including tensors with repeated eigenvalues, and that the patch data version
+// of CFRelaxationOperator::convertToConformation() converts all cells at once
+// by default and converts each cell with the single tensor version when it is
+// overridden.
+
+namespace
+{
+static const int NUM_TENSOR_COMPONENTS = NDIM * (NDIM + 1) / 2;
+
+// A relaxation operator that exposes the conversion of patch data, optionally
+// converts each cell with the single tensor conversion, and optionally overrides
+// the single tensor conversion.
+class TestRelaxation : public CFRelaxationOperator
+{
+public:
+    TestRelaxation(const std::string& object_name,
+                   Pointer<Database> input_db,
+                   const bool convert_each_tensor,
+                   const bool scale_tensors)
+        : CFRelaxationOperator(object_name, input_db),
+          d_convert_each_tensor(convert_each_tensor),
+          d_scale_tensors(scale_tensors)
+    {
+        // intentionally blank
+        return;
+    }
+
+    void setDataOnPatch(const int /*data_idx*/,
+                        Pointer<hier::Variable<NDIM> > /*var*/,
+                        Pointer<Patch<NDIM> > /*patch*/,
+                        const double /*data_time*/,
+                        const bool /*initial_time*/,
+                        Pointer<PatchLevel<NDIM> > /*patch_level*/) override
+    {
+        // intentionally blank
+        return;
+    }
+
+    void convert(const CellData<NDIM, double>& in_data, CellData<NDIM, double>& out_data, const Box<NDIM>& box)
+    {
+        convertToConformation(in_data, out_data, box);
+        return;
+    }
+
+protected:
+    bool usesSingleTensorConversion() const override
+    {
+        return d_convert_each_tensor;
+    }
+
+    MatrixNd convertToConformation(const MatrixNd& mat) override
+    {
+        return d_scale_tensors ? MatrixNd(2.0 * mat) : CFRelaxationOperator::convertToConformation(mat);
+    }
+
+    using CFRelaxationOperator::convertToConformation;
+
+private:
+    const bool d_convert_each_tensor;
+    const bool d_scale_tensors;
+};
+
+MatrixNd
+get_tensor(const CellData<NDIM, double>& data, const CellIndex<NDIM>& i)
+{
+    MatrixNd mat;
+    for (int k = 0; k < NUM_TENSOR_COMPONENTS; ++k)
+    {
+        const std::pair<int, int> idx = voigt_to_tensor_idx(k);
+        mat(idx.first, idx.second) = mat(idx.second, idx.first) = data(i, k);
+    }
+    return mat;
+}
+
+// Fill the data with symmetric tensors with eigenvalues of both signs.  Every
+// third cell contains a multiple of the identity and every fifth cell contains
+// a tensor with a pair of nearly repeated eigenvalues.
+void
+fill_tensors(CellData<NDIM, double>& data)
+{
+    int n = 0;
+    for (CellIterator<NDIM> ic(data.getGhostBox()); ic; ic++, ++n)
+    {
+        const CellIndex<NDIM>& i = ic();
+        for (int k = 0; k < NUM_TENSOR_COMPONENTS; ++k)
+        {
+            const std::pair<int, int> idx = voigt_to_tensor_idx(k);
+            data(i, k) = idx.first == idx.second ? 2.0 * std::sin(0.37 * n + k) : std::cos(0.73 * n + 1.3 * k);
+        }
+        if (n % 3 == 0 || n % 5 == 0)
+        {
+            for (int k = 0; k < NUM_TENSOR_COMPONENTS; ++k)
+            {
+                const std::pair<int, int> idx = voigt_to_tensor_idx(k);
+                if (idx.first != idx.second) data(i, k) = 0.0;
+            }
+            for (int d = 1; d < NDIM; ++d) data(i, d) = data(i, 0) + (n % 3 == 0 ? 0.0 : 1.0e-9 * d);
+        }
+    }
+    return;
+}
+
+double
+relative_error(const MatrixNd& computed, const MatrixNd& expected)
+{
+    return (computed - expected).norm() / std::max(expected.norm(), 1.0);
+}
+} // namespace
+
+int
+main(int argc, char** argv)
+{
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+    std::ofstream out("output");
+    const double tol = 1.0e-10;
+
+    const Box<NDIM> box(hier::Index<NDIM>(0), hier::Index<NDIM>(7));
+    CellData<NDIM, double> in_data(box, NUM_TENSOR_COMPONENTS, IntVector<NDIM>(1));
+    CellData<NDIM, double> out_data(box, NUM_TENSOR_COMPONENTS, IntVector<NDIM>(1));
+    fill_tensors(in_data);
+    const Box<NDIM>& ghost_box = in_data.getGhostBox();
+
+    // Single tensors.
+    double max_exp_err = 0.0;
+    for (CellIterator<NDIM> ic(ghost_box); ic; ic++)
+    {
+        const MatrixNd mat = get_tensor(in_data, ic());
+        max_exp_err = std::max(max_exp_err, relative_error(symmetric_tensor_exp(mat), MatrixNd(mat.exp())));
+    }
+    out << "single tensor exponential matches Eigen: " << (max_exp_err <= tol) << "\n";
+
+    // Patch data, including the ghost cells.
+    symmetric_tensor_exp(in_data, out_data, ghost_box);
+    double max_patch_exp_err = 0.0;
+    for (CellIterator<NDIM> ic(ghost_box); ic; ic++)
+    {
+        const MatrixNd mat = get_tensor(in_data, ic());
+        max_patch_exp_err =
+            std::max(max_patch_exp_err, relative_error(get_tensor(out_data, ic()), MatrixNd(mat.exp())));
+    }
+    out << "patch data exponential matches Eigen: " << (max_patch_exp_err <= tol) << "\n";
+
+    symmetric_tensor_positive_part(in_data, out_data, ghost_box);
+    double max_positive_part_err = 0.0;
+    Eigen::SelfAdjointEigenSolver<MatrixNd> eigs;
+    for (CellIterator<NDIM> ic(ghost_box); ic; ic++)
+    {
+        eigs.compute(get_tensor(in_data, ic()));
+        const VectorNd eig_vals = eigs.eigenvalues().cwiseMax(0.0);
+        const MatrixNd expected = eigs.eigenvectors() * eig_vals.asDiagonal() * eigs.eigenvectors().transpose();
+        max_positive_part_err = std::max(max_positive_part_err, relative_error(get_tensor(out_data, ic()), expected));
+    }
+    out << "patch data positive part matches Eigen: " << (max_positive_part_err <= tol) << "\n";
+
+    // Only the cells in the box are modified, also when the data are modified
+    // in place.
+    CellData<NDIM, double> in_place_data(box, NUM_TENSOR_COMPONENTS, IntVector<NDIM>(1));
+    fill_tensors(in_place_data);
+    symmetric_tensor_exp(in_place_data, in_place_data, box);
+    double max_in_place_err = 0.0;
+    for (CellIterator<NDIM> ic(ghost_box); ic; ic++)
+    {
+        const MatrixNd mat = get_tensor(in_data, ic());
+        const MatrixNd expected = box.contains(ic()) ? MatrixNd(mat.exp()) : mat;
+        max_in_place_err = std::max(max_in_place_err, relative_error(get_tensor(in_place_data, ic()), expected));
+    }
+    out << "in place exponential matches Eigen: " << (max_in_place_err <= tol) << "\n";
+
+    // The patch data conversion of a relaxation operator converts all cells at
+    // once by default, and otherwise uses the single tensor conversion, both
+    // the default one and an overridden one.
+    auto max_conversion_err = [&](const std::string& evolution_type,
+                                  const bool convert_each_tensor,
+                                  const bool scale_tensors,
+                                  const bool in_place) {
+        Pointer<Database> input_db = new MemoryDatabase("relaxation");
+        input_db->putString("evolution_type", evolution_type);
+        TestRelaxation relaxation("relaxation", input_db, convert_each_tensor, scale_tensors);
+        CellData<NDIM, double> conform_data(box, NUM_TENSOR_COMPONENTS, IntVector<NDIM>(1));
+        if (in_place)
+        {
+            fill_tensors(conform_data);
+            relaxation.convert(conform_data, conform_data, box);
+        }
+        else
+        {
+            relaxation.convert(in_data, conform_data, box);
+        }
+        double max_err = 0.0;
+        for (CellIterator<NDIM> ic(box); ic; ic++)
+        {
+            const MatrixNd mat = get_tensor(in_data, ic());
+            MatrixNd expected = mat;
+            if (scale_tensors)
+                expected = 2.0 * mat;
+            else if (evolution_type == "LOGARITHM")
+                expected = mat.exp();
+            else if (evolution_type == "SQUARE_ROOT")
+                expected = mat * mat;
+            max_err = std::max(max_err, relative_error(get_tensor(conform_data, ic()), expected));
+        }
+        return max_err;
+    };
+    for (const std::string evolution_type : { "STANDARD", "SQUARE_ROOT", "LOGARITHM" })
+    {
+        out << evolution_type << " batched conversion is correct: "
+            << (max_conversion_err(evolution_type, false, false, false) <= tol) << "\n";
+        out << evolution_type << " batched conversion in place is correct: "
+            << (max_conversion_err(evolution_type, false, false, true) <= tol) << "\n";
+        out << evolution_type << " single tensor conversion is correct: "
+            << (max_conversion_err(evolution_type, true, false, false) <= tol) << "\n";
+    }
+    out << "overridden conversion is used: " << (max_conversion_err("LOGARITHM", true, true, false) <= tol) << "\n";
+}
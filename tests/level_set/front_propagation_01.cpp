@@ -0,0 +1,213 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <SAMRAI_config.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CartesianPatchGeometry.h>
+#include <CellData.h>
+#include <CellIndex.h>
+#include <CellIterator.h>
+#include <CellVariable.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/FastSweepingLSMethod.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/HierarchyMathOps.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// Check that reinitializing the level set of a circle with front propagation,
+// in which the fronts are first exchanged between the patches of each process
+// and then between all processes, reproduces the signed distance computed by
+// the default sweeping over the entire hierarchy, for two patch layouts of the
+// same grid, and that the number of outer iterations, each of which fills the
+// ghost cells on all processes, does not grow when the patches are refined.
+
+struct CircularInterface
+{
+    double R;
+    double X0[NDIM];
+};
+
+void
+locate_circular_interface(int D_idx,
+                          Pointer<HierarchyMathOps> hier_math_ops,
+                          double /*time*/,
+                          bool /*initial_time*/,
+                          void* ctx)
+{
+    const CircularInterface* circle = static_cast<CircularInterface*>(ctx);
+    Pointer<PatchHierarchy<NDIM> > hierarchy = hier_math_ops->getPatchHierarchy();
+    for (int ln = 0; ln <= hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+            const double* const x_lower = pgeom->getXLower();
+            const double* const dx = pgeom->getDx();
+            Pointer<CellData<NDIM, double> > D_data = patch->getPatchData(D_idx);
+            for (CellIterator<NDIM> ic(patch_box); ic; ic++)
+            {
+                const CellIndex<NDIM>& i = ic();
+                double r_sq = 0.0;
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    const double x = x_lower[d] + dx[d] * (i(d) - patch_box.lower()(d) + 0.5);
+                    r_sq += (x - circle->X0[d]) * (x - circle->X0[d]);
+                }
+                const double distance = std::sqrt(r_sq) - circle->R;
+                if (distance < -1.5 * dx[0])
+                {
+                    (*D_data)(i) = -1.0e8;
+                }
+                else if (distance > 1.5 * dx[0])
+                {
+                    (*D_data)(i) = 1.0e8;
+                }
+                else
+                {
+                    (*D_data)(i) = distance;
+                }
+            }
+        }
+    }
+    return;
+} // locate_circular_interface
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    // prevent a warning about timer initializations
+    TimerManager::createManager(nullptr);
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "front_propagation.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+
+        // Create variables and register them with the variable database.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+        Pointer<CellVariable<NDIM, double> > D_default_var = new CellVariable<NDIM, double>("D_default");
+        Pointer<CellVariable<NDIM, double> > D_front_var = new CellVariable<NDIM, double>("D_front");
+        const int D_default_idx = var_db->registerVariableAndContext(D_default_var, ctx, IntVector<NDIM>(1));
+        const int D_front_idx = var_db->registerVariableAndContext(D_front_var, ctx, IntVector<NDIM>(1));
+
+        CircularInterface circle;
+        circle.R = input_db->getDouble("R");
+        input_db->getDoubleArray("X0", circle.X0, NDIM);
+
+        const double tol = input_db->getDouble("TOL");
+        std::ofstream out;
+        if (IBTK_MPI::getRank() == 0) out.open("output");
+
+        // Build two single-level hierarchies that differ only in the sizes of
+        // their patches and reinitialize the level set on each of them.
+        std::vector<int> num_front_its;
+        for (const std::string gridding_name : { "CoarsePatchGriddingAlgorithm", "FinePatchGriddingAlgorithm" })
+        {
+            Pointer<PatchHierarchy<NDIM> > patch_hierarchy =
+                new PatchHierarchy<NDIM>("PatchHierarchy_" + gridding_name, grid_geometry);
+            Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+                new GriddingAlgorithm<NDIM>(gridding_name,
+                                            app_initializer->getComponentDatabase(gridding_name),
+                                            error_detector,
+                                            box_generator,
+                                            load_balancer);
+            gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(0);
+            level->allocatePatchData(D_default_idx, 0.0);
+            level->allocatePatchData(D_front_idx, 0.0);
+            Pointer<HierarchyMathOps> hier_math_ops =
+                new HierarchyMathOps("HierarchyMathOps_" + gridding_name, patch_hierarchy);
+
+            // Reinitialize the level set with the default sweeping and with
+            // front propagation.
+            Pointer<FastSweepingLSMethod> default_ls = new FastSweepingLSMethod(
+                "default_ls", app_initializer->getComponentDatabase("DefaultLevelSet"), false);
+            default_ls->registerInterfaceNeighborhoodLocatingFcn(&locate_circular_interface,
+                                                                 static_cast<void*>(&circle));
+            default_ls->initializeLSData(D_default_idx, hier_math_ops, 0, 0.0, true);
+
+            Pointer<FastSweepingLSMethod> front_ls = new FastSweepingLSMethod(
+                "front_ls", app_initializer->getComponentDatabase("FrontPropagationLevelSet"), false);
+            front_ls->registerInterfaceNeighborhoodLocatingFcn(&locate_circular_interface,
+                                                               static_cast<void*>(&circle));
+            front_ls->initializeLSData(D_front_idx, hier_math_ops, 0, 0.0, true);
+            num_front_its.push_back(front_ls->getNumberOfIterations());
+
+            double max_diff = 0.0;
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                Pointer<CellData<NDIM, double> > D_default_data = patch->getPatchData(D_default_idx);
+                Pointer<CellData<NDIM, double> > D_front_data = patch->getPatchData(D_front_idx);
+                for (CellIterator<NDIM> ic(patch->getBox()); ic; ic++)
+                {
+                    const CellIndex<NDIM>& i = ic();
+                    max_diff = std::max(max_diff, std::abs((*D_default_data)(i) - (*D_front_data)(i)));
+                }
+            }
+            max_diff = IBTK_MPI::maxReduction(max_diff);
+
+            if (IBTK_MPI::getRank() == 0)
+            {
+                out << gridding_name << " number of patches: " << level->getNumberOfPatches() << "\n";
+                out << gridding_name << " front propagation matches the default sweeping: " << (max_diff <= tol)
+                    << "\n";
+            }
+
+            level->deallocatePatchData(D_default_idx);
+            level->deallocatePatchData(D_front_idx);
+        }
+
+        // The patches of each process exchange their fronts without a ghost
+        // cell fill, so refining the patches does not increase the number of
+        // outer iterations.
+        if (IBTK_MPI::getRank() == 0)
+        {
+            out << "front propagation outer iterations do not grow when the patches are refined: "
+                << (num_front_its[1] <= num_front_its[0]) << "\n";
+        }
+    } // cleanup dynamically allocated objects prior to shutdown
+} // main
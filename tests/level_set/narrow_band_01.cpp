@@ -0,0 +1,266 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <SAMRAI_config.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CartesianPatchGeometry.h>
+#include <CellData.h>
+#include <CellIndex.h>
+#include <CellIterator.h>
+#include <CellVariable.h>
+#include <GriddingAlgorithm.h>
+#include <HierarchyCellDataOpsReal.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/FastSweepingLSMethod.h>
+#include <ibamr/RelaxationLSMethod.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/HierarchyMathOps.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <string>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// Check that reinitializing the level set of a circle in narrow band mode, by
+// either fast sweeping or relaxation, reproduces the signed distance computed
+// on the entire hierarchy in the band, that the level set keeps its sign and is
+// capped outside of the band, and that the level set can be reinitialized again
+// in narrow band mode.
+
+struct CircularInterface
+{
+    double R;
+    double X0[NDIM];
+};
+
+void
+locate_circular_interface(int D_idx,
+                          Pointer<HierarchyMathOps> hier_math_ops,
+                          double /*time*/,
+                          bool /*initial_time*/,
+                          void* ctx)
+{
+    const CircularInterface* circle = static_cast<CircularInterface*>(ctx);
+    Pointer<PatchHierarchy<NDIM> > hierarchy = hier_math_ops->getPatchHierarchy();
+    for (int ln = 0; ln <= hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+            const double* const x_lower = pgeom->getXLower();
+            const double* const dx = pgeom->getDx();
+            Pointer<CellData<NDIM, double> > D_data = patch->getPatchData(D_idx);
+            for (CellIterator<NDIM> ic(patch_box); ic; ic++)
+            {
+                const CellIndex<NDIM>& i = ic();
+                double r_sq = 0.0;
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    const double x = x_lower[d] + dx[d] * (i(d) - patch_box.lower()(d) + 0.5);
+                    r_sq += (x - circle->X0[d]) * (x - circle->X0[d]);
+                }
+                const double distance = std::sqrt(r_sq) - circle->R;
+                if (distance < -1.5 * dx[0])
+                {
+                    (*D_data)(i) = -1.0e8;
+                }
+                else if (distance > 1.5 * dx[0])
+                {
+                    (*D_data)(i) = 1.0e8;
+                }
+                else
+                {
+                    (*D_data)(i) = distance;
+                }
+            }
+        }
+    }
+    return;
+} // locate_circular_interface
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    // prevent a warning about timer initializations
+    TimerManager::createManager(nullptr);
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "narrow_band.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Create variables and register them with the variable database.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+        Pointer<CellVariable<NDIM, double> > D_full_var = new CellVariable<NDIM, double>("D_full");
+        Pointer<CellVariable<NDIM, double> > D_band_var = new CellVariable<NDIM, double>("D_band");
+        Pointer<CellVariable<NDIM, double> > D_band_prev_var = new CellVariable<NDIM, double>("D_band_prev");
+        const int D_full_idx = var_db->registerVariableAndContext(D_full_var, ctx, IntVector<NDIM>(1));
+        const int D_band_idx = var_db->registerVariableAndContext(D_band_var, ctx, IntVector<NDIM>(1));
+        const int D_band_prev_idx = var_db->registerVariableAndContext(D_band_prev_var, ctx, IntVector<NDIM>(1));
+
+        // Initialize the AMR patch hierarchy.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        int tag_buffer = 1;
+        int level_number = 0;
+        bool done = false;
+        while (!done && (gridding_algorithm->levelCanBeRefined(level_number)))
+        {
+            gridding_algorithm->makeFinerLevel(patch_hierarchy, 0.0, 0.0, tag_buffer);
+            done = !patch_hierarchy->finerLevelExists(level_number);
+            ++level_number;
+        }
+        const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+        for (int ln = 0; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            level->allocatePatchData(D_full_idx, 0.0);
+            level->allocatePatchData(D_band_idx, 0.0);
+            level->allocatePatchData(D_band_prev_idx, 0.0);
+        }
+        Pointer<HierarchyMathOps> hier_math_ops = new HierarchyMathOps("HierarchyMathOps", patch_hierarchy);
+
+        CircularInterface circle;
+        circle.R = input_db->getDouble("R");
+        input_db->getDoubleArray("X0", circle.X0, NDIM);
+
+        // Reinitialize the level set on the entire hierarchy and in the band
+        // with the given methods and compare the results.
+        HierarchyCellDataOpsReal<NDIM, double> hier_cc_data_ops(patch_hierarchy, 0, finest_ln);
+        std::ofstream out;
+        if (IBTK_MPI::getRank() == 0) out.open("output");
+        auto check_narrow_band = [&](const std::string& method_name,
+                                     Pointer<LSInitStrategy> full_ls,
+                                     Pointer<LSInitStrategy> band_ls,
+                                     const std::string& band_db_name,
+                                     const double tol) {
+            full_ls->registerInterfaceNeighborhoodLocatingFcn(&locate_circular_interface,
+                                                              static_cast<void*>(&circle));
+            full_ls->initializeLSData(D_full_idx, hier_math_ops, 0, 0.0, true);
+
+            band_ls->registerInterfaceNeighborhoodLocatingFcn(&locate_circular_interface,
+                                                              static_cast<void*>(&circle));
+            band_ls->initializeLSData(D_band_idx, hier_math_ops, 0, 0.0, true);
+            hier_cc_data_ops.copyData(D_band_prev_idx, D_band_idx);
+
+            // Reinitializing again reuses the data of the narrow band.
+            band_ls->setReinitializeLSData(true);
+            band_ls->initializeLSData(D_band_idx, hier_math_ops, 1, 0.0, false);
+
+            const int band_width = input_db->getDatabase(band_db_name)->getInteger("narrow_band_width");
+            double max_band_diff = 0.0, max_repeat_diff = 0.0, max_excess = 0.0;
+            int num_sign_errors = 0;
+            for (int ln = 0; ln <= finest_ln; ++ln)
+            {
+                Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+                for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+                {
+                    Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                    Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+                    const double* const dx = pgeom->getDx();
+                    const double h = *std::max_element(dx, dx + NDIM);
+                    const double cap = (band_width + 1) * std::sqrt(static_cast<double>(NDIM)) * h;
+                    Pointer<CellData<NDIM, double> > D_full_data = patch->getPatchData(D_full_idx);
+                    Pointer<CellData<NDIM, double> > D_band_data = patch->getPatchData(D_band_idx);
+                    Pointer<CellData<NDIM, double> > D_band_prev_data = patch->getPatchData(D_band_prev_idx);
+                    for (CellIterator<NDIM> ic(patch->getBox()); ic; ic++)
+                    {
+                        const CellIndex<NDIM>& i = ic();
+                        const double D_full = (*D_full_data)(i);
+                        const double D_band = (*D_band_data)(i);
+                        if (std::abs(D_full) <= (band_width - 1) * h)
+                        {
+                            max_band_diff = std::max(max_band_diff, std::abs(D_full - D_band));
+                        }
+                        max_repeat_diff = std::max(max_repeat_diff, std::abs(D_band - (*D_band_prev_data)(i)));
+                        max_excess = std::max(max_excess, std::abs(D_band) - cap);
+                        if (D_full * D_band <= 0.0) ++num_sign_errors;
+                    }
+                }
+            }
+            max_band_diff = IBTK_MPI::maxReduction(max_band_diff);
+            max_repeat_diff = IBTK_MPI::maxReduction(max_repeat_diff);
+            max_excess = IBTK_MPI::maxReduction(max_excess);
+            num_sign_errors = IBTK_MPI::sumReduction(num_sign_errors);
+
+            if (IBTK_MPI::getRank() == 0)
+            {
+                out << method_name << ":\n";
+                out << "narrow band matches full reinitialization: " << (max_band_diff <= tol) << "\n";
+                out << "level set is capped outside of the band: " << (max_excess <= tol) << "\n";
+                out << "number of cells with a different sign: " << num_sign_errors << "\n";
+                out << "repeated reinitialization matches: " << (max_repeat_diff <= tol) << "\n";
+            }
+        };
+
+        check_narrow_band(
+            "fast sweeping",
+            new FastSweepingLSMethod("full_ls", app_initializer->getComponentDatabase("FullLevelSet"), false),
+            new FastSweepingLSMethod("band_ls", app_initializer->getComponentDatabase("NarrowBandLevelSet"), false),
+            "NarrowBandLevelSet",
+            input_db->getDouble("TOL"));
+
+        // Relaxation converges to the signed distance only up to the tolerance
+        // of its iterations, so that the results are compared with a larger
+        // tolerance.
+        check_narrow_band(
+            "relaxation",
+            new RelaxationLSMethod(
+                "relaxation_full_ls", app_initializer->getComponentDatabase("RelaxationFullLevelSet"), false),
+            new RelaxationLSMethod(
+                "relaxation_band_ls", app_initializer->getComponentDatabase("RelaxationNarrowBandLevelSet"), false),
+            "RelaxationNarrowBandLevelSet",
+            input_db->getDouble("RELAXATION_TOL"));
+
+        for (int ln = 0; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            level->deallocatePatchData(D_full_idx);
+            level->deallocatePatchData(D_band_idx);
+            level->deallocatePatchData(D_band_prev_idx);
+        }
+    } // cleanup dynamically allocated objects prior to shutdown
+} // main
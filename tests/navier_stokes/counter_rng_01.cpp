@@ -0,0 +1,226 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+
+#include <SAMRAI_config.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CellData.h>
+#include <CellIterator.h>
+#include <CellVariable.h>
+#include <LoadBalancer.h>
+#include <RefineAlgorithm.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/RNG.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <ios>
+#include <string>
+#include <vector>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// Fill cell-centered data with the counter-based generator on two hierarchies
+// that cover the same domain with different patch layouts, and check that the
+// values are the same bit for bit.  The values are also summarized by a
+// checksum that does not depend on the order of the cells, which is written to
+// the output file so that the values are also compared across process counts.
+// Finally, check the sample mean and variance of the normal variates.
+namespace
+{
+inline std::uint32_t
+mix(std::uint32_t x)
+{
+    // The finalizer of the 32-bit MurmurHash3 hash function.
+    x ^= x >> 16;
+    x *= 0x85EBCA6Bu;
+    x ^= x >> 13;
+    x *= 0xC2B2AE35u;
+    x ^= x >> 16;
+    return x;
+} // mix
+
+// Compute a checksum of the values over the patch boxes of a level that does
+// not depend on the order in which the values are visited.
+std::vector<unsigned int>
+compute_checksum(Pointer<PatchLevel<NDIM> > level, const int data_idx)
+{
+    std::vector<unsigned int> checksum(2, 0u);
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        Pointer<CellData<NDIM, double> > data = patch->getPatchData(data_idx);
+        for (CellIterator<NDIM> ic(patch->getBox()); ic; ic++)
+        {
+            std::uint32_t cell_hash = 0;
+            for (unsigned int d = 0; d < NDIM; ++d) cell_hash = mix(cell_hash ^ static_cast<std::uint32_t>(ic()(d)));
+            for (int depth = 0; depth < data->getDepth(); ++depth)
+            {
+                const double value = (*data)(ic(), depth);
+                std::uint32_t bits[2];
+                std::memcpy(bits, &value, sizeof(value));
+                const std::uint32_t key = mix(cell_hash ^ static_cast<std::uint32_t>(depth));
+                checksum[0] += mix(key ^ bits[0]);
+                checksum[1] += mix(key ^ mix(bits[1]));
+            }
+        }
+    }
+    IBTK_MPI::sumReduction(checksum.data(), 2);
+    return checksum;
+} // compute_checksum
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    { // cleanup dynamically allocated objects prior to shutdown
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "counter_rng.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", nullptr, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+
+        // The data have an odd depth, so that one generator evaluation is used
+        // for a single depth, and ghost cells, so that the filled box is
+        // smaller than the data box.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+        const int depth = input_db->getInteger("DEPTH");
+        Pointer<CellVariable<NDIM, double> > W_var = new CellVariable<NDIM, double>("W", depth);
+        Pointer<CellVariable<NDIM, double> > W_copy_var = new CellVariable<NDIM, double>("W_copy", depth);
+        const int W_idx = var_db->registerVariableAndContext(W_var, ctx, IntVector<NDIM>(1));
+        const int W_copy_idx = var_db->registerVariableAndContext(W_copy_var, ctx, IntVector<NDIM>(0));
+
+        // Build two single-level hierarchies that differ only in the sizes of
+        // their patches.
+        std::vector<Pointer<PatchHierarchy<NDIM> > > hierarchies;
+        for (const std::string gridding_name : { "CoarsePatchGriddingAlgorithm", "FinePatchGriddingAlgorithm" })
+        {
+            Pointer<PatchHierarchy<NDIM> > patch_hierarchy =
+                new PatchHierarchy<NDIM>("PatchHierarchy_" + gridding_name, grid_geometry);
+            Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+                new GriddingAlgorithm<NDIM>(gridding_name,
+                                            app_initializer->getComponentDatabase(gridding_name),
+                                            error_detector,
+                                            box_generator,
+                                            load_balancer);
+            gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(0);
+            level->allocatePatchData(W_idx, 0.0);
+            level->allocatePatchData(W_copy_idx, 0.0);
+            hierarchies.push_back(patch_hierarchy);
+        }
+        Pointer<PatchLevel<NDIM> > coarse_patch_level = hierarchies[0]->getPatchLevel(0);
+        Pointer<PatchLevel<NDIM> > fine_patch_level = hierarchies[1]->getPatchLevel(0);
+
+        // The stream key depends only on the seed and the name.
+        RNG::counter_seed(input_db->getInteger("SEED"));
+        const unsigned int stream_key = RNG::counter_stream_key("counter_rng_01");
+        pout << "stream key: " << stream_key << "\n";
+        pout << "stream keys of different objects differ: "
+             << (RNG::counter_stream_key("counter_rng_01_other") != stream_key) << "\n";
+
+        const int step_num = input_db->getInteger("STEP_NUM");
+        const int substream_num = input_db->getInteger("SUBSTREAM_NUM");
+        auto fill_level = [&](Pointer<PatchLevel<NDIM> > level, const int step) {
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                Pointer<CellData<NDIM, double> > W_data = patch->getPatchData(W_idx);
+                W_data->fillAll(0.0);
+                RNG::genrandn(W_data->getArrayData(), patch->getBox(), stream_key, step, substream_num, 0);
+            }
+        };
+        fill_level(coarse_patch_level, step_num);
+        fill_level(fine_patch_level, step_num);
+
+        // Copy the values on the coarse patches to the fine patches and compare
+        // them bit for bit.
+        RefineAlgorithm<NDIM> copy_alg;
+        copy_alg.registerRefine(W_copy_idx, W_idx, W_copy_idx, nullptr);
+        copy_alg.createSchedule(fine_patch_level, coarse_patch_level)->fillData(0.0);
+        int num_mismatches = 0, num_samples = 0;
+        double sum = 0.0, sum_sq = 0.0;
+        for (PatchLevel<NDIM>::Iterator p(fine_patch_level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = fine_patch_level->getPatch(p());
+            Pointer<CellData<NDIM, double> > W_data = patch->getPatchData(W_idx);
+            Pointer<CellData<NDIM, double> > W_copy_data = patch->getPatchData(W_copy_idx);
+            for (CellIterator<NDIM> ic(patch->getBox()); ic; ic++)
+            {
+                for (int d = 0; d < depth; ++d)
+                {
+                    const double value = (*W_data)(ic(), d);
+                    const double copy_value = (*W_copy_data)(ic(), d);
+                    if (std::memcmp(&value, &copy_value, sizeof(double)) != 0) ++num_mismatches;
+                    sum += value;
+                    sum_sq += value * value;
+                    ++num_samples;
+                }
+            }
+        }
+        num_mismatches = IBTK_MPI::sumReduction(num_mismatches);
+        pout << "values are independent of the patch layout: " << (num_mismatches == 0) << "\n";
+
+        // The checksums are the same for all numbers of processes.
+        const std::vector<unsigned int> coarse_checksum = compute_checksum(coarse_patch_level, W_idx);
+        const std::vector<unsigned int> fine_checksum = compute_checksum(fine_patch_level, W_idx);
+        pout << "checksum: " << std::hex << coarse_checksum[0] << " " << coarse_checksum[1] << std::dec << "\n";
+        pout << "checksums of both patch layouts agree: " << (coarse_checksum == fine_checksum) << "\n";
+
+        // The values of a different time step are different.
+        fill_level(fine_patch_level, step_num + 1);
+        const std::vector<unsigned int> next_step_checksum = compute_checksum(fine_patch_level, W_idx);
+        pout << "values of the next time step differ: " << (next_step_checksum != fine_checksum) << "\n";
+
+        // The sample mean and variance of n standard normal variates have
+        // standard deviations 1/sqrt(n) and sqrt(2/n).
+        sum = IBTK_MPI::sumReduction(sum);
+        sum_sq = IBTK_MPI::sumReduction(sum_sq);
+        const double n = IBTK_MPI::sumReduction(num_samples);
+        const double mean = sum / n;
+        const double variance = (sum_sq - n * mean * mean) / (n - 1.0);
+        pout << "number of samples: " << n << "\n";
+        pout << "sample mean is within four standard deviations of 0: " << (std::abs(mean) < 4.0 / std::sqrt(n))
+             << "\n";
+        pout << "sample variance is within four standard deviations of 1: "
+             << (std::abs(variance - 1.0) < 4.0 * std::sqrt(2.0 / n)) << "\n";
+
+        for (Pointer<PatchHierarchy<NDIM> > patch_hierarchy : hierarchies)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(0);
+            level->deallocatePatchData(W_idx);
+            level->deallocatePatchData(W_copy_idx);
+        }
+    } // cleanup dynamically allocated objects prior to shutdown
+} // main
@@ -0,0 +1,164 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+
+#include <SAMRAI_config.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <HierarchySideDataOpsReal.h>
+#include <LoadBalancer.h>
+#include <RefineAlgorithm.h>
+#include <SAMRAIVectorReal.h>
+#include <SideVariable.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/INSStaggeredPPMConvectiveOperator.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+#include <string>
+#include <vector>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// Check that the staggered PPM convective operator, which keeps its work
+// arrays between calls, gives the same result on two hierarchies that cover the
+// same periodic domain with different patch layouts, and that reapplying one
+// operator object after it has been used on patches of a different size gives
+// the same result as the first application.
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    { // cleanup dynamically allocated objects prior to shutdown
+        // prevent a warning about timer initializations
+        TimerManager::createManager(nullptr);
+
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "ppm_convective_operator.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", nullptr, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+
+        // Create variables and register them with the variable database.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+        Pointer<SideVariable<NDIM, double> > U_var = new SideVariable<NDIM, double>("U");
+        Pointer<SideVariable<NDIM, double> > N_var = new SideVariable<NDIM, double>("N");
+        Pointer<SideVariable<NDIM, double> > N_ref_var = new SideVariable<NDIM, double>("N_ref");
+        const int U_idx = var_db->registerVariableAndContext(U_var, ctx, IntVector<NDIM>(0));
+        const int N_idx = var_db->registerVariableAndContext(N_var, ctx, IntVector<NDIM>(0));
+        const int N_ref_idx = var_db->registerVariableAndContext(N_ref_var, ctx, IntVector<NDIM>(0));
+
+        // Build two single-level hierarchies that differ only in the sizes of
+        // their patches.
+        muParserCartGridFunction U_fcn("U_fcn", app_initializer->getComponentDatabase("Velocity"), grid_geometry);
+        std::vector<Pointer<PatchHierarchy<NDIM> > > hierarchies;
+        for (const std::string gridding_name : { "CoarsePatchGriddingAlgorithm", "FinePatchGriddingAlgorithm" })
+        {
+            Pointer<PatchHierarchy<NDIM> > patch_hierarchy =
+                new PatchHierarchy<NDIM>("PatchHierarchy_" + gridding_name, grid_geometry);
+            Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+                new GriddingAlgorithm<NDIM>(gridding_name,
+                                            app_initializer->getComponentDatabase(gridding_name),
+                                            error_detector,
+                                            box_generator,
+                                            load_balancer);
+            gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(0);
+            level->allocatePatchData(U_idx, 0.0);
+            level->allocatePatchData(N_idx, 0.0);
+            level->allocatePatchData(N_ref_idx, 0.0);
+            U_fcn.setDataOnPatchHierarchy(U_idx, U_var, patch_hierarchy, 0.0);
+            hierarchies.push_back(patch_hierarchy);
+        }
+        Pointer<PatchHierarchy<NDIM> > coarse_patch_hierarchy = hierarchies[0];
+        Pointer<PatchHierarchy<NDIM> > fine_patch_hierarchy = hierarchies[1];
+        pout << "number of coarse patches: " << coarse_patch_hierarchy->getPatchLevel(0)->getNumberOfPatches()
+             << "\n";
+        pout << "number of fine patches: " << fine_patch_hierarchy->getPatchLevel(0)->getNumberOfPatches() << "\n";
+
+        // Copies the result computed on the coarse patches to the fine
+        // patches.
+        RefineAlgorithm<NDIM> copy_alg;
+        copy_alg.registerRefine(N_idx, N_idx, N_idx, nullptr);
+        Pointer<RefineSchedule<NDIM> > copy_sched = copy_alg.createSchedule(
+            fine_patch_hierarchy->getPatchLevel(0), coarse_patch_hierarchy->getPatchLevel(0));
+
+        const double tol = input_db->getDouble("TOL");
+        const std::vector<RobinBcCoefStrategy<NDIM>*> bc_coefs(NDIM, nullptr);
+        for (const ConvectiveDifferencingType difference_form : { ADVECTIVE, CONSERVATIVE, SKEW_SYMMETRIC })
+        {
+            // Use a single operator object for both hierarchies so that its work
+            // arrays are sized for the small patches first and are then reused
+            // for the large patches and again for the small ones.
+            INSStaggeredPPMConvectiveOperator convec_op(
+                "ConvectiveOperator",
+                app_initializer->getComponentDatabase("ConvectiveOperator"),
+                difference_form,
+                bc_coefs);
+            convec_op.setAdvectionVelocity(U_idx);
+            convec_op.setSolutionTime(0.0);
+            auto apply = [&](Pointer<PatchHierarchy<NDIM> > patch_hierarchy) {
+                SAMRAIVectorReal<NDIM, double> U_vec("U", patch_hierarchy, 0, 0);
+                SAMRAIVectorReal<NDIM, double> N_vec("N", patch_hierarchy, 0, 0);
+                U_vec.addComponent(U_var, U_idx);
+                N_vec.addComponent(N_var, N_idx);
+                convec_op.initializeOperatorState(U_vec, N_vec);
+                convec_op.applyConvectiveOperator(U_idx, N_idx);
+                convec_op.deallocateOperatorState();
+            };
+
+            HierarchySideDataOpsReal<NDIM, double> fine_sc_data_ops(fine_patch_hierarchy, 0, 0);
+            apply(fine_patch_hierarchy);
+            fine_sc_data_ops.copyData(N_ref_idx, N_idx);
+            const double N_norm = fine_sc_data_ops.maxNorm(N_ref_idx);
+
+            apply(coarse_patch_hierarchy);
+            apply(fine_patch_hierarchy);
+            fine_sc_data_ops.subtract(N_idx, N_idx, N_ref_idx);
+            const std::string form_name = enum_to_string<ConvectiveDifferencingType>(difference_form);
+            pout << form_name << " result is nonzero: " << (N_norm > 0.0) << "\n";
+            pout << form_name
+                 << " result is unchanged after reuse: " << (fine_sc_data_ops.maxNorm(N_idx) <= tol * N_norm) << "\n";
+
+            copy_sched->fillData(0.0);
+            fine_sc_data_ops.subtract(N_idx, N_idx, N_ref_idx);
+            pout << form_name << " result is independent of the patch layout: "
+                 << (fine_sc_data_ops.maxNorm(N_idx) <= tol * N_norm) << "\n";
+        }
+
+        for (Pointer<PatchHierarchy<NDIM> > patch_hierarchy : hierarchies)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(0);
+            level->deallocatePatchData(U_idx);
+            level->deallocatePatchData(N_idx);
+            level->deallocatePatchData(N_ref_idx);
+        }
+    } // cleanup dynamically allocated objects prior to shutdown
+} // main
@@ -0,0 +1,206 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+
+#include <SAMRAI_config.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CellVariable.h>
+#include <HierarchyCellDataOpsReal.h>
+#include <HierarchySideDataOpsReal.h>
+#include <LoadBalancer.h>
+#include <SAMRAIVectorReal.h>
+#include <SideVariable.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+#include <vector>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// Check that the initial guess for the Stokes solver that the staggered
+// integrator extrapolates from the solutions of previous time steps is exact
+// when the velocity and pressure are polynomials in time of degree at most the
+// extrapolation order, for variable time step sizes, and that the stored
+// solutions are discarded when the patch hierarchy is regridded.
+
+namespace
+{
+// Expose the management of the stored solutions to the test.
+class TestINSStaggeredHierarchyIntegrator : public INSStaggeredHierarchyIntegrator
+{
+public:
+    TestINSStaggeredHierarchyIntegrator(const std::string& object_name, Pointer<Database> input_db)
+        : INSStaggeredHierarchyIntegrator(object_name, input_db)
+    {
+        // intentionally blank
+    }
+
+    using INSStaggeredHierarchyIntegrator::clearStokesSolutionHistory;
+    using INSStaggeredHierarchyIntegrator::extrapolateStokesSolution;
+    using INSStaggeredHierarchyIntegrator::storeStokesSolution;
+};
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    { // cleanup dynamically allocated objects prior to shutdown
+        // prevent a warning about timer initializations
+        TimerManager::createManager(nullptr);
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "INS.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        const std::string ins_name = "INSStaggeredHierarchyIntegrator";
+        Pointer<TestINSStaggeredHierarchyIntegrator> time_integrator =
+            new TestINSStaggeredHierarchyIntegrator(ins_name, app_initializer->getComponentDatabase(ins_name));
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               time_integrator,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Create initial condition specification objects.
+        Pointer<CartGridFunction> u_init = new muParserCartGridFunction(
+            "u_init", app_initializer->getComponentDatabase("VelocityInitialConditions"), grid_geometry);
+        time_integrator->registerVelocityInitialConditions(u_init);
+        Pointer<CartGridFunction> p_init = new muParserCartGridFunction(
+            "p_init", app_initializer->getComponentDatabase("PressureInitialConditions"), grid_geometry);
+        time_integrator->registerPressureInitialConditions(p_init);
+
+        // Initialize hierarchy configuration and data on all patches.
+        time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+        const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+
+        // Create the vectors that hold the manufactured solutions, laid out
+        // like the solution vector of the Stokes solver.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("test");
+        Pointer<SideVariable<NDIM, double> > U_var = new SideVariable<NDIM, double>("U_test");
+        Pointer<CellVariable<NDIM, double> > P_var = new CellVariable<NDIM, double>("P_test");
+        Pointer<SideVariable<NDIM, double> > U_exact_var = new SideVariable<NDIM, double>("U_exact");
+        Pointer<CellVariable<NDIM, double> > P_exact_var = new CellVariable<NDIM, double>("P_exact");
+        const int U_idx = var_db->registerVariableAndContext(U_var, ctx, IntVector<NDIM>(0));
+        const int P_idx = var_db->registerVariableAndContext(P_var, ctx, IntVector<NDIM>(0));
+        const int U_exact_idx = var_db->registerVariableAndContext(U_exact_var, ctx, IntVector<NDIM>(0));
+        const int P_exact_idx = var_db->registerVariableAndContext(P_exact_var, ctx, IntVector<NDIM>(0));
+        for (int ln = 0; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            level->allocatePatchData(U_idx, 0.0);
+            level->allocatePatchData(P_idx, 0.0);
+            level->allocatePatchData(U_exact_idx, 0.0);
+            level->allocatePatchData(P_exact_idx, 0.0);
+        }
+        Pointer<SAMRAIVectorReal<NDIM, double> > sol_vec =
+            new SAMRAIVectorReal<NDIM, double>("sol_vec", patch_hierarchy, 0, finest_ln);
+        sol_vec->addComponent(U_var, U_idx);
+        sol_vec->addComponent(P_var, P_idx);
+        HierarchySideDataOpsReal<NDIM, double> hier_sc_data_ops(patch_hierarchy, 0, finest_ln);
+        HierarchyCellDataOpsReal<NDIM, double> hier_cc_data_ops(patch_hierarchy, 0, finest_ln);
+
+        // The time steps have different sizes.
+        const std::vector<double> times = { 0.0, 0.1, 0.25, 0.3, 0.5 };
+        for (int order = 1; order <= 2; ++order)
+        {
+            const std::string db_suffix = "_" + std::to_string(order);
+            muParserCartGridFunction U_fcn(
+                "U_fcn", app_initializer->getComponentDatabase("Velocity" + db_suffix), grid_geometry);
+            muParserCartGridFunction P_fcn(
+                "P_fcn", app_initializer->getComponentDatabase("Pressure" + db_suffix), grid_geometry);
+
+            // Store the solutions of the first order + 1 time steps.  The
+            // velocity is defined at the end and the pressure at the midpoint
+            // of each time step.
+            time_integrator->clearStokesSolutionHistory();
+            time_integrator->setStokesInitialGuessExtrapolationOrder(order);
+            for (int k = 0; k <= order; ++k)
+            {
+                U_fcn.setDataOnPatchHierarchy(U_idx, U_var, patch_hierarchy, times[k + 1]);
+                P_fcn.setDataOnPatchHierarchy(P_idx, P_var, patch_hierarchy, 0.5 * (times[k] + times[k + 1]));
+                time_integrator->storeStokesSolution(sol_vec, times[k], times[k + 1]);
+            }
+            pout << "order " << order << " stored solutions: " << time_integrator->getNumberOfStoredStokesSolutions()
+                 << "\n";
+
+            // Extrapolate to the next time step and compare to the exact
+            // solution.
+            const double current_time = times[order + 1], new_time = times[order + 2];
+            sol_vec->setToScalar(0.0);
+            time_integrator->extrapolateStokesSolution(sol_vec, current_time, new_time);
+            U_fcn.setDataOnPatchHierarchy(U_exact_idx, U_exact_var, patch_hierarchy, new_time);
+            P_fcn.setDataOnPatchHierarchy(P_exact_idx, P_exact_var, patch_hierarchy, 0.5 * (current_time + new_time));
+            const double U_norm = hier_sc_data_ops.maxNorm(U_exact_idx);
+            const double P_norm = hier_cc_data_ops.maxNorm(P_exact_idx);
+            hier_sc_data_ops.subtract(U_idx, U_idx, U_exact_idx);
+            hier_cc_data_ops.subtract(P_idx, P_idx, P_exact_idx);
+            const double tol = input_db->getDouble("TOL");
+            pout << "order " << order
+                 << " extrapolated velocity is exact: " << (hier_sc_data_ops.maxNorm(U_idx) <= tol * U_norm) << "\n";
+            pout << "order " << order
+                 << " extrapolated pressure is exact: " << (hier_cc_data_ops.maxNorm(P_idx) <= tol * P_norm) << "\n";
+        }
+        time_integrator->clearStokesSolutionHistory();
+        for (int ln = 0; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            level->deallocatePatchData(U_idx);
+            level->deallocatePatchData(P_idx);
+            level->deallocatePatchData(U_exact_idx);
+            level->deallocatePatchData(P_exact_idx);
+        }
+
+        // Take enough time steps to fill the history and then regrid.
+        const int num_steps = input_db->getInteger("NUM_STEPS");
+        for (int step = 0; step < num_steps; ++step)
+        {
+            time_integrator->advanceHierarchy(time_integrator->getMaximumTimeStepSize());
+        }
+        pout << "stored solutions after " << num_steps
+             << " time steps: " << time_integrator->getNumberOfStoredStokesSolutions() << "\n";
+        time_integrator->regridHierarchy();
+        pout << "stored solutions after regridding: " << time_integrator->getNumberOfStoredStokesSolutions() << "\n";
+        time_integrator->advanceHierarchy(time_integrator->getMaximumTimeStepSize());
+        pout << "stored solutions after one more time step: " << time_integrator->getNumberOfStoredStokesSolutions()
+             << "\n";
+    } // cleanup dynamically allocated objects prior to shutdown
+} // main
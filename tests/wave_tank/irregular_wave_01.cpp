@@ -0,0 +1,264 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2020 - 2020 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <SAMRAI_config.h>
+
+// Headers for basic SAMRAI objects
+#include <ArrayData.h>
+#include <BergerRigoutsos.h>
+#include <BoundaryBox.h>
+#include <CartesianGridGeometry.h>
+#include <CartesianPatchGeometry.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <SideVariable.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/IrregularWaveBcCoef.h>
+#include <ibamr/IrregularWaveGenerator.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+#include <ibtk/PhysicalBoundaryUtilities.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <vector>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// Check the velocities of the irregular wave inlet boundary condition, which
+// are computed from cached tables of coefficients, and the velocities and
+// surface elevation of the irregular wave generator, which are computed from
+// cached horizontal factors and vertical profiles, against the direct sums of
+// the component waves, for all velocity components.  The generator is evaluated
+// at more positions than it caches, so that cached values are evicted and
+// recomputed.
+namespace
+{
+struct ComponentWaves
+{
+    std::vector<double> amplitude, omega, wave_number, phase;
+};
+
+// Read the component waves written by the wave generator with full precision.
+ComponentWaves
+get_component_waves(const IrregularWaveGenerator& wave_generator)
+{
+    {
+        std::ofstream os("irregular_wave_data.txt");
+        os.precision(17);
+        wave_generator.printWaveData(os);
+    }
+    ComponentWaves waves;
+    std::ifstream is("irregular_wave_data.txt");
+    double a, omega, k, phase;
+    while (is >> a >> omega >> k >> phase)
+    {
+        waves.amplitude.push_back(a);
+        waves.omega.push_back(omega);
+        waves.wave_number.push_back(k);
+        waves.phase.push_back(phase);
+    }
+    return waves;
+} // get_component_waves
+
+double
+direct_surface_elevation(const ComponentWaves& waves, const double x, const double time)
+{
+    double eta = 0.0;
+    for (unsigned int i = 0; i < waves.amplitude.size(); ++i)
+    {
+        const double theta = waves.wave_number[i] * x - waves.omega[i] * time + waves.phase[i];
+        eta += waves.amplitude[i] * std::cos(theta);
+    }
+    return eta;
+} // direct_surface_elevation
+
+double
+direct_velocity(const ComponentWaves& waves,
+                const double depth,
+                const double x,
+                const double z_plus_d,
+                const double time,
+                const int comp_idx)
+{
+    if (comp_idx != 0 && comp_idx != NDIM - 1) return 0.0;
+    double velocity = 0.0;
+    for (unsigned int i = 0; i < waves.amplitude.size(); ++i)
+    {
+        const double k = waves.wave_number[i];
+        const double theta = k * x - waves.omega[i] * time + waves.phase[i];
+        const double scale = waves.amplitude[i] * waves.omega[i] / std::sinh(k * depth);
+        if (comp_idx == 0)
+            velocity += scale * std::cosh(k * z_plus_d) * std::cos(theta);
+        else
+            velocity += scale * std::sinh(k * z_plus_d) * std::sin(theta);
+    }
+    return velocity;
+} // direct_velocity
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    { // cleanup dynamically allocated objects prior to shutdown
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "irregular_wave.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", nullptr, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(0);
+        Pointer<SideVariable<NDIM, double> > u_var = new SideVariable<NDIM, double>("u");
+
+        // The boundary condition objects and the wave generator use the same
+        // wave parameters and hence the same component waves.
+        Pointer<Database> bc_coefs_db = app_initializer->getComponentDatabase("VelocityBcCoefs");
+        const IrregularWaveGenerator wave_generator("IrregularWaveGenerator", bc_coefs_db);
+        const ComponentWaves waves = get_component_waves(wave_generator);
+        const double depth = bc_coefs_db->getDatabase("wave_parameters_db")->getDouble("depth");
+
+        const double tol = input_db->getDouble("TOL");
+        const Array<double> times = input_db->getDoubleArray("TIMES");
+        std::ofstream out;
+        if (IBTK_MPI::getRank() == 0) out.open("output");
+        if (IBTK_MPI::getRank() == 0) out << "number of component waves: " << waves.amplitude.size() << "\n";
+
+        // Compare the inlet boundary values on a patch with the direct sums.
+        auto check_inlet_velocity = [&](const IrregularWaveBcCoef& bc_coefs,
+                                        const Patch<NDIM>& patch,
+                                        const double time,
+                                        const int comp_idx,
+                                        double& max_err,
+                                        double& max_velocity) {
+            Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch.getPatchGeometry();
+            if (!pgeom->getTouchesRegularBoundary()) return;
+            const Box<NDIM>& patch_box = patch.getBox();
+            const double* const x_lower = pgeom->getXLower();
+            const double* const dx = pgeom->getDx();
+            const Array<BoundaryBox<NDIM> > bdry_boxes =
+                PhysicalBoundaryUtilities::getPhysicalBoundaryCodim1Boxes(patch);
+            for (int k = 0; k < bdry_boxes.size(); ++k)
+            {
+                const BoundaryBox<NDIM>& bdry_box = bdry_boxes[k];
+                if (bdry_box.getLocationIndex() != 0) continue;
+                const Box<NDIM> bc_coef_box = PhysicalBoundaryUtilities::makeSideBoundaryCodim1Box(bdry_box);
+                Pointer<ArrayData<NDIM, double> > acoef_data = new ArrayData<NDIM, double>(bc_coef_box, 1);
+                Pointer<ArrayData<NDIM, double> > bcoef_data = new ArrayData<NDIM, double>(bc_coef_box, 1);
+                Pointer<ArrayData<NDIM, double> > gcoef_data = new ArrayData<NDIM, double>(bc_coef_box, 1);
+                bc_coefs.setBcCoefs(acoef_data, bcoef_data, gcoef_data, u_var, patch, bdry_box, time);
+                for (Box<NDIM>::Iterator b(bc_coef_box); b; b++)
+                {
+                    const double x = x_lower[0] + dx[0] * (b()(0) - patch_box.lower(0));
+                    const double z_plus_d =
+                        x_lower[NDIM - 1] + dx[NDIM - 1] * (b()(NDIM - 1) - patch_box.lower(NDIM - 1) + 0.5);
+                    const double expected = direct_velocity(waves, depth, x, z_plus_d, time, comp_idx);
+                    max_err = std::max(max_err, std::abs((*gcoef_data)(b(), 0) - expected));
+                    max_velocity = std::max(max_velocity, std::abs(expected));
+                }
+            }
+        };
+
+        // The inlet is below the free surface, so that the boundary values are
+        // the velocities at the inlet.  Each time is evaluated twice, so that
+        // the cached tables are also used.
+        for (int comp_idx = 0; comp_idx < NDIM; ++comp_idx)
+        {
+            IrregularWaveBcCoef bc_coefs("IrregularWaveBcCoef", comp_idx, bc_coefs_db, grid_geometry);
+            double max_err = 0.0, max_velocity = 0.0;
+            for (int n = 0; n < times.size(); ++n)
+            {
+                const double time = times[n];
+                for (int rep = 0; rep < 2; ++rep)
+                {
+                    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+                    {
+                        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                        check_inlet_velocity(bc_coefs, *patch, time, comp_idx, max_err, max_velocity);
+                    }
+                }
+            }
+            max_err = IBTK_MPI::maxReduction(max_err);
+            max_velocity = IBTK_MPI::maxReduction(max_velocity);
+            if (IBTK_MPI::getRank() == 0)
+            {
+                out << "boundary velocity component " << comp_idx
+                    << " matches the direct sum: " << (max_err <= tol * std::max(max_velocity, 1.0)) << "\n";
+            }
+        }
+
+        // Evaluate the wave generator along a relaxation zone with more
+        // horizontal positions than are cached, twice, so that the second pass
+        // recomputes evicted values.
+        const int num_x = input_db->getInteger("NUM_X");
+        const double zone_length = input_db->getDouble("ZONE_LENGTH");
+        const Array<double> z_values = input_db->getDoubleArray("Z_VALUES");
+        double max_eta_err = 0.0, max_velocity_err[NDIM] = { 0.0 }, max_velocity[NDIM] = { 0.0 };
+        for (int n = 0; n < times.size(); ++n)
+        {
+            const double time = times[n];
+            for (int pass = 0; pass < 2; ++pass)
+            {
+                for (int j = 0; j < num_x; ++j)
+                {
+                    const double x = zone_length * (j + 0.5) / num_x;
+                    max_eta_err = std::max(max_eta_err,
+                                           std::abs(wave_generator.getSurfaceElevation(x, time) -
+                                                    direct_surface_elevation(waves, x, time)));
+                    for (int l = 0; l < z_values.size(); ++l)
+                    {
+                        const double z_plus_d = z_values[l];
+                        for (int comp_idx = 0; comp_idx < NDIM; ++comp_idx)
+                        {
+                            const double expected = direct_velocity(waves, depth, x, z_plus_d, time, comp_idx);
+                            max_velocity_err[comp_idx] =
+                                std::max(max_velocity_err[comp_idx],
+                                         std::abs(wave_generator.getVelocity(x, z_plus_d, time, comp_idx) - expected));
+                            max_velocity[comp_idx] = std::max(max_velocity[comp_idx], std::abs(expected));
+                        }
+                    }
+                }
+            }
+        }
+        if (IBTK_MPI::getRank() == 0)
+        {
+            out << "generator surface elevation matches the direct sum: " << (max_eta_err <= tol) << "\n";
+            for (int comp_idx = 0; comp_idx < NDIM; ++comp_idx)
+            {
+                out << "generator velocity component " << comp_idx << " matches the direct sum: "
+                    << (max_velocity_err[comp_idx] <= tol * std::max(max_velocity[comp_idx], 1.0)) << "\n";
+            }
+        }
+    } // cleanup dynamically allocated objects prior to shutdown
+} // main